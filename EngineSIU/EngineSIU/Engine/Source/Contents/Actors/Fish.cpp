@@ -26,7 +26,8 @@ AFish::AFish()
     , KillZ(-10.f)
     , Score(0)
 {
-    
+    // Move가 Actor의 위치를 바꾸고, 떨어지면 OnDied Broadcast와 EndMatch를 호출하므로 게임 스레드에서 Tick합니다.
+    PrimaryActorTick.bCanEverTick = true;
 }
 
 void AFish::PostSpawnInitialize()
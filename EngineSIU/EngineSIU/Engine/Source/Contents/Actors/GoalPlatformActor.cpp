@@ -5,6 +5,7 @@
 
 AGoalPlatformActor::AGoalPlatformActor()
 {
+    // 움직이지 않는 발판이므로 Tick하지 않습니다. (bCanEverTick 기본값 false)
     BoxComponent = AddComponent<UBoxComponent>(FName("BoxComponent_0"));
     RootComponent = BoxComponent;
 
@@ -9,6 +9,10 @@
 
 AItemActor::AItemActor()
 {
+    // 떠다니는 연출만 하므로 멀리 있으면 느리게 Tick하거나 멈춰도 됩니다.
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bAllowSignificanceThrottling = true;
+
     MeshComponent = AddComponent<USkeletalMeshComponent>(FName("MeshComponent_0"));
     
     auto mesh = FFbxLoader::GetSkeletalMesh("Contents/dragon/Dragon 2.5_fbx.fbx");
@@ -52,7 +56,7 @@ void AItemActor::Tick(float DeltaTime)
     if (UStaticMeshComponent* MeshComp = GetComponentByClass<UStaticMeshComponent>())
     {
         MeshComp->SetRelativeRotation(FRotator(0.f, ElapsedTime * Speed, 0.f));
-        MeshComp->SetRelativeLocation(FVector(0.f, 0.f, FMath::Sin(ElapsedTime * FloatingFrequency) * FloatingHeight));       
+        MeshComp->SetRelativeLocation(FVector(0.f, 0.f, FMath::FastSin(ElapsedTime * FloatingFrequency) * FloatingHeight));       
     }
 }
 
@@ -5,6 +5,9 @@
 
 UFishTailComponent::UFishTailComponent()
 {
+    // SetRelativeRotation은 자식들의 World Transform까지 바꾸고, AFish::Tick도 같은 프레임에 몸통의 회전을 다루므로 게임 스레드에서 Tick합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bAllowSignificanceThrottling = true;
 }
 
 void UFishTailComponent::TickComponent(float DeltaTime)
@@ -13,7 +16,7 @@ void UFishTailComponent::TickComponent(float DeltaTime)
 
     ElapsedTime += DeltaTime;
 
-    SetRelativeRotation(FRotator(0.f, FMath::Sin(ElapsedTime * PI * CurrentFrequency) * CurrentYaw, 0.f));
+    SetRelativeRotation(FRotator(0.f, FMath::FastSin(ElapsedTime * PI * CurrentFrequency) * CurrentYaw, 0.f));
 
     // UE_LOG(ELogLevel::Display, TEXT("ElapsedTime: %f, Yaw: %f"), ElapsedTime, GetRelativeRotation().Yaw);
 }
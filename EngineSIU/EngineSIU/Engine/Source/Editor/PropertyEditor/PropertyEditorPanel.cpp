@@ -45,6 +45,37 @@
 #include "imgui/imgui_bezier.h"
 #include "imgui/imgui_curve.h"
 
+namespace
+{
+    /** Mesh 목록의 항목에 마우스를 올리면, 로드하지 않고 Registry에 저장된 정보를 보여줍니다. */
+    void ShowAssetTooltip(const FAssetInfo& AssetInfo)
+    {
+        if (!ImGui::IsItemHovered())
+        {
+            return;
+        }
+
+        ImGui::BeginTooltip();
+        ImGui::Text("%s (%.1f KB)", GetData(AssetInfo.GetFullPath()), static_cast<float>(AssetInfo.Size) / 1024.f);
+        if (AssetInfo.bHasMeshInfo)
+        {
+            const FAssetMeshInfo& MeshInfo = AssetInfo.MeshInfo;
+            const FVector Extent = MeshInfo.BoundsMax - MeshInfo.BoundsMin;
+            ImGui::Text("Bounds: %.2f x %.2f x %.2f", Extent.X, Extent.Y, Extent.Z);
+            ImGui::Text("Vertices: %u, Material Slots: %u", MeshInfo.NumVertices, MeshInfo.NumMaterialSlots);
+            if (AssetInfo.AssetType == EAssetType::SkeletalMesh)
+            {
+                ImGui::Text("Bones: %u", MeshInfo.NumBones);
+            }
+        }
+        else
+        {
+            ImGui::TextDisabled("Not loaded yet");
+        }
+        ImGui::EndTooltip();
+    }
+}
+
 void PropertyEditorPanel::Render()
 {
     UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
@@ -413,12 +444,18 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
             }
         }
 
-        const TMap<FName, FAssetInfo> Assets = UAssetManager::Get().GetAssetRegistry();
+        const TMap<FName, FAssetInfo>& Assets = UAssetManager::Get().GetAssetRegistry();
 
         if (ImGui::BeginCombo("##StaticMesh", GetData(PreviewName), ImGuiComboFlags_None))
         {
             for (const auto& Asset : Assets)
             {
+                if (Asset.Value.AssetType != EAssetType::StaticMesh)
+                {
+                    continue;
+                }
+
+                // 로드되지 않은 Mesh는 선택할 때 로드됩니다.
                 if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
                 {
                     FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
@@ -428,6 +465,7 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
                         StaticMeshComp->SetStaticMesh(StaticMesh);
                     }
                 }
+                ShowAssetTooltip(Asset.Value);
             }
             ImGui::EndCombo();
         }
@@ -537,7 +575,7 @@ void PropertyEditorPanel::RenderForSkeletalMesh(USkeletalMeshComponent* Skeletal
             PreviewName = SkeletalMesh->GetOjbectName();
         }
         
-        const TMap<FName, FAssetInfo> Assets = UAssetManager::Get().GetAssetRegistry();
+        const TMap<FName, FAssetInfo>& Assets = UAssetManager::Get().GetAssetRegistry();
 
         if (ImGui::BeginCombo("##SkeletalMesh", GetData(PreviewName), ImGuiComboFlags_None))
         {
@@ -545,23 +583,18 @@ void PropertyEditorPanel::RenderForSkeletalMesh(USkeletalMeshComponent* Skeletal
             {
                 if (Asset.Value.AssetType == EAssetType::SkeletalMesh)
                 {
-                    if (Asset.Value.IsLoaded)
+                    // 로드되지 않은 Mesh는 선택할 때 로드됩니다.
+                    if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
                     {
-                        if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
+                        //FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
+                        FString MeshName = Asset.Value.GetFullPath();
+                        USkeletalMesh* SkeletalMesh = FFbxLoader::GetSkeletalMesh(MeshName.ToWideString());
+                        if (SkeletalMesh)
                         {
-                            //FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
-                            FString MeshName = Asset.Value.GetFullPath();
-                            USkeletalMesh* SkeletalMesh = FFbxLoader::GetSkeletalMesh(MeshName.ToWideString());
-                            if (SkeletalMesh)
-                            {
-                                SkeletalComp->SetSkeletalMesh(SkeletalMesh);
-                            }
+                            SkeletalComp->SetSkeletalMesh(SkeletalMesh);
                         }
                     }
-                    else
-                    {
-                        FString Path = Asset.Value.GetFullPath();
-                    }
+                    ShowAssetTooltip(Asset.Value);
                 }
             }
             ImGui::EndCombo();
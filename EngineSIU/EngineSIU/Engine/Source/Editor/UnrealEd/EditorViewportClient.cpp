@@ -60,7 +60,7 @@ void FEditorViewportClient::Tick(const float DeltaTime)
     }
     UpdateViewMatrix();
     UpdateProjectionMatrix();
-    GizmoActor->Tick(DeltaTime);
+    GizmoActor->TickActorAndComponents(DeltaTime);
 }
 
 void FEditorViewportClient::Release() const
@@ -6,7 +6,24 @@
 #include "EngineLoop.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "UnrealEd/EditorViewportClient.h"
+#include "Math/MathKernels.h"
 
+namespace
+{
+/**
+ * ModelMatrix의 회전, 스케일에 이동을 Center로 바꾼 행렬입니다.
+ * 이 행렬로 점(W=1)을 변환하면 Center + FMatrix::TransformVector(점, ModelMatrix)와 같고, 결과의 W는 0입니다.
+ */
+FMatrix MakeBoxMatrix(const FVector& Center, const FMatrix& ModelMatrix)
+{
+    FMatrix BoxMatrix = ModelMatrix;
+    BoxMatrix.M[3][0] = Center.X;
+    BoxMatrix.M[3][1] = Center.Y;
+    BoxMatrix.M[3][2] = Center.Z;
+    BoxMatrix.M[3][3] = 0.0f;
+    return BoxMatrix;
+}
+}
 
 UPrimitiveDrawBatch::~UPrimitiveDrawBatch()
 {
@@ -95,6 +112,8 @@ void UPrimitiveDrawBatch::PrepareBatch(FLinePrimitiveBatchArgs& OutLinePrimitive
 
 void UPrimitiveDrawBatch::RemoveArr()
 {
+    LocalBoundingBoxes.Empty();
+    BoundingBoxMatrices.Empty();
     BoundingBoxes.Empty();
     Cones.Empty();
     OrientedBoundingBoxes.Empty();
@@ -124,6 +143,10 @@ void UPrimitiveDrawBatch::UpdateGridConstantBuffer(const FGridParameters& GridPa
 
 void UPrimitiveDrawBatch::UpdateBoundingBoxBuffers()
 {
+    // 이번 프레임에 모인 AABB를 한 번에 월드 공간으로 변환합니다.
+    BoundingBoxes.SetNum(LocalBoundingBoxes.Num());
+    FMathKernels::Get().TransformBoxes(BoundingBoxes.GetData(), LocalBoundingBoxes.GetData(), BoundingBoxMatrices.GetData(), LocalBoundingBoxes.Num());
+
     if (BoundingBoxes.Num() > AllocatedBoundingBoxCapacity)
     {
         AllocatedBoundingBoxCapacity = BoundingBoxes.Num();
@@ -226,56 +249,26 @@ void UPrimitiveDrawBatch::ReleaseOBBBuffers()
 // 6. 프리미티브 렌더링 관련 함수
 void UPrimitiveDrawBatch::AddAABBToBatch(const FBoundingBox& LocalAABB, const FVector& Center, const FMatrix& ModelMatrix)
 {
-    FVector LocalVertices[8] = {
-        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z }
-    };
-
-    FVector WorldVertices[8];
-    WorldVertices[0] = Center + FMatrix::TransformVector(LocalVertices[0], ModelMatrix);
-
-    FVector Min = WorldVertices[0], Max = WorldVertices[0];
-
-    for (int i = 1; i < 8; ++i)
-    {
-        WorldVertices[i] = Center + FMatrix::TransformVector(LocalVertices[i], ModelMatrix);
-        Min.X = (WorldVertices[i].X < Min.X) ? WorldVertices[i].X : Min.X;
-        Min.Y = (WorldVertices[i].Y < Min.Y) ? WorldVertices[i].Y : Min.Y;
-        Min.Z = (WorldVertices[i].Z < Min.Z) ? WorldVertices[i].Z : Min.Z;
-        Max.X = (WorldVertices[i].X > Max.X) ? WorldVertices[i].X : Max.X;
-        Max.Y = (WorldVertices[i].Y > Max.Y) ? WorldVertices[i].Y : Max.Y;
-        Max.Z = (WorldVertices[i].Z > Max.Z) ? WorldVertices[i].Z : Max.Z;
-    }
-    FBoundingBox BoundingBox;
-    BoundingBox.MinLocation = Min;
-    BoundingBox.MaxLocation = Max;
-    BoundingBoxes.Add(BoundingBox);
+    // 월드 AABB는 UpdateBoundingBoxBuffers에서 모아서 계산합니다.
+    LocalBoundingBoxes.Add(LocalAABB);
+    BoundingBoxMatrices.Add(MakeBoxMatrix(Center, ModelMatrix));
 }
 
 void UPrimitiveDrawBatch::AddOBBToBatch(const FBoundingBox& LocalAABB, const FVector& Center, const FMatrix& ModelMatrix)
 {
-    FVector LocalVertices[8] = {
-        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z },
-        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z }
+    FVector4 LocalVertices[8] = {
+        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z, 1.0f },
+        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MinLocation.Z, 1.0f },
+        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z, 1.0f },
+        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MinLocation.Z, 1.0f },
+        { LocalAABB.MinLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z, 1.0f },
+        { LocalAABB.MaxLocation.X, LocalAABB.MinLocation.Y, LocalAABB.MaxLocation.Z, 1.0f },
+        { LocalAABB.MinLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z, 1.0f },
+        { LocalAABB.MaxLocation.X, LocalAABB.MaxLocation.Y, LocalAABB.MaxLocation.Z, 1.0f }
     };
 
     FOBB OBB;
-    for (int i = 0; i < 8; ++i)
-    {
-        OBB.corners[i] = Center + FMatrix::TransformVector(LocalVertices[i], ModelMatrix);
-    }
+    FMathKernels::Get().TransformVector4s(OBB.corners, LocalVertices, 8, MakeBoxMatrix(Center, ModelMatrix));
     OrientedBoundingBoxes.Add(OBB);
 }
 
@@ -89,7 +89,9 @@ private:
     size_t AllocatedOBBCapacity = 0;
 
     // 프리미티브 데이터 컨테이너
-    TArray<FBoundingBox> BoundingBoxes;
+    TArray<FBoundingBox> LocalBoundingBoxes;
+    TArray<FMatrix> BoundingBoxMatrices;
+    TArray<FBoundingBox> BoundingBoxes; // LocalBoundingBoxes를 월드 공간으로 변환한 결과
     TArray<FOBB> OrientedBoundingBoxes;
     TArray<FCone> Cones;
 
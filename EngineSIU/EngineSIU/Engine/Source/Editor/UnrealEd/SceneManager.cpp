@@ -1,5 +1,6 @@
 #include "SceneManager.h"
 #include <fstream>
+#include <unordered_map>
 #include "EditorViewportClient.h"
 #include "Engine/FObjLoader.h"
 #include "Engine/StaticMeshActor.h"
@@ -51,14 +52,28 @@ template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json = Map.GetContainerPrivate();
+    // 기존 저장 포맷을 유지하기 위해 std::unordered_map을 거쳐서 변환
+    std::unordered_map<KeyType, ValueType> StdMap;
+    StdMap.reserve(Map.Num());
+    for (const auto& [Key, Value] : Map)
+    {
+        StdMap.emplace(Key, Value);
+    }
+    Json = StdMap;
 }
 
 template <typename KeyType, typename ValueType, typename Allocator>
 [[maybe_unused]]
 static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
 {
-    Json.get_to(Map.GetContainerPrivate());
+    std::unordered_map<KeyType, ValueType> StdMap;
+    Json.get_to(StdMap);
+
+    Map.Empty(static_cast<int32>(StdMap.size()));
+    for (auto& [Key, Value] : StdMap)
+    {
+        Map.Emplace(Key, std::move(Value));
+    }
 }
 #pragma endregion
 
@@ -0,0 +1,585 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+#include "Stats/CpuProfiler.h"
+#include "Stats/Stats.h"
+
+
+thread_local FJobSystem::FThreadContext* FJobSystem::LocalContext = nullptr;
+
+
+/**
+ * Chase-Lev Work-stealing Deque
+ *
+ * 소유한 스레드만 Push/Pop(Bottom 쪽, LIFO)할 수 있고, 다른 스레드는 Steal(Top 쪽, FIFO)로 가져갑니다.
+ * 크기가 고정되어 있으므로 Buffer를 교체하거나 회수할 필요가 없습니다.
+ */
+class FJobSystem::FJobDeque
+{
+public:
+    static constexpr int64 Capacity = LocalQueueCapacity;
+    static constexpr int64 IndexMask = Capacity - 1;
+    static_assert((Capacity & IndexMask) == 0, "LocalQueueCapacity는 2의 거듭제곱이어야 합니다.");
+
+    /** 소유 스레드 전용, 가득 차있으면 false */
+    bool Push(FJob* Job)
+    {
+        const int64 B = Bottom.load(std::memory_order_relaxed);
+        const int64 T = Top.load(std::memory_order_acquire);
+        if (B - T >= Capacity)
+        {
+            return false;
+        }
+
+        Buffer[B & IndexMask].store(Job, std::memory_order_relaxed);
+        Bottom.store(B + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 소유 스레드 전용, 가장 최근에 넣은 Job을 꺼냅니다. */
+    FJob* Pop()
+    {
+        // Bottom을 먼저 줄여서 Steal과 마지막 요소를 두고 경쟁합니다.
+        const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+        Bottom.store(B, std::memory_order_seq_cst);
+        int64 T = Top.load(std::memory_order_seq_cst);
+
+        if (T > B)
+        {
+            Bottom.store(B + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        FJob* Job = Buffer[B & IndexMask].load(std::memory_order_relaxed);
+        if (T == B)
+        {
+            // 마지막 요소는 Steal과 CAS로 경쟁합니다.
+            if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                Job = nullptr;
+            }
+            Bottom.store(B + 1, std::memory_order_relaxed);
+        }
+        return Job;
+    }
+
+    /** 아무 스레드에서나 호출할 수 있으며, 가장 오래된 Job을 가져갑니다. */
+    FJob* Steal()
+    {
+        int64 T = Top.load(std::memory_order_seq_cst);
+        const int64 B = Bottom.load(std::memory_order_seq_cst);
+        if (T >= B)
+        {
+            return nullptr;
+        }
+
+        FJob* Job = Buffer[T & IndexMask].load(std::memory_order_relaxed);
+        if (!Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            // 다른 스레드가 먼저 가져갔습니다.
+            return nullptr;
+        }
+        return Job;
+    }
+
+private:
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Top = 0;
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Bottom = 0;
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<FJob*> Buffer[Capacity] = {};
+};
+
+
+FJobHandle::~FJobHandle()
+{
+    Reset();
+}
+
+FJobHandle::FJobHandle(const FJobHandle& Other)
+    : Job(Other.Job)
+{
+    if (Job)
+    {
+        Job->RefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+FJobHandle& FJobHandle::operator=(const FJobHandle& Other)
+{
+    if (this != &Other)
+    {
+        FJobHandle Temp(Other);
+        std::swap(Job, Temp.Job);
+    }
+    return *this;
+}
+
+FJobHandle::FJobHandle(FJobHandle&& Other) noexcept
+    : Job(Other.Job)
+{
+    Other.Job = nullptr;
+}
+
+FJobHandle& FJobHandle::operator=(FJobHandle&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Reset();
+        Job = Other.Job;
+        Other.Job = nullptr;
+    }
+    return *this;
+}
+
+void FJobHandle::Reset()
+{
+    if (Job)
+    {
+        FJobSystem::Release(Job);
+        Job = nullptr;
+    }
+}
+
+
+FJobSystem& FJobSystem::Get()
+{
+    static FJobSystem Instance;
+    return Instance;
+}
+
+FJobSystem::FJobSystem()
+    : GlobalQueue(GlobalQueueCapacity)
+{
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Initialize(int32 NumWorkers)
+{
+    if (IsRunning())
+    {
+        return;
+    }
+
+    if (NumWorkers <= 0)
+    {
+        const int32 NumHardwareThreads = static_cast<int32>(std::thread::hardware_concurrency());
+        NumWorkers = std::max(1, NumHardwareThreads - 1);
+    }
+
+    GameThreadId = std::this_thread::get_id();
+    NumWorkerThreads = NumWorkers;
+
+    // Worker 스레드 + 게임 스레드
+    for (int32 Index = 0; Index <= NumWorkers; ++Index)
+    {
+        FThreadContext* Context = new FThreadContext;
+        Context->Deque = new FJobDeque;
+        Contexts.Add(Context);
+    }
+    LocalContext = Contexts[NumWorkers];
+
+    bIsRunning.store(true, std::memory_order_release);
+
+    Workers.Reserve(NumWorkers);
+    for (int32 Index = 0; Index < NumWorkers; ++Index)
+    {
+        Workers.Emplace([this, Index]() { WorkerMain(Index); });
+    }
+}
+
+void FJobSystem::Shutdown()
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    // Worker는 남은 Job을 모두 실행한 뒤 종료됩니다.
+    bIsRunning.store(false, std::memory_order_release);
+    WakeWorker(true);
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.Empty();
+
+    // Worker가 종료된 뒤에 들어온 Job은 여기서 실행합니다.
+    while (TryExecuteOne(true))
+    {
+    }
+
+    for (FThreadContext* Context : Contexts)
+    {
+        delete Context->Deque;
+        delete Context;
+    }
+    Contexts.Empty();
+    LocalContext = nullptr;
+    NumWorkerThreads = 0;
+}
+
+FJobHandle FJobSystem::LaunchInternal(std::function<void()>&& Task, const FJobHandle* Prerequisites, int32 NumPrerequisites, EJobThread Thread)
+{
+    FJob* Job = new FJob;
+    Job->Task = std::move(Task);
+    Job->Thread = Thread;
+
+    // RefCount 1은 실행이 끝날 때까지 System이 가지고, 나머지 1은 반환할 Handle이 가집니다.
+    Job->RefCount.store(2, std::memory_order_relaxed);
+    FJobHandle Handle(Job);
+
+    Job->NumPendingPrerequisites.store(1 + NumPrerequisites, std::memory_order_relaxed);
+
+    // 완료된 선행 Job과 Launch 자신의 몫 1을 마지막에 한 번에 뺍니다.
+    int32 NumReady = 1;
+    for (int32 Index = 0; Index < NumPrerequisites; ++Index)
+    {
+        FJob* Prerequisite = Prerequisites[Index].Job;
+        if (!Prerequisite)
+        {
+            ++NumReady;
+            continue;
+        }
+
+        LockContinuations(Prerequisite);
+        if (Prerequisite->bContinuationsClosed)
+        {
+            ++NumReady;
+        }
+        else
+        {
+            Prerequisite->Continuations.Add(Job);
+        }
+        UnlockContinuations(Prerequisite);
+    }
+
+    if (Job->NumPendingPrerequisites.fetch_sub(NumReady, std::memory_order_acq_rel) == NumReady)
+    {
+        Schedule(Job);
+    }
+    return Handle;
+}
+
+void FJobSystem::Schedule(FJob* Job)
+{
+    if (Job->Thread == EJobThread::GameThread)
+    {
+        GameThreadQueue.Enqueue(Job);
+        return;
+    }
+
+    if (!IsRunning())
+    {
+        Execute(Job, LocalContext);
+        return;
+    }
+
+    const bool bQueued = (LocalContext && LocalContext->Deque->Push(Job)) || GlobalQueue.Enqueue(Job);
+    if (!bQueued)
+    {
+        // 모든 Queue가 가득 찼으므로 직접 실행합니다.
+        Execute(Job, LocalContext);
+        return;
+    }
+
+    WakeWorker(false);
+}
+
+void FJobSystem::Execute(FJob* Job, FThreadContext* Context)
+{
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(JobSystem_Execute)
+        Job->Task();
+    }
+
+    // Capture된 객체들을 Handle보다 먼저 해제합니다.
+    Job->Task = nullptr;
+
+    LockContinuations(Job);
+    Job->bContinuationsClosed = true;
+    TArray<FJob*> Continuations = std::move(Job->Continuations);
+    UnlockContinuations(Job);
+
+    Job->bCompleted.store(true, std::memory_order_release);
+
+    for (FJob* Continuation : Continuations)
+    {
+        if (Continuation->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Schedule(Continuation);
+        }
+    }
+
+    if (Context)
+    {
+        Context->NumExecuted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Release(Job);
+}
+
+FJob* FJobSystem::FindJob(FThreadContext* Context)
+{
+    if (Context)
+    {
+        if (FJob* Job = Context->Deque->Pop())
+        {
+            return Job;
+        }
+    }
+
+    FJob* Job = nullptr;
+    if (GlobalQueue.Dequeue(Job))
+    {
+        return Job;
+    }
+
+    // 자신의 다음 Context부터 돌아가며 훔쳐옵니다.
+    const int32 NumContexts = Contexts.Num();
+    int32 Start = 0;
+    for (int32 Index = 0; Index < NumContexts; ++Index)
+    {
+        if (Contexts[Index] == Context)
+        {
+            Start = Index + 1;
+            break;
+        }
+    }
+
+    for (int32 Offset = 0; Offset < NumContexts; ++Offset)
+    {
+        FThreadContext* Victim = Contexts[(Start + Offset) % NumContexts];
+        if (Victim == Context)
+        {
+            continue;
+        }
+
+        if (FJob* Stolen = Victim->Deque->Steal())
+        {
+            if (Context)
+            {
+                Context->NumStolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            return Stolen;
+        }
+    }
+    return nullptr;
+}
+
+bool FJobSystem::TryExecuteOne(bool bIncludeGameThreadJobs)
+{
+    if (bIncludeGameThreadJobs)
+    {
+        FJob* Job = nullptr;
+        if (GameThreadQueue.Dequeue(Job))
+        {
+            Execute(Job, LocalContext);
+            return true;
+        }
+    }
+
+    if (FJob* Job = FindJob(LocalContext))
+    {
+        Execute(Job, LocalContext);
+        return true;
+    }
+    return false;
+}
+
+void FJobSystem::Wait(const FJobHandle& Handle, bool bRunGameThreadJobs)
+{
+    const bool bIncludeGameThreadJobs = bRunGameThreadJobs && IsInGameThread();
+    assert(bIncludeGameThreadJobs || !IsInGameThread() || !Handle.Job || Handle.Job->Thread != EJobThread::GameThread);
+
+    while (!Handle.IsCompleted())
+    {
+        if (!TryExecuteOne(bIncludeGameThreadJobs))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void FJobSystem::WaitAll(const TArray<FJobHandle>& Handles, bool bRunGameThreadJobs)
+{
+    for (const FJobHandle& Handle : Handles)
+    {
+        Wait(Handle, bRunGameThreadJobs);
+    }
+}
+
+void FJobSystem::ParallelForRange(int32 Num, const std::function<void(int32, int32)>& Body, int32 GrainSize)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    const int32 NumThreads = NumWorkerThreads + 1;
+    if (GrainSize <= 0)
+    {
+        // 스레드마다 4개 정도의 구간을 가져가도록 나눠서 부하 불균형을 줄입니다.
+        GrainSize = std::max(1, Num / (NumThreads * 4));
+    }
+
+    const int32 NumBatches = (Num + GrainSize - 1) / GrainSize;
+    if (NumBatches <= 1 || !IsRunning())
+    {
+        Body(0, Num);
+        return;
+    }
+
+    std::atomic<int32> NextBatch = 0;
+    auto RunBatches = [&NextBatch, &Body, NumBatches, GrainSize, Num]()
+    {
+        while (true)
+        {
+            const int32 Batch = NextBatch.fetch_add(1, std::memory_order_relaxed);
+            if (Batch >= NumBatches)
+            {
+                break;
+            }
+
+            const int32 Begin = Batch * GrainSize;
+            Body(Begin, std::min(Begin + GrainSize, Num));
+        }
+    };
+
+    // 구간은 Helper Job과 호출한 스레드가 먼저 가져가는 순서대로 처리합니다.
+    const int32 NumHelpers = std::min(NumBatches - 1, NumWorkerThreads);
+    TArray<FJobHandle> Helpers;
+    Helpers.Reserve(NumHelpers);
+    for (int32 Index = 0; Index < NumHelpers; ++Index)
+    {
+        Helpers.Add(Launch(RunBatches));
+    }
+
+    RunBatches();
+    WaitAll(Helpers, false);
+}
+
+void FJobSystem::ProcessGameThreadJobs()
+{
+    // 실행 중에 추가된 Job은 다음 호출에서 실행합니다.
+    TArray<FJob*> Jobs;
+    GameThreadQueue.DequeueBatch(Jobs);
+    for (FJob* Job : Jobs)
+    {
+        Execute(Job, LocalContext);
+    }
+}
+
+void FJobSystem::GetStats(uint64& OutNumExecuted, uint64& OutNumStolen) const
+{
+    OutNumExecuted = 0;
+    OutNumStolen = 0;
+    for (const FThreadContext* Context : Contexts)
+    {
+        OutNumExecuted += Context->NumExecuted.load(std::memory_order_relaxed);
+        OutNumStolen += Context->NumStolen.load(std::memory_order_relaxed);
+    }
+}
+
+void FJobSystem::WorkerMain(int32 ContextIndex)
+{
+    FThreadContext* Context = Contexts[ContextIndex];
+    LocalContext = Context;
+
+    FCpuProfiler::Get().SetThreadName(FString::Printf(TEXT("Worker %d"), ContextIndex));
+
+    // 잠들기 전에 잠깐 다시 찾아보는 횟수
+    constexpr int32 NumSpinsBeforeSleep = 64;
+
+    int32 NumSpins = 0;
+    while (true)
+    {
+        if (FJob* Job = FindJob(Context))
+        {
+            Execute(Job, Context);
+            NumSpins = 0;
+            continue;
+        }
+
+        if (!IsRunning())
+        {
+            break;
+        }
+
+        if (++NumSpins < NumSpinsBeforeSleep)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        NumSpins = 0;
+
+        // Epoch를 읽은 뒤 다시 찾아보고, 그 사이에 Job이 추가되었다면 Epoch가 바뀌어 있으므로 잠들지 않습니다.
+        NumSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        const uint32 Epoch = WakeEpoch.load(std::memory_order_seq_cst);
+        if (FJob* Job = FindJob(Context))
+        {
+            NumSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+            Execute(Job, Context);
+            continue;
+        }
+
+        {
+            std::unique_lock Lock(WakeMutex);
+            WakeCondition.wait(Lock, [this, Epoch]()
+            {
+                return WakeEpoch.load(std::memory_order_seq_cst) != Epoch || !IsRunning();
+            });
+        }
+        NumSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    LocalContext = nullptr;
+}
+
+void FJobSystem::WakeWorker(bool bWakeAll)
+{
+    WakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (!bWakeAll && NumSleepingWorkers.load(std::memory_order_seq_cst) == 0)
+    {
+        return;
+    }
+
+    // Worker가 조건을 확인하고 wait에 들어가는 사이에 notify가 끼어들지 않도록 Lock을 거칩니다.
+    {
+        std::lock_guard Lock(WakeMutex);
+    }
+
+    if (bWakeAll)
+    {
+        WakeCondition.notify_all();
+    }
+    else
+    {
+        WakeCondition.notify_one();
+    }
+}
+
+void FJobSystem::Release(FJob* Job)
+{
+    if (Job->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete Job;
+    }
+}
+
+void FJobSystem::LockContinuations(FJob* Job)
+{
+    while (Job->ContinuationLock.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+void FJobSystem::UnlockContinuations(FJob* Job)
+{
+    Job->ContinuationLock.clear(std::memory_order_release);
+}
@@ -0,0 +1,277 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "Container/LockFreeQueue.h"
+#include "HAL/PlatformType.h"
+
+
+/** Job이 실행될 스레드 */
+enum class EJobThread : uint8
+{
+    /** Worker 스레드, 또는 Wait 중인 스레드에서 실행됩니다. */
+    AnyThread,
+
+    /** 게임 스레드의 FJobSystem::ProcessGameThreadJobs, 또는 게임 스레드가 Wait하는 동안 실행됩니다. */
+    GameThread,
+};
+
+
+/**
+ * Job 하나의 실행 상태, FJobHandle과 FJobSystem이 참조 카운트로 공유합니다.
+ * 직접 사용하지 말고 FJobHandle을 통해 접근해야 합니다.
+ */
+struct FJob
+{
+    std::function<void()> Task;
+
+    std::atomic<int32> RefCount = 1;
+
+    /** 완료되지 않은 선행 Job 수 + 1, Launch가 끝나기 전에 실행되지 않도록 1부터 시작합니다. */
+    std::atomic<int32> NumPendingPrerequisites = 1;
+
+    std::atomic<bool> bCompleted = false;
+
+    EJobThread Thread = EJobThread::AnyThread;
+
+    /** Continuations와 bContinuationsClosed를 보호합니다. */
+    std::atomic_flag ContinuationLock;
+
+    /** true가 되면 더 이상 Continuation을 받지 않습니다. (이미 완료됨) */
+    bool bContinuationsClosed = false;
+
+    /** 이 Job이 완료되면 NumPendingPrerequisites를 감소시킬 Job들 */
+    TArray<FJob*> Continuations;
+};
+
+
+/**
+ * FJobSystem::Launch가 반환하는 Job의 참조
+ *
+ * Handle이 남아있는 동안 Job의 완료 여부를 확인하거나, 다른 Job의 선행 조건으로 사용할 수 있습니다.
+ * 빈 Handle은 이미 완료된 Job처럼 취급됩니다.
+ */
+class FJobHandle
+{
+public:
+    FJobHandle() = default;
+    ~FJobHandle();
+
+    FJobHandle(const FJobHandle& Other);
+    FJobHandle& operator=(const FJobHandle& Other);
+    FJobHandle(FJobHandle&& Other) noexcept;
+    FJobHandle& operator=(FJobHandle&& Other) noexcept;
+
+    bool IsValid() const { return Job != nullptr; }
+
+    bool IsCompleted() const
+    {
+        return !Job || Job->bCompleted.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Job이 완료될 때까지 다른 Job을 실행하며 기다립니다.
+     * @param bRunGameThreadJobs false이면 게임 스레드에서 기다리는 동안 GameThread Job을 실행하지 않습니다.
+     */
+    void Wait(bool bRunGameThreadJobs = true) const;
+
+    /** 이 Job이 완료된 뒤에 실행될 Job을 추가합니다. */
+    template <typename FuncType>
+    FJobHandle Then(FuncType&& Func, EJobThread Thread = EJobThread::AnyThread) const;
+
+    void Reset();
+
+private:
+    friend class FJobSystem;
+
+    /** 참조 카운트를 증가시키지 않고 Job을 가져옵니다. */
+    explicit FJobHandle(FJob* InJob)
+        : Job(InJob)
+    {
+    }
+
+    FJob* Job = nullptr;
+};
+
+
+/**
+ * Work-stealing 방식의 Job System
+ *
+ * - 하드웨어 스레드 수 - 1개의 Worker 스레드를 고정으로 생성합니다. (게임 스레드가 나머지 하나를 사용)
+ * - Worker와 게임 스레드는 각자의 Deque에 Job을 넣고 꺼내며(LIFO), 일이 없으면 다른 스레드의 Deque에서 훔쳐옵니다(FIFO).
+ * - 그 외의 스레드에서 Launch한 Job은 공용 Queue로 들어갑니다.
+ * - 선행 Job(Prerequisites)이 모두 완료되어야 실행되며, EJobThread::GameThread Job은 게임 스레드에서 실행됩니다.
+ * - Wait는 잠들지 않고 다른 Job을 대신 실행하므로, Job 안에서 다른 Job을 기다려도 교착되지 않습니다.
+ *
+ * Initialize 전이나 Shutdown 이후에 Launch한 AnyThread Job은 호출한 스레드에서 즉시 실행됩니다.
+ */
+class FJobSystem
+{
+public:
+    /** 스레드 하나의 Deque 크기, 가득 차면 공용 Queue를 사용합니다. */
+    static constexpr int32 LocalQueueCapacity = 4096;
+
+    /** 공용 Queue의 크기, 가득 차면 호출한 스레드에서 즉시 실행합니다. */
+    static constexpr uint32 GlobalQueueCapacity = 16 * 1024;
+
+    static FJobSystem& Get();
+
+    FJobSystem();
+    ~FJobSystem();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+
+    /**
+     * Worker 스레드를 생성합니다. 호출한 스레드를 게임 스레드로 등록합니다.
+     * @param NumWorkers Worker 스레드 수, 0 이하이면 하드웨어 스레드 수 - 1 (최소 1)
+     */
+    void Initialize(int32 NumWorkers = 0);
+
+    /** 대기 중인 Job을 모두 실행한 뒤 Worker 스레드를 종료합니다. 게임 스레드에서 호출해야 합니다. */
+    void Shutdown();
+
+    bool IsRunning() const { return bIsRunning.load(std::memory_order_acquire); }
+
+    int32 GetNumWorkers() const { return NumWorkerThreads; }
+
+    bool IsInGameThread() const { return std::this_thread::get_id() == GameThreadId; }
+
+public:
+    FJobHandle Launch(std::function<void()> Task, EJobThread Thread = EJobThread::AnyThread)
+    {
+        return LaunchInternal(std::move(Task), nullptr, 0, Thread);
+    }
+
+    /** Prerequisites가 모두 완료된 뒤에 Task를 실행합니다. */
+    FJobHandle Launch(std::function<void()> Task, std::initializer_list<FJobHandle> Prerequisites, EJobThread Thread = EJobThread::AnyThread)
+    {
+        return LaunchInternal(std::move(Task), Prerequisites.begin(), static_cast<int32>(Prerequisites.size()), Thread);
+    }
+
+    FJobHandle Launch(std::function<void()> Task, const TArray<FJobHandle>& Prerequisites, EJobThread Thread = EJobThread::AnyThread)
+    {
+        return LaunchInternal(std::move(Task), Prerequisites.GetData(), Prerequisites.Num(), Thread);
+    }
+
+    /**
+     * Handle이 완료될 때까지 다른 Job을 실행하며 기다립니다.
+     * @param bRunGameThreadJobs 게임 스레드에서 기다릴 때 GameThread Job도 함께 실행할지 여부
+     *        Tick 도중처럼 GameThread Job의 Callback이 실행되면 안되는 곳에서는 false로 호출합니다.
+     *        이때 Handle이 GameThread Job을 기다린다면 ProcessGameThreadJobs가 호출될 때까지 완료되지 않으므로 교착됩니다.
+     */
+    void Wait(const FJobHandle& Handle, bool bRunGameThreadJobs = true);
+
+    void WaitAll(const TArray<FJobHandle>& Handles, bool bRunGameThreadJobs = true);
+
+    /**
+     * [0, Num) 범위를 GrainSize 크기의 구간으로 나누어 Worker들과 호출한 스레드가 나눠서 실행합니다.
+     * 모든 구간이 끝나야 반환합니다. 기다리는 동안 GameThread Job은 실행하지 않습니다.
+     *
+     * @param Body 구간 [Begin, End)를 처리하는 함수
+     * @param GrainSize 구간 하나의 크기, 0 이하이면 스레드 수에 맞춰 자동으로 정합니다.
+     */
+    void ParallelForRange(int32 Num, const std::function<void(int32 /*Begin*/, int32 /*End*/)>& Body, int32 GrainSize = 0);
+
+    /** EJobThread::GameThread로 예약된 Job들을 실행합니다. 게임 스레드에서 매 프레임 호출됩니다. */
+    void ProcessGameThreadJobs();
+
+    /** 시작 이후 실행된 Job 수와, 그 중 다른 스레드에서 훔쳐온 Job 수 */
+    void GetStats(uint64& OutNumExecuted, uint64& OutNumStolen) const;
+
+private:
+    class FJobDeque;
+
+    /** 스레드 하나가 소유하는 Deque와 통계, False Sharing을 막기 위해 Cache Line 단위로 정렬합니다. */
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FThreadContext
+    {
+        FJobDeque* Deque = nullptr;
+        std::atomic<uint64> NumExecuted = 0;
+        std::atomic<uint64> NumStolen = 0;
+    };
+
+    FJobHandle LaunchInternal(std::function<void()>&& Task, const FJobHandle* Prerequisites, int32 NumPrerequisites, EJobThread Thread);
+
+    /** 선행 Job이 모두 완료된 Job을 실행 대기열에 넣습니다. */
+    void Schedule(FJob* Job);
+
+    /** Job을 실행하고 Continuation들을 깨웁니다. */
+    void Execute(FJob* Job, FThreadContext* Context);
+
+    /** 현재 스레드가 실행할 Job을 찾습니다. 없으면 nullptr */
+    FJob* FindJob(FThreadContext* Context);
+
+    /** Job을 하나 찾아 실행합니다. 실행한 Job이 없으면 false */
+    bool TryExecuteOne(bool bIncludeGameThreadJobs);
+
+    void WorkerMain(int32 ContextIndex);
+
+    void WakeWorker(bool bWakeAll);
+
+    static void Release(FJob* Job);
+
+    static void LockContinuations(FJob* Job);
+    static void UnlockContinuations(FJob* Job);
+
+private:
+    friend class FJobHandle;
+
+    /** Worker들과 게임 스레드의 Context, 게임 스레드는 마지막 Index를 사용합니다. */
+    TArray<FThreadContext*> Contexts;
+
+    TArray<std::thread> Workers;
+    int32 NumWorkerThreads = 0;
+
+    std::thread::id GameThreadId;
+
+    std::atomic<bool> bIsRunning = false;
+
+    /** 등록되지 않은 스레드에서 Launch한 Job */
+    TBoundedQueue<FJob*, EQueueMode::Mpmc> GlobalQueue;
+
+    /** EJobThread::GameThread Job, 여러 스레드에서 넣고 게임 스레드에서만 꺼냅니다. */
+    TLockFreeQueue<FJob*, EQueueMode::Mpsc> GameThreadQueue;
+
+    /** Job이 추가될 때마다 증가하며, 잠들기 직전의 값과 비교해 Wakeup 유실을 막습니다. */
+    std::atomic<uint32> WakeEpoch = 0;
+    std::atomic<int32> NumSleepingWorkers = 0;
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+
+    /** 현재 스레드의 Context, 등록되지 않은 스레드는 nullptr */
+    static thread_local FThreadContext* LocalContext;
+};
+
+
+/**
+ * [0, Num)의 각 Index에 대해 Body(Index)를 병렬로 실행합니다.
+ * @param GrainSize 한 번에 가져가는 Index 수, 0 이하이면 자동으로 정합니다.
+ */
+template <typename FuncType>
+void ParallelFor(int32 Num, FuncType&& Body, int32 GrainSize = 0)
+{
+    FJobSystem::Get().ParallelForRange(Num, [&Body](int32 Begin, int32 End)
+    {
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            Body(Index);
+        }
+    }, GrainSize);
+}
+
+
+inline void FJobHandle::Wait(bool bRunGameThreadJobs) const
+{
+    FJobSystem::Get().Wait(*this, bRunGameThreadJobs);
+}
+
+template <typename FuncType>
+FJobHandle FJobHandle::Then(FuncType&& Func, EJobThread Thread) const
+{
+    return FJobSystem::Get().Launch(std::forward<FuncType>(Func), { *this }, Thread);
+}
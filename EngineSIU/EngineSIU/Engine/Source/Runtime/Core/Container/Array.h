@@ -8,17 +8,35 @@
 #include "Serialization/Archive.h"
 
 
+/**
+ * std::vector 기반의 동적 배열입니다.
+ * @tparam T 요소 타입
+ * @tparam Allocator 요소 타입의 Allocator 또는 TInlineAllocator<N> 같은 Allocator Policy
+ */
 template <typename T, typename Allocator = FDefaultAllocator<T>>
-class TArray
+class TArray : private TContainerAllocatorStorage<typename TResolveContainerAllocator<Allocator, T>::Type>
 {
 public:
-    using SizeType = typename Allocator::SizeType;
+    using AllocatorType = typename TResolveContainerAllocator<Allocator, T>::Type;
+    using SizeType = typename AllocatorType::SizeType;
     using ElementType = T;
-    using ArrayType = std::vector<ElementType, Allocator>;
+    using ArrayType = std::vector<ElementType, AllocatorType>;
 
 private:
+    /** Allocator가 컨테이너 내부에 Inline 버퍼를 가지고 있는지 여부 */
+    static constexpr bool bHasInlineStorage = requires { AllocatorType::InlineCapacity; };
+
     ArrayType ContainerPrivate;
 
+    /** Inline 버퍼를 가진 Allocator라면, 처음부터 Inline 버퍼 전체를 Capacity로 확보합니다. */
+    void ReserveInlineStorage()
+    {
+        if constexpr (bHasInlineStorage)
+        {
+            ContainerPrivate.reserve(AllocatorType::InlineCapacity);
+        }
+    }
+
 public:
     // Iterator를 사용하기 위함
     auto begin() noexcept { return ContainerPrivate.begin(); }
@@ -221,26 +239,49 @@ TArray<T, Allocator> TArray<T, Allocator>::operator+(const TArray& OtherArray) c
 
 template <typename T, typename Allocator>
 TArray<T, Allocator>::TArray()
-    : ContainerPrivate()
+    : ContainerPrivate(this->MakeAllocator())
 {
+    ReserveInlineStorage();
 }
 
 template <typename T, typename Allocator>
 TArray<T, Allocator>::TArray(std::initializer_list<T> InitList)
-    : ContainerPrivate(InitList)
+    : ContainerPrivate(this->MakeAllocator())
 {
+    ReserveInlineStorage();
+    ContainerPrivate.assign(InitList);
 }
 
 template <typename T, typename Allocator>
 TArray<T, Allocator>::TArray(const TArray& Other)
-    : ContainerPrivate(Other.ContainerPrivate)
+    : ContainerPrivate(this->MakeAllocator())
 {
+    if constexpr (bHasInlineStorage)
+    {
+        ReserveInlineStorage();
+        ContainerPrivate.assign(Other.ContainerPrivate.begin(), Other.ContainerPrivate.end());
+    }
+    else
+    {
+        ContainerPrivate = Other.ContainerPrivate;
+    }
 }
 
 template <typename T, typename Allocator>
 TArray<T, Allocator>::TArray(TArray&& Other) noexcept
-    : ContainerPrivate(std::move(Other.ContainerPrivate))
+    : ContainerPrivate(this->MakeAllocator())
 {
+    if constexpr (bHasInlineStorage)
+    {
+        // Inline 버퍼는 넘겨받을 수 없으므로 요소를 하나씩 이동
+        ReserveInlineStorage();
+        ContainerPrivate.assign(std::make_move_iterator(Other.ContainerPrivate.begin()), std::make_move_iterator(Other.ContainerPrivate.end()));
+        Other.ContainerPrivate.clear();
+    }
+    else
+    {
+        ContainerPrivate = std::move(Other.ContainerPrivate);
+    }
 }
 
 template <typename T, typename Allocator>
@@ -259,6 +300,11 @@ TArray<T, Allocator>& TArray<T, Allocator>::operator=(TArray&& Other) noexcept
     if (this != &Other)
     {
         ContainerPrivate = std::move(Other.ContainerPrivate);
+        if constexpr (bHasInlineStorage)
+        {
+            // Allocator가 서로 다르면 요소 단위로 이동되므로, 이동 후 Other를 비웁니다.
+            Other.ContainerPrivate.clear();
+        }
     }
     return *this;
 }
@@ -562,7 +608,23 @@ typename TArray<T, Allocator>::SizeType TArray<T, Allocator>::AddDefaulted(SizeT
 template <typename T, typename Allocator>
 void TArray<T, Allocator>::Shrink()
 {
-    ContainerPrivate.shrink_to_fit();
+    if constexpr (bHasInlineStorage)
+    {
+        // Inline 버퍼에 들어갈 크기라면 Heap으로 다시 옮기지 않고, 비어있을 때만 Inline 버퍼로 되돌립니다.
+        if (Num() > AllocatorType::InlineCapacity)
+        {
+            ContainerPrivate.shrink_to_fit();
+        }
+        else if (IsEmpty())
+        {
+            ContainerPrivate.shrink_to_fit();
+            ReserveInlineStorage();
+        }
+    }
+    else
+    {
+        ContainerPrivate.shrink_to_fit();
+    }
 }
 
 template <typename T, typename Allocator>
@@ -1,8 +1,10 @@
 #pragma once
 #include <iostream>
+#include <memory>
 
 #include "Core/HAL/PlatformType.h"
 #include "Core/HAL/PlatformMemory.h"
+#include "Core/HAL/MemStack.h"
 
 
 /**
@@ -75,6 +77,9 @@ public:
 public:
     constexpr T* allocate(size_type n) noexcept;
     constexpr void deallocate(T* p, size_type n) noexcept;
+
+    template <typename U>
+    constexpr bool operator==(const TContainerAllocator<U, IndexSize>&) const noexcept { return true; }
 };
 
 template <typename T, int IndexSize>
@@ -93,3 +98,240 @@ constexpr void TContainerAllocator<T, IndexSize>::deallocate(T* p, size_type n)
 
 template <typename T> using FDefaultAllocator = TContainerAllocator<T, 32>;
 template <typename T> using FDefaultAllocator64 = TContainerAllocator<T, 64>;
+
+
+/**
+ * 현재 스레드의 FMemStack에서 메모리를 할당하는 Allocator
+ * 한 프레임 안에서만 사용하는 임시 컨테이너에 사용하며, 할당/해제 비용이 포인터 이동 수준입니다.
+ *
+ * 게임 스레드에서만 Flush되므로, 다른 스레드에서는 FMemMark 범위 안에서만 사용할 수 있습니다. (FMemStack::Alloc에서 assert합니다)
+ * 다른 Allocator의 컨테이너도 받아야 하는 함수는 TArray<T, TFrameAllocator<T>> 대신 포인터와 개수를 받습니다.
+ *
+ * @warning 컨테이너가 FMemStack의 Flush(프레임 경계)나 FMemMark 범위를 넘어서 살아있으면 안됩니다.
+ * @tparam T 컨테이너 타입
+ * @tparam IndexSize 최대 Index의 크기 (bit)
+ */
+template <typename T, int IndexSize = 32>
+struct TFrameAllocator
+{
+public:
+    using SizeType = typename TBitsToSizeType<IndexSize>::Type;
+
+    //~ std::allocator_traits 관련 타입
+    using value_type = T;
+    using size_type = std::make_unsigned_t<SizeType>;
+    using difference_type = std::make_signed_t<SizeType>;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TFrameAllocator<U, IndexSize>;
+    };
+    //~ std::allocator_traits 관련 타입
+
+public:
+    constexpr TFrameAllocator() noexcept = default;
+
+    constexpr TFrameAllocator(const TFrameAllocator&) noexcept = default;
+    constexpr TFrameAllocator& operator=(const TFrameAllocator&) = default;
+    constexpr TFrameAllocator(TFrameAllocator&&) noexcept = default;
+    constexpr TFrameAllocator& operator=(TFrameAllocator&&) noexcept = default;
+
+    template <class U>
+    constexpr TFrameAllocator(const TFrameAllocator<U, IndexSize>&) noexcept {}
+
+    constexpr ~TFrameAllocator() = default;
+
+public:
+    T* allocate(size_type n) noexcept
+    {
+        return static_cast<T*>(FMemStack::Get().Alloc(sizeof(T) * n, alignof(T)));
+    }
+
+    void deallocate(T* p, size_type n) noexcept
+    {
+        // 마지막 할당이라면 즉시 되돌리고, 나머지는 프레임 경계에서 한 번에 회수됩니다.
+        FMemStack::Get().Free(p, sizeof(T) * n);
+    }
+
+    template <typename U>
+    constexpr bool operator==(const TFrameAllocator<U, IndexSize>&) const noexcept { return true; }
+};
+
+
+/**
+ * 요소 타입 없이 지정하는 Allocator Policy입니다.
+ * TArray<int32, TInlineAllocator<4>> 처럼 사용하며, 컨테이너가 ForElementType<T>로 실제 Allocator를 만듭니다.
+ */
+template <typename AllocatorType>
+concept TIsAllocatorPolicy = requires { typename AllocatorType::template ForElementType<int>; };
+
+/**
+ * 컨테이너가 실제로 사용할 ElementType의 Allocator
+ * - 일반 Allocator: ElementType으로 rebind
+ * - Allocator Policy: ForElementType<ElementType>
+ */
+template <typename AllocatorType, typename ElementType>
+struct TResolveContainerAllocator
+{
+    using Type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<ElementType>;
+};
+
+template <TIsAllocatorPolicy AllocatorType, typename ElementType>
+struct TResolveContainerAllocator<AllocatorType, ElementType>
+{
+    using Type = typename AllocatorType::template ForElementType<ElementType>;
+};
+
+/**
+ * 컨테이너 내부의 다른 컨테이너에 Allocator를 전달할 때 사용합니다.
+ * Allocator Policy는 그대로 전달하고, 일반 Allocator는 ElementType으로 rebind합니다.
+ */
+template <typename AllocatorType, typename ElementType>
+struct TRebindContainerAllocator
+{
+    using Type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<ElementType>;
+};
+
+template <TIsAllocatorPolicy AllocatorType, typename ElementType>
+struct TRebindContainerAllocator<AllocatorType, ElementType>
+{
+    using Type = AllocatorType;
+};
+
+
+/**
+ * 컨테이너 객체 내부에 NumInlineElements개의 요소를 저장하고, 그보다 많아지면 Heap으로 넘어가는 Allocator Policy
+ * 대부분 요소가 몇 개 되지 않는 작은 배열(AttachChildren, Overlap 목록 등)의 Heap 할당을 없애기 위해 사용합니다.
+ *
+ * Inline 버퍼(StorageType)는 컨테이너가 소유하고, Allocator는 그 버퍼를 가리키기만 합니다.
+ * 따라서 std::vector 내부에서 Allocator가 복사되어도 같은 버퍼를 올바르게 해제할 수 있습니다.
+ *
+ * @tparam NumInlineElements 컨테이너 내부에 저장할 요소의 개수
+ * @tparam IndexSize 최대 Index의 크기 (bit)
+ *
+ * @note Inline 버퍼는 컨테이너 객체에 포함되므로, 컨테이너를 이동하면 요소를 하나씩 이동합니다.
+ */
+template <int32 NumInlineElements, int IndexSize = 32>
+struct TInlineAllocator
+{
+    static_assert(NumInlineElements > 0, "TInlineAllocator requires at least one inline element.");
+
+    /** 컨테이너가 소유하는 Inline 버퍼 */
+    template <typename T>
+    struct TInlineStorage
+    {
+        TInlineStorage() = default;
+        TInlineStorage(const TInlineStorage&) = delete;
+        TInlineStorage& operator=(const TInlineStorage&) = delete;
+
+        T* GetData() noexcept { return reinterpret_cast<T*>(Data); }
+
+        alignas(T) uint8 Data[sizeof(T) * NumInlineElements];
+        bool bInUse = false;
+    };
+
+    template <typename T>
+    class ForElementType
+    {
+    public:
+        using SizeType = typename TBitsToSizeType<IndexSize>::Type;
+        using StorageType = TInlineStorage<T>;
+
+        /** 컨테이너 내부에 저장할 수 있는 요소의 개수 */
+        static constexpr SizeType InlineCapacity = static_cast<SizeType>(NumInlineElements);
+
+        //~ std::allocator_traits 관련 타입
+        using value_type = T;
+        using size_type = std::make_unsigned_t<SizeType>;
+        using difference_type = std::make_signed_t<SizeType>;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = typename TInlineAllocator::template ForElementType<U>;
+        };
+        //~ std::allocator_traits 관련 타입
+
+    public:
+        /** Inline 버퍼 없이 항상 Heap을 사용하는 Allocator */
+        ForElementType() noexcept = default;
+
+        explicit ForElementType(StorageType* InStorage) noexcept
+            : Storage(InStorage)
+        {
+        }
+
+        ForElementType(const ForElementType&) noexcept = default;
+        ForElementType& operator=(const ForElementType&) noexcept = default;
+
+        // 다른 타입으로 rebind된 Allocator는 Inline 버퍼를 사용하지 않습니다.
+        template <typename U>
+        ForElementType(const ForElementType<U>&) noexcept
+        {
+        }
+
+        /** 컨테이너 복사 시, 새 컨테이너가 원본의 Inline 버퍼를 공유하지 않도록 합니다. */
+        ForElementType select_on_container_copy_construction() const noexcept
+        {
+            return ForElementType();
+        }
+
+    public:
+        T* allocate(size_type n)
+        {
+            if (Storage && !Storage->bInUse && n <= static_cast<size_type>(InlineCapacity))
+            {
+                Storage->bInUse = true;
+                return Storage->GetData();
+            }
+            return static_cast<T*>(FPlatformMemory::Malloc<EAT_Container>(sizeof(T) * n));
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            if (Storage && p == Storage->GetData())
+            {
+                Storage->bInUse = false;
+                return;
+            }
+            FPlatformMemory::Free<EAT_Container>(p, sizeof(T) * n);
+        }
+
+        bool operator==(const ForElementType& Other) const noexcept { return Storage == Other.Storage; }
+
+    private:
+        StorageType* Storage = nullptr;
+    };
+};
+
+
+/**
+ * 컨테이너가 Allocator에 필요한 저장공간을 상속받아 소유하기 위한 Base 클래스입니다.
+ * 일반 Allocator는 빈 클래스이므로 크기가 늘어나지 않습니다.
+ */
+template <typename AllocatorType>
+struct TContainerAllocatorStorage
+{
+    AllocatorType MakeAllocator() noexcept { return AllocatorType(); }
+};
+
+template <typename AllocatorType>
+    requires requires { typename AllocatorType::StorageType; }
+struct TContainerAllocatorStorage<AllocatorType>
+{
+    TContainerAllocatorStorage() = default;
+    TContainerAllocatorStorage(const TContainerAllocatorStorage&) {}
+    TContainerAllocatorStorage& operator=(const TContainerAllocatorStorage&) { return *this; }
+
+    AllocatorType MakeAllocator() noexcept { return AllocatorType(&AllocatorStorage); }
+
+private:
+    typename AllocatorType::StorageType AllocatorStorage;
+};
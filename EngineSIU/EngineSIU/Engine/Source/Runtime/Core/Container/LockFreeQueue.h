@@ -0,0 +1,509 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <new>
+#include <utility>
+
+#include "Array.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformType.h"
+
+
+/** 동시성 Queue에 접근하는 Producer/Consumer 스레드 구성 */
+enum class EQueueMode : uint8
+{
+    /** Single-Producer, Single-Consumer */
+    Spsc,
+
+    /** Multiple-Producers, Single-Consumer */
+    Mpsc,
+
+    /** Multiple-Producers, Multiple-Consumers */
+    Mpmc,
+};
+
+
+/**
+ * 고정 크기 Ring Buffer 기반의 Lock-free Queue입니다.
+ * 생성 시점에 용량이 정해지며, 가득 차면 Enqueue가 false를 반환합니다. 실행 중에는 메모리를 할당하지 않습니다.
+ *
+ * - Spsc: Head/Tail만 사용하며, 상대 Index를 캐시해서 공유 캐시 라인 접근을 최소화합니다.
+ * - Mpsc/Mpmc: Slot마다 Sequence 번호를 두는 방식(Dmitry Vyukov)으로, Producer끼리는 CAS로 Slot을 예약합니다.
+ *   Mpsc의 Consumer는 CAS 없이 꺼냅니다.
+ *
+ * @tparam T 저장할 요소의 타입
+ * @tparam Mode Producer/Consumer 구성, 지정한 것보다 많은 스레드에서 접근하면 안됩니다.
+ */
+template <typename T, EQueueMode Mode = EQueueMode::Mpmc>
+class TBoundedQueue
+{
+public:
+    using ElementType = T;
+
+    /** @param InCapacity 최대 요소 개수, 2의 거듭제곱으로 올림됩니다. */
+    explicit TBoundedQueue(uint32 InCapacity)
+    {
+        Capacity = std::bit_ceil(std::max<uint32>(InCapacity, 2));
+        IndexMask = Capacity - 1;
+
+        Cells = static_cast<FCell*>(FPlatformMemory::AlignedMalloc<EAT_Container>(sizeof(FCell) * Capacity, alignof(FCell)));
+        for (uint32 Index = 0; Index < Capacity; ++Index)
+        {
+            new (&Cells[Index]) FCell;
+            Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+        }
+    }
+
+    ~TBoundedQueue()
+    {
+        // 소멸 시점에는 다른 스레드가 접근하지 않으므로, Head부터 Tail까지 남은 요소를 파괴합니다.
+        const uint64 LastPos = Tail.Value.load(std::memory_order_relaxed);
+        for (uint64 Pos = Head.Value.load(std::memory_order_relaxed); Pos < LastPos; ++Pos)
+        {
+            Cells[Pos & IndexMask].GetItem()->~ElementType();
+        }
+
+        for (uint32 Index = 0; Index < Capacity; ++Index)
+        {
+            Cells[Index].~FCell();
+        }
+        FPlatformMemory::AlignedFree<EAT_Container>(Cells, sizeof(FCell) * Capacity);
+    }
+
+    TBoundedQueue(const TBoundedQueue&) = delete;
+    TBoundedQueue& operator=(const TBoundedQueue&) = delete;
+    TBoundedQueue(TBoundedQueue&&) = delete;
+    TBoundedQueue& operator=(TBoundedQueue&&) = delete;
+
+public:
+    /**
+     * Queue의 맨 뒤에 요소를 생성합니다.
+     * @return Queue가 가득 찼으면 false
+     */
+    template <typename... ArgsType>
+    bool Enqueue(ArgsType&&... Args)
+    {
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            const uint64 Pos = Tail.Value.load(std::memory_order_relaxed);
+            if (Pos - CachedHead >= Capacity)
+            {
+                CachedHead = Head.Value.load(std::memory_order_acquire);
+                if (Pos - CachedHead >= Capacity)
+                {
+                    return false;
+                }
+            }
+
+            new (Cells[Pos & IndexMask].GetItem()) ElementType(std::forward<ArgsType>(Args)...);
+            Tail.Value.store(Pos + 1, std::memory_order_release);
+            return true;
+        }
+        else
+        {
+            FCell* Cell;
+            uint64 Pos = Tail.Value.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell = &Cells[Pos & IndexMask];
+                const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+                const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+                if (Diff == 0)
+                {
+                    // 비어있는 Slot, 다른 Producer보다 먼저 예약합니다.
+                    if (Tail.Value.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (Diff < 0)
+                {
+                    // Consumer가 아직 비우지 않은 Slot, Queue가 가득 찼습니다.
+                    return false;
+                }
+                else
+                {
+                    Pos = Tail.Value.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (Cell->GetItem()) ElementType(std::forward<ArgsType>(Args)...);
+            Cell->Sequence.store(Pos + 1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    /**
+     * Queue의 맨 앞 요소를 꺼냅니다.
+     * @return Queue가 비어있으면 false, OutItem은 변경되지 않습니다.
+     */
+    bool Dequeue(ElementType& OutItem)
+    {
+        return DequeueWith([&OutItem](ElementType& Item)
+        {
+            OutItem = std::move(Item);
+        });
+    }
+
+    /**
+     * 최대 MaxItems개의 요소를 한 번에 꺼내 OutItems 뒤에 추가합니다.
+     * Spsc는 공유 Index를 한 번만 읽고 한 번만 갱신합니다.
+     * @return 꺼낸 요소의 개수
+     */
+    int32 DequeueBatch(TArray<ElementType>& OutItems, int32 MaxItems = INT32_MAX)
+    {
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            const uint64 Pos = Head.Value.load(std::memory_order_relaxed);
+            CachedTail = Tail.Value.load(std::memory_order_acquire);
+            const int32 NumItems = static_cast<int32>(std::min<uint64>(CachedTail - Pos, static_cast<uint64>(MaxItems)));
+
+            OutItems.Reserve(OutItems.Num() + NumItems);
+            for (int32 Offset = 0; Offset < NumItems; ++Offset)
+            {
+                ElementType* Item = Cells[(Pos + Offset) & IndexMask].GetItem();
+                OutItems.Add(std::move(*Item));
+                Item->~ElementType();
+            }
+
+            Head.Value.store(Pos + NumItems, std::memory_order_release);
+            return NumItems;
+        }
+        else
+        {
+            int32 NumItems = 0;
+            while (NumItems < MaxItems && DequeueWith([&OutItems](ElementType& Item) { OutItems.Add(std::move(Item)); }))
+            {
+                ++NumItems;
+            }
+            return NumItems;
+        }
+    }
+
+    /** 요소가 없는지 확인합니다. 다른 스레드가 동시에 접근 중이라면 근사값입니다. */
+    [[nodiscard]] bool IsEmpty() const { return Num() == 0; }
+
+    /** 요소의 개수, 다른 스레드가 동시에 접근 중이라면 근사값입니다. */
+    uint32 Num() const
+    {
+        const uint64 CurrentHead = Head.Value.load(std::memory_order_acquire);
+        const uint64 CurrentTail = Tail.Value.load(std::memory_order_acquire);
+        return CurrentTail > CurrentHead ? static_cast<uint32>(CurrentTail - CurrentHead) : 0;
+    }
+
+    uint32 Max() const { return Capacity; }
+
+private:
+    /** 맨 앞 요소를 예약해 Consume(Item)에 넘긴 뒤 파괴합니다. */
+    template <typename FuncType>
+    bool DequeueWith(FuncType&& Consume)
+    {
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            const uint64 Pos = Head.Value.load(std::memory_order_relaxed);
+            if (Pos == CachedTail)
+            {
+                CachedTail = Tail.Value.load(std::memory_order_acquire);
+                if (Pos == CachedTail)
+                {
+                    return false;
+                }
+            }
+
+            ElementType* Item = Cells[Pos & IndexMask].GetItem();
+            Consume(*Item);
+            Item->~ElementType();
+            Head.Value.store(Pos + 1, std::memory_order_release);
+            return true;
+        }
+        else
+        {
+            FCell* Cell;
+            uint64 Pos = Head.Value.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell = &Cells[Pos & IndexMask];
+                const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+                const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos + 1);
+                if (Diff < 0)
+                {
+                    return false;
+                }
+
+                if constexpr (Mode == EQueueMode::Mpsc)
+                {
+                    // Consumer가 하나뿐이므로 Diff는 항상 0입니다.
+                    Head.Value.store(Pos + 1, std::memory_order_relaxed);
+                    break;
+                }
+                else
+                {
+                    if (Diff == 0)
+                    {
+                        if (Head.Value.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        Pos = Head.Value.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            ElementType* Item = Cell->GetItem();
+            Consume(*Item);
+            Item->~ElementType();
+
+            // 한 바퀴 뒤의 Producer가 사용할 수 있도록 Sequence를 넘겨줍니다.
+            Cell->Sequence.store(Pos + Capacity, std::memory_order_release);
+            return true;
+        }
+    }
+
+
+    struct FCell
+    {
+        /** Mpsc/Mpmc에서 Slot의 상태를 나타내는 번호 (Spsc에서는 사용하지 않음) */
+        std::atomic<uint64> Sequence;
+        alignas(ElementType) uint8 Storage[sizeof(ElementType)];
+
+        ElementType* GetItem() { return reinterpret_cast<ElementType*>(Storage); }
+    };
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FPaddedIndex
+    {
+        std::atomic<uint64> Value = 0;
+    };
+
+    FCell* Cells = nullptr;
+    uint32 Capacity = 0;
+    uint32 IndexMask = 0;
+
+    /** Consumer가 다음에 꺼낼 위치 */
+    FPaddedIndex Head;
+
+    /** Producer가 다음에 넣을 위치 */
+    FPaddedIndex Tail;
+
+    /** Spsc 전용, Producer가 마지막으로 읽은 Head */
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint64 CachedHead = 0;
+
+    /** Spsc 전용, Consumer가 마지막으로 읽은 Tail */
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint64 CachedTail = 0;
+};
+
+
+/**
+ * 연결 리스트 기반의 크기 제한이 없는 Lock-free Queue입니다. (Dmitry Vyukov의 Intrusive MPSC/Unbounded SPSC 방식)
+ *
+ * - Spsc/Mpsc만 지원합니다. 여러 Consumer가 Node를 안전하게 해제하려면 Hazard Pointer 같은 메모리 회수 기법이 필요하므로,
+ *   Mpmc가 필요하다면 TBoundedQueue를 사용해야 합니다.
+ * - Spsc는 Consumer가 지나간 Node를 Producer가 재사용하므로, 최대 사용량만큼 할당된 뒤에는 메모리를 할당하지 않습니다.
+ * - Mpsc는 Enqueue마다 Node 하나를 할당하고, Consumer가 꺼낼 때 해제합니다.
+ * - Producer는 Wait-free이며, Consumer는 Enqueue가 완료되지 않은 요소를 잠시 보지 못할 수 있지만 유실되지는 않습니다.
+ *
+ * @tparam T 저장할 요소의 타입
+ * @tparam Mode Producer/Consumer 구성
+ */
+template <typename T, EQueueMode Mode = EQueueMode::Mpsc>
+class TLockFreeQueue
+{
+    static_assert(Mode != EQueueMode::Mpmc, "TLockFreeQueue는 Mpmc를 지원하지 않습니다. TBoundedQueue를 사용하세요.");
+
+public:
+    using ElementType = T;
+
+    TLockFreeQueue()
+    {
+        FNode* Stub = NewNode();
+        Head.Value.store(Stub, std::memory_order_relaxed);
+        Tail.store(Stub, std::memory_order_relaxed);
+        FirstFree = Stub;
+        CachedTail = Stub;
+    }
+
+    ~TLockFreeQueue()
+    {
+        FNode* Stub = Tail.load(std::memory_order_relaxed);
+
+        // Spsc는 Stub 앞쪽에 재사용 대기 중인 Node가 남아있습니다.
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            while (FirstFree != Stub)
+            {
+                FNode* Next = FirstFree->Next.load(std::memory_order_relaxed);
+                DeleteNode(FirstFree);
+                FirstFree = Next;
+            }
+        }
+
+        // Stub을 제외한 Node는 모두 요소를 가지고 있습니다.
+        FNode* Node = Stub->Next.load(std::memory_order_relaxed);
+        DeleteNode(Stub);
+        while (Node)
+        {
+            FNode* Next = Node->Next.load(std::memory_order_relaxed);
+            Node->GetItem()->~ElementType();
+            DeleteNode(Node);
+            Node = Next;
+        }
+    }
+
+    TLockFreeQueue(const TLockFreeQueue&) = delete;
+    TLockFreeQueue& operator=(const TLockFreeQueue&) = delete;
+    TLockFreeQueue(TLockFreeQueue&&) = delete;
+    TLockFreeQueue& operator=(TLockFreeQueue&&) = delete;
+
+public:
+    /** Queue의 맨 뒤에 요소를 생성합니다. 항상 성공합니다. */
+    template <typename... ArgsType>
+    bool Enqueue(ArgsType&&... Args)
+    {
+        FNode* Node = AcquireNode();
+        new (Node->GetItem()) ElementType(std::forward<ArgsType>(Args)...);
+
+        FNode* PrevHead;
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            PrevHead = Head.Value.load(std::memory_order_relaxed);
+            Head.Value.store(Node, std::memory_order_relaxed);
+        }
+        else
+        {
+            PrevHead = Head.Value.exchange(Node, std::memory_order_acq_rel);
+        }
+
+        // 이 시점 이후 Consumer가 Node를 볼 수 있습니다.
+        PrevHead->Next.store(Node, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Queue의 맨 앞 요소를 꺼냅니다. Consumer 스레드에서만 호출해야 합니다.
+     * @return Queue가 비어있으면 false
+     */
+    bool Dequeue(ElementType& OutItem)
+    {
+        return DequeueWith([&OutItem](ElementType& Item)
+        {
+            OutItem = std::move(Item);
+        });
+    }
+
+    /**
+     * 최대 MaxItems개의 요소를 한 번에 꺼내 OutItems 뒤에 추가합니다. Consumer 스레드에서만 호출해야 합니다.
+     * @return 꺼낸 요소의 개수
+     */
+    int32 DequeueBatch(TArray<ElementType>& OutItems, int32 MaxItems = INT32_MAX)
+    {
+        int32 NumItems = 0;
+        while (NumItems < MaxItems && DequeueWith([&OutItems](ElementType& Item) { OutItems.Add(std::move(Item)); }))
+        {
+            ++NumItems;
+        }
+        return NumItems;
+    }
+
+    /** 맨 앞 요소의 포인터를 반환합니다. Consumer 스레드에서만 호출해야 합니다. */
+    ElementType* Peek() const
+    {
+        FNode* Next = Tail.load(std::memory_order_relaxed)->Next.load(std::memory_order_acquire);
+        return Next ? Next->GetItem() : nullptr;
+    }
+
+    /** Consumer 스레드에서만 정확합니다. */
+    [[nodiscard]] bool IsEmpty() const
+    {
+        return Tail.load(std::memory_order_relaxed)->Next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct FNode
+    {
+        std::atomic<FNode*> Next = nullptr;
+        alignas(ElementType) uint8 Storage[sizeof(ElementType)];
+
+        ElementType* GetItem() { return reinterpret_cast<ElementType*>(Storage); }
+    };
+
+    /** 맨 앞 요소를 Consume(Item)에 넘긴 뒤 파괴합니다. */
+    template <typename FuncType>
+    bool DequeueWith(FuncType&& Consume)
+    {
+        FNode* Stub = Tail.load(std::memory_order_relaxed);
+        FNode* Next = Stub->Next.load(std::memory_order_acquire);
+        if (!Next)
+        {
+            return false;
+        }
+
+        // Next는 새로운 Stub이 되므로, 요소만 꺼내고 Node는 남겨둡니다.
+        ElementType* Item = Next->GetItem();
+        Consume(*Item);
+        Item->~ElementType();
+
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            // 이전 Stub은 Producer가 재사용합니다.
+            Tail.store(Next, std::memory_order_release);
+        }
+        else
+        {
+            Tail.store(Next, std::memory_order_relaxed);
+            DeleteNode(Stub);
+        }
+        return true;
+    }
+
+    /** Producer 스레드에서 Enqueue할 Node를 가져옵니다. */
+    FNode* AcquireNode()
+    {
+        if constexpr (Mode == EQueueMode::Spsc)
+        {
+            // FirstFree부터 Consumer의 Stub 직전까지는 이미 소비된 Node입니다.
+            if (FirstFree == CachedTail)
+            {
+                CachedTail = Tail.load(std::memory_order_acquire);
+            }
+            if (FirstFree != CachedTail)
+            {
+                FNode* Node = FirstFree;
+                FirstFree = FirstFree->Next.load(std::memory_order_relaxed);
+                Node->Next.store(nullptr, std::memory_order_relaxed);
+                return Node;
+            }
+        }
+        return NewNode();
+    }
+
+    static FNode* NewNode()
+    {
+        void* Memory = FPlatformMemory::AlignedMalloc<EAT_Container>(sizeof(FNode), alignof(FNode));
+        return new (Memory) FNode;
+    }
+
+    static void DeleteNode(FNode* Node)
+    {
+        Node->~FNode();
+        FPlatformMemory::AlignedFree<EAT_Container>(Node, sizeof(FNode));
+    }
+
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) FPaddedNodePtr
+    {
+        std::atomic<FNode*> Value = nullptr;
+    };
+
+    /** Producer가 마지막으로 추가한 Node */
+    FPaddedNodePtr Head;
+
+    /** Spsc 전용, Producer가 재사용할 첫 Node와 마지막으로 읽은 Tail */
+    FNode* FirstFree = nullptr;
+    FNode* CachedTail = nullptr;
+
+    /** Consumer가 마지막으로 꺼낸 Node (Stub), Tail->Next가 다음 요소입니다. */
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<FNode*> Tail = nullptr;
+};
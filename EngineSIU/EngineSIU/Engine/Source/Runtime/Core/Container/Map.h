@@ -1,73 +1,148 @@
 ﻿#pragma once
-#include <unordered_map>
+#include <cassert>
+#include <functional>
+#include <optional>
 
 #include "ContainerAllocator.h"
 #include "Pair.h"
+#include "Set.h"
 #include "Serialization/Archive.h"
 
 
+/** TMap이 내부 TSet에 TPair<Key, Value>를 저장할 때 사용하는 KeyFuncs, Pair의 Key만으로 비교/해싱합니다. */
+template <typename InKeyType, typename InValueType, typename Hasher = std::hash<InKeyType>>
+struct TDefaultMapKeyFuncs
+{
+    using KeyType = InKeyType;
+    using ElementType = TPair<InKeyType, InValueType>;
+
+    static FORCEINLINE const KeyType& GetSetKey(const ElementType& Element)
+    {
+        return Element.Key;
+    }
+
+    static FORCEINLINE bool Matches(const KeyType& A, const KeyType& B)
+    {
+        return A == B;
+    }
+
+    static FORCEINLINE size_t GetKeyHash(const KeyType& Key)
+    {
+        return Hasher()(Key);
+    }
+};
+
+
+/**
+ * Key-Value 쌍을 저장하는 Hash Map입니다.
+ * 내부적으로 TPair<Key, Value>를 Open Addressing 기반의 TSet에 저장합니다.
+ *
+ * @warning 삽입/삭제 시 Value의 메모리 위치가 바뀔 수 있으므로, Find나 operator[]로 얻은 포인터/참조를 보관하면 안됩니다.
+ */
 template <typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator<std::pair<const KeyType, ValueType>>>
 class TMap
 {
 public:
-    using PairType = TPair<const KeyType, ValueType>;
-    using MapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
-    using SizeType = typename MapType::size_type;
+    using ElementType = TPair<KeyType, ValueType>;
+    using KeyFuncs = TDefaultMapKeyFuncs<KeyType, ValueType>;
+    using ElementSetType = TSet<
+        ElementType,
+        std::hash<KeyType>,
+        typename TRebindContainerAllocator<Allocator, ElementType>::Type,
+        KeyFuncs
+    >;
+    using SizeType = typename ElementSetType::SizeType;
 
 private:
-    MapType ContainerPrivate;
+    ElementSetType Pairs;
 
-public:
-    class Iterator
+private:
+    /**
+     * Map을 순회할 때 *It가 돌려주는 Key-Value의 참조입니다.
+     * 저장된 TPair<Key, Value>를 TPair<const Key, Value>로 바꿔 보지 않고, Key는 const 참조로만 노출합니다.
+     * `auto& [Key, Value] : Map`처럼 참조로 받을 수 있도록 Iterator가 보관하며, 다음 역참조까지만 유효합니다.
+     */
+    template <typename InValueType>
+    struct TPairRef
     {
-    private:
-        typename MapType::iterator InnerIt;
-    public:
-        Iterator(typename MapType::iterator it) : InnerIt(std::move(it)) {}
-        PairType& operator*() { return reinterpret_cast<PairType&>(*InnerIt); }
-        PairType* operator->() { return reinterpret_cast<PairType*>(&(*InnerIt)); }
-        Iterator& operator++() { ++InnerIt; return *this; }
-        bool operator!=(const Iterator& other) const { return InnerIt != other.InnerIt; }
+        const KeyType& Key;
+        InValueType& Value;
     };
 
-    class ConstIterator
+    template <bool bConst>
+    class TBaseIterator
     {
     private:
-        typename MapType::const_iterator InnerIt;
+        using MapType = std::conditional_t<bConst, const TMap, TMap>;
+        using PairRefType = TPairRef<std::conditional_t<bConst, const ValueType, ValueType>>;
+
+        MapType* Map;
+        SizeType Id;
+        mutable std::optional<PairRefType> Current;
+
     public:
-        ConstIterator(typename MapType::const_iterator it) : InnerIt(it) {}
-        const PairType& operator*() const { return reinterpret_cast<const PairType&>(*InnerIt); }
-        const PairType* operator->() const { return reinterpret_cast<const PairType*>(&(*InnerIt)); }
-        ConstIterator& operator++() { ++InnerIt; return *this; }
-        bool operator!=(const ConstIterator& other) const { return InnerIt != other.InnerIt; }
+        TBaseIterator(MapType* InMap, SizeType InId) : Map(InMap), Id(InId) {}
+        TBaseIterator(const TBaseIterator& Other) : Map(Other.Map), Id(Other.Id) {}
+
+        TBaseIterator& operator=(const TBaseIterator& Other)
+        {
+            Map = Other.Map;
+            Id = Other.Id;
+            Current.reset();
+            return *this;
+        }
+
+        PairRefType& operator*() const
+        {
+            auto& Pair = GetPair();
+            Current.emplace(PairRefType{ Pair.Key, Pair.Value });
+            return *Current;
+        }
+
+        PairRefType* operator->() const { return &**this; }
+        TBaseIterator& operator++() { ++Id; return *this; }
+        bool operator==(const TBaseIterator& Other) const { return Map == Other.Map && Id == Other.Id; }
+        bool operator!=(const TBaseIterator& Other) const { return !(*this == Other); }
+
+    private:
+        auto& GetPair() const
+        {
+            if constexpr (bConst)
+            {
+                return Map->Pairs[Id];
+            }
+            else
+            {
+                return Map->Pairs.GetMutable(Id);
+            }
+        }
     };
 
 public:
-    // TPair를 반환하는 커스텀 반복자
-    Iterator begin() noexcept { return Iterator(ContainerPrivate.begin()); }
-    Iterator end() noexcept { return Iterator(ContainerPrivate.end()); }
-    ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.begin()); }
-    ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.end()); }
+    using Iterator = TBaseIterator<false>;
+    using ConstIterator = TBaseIterator<true>;
 
-    MapType& GetContainerPrivate() { return ContainerPrivate; }
-    const MapType& GetContainerPrivate() const { return ContainerPrivate; }
+    Iterator begin() noexcept { return Iterator(this, 0); }
+    Iterator end() noexcept { return Iterator(this, Num()); }
+    ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+    ConstIterator end() const noexcept { return ConstIterator(this, Num()); }
 
     // 생성자 및 소멸자
     TMap() = default;
     ~TMap() = default;
 
     // 복사 생성자
-    TMap(const TMap& Other) : ContainerPrivate(Other.ContainerPrivate) {}
+    TMap(const TMap& Other) : Pairs(Other.Pairs) {}
 
     // 이동 생성자
-    TMap(TMap&& Other) noexcept : ContainerPrivate(std::move(Other.ContainerPrivate)) {}
+    TMap(TMap&& Other) noexcept : Pairs(std::move(Other.Pairs)) {}
 
     // 복사 할당 연산자
     TMap& operator=(const TMap& Other)
     {
         if (this != &Other)
         {
-            ContainerPrivate = Other.ContainerPrivate;
+            Pairs = Other.Pairs;
         }
         return *this;
     }
@@ -77,7 +152,7 @@ public:
     {
         if (this != &Other)
         {
-            ContainerPrivate = std::move(Other.ContainerPrivate);
+            Pairs = std::move(Other.Pairs);
         }
         return *this;
     }
@@ -85,98 +160,133 @@ public:
     // 요소 접근 및 수정
     ValueType& operator[](const KeyType& Key)
     {
-        return ContainerPrivate[Key];
+        return FindOrAdd(Key);
     }
 
     const ValueType& operator[](const KeyType& Key) const
     {
-        return ContainerPrivate.at(Key);
+        const ValueType* Value = Find(Key);
+        assert(Value && "TMap::operator[] const: Key does not exist");
+        return *Value;
     }
 
+    /** Key가 이미 존재한다면 Value를 덮어씁니다. */
     void Add(const KeyType& Key, const ValueType& Value)
     {
-        ContainerPrivate.insert_or_assign(Key, Value);
+        const uint32 KeyHash = ElementSetType::HashKey(Key);
+        const SizeType Id = Pairs.FindIdByHash(KeyHash, Key);
+        if (Id != INDEX_NONE)
+        {
+            Pairs.GetMutable(Id).Value = Value;
+            return;
+        }
+        Pairs.EmplaceNewByHash(KeyHash, Key, Value);
     }
 
     /**
      * Map에 새로운 Key-Value를 삽입합니다.
      * @param InKey 삽입할 키
      * @param InValue 삽입할 값
-     * @return InValue의 참조
+     * @return InValue의 참조, 이미 Key가 존재한다면 기존 Value의 참조
      */
     template <typename InitKeyType = KeyType, typename InitValueType = ValueType>
     ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), std::forward<InitValueType>(InValue));
-        return result.first->second;
+        if constexpr (std::is_same_v<std::decay_t<InitKeyType>, KeyType>)
+        {
+            const uint32 KeyHash = ElementSetType::HashKey(InKey);
+            SizeType Id = Pairs.FindIdByHash(KeyHash, InKey);
+            if (Id == INDEX_NONE)
+            {
+                Id = Pairs.EmplaceNewByHash(
+                    KeyHash,
+                    KeyType(std::forward<InitKeyType>(InKey)),
+                    ValueType(std::forward<InitValueType>(InValue))
+                );
+            }
+            return Pairs.GetMutable(Id).Value;
+        }
+        else
+        {
+            // const char* -> FString 처럼 변환이 필요한 경우, Key를 한 번만 생성
+            return Emplace(KeyType(std::forward<InitKeyType>(InKey)), std::forward<InitValueType>(InValue));
+        }
     }
 
     // Key만 넣고, Value는 기본값으로 삽입
     template <typename InitKeyType = KeyType>
     ValueType& Emplace(InitKeyType&& InKey)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), ValueType{});
-        return result.first->second;
+        if constexpr (std::is_same_v<std::decay_t<InitKeyType>, KeyType>)
+        {
+            const uint32 KeyHash = ElementSetType::HashKey(InKey);
+            SizeType Id = Pairs.FindIdByHash(KeyHash, InKey);
+            if (Id == INDEX_NONE)
+            {
+                Id = Pairs.EmplaceNewByHash(KeyHash, KeyType(std::forward<InitKeyType>(InKey)), ValueType{});
+            }
+            return Pairs.GetMutable(Id).Value;
+        }
+        else
+        {
+            return Emplace(KeyType(std::forward<InitKeyType>(InKey)));
+        }
     }
 
-    void Remove(const KeyType& Key)
+    /** @return 제거된 요소의 개수 */
+    SizeType Remove(const KeyType& Key)
     {
-        ContainerPrivate.erase(Key);
+        return Pairs.Remove(Key);
     }
 
     void Empty()
     {
-        ContainerPrivate.clear();
+        Pairs.Empty();
     }
 
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        Pairs.Empty(Number);
     }
 
     // 검색 및 조회
     bool Contains(const KeyType& Key) const
     {
-        return ContainerPrivate.contains(Key);
+        return Pairs.Contains(Key);
     }
 
     const ValueType* Find(const KeyType& Key) const
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const ElementType* Pair = Pairs.Find(Key);
+        return Pair ? &Pair->Value : nullptr;
     }
 
     ValueType* Find(const KeyType& Key)
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const SizeType Id = Pairs.FindId(Key);
+        return Id != INDEX_NONE ? &Pairs.GetMutable(Id).Value : nullptr;
     }
 
     ValueType& FindOrAdd(const KeyType& Key)
     {
-        if (ValueType* Value = Find(Key))
-        {
-            return *Value;
-        }
         return Emplace(Key);
     }
 
     // 크기 관련
     SizeType Num() const
     {
-        return ContainerPrivate.size();
+        return Pairs.Num();
     }
 
     bool IsEmpty() const
     {
-        return ContainerPrivate.empty();
+        return Pairs.IsEmpty();
     }
 
     // 용량 관련
     void Reserve(SizeType Number)
     {
-        ContainerPrivate.reserve(Number);
+        Pairs.Reserve(Number);
     }
 };
 
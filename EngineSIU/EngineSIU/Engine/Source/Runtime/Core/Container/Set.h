@@ -1,69 +1,228 @@
 ﻿#pragma once
-#include <unordered_set>
+#include <algorithm>
+#include <bit>
+#include <functional>
 
 #include "Array.h"
 #include "ContainerAllocator.h"
 
 
-template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
+/**
+ * TSet에서 Element로부터 Key를 얻고, Key를 비교/해싱하는 방법을 정의합니다.
+ * 기본적으로 Element 자체가 Key로 사용됩니다.
+ *
+ * @tparam ElementType Set에 저장되는 타입
+ * @tparam Hasher Key의 Hash를 계산하는 함수 객체
+ */
+template <typename ElementType, typename Hasher = std::hash<ElementType>>
+struct TDefaultSetKeyFuncs
+{
+    using KeyType = ElementType;
+
+    static FORCEINLINE const KeyType& GetSetKey(const ElementType& Element)
+    {
+        return Element;
+    }
+
+    static FORCEINLINE bool Matches(const KeyType& A, const KeyType& B)
+    {
+        return A == B;
+    }
+
+    static FORCEINLINE size_t GetKeyHash(const KeyType& Key)
+    {
+        return Hasher()(Key);
+    }
+};
+
+
+/**
+ * TSet의 Bucket 배열이 사용할 Allocator
+ * Inline Allocator라면, Inline Element 개수만큼 삽입하는 동안 Bucket도 Heap으로 넘어가지 않도록 Inline Bucket 개수를 맞춥니다.
+ */
+template <typename Allocator>
+struct TSetBucketAllocator
+{
+    using Type = Allocator;
+};
+
+template <int32 NumInlineElements, int IndexSize>
+struct TSetBucketAllocator<TInlineAllocator<NumInlineElements, IndexSize>>
+{
+    // Load Factor 0.5, 최소 Bucket 개수 8 (TSet::MinNumBuckets)
+    static constexpr int32 NumInlineBuckets = static_cast<int32>(std::bit_ceil(static_cast<uint32>(std::max(NumInlineElements * 2, 8))));
+
+    using Type = TInlineAllocator<NumInlineBuckets, IndexSize>;
+};
+
+
+/**
+ * Open Addressing 기반의 Hash Set입니다.
+ *
+ * Element는 TArray에 빈틈없이(dense) 저장되고, 별도의 Bucket 배열이 Element의 Index를 가리킵니다.
+ * - 삽입시 Element 하나당 노드를 할당하지 않으며, 반환되는 Index는 Element 배열의 Index입니다.
+ * - 충돌은 Linear Probing으로 처리하고, 삭제는 Backward Shift로 처리하여 Tombstone이 남지 않습니다.
+ * - Element를 제거하면 마지막 Element가 빈 자리로 이동하므로, 제거 이후에는 Index와 순회 순서가 바뀔 수 있습니다.
+ *
+ * @tparam T 저장할 Element의 타입
+ * @tparam Hasher Key의 Hash를 계산하는 함수 객체 (KeyFuncs가 기본값일 때 사용)
+ * @tparam Allocator Element와 Bucket에 사용할 Allocator 또는 TInlineAllocator<N> 같은 Allocator Policy
+ * @tparam KeyFuncs Element에서 Key를 얻고 비교/해싱하는 방법
+ *
+ * @warning 삽입/삭제 시 Element의 메모리 위치가 바뀔 수 있으므로, Element의 포인터나 참조를 보관하면 안됩니다.
+ */
+template <
+    typename T,
+    typename Hasher = std::hash<T>,
+    typename Allocator = FDefaultAllocator<T>,
+    typename KeyFuncs = TDefaultSetKeyFuncs<T, Hasher>
+>
 class TSet
 {
-private:
-    using SetType = std::unordered_set<T, Hasher, std::equal_to<>, Allocator>;
+public:
     using ElementType = T;
+    using KeyType = typename KeyFuncs::KeyType;
+    using SizeType = typename TResolveContainerAllocator<Allocator, T>::Type::SizeType;
 
-    SetType ContainerPrivate;
+private:
+    template <typename U>
+    using TRebindAllocator = typename TRebindContainerAllocator<Allocator, U>::Type;
 
-public:
-    using SizeType = typename Allocator::SizeType;
-    using Iterator = typename SetType::iterator;
-    using ConstIterator = typename SetType::const_iterator;
+    using ElementArrayType = TArray<ElementType, TRebindAllocator<ElementType>>;
+    using IndexArrayType = TArray<SizeType, typename TSetBucketAllocator<TRebindAllocator<SizeType>>::Type>;
+    using HashArrayType = TArray<uint32, TRebindAllocator<uint32>>;
+
+    /** 최소 Bucket 개수, 반드시 2의 거듭제곱 */
+    static constexpr SizeType MinNumBuckets = 8;
+
+    /** Element 배열, 삽입 순서대로 빈틈없이 저장됩니다. */
+    ElementArrayType Elements;
 
-    SetType& GetContainerPrivate() { return ContainerPrivate; }
-    const SetType& GetContainerPrivate() const { return ContainerPrivate; }
+    /** Elements와 같은 Index에 해당 Element의 Hash를 저장합니다. (Rehash 및 비교 시 재계산 방지) */
+    HashArrayType ElementHashes;
+
+    /** Element의 Index를 담는 Open Addressing 테이블, 비어있는 Bucket은 INDEX_NONE */
+    IndexArrayType Buckets;
+
+public:
+    using ConstIterator = decltype(std::declval<const ElementArrayType&>().begin());
 
     // 기본 생성자
     TSet() = default;
 
-    // Iterator 관련 메서드
-    Iterator begin() noexcept { return ContainerPrivate.begin(); }
-    Iterator end() noexcept { return ContainerPrivate.end(); }
-    ConstIterator begin() const noexcept { return ContainerPrivate.begin(); }
-    ConstIterator end() const noexcept { return ContainerPrivate.end(); }
+    TSet(std::initializer_list<ElementType> InitList)
+    {
+        Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Emplace(Element);
+        }
+    }
+
+    // Iterator 관련 메서드, Key를 바꾸면 Bucket의 위치가 맞지 않게 되므로 Element는 const로만 순회합니다.
+    ConstIterator begin() const noexcept { return Elements.begin(); }
+    ConstIterator end() const noexcept { return Elements.end(); }
 
     // Add
-    int32 Add(const T& Item) { return Emplace(Item); }
-    int32 Add(T&& Item) { return Emplace(std::move(Item)); }
+    SizeType Add(const ElementType& Item) { return Emplace(Item); }
+    SizeType Add(ElementType&& Item) { return Emplace(std::move(Item)); }
 
     /**
      * r-value를 받아 값을 새로 만들어 Set에 추가합니다.
      * @tparam ArgsType TSet<T>의 T부분
      * @param Args Set에 추가될 인자 (r-value)
+     * @param bIsAlreadyInSetPtr nullptr이 아니라면, 이미 Set에 존재했는지 여부가 저장됩니다.
      * @return 새로 추가된 Element의 Index, 이미 존재하는 경우 기존 Element의 Index를 반환
      */
-    template<typename ArgsType = T>
-    int32 Emplace(ArgsType&& Args) 
-    { 
-        auto iter = ContainerPrivate.emplace(std::forward<ArgsType>(Args));
-        return std::distance(ContainerPrivate.begin(), iter.first);
+    template <typename ArgsType = ElementType>
+    SizeType Emplace(ArgsType&& Args, bool* bIsAlreadyInSetPtr = nullptr)
+    {
+        ElementType Element(std::forward<ArgsType>(Args));
+        const uint32 KeyHash = HashKey(KeyFuncs::GetSetKey(Element));
+
+        const SizeType ExistingId = FindIdByHash(KeyHash, KeyFuncs::GetSetKey(Element));
+        if (bIsAlreadyInSetPtr)
+        {
+            *bIsAlreadyInSetPtr = ExistingId != INDEX_NONE;
+        }
+        if (ExistingId != INDEX_NONE)
+        {
+            return ExistingId;
+        }
+        return EmplaceNewByHash(KeyHash, std::move(Element));
+    }
+
+    /**
+     * Key가 Set에 없다는 것이 보장될 때, Hash를 재계산하지 않고 Element를 추가합니다.
+     * @param KeyHash HashKey()로 계산된 Key의 Hash
+     * @param Args Element의 생성자 인자
+     * @return 새로 추가된 Element의 Index
+     */
+    template <typename... ArgsType>
+    SizeType EmplaceNewByHash(uint32 KeyHash, ArgsType&&... Args)
+    {
+        ReserveBuckets(Num() + 1);
+
+        const SizeType NewId = Elements.Emplace(std::forward<ArgsType>(Args)...);
+        ElementHashes.Add(KeyHash);
+        LinkElement(NewId, KeyHash);
+        return NewId;
     }
 
     // Num (개수)
-    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
+    SizeType Num() const { return Elements.Num(); }
+
+    /**
+     * Key와 일치하는 Element의 Index를 찾습니다.
+     * @return Element의 Index, 찾을 수 없다면 INDEX_NONE
+     */
+    SizeType FindId(const KeyType& Key) const
+    {
+        return FindIdByHash(HashKey(Key), Key);
+    }
+
+    /** 미리 계산된 Hash로 Element의 Index를 찾습니다. */
+    SizeType FindIdByHash(uint32 KeyHash, const KeyType& Key) const
+    {
+        if (Buckets.IsEmpty())
+        {
+            return INDEX_NONE;
+        }
+
+        const uint32 BucketMask = static_cast<uint32>(Buckets.Num()) - 1;
+        for (uint32 Bucket = KeyHash & BucketMask; ; Bucket = (Bucket + 1) & BucketMask)
+        {
+            const SizeType Id = Buckets[Bucket];
+            if (Id == INDEX_NONE)
+            {
+                return INDEX_NONE;
+            }
+            if (ElementHashes[Id] == KeyHash && KeyFuncs::Matches(KeyFuncs::GetSetKey(Elements[Id]), Key))
+            {
+                return Id;
+            }
+        }
+    }
+
+    /** Index로 Element를 가져옵니다. */
+    const ElementType& operator[](SizeType Id) const { return Elements[Id]; }
 
     // Find
-    Iterator Find(const T& Item) { return ContainerPrivate.find(Item); }
-    ConstIterator Find(const T& Item) const { return ContainerPrivate.find(Item); }
+    const ElementType* Find(const KeyType& Key) const
+    {
+        const SizeType Id = FindId(Key);
+        return Id != INDEX_NONE ? &Elements[Id] : nullptr;
+    }
 
     // Contains
-    bool Contains(const T& Item) const { return ContainerPrivate.contains(Item); }
+    bool Contains(const KeyType& Key) const { return FindId(Key) != INDEX_NONE; }
 
     // Array (TArray로 반환)
-    TArray<T, Allocator> Array() const
+    TArray<ElementType, Allocator> Array() const
     {
-        TArray<T, Allocator> Result;
+        TArray<ElementType, Allocator> Result;
         Result.Reserve(Num());
-        for (const auto& Item : ContainerPrivate)
+        for (const ElementType& Item : Elements)
         {
             Result.Add(Item);
         }
@@ -71,24 +230,157 @@ public:
     }
 
     // Remove
-    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.erase(Item)); }
+    SizeType Remove(const KeyType& Key)
+    {
+        const SizeType Id = FindId(Key);
+        if (Id == INDEX_NONE)
+        {
+            return 0;
+        }
+        RemoveById(Id);
+        return 1;
+    }
+
+    /**
+     * Index에 해당하는 Element를 제거합니다.
+     * 마지막 Element가 제거된 자리로 이동하므로, 마지막 Element의 Index가 Id로 바뀝니다.
+     */
+    void RemoveById(SizeType Id)
+    {
+        assert(Elements.IsValidIndex(Id));
+
+        UnlinkElement(Id);
+
+        const SizeType LastId = Num() - 1;
+        if (Id != LastId)
+        {
+            // 마지막 Element를 빈 자리로 옮기고, 해당 Element를 가리키던 Bucket을 갱신
+            Buckets[FindBucketOfId(LastId)] = Id;
+            Elements[Id] = std::move(Elements[LastId]);
+            ElementHashes[Id] = ElementHashes[LastId];
+        }
+        Elements.RemoveAt(LastId);
+        ElementHashes.RemoveAt(LastId);
+    }
 
     // Empty
-    void Empty() { ContainerPrivate.clear(); }
+    void Empty()
+    {
+        Elements.Empty();
+        ElementHashes.Empty();
+        Buckets.Empty();
+    }
+
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        Elements.Empty(Number);
+        ElementHashes.Empty(Number);
+        Buckets.Empty();
+        ReserveBuckets(Number);
+    }
+
+    /** Number개의 Element를 재할당 없이 담을 수 있도록 공간을 확보합니다. */
+    void Reserve(SizeType Number)
+    {
+        Elements.Reserve(Number);
+        ElementHashes.Reserve(Number);
+        ReserveBuckets(Number);
     }
 
     // IsEmpty
-    bool IsEmpty() const { return ContainerPrivate.empty(); }
+    bool IsEmpty() const { return Elements.IsEmpty(); }
+
+    /**
+     * Key의 Hash를 계산합니다.
+     * std::hash는 정수나 포인터에 대해 항등 함수인 경우가 많으므로, Fibonacci Hashing으로 상위 비트를 섞어서 사용합니다.
+     */
+    static FORCEINLINE uint32 HashKey(const KeyType& Key)
+    {
+        const uint64 Hash = static_cast<uint64>(KeyFuncs::GetKeyHash(Key));
+        return static_cast<uint32>((Hash * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+private:
+    /** TMap은 Key를 제외한 Value만 수정하므로, 수정 가능한 Element에 접근할 수 있습니다. */
+    template <typename, typename, typename>
+    friend class TMap;
+
+    ElementType& GetMutable(SizeType Id) { return Elements[Id]; }
+
+    /** Number개의 Element를 Load Factor 0.5 이하로 담을 수 있도록 Bucket을 늘립니다. */
+    void ReserveBuckets(SizeType Number)
+    {
+        if (Number * 2 <= Buckets.Num())
+        {
+            return;
+        }
+
+        SizeType NewNumBuckets = std::max(Buckets.Num(), MinNumBuckets);
+        while (NewNumBuckets < Number * 2)
+        {
+            NewNumBuckets *= 2;
+        }
+        Rehash(NewNumBuckets);
+    }
+
+    void Rehash(SizeType NewNumBuckets)
+    {
+        Buckets.Init(INDEX_NONE, NewNumBuckets);
+        for (SizeType Id = 0; Id < Num(); ++Id)
+        {
+            LinkElement(Id, ElementHashes[Id]);
+        }
+    }
+
+    /** Hash에서 시작하여 처음 만나는 빈 Bucket에 Id를 저장합니다. */
+    void LinkElement(SizeType Id, uint32 KeyHash)
+    {
+        const uint32 BucketMask = static_cast<uint32>(Buckets.Num()) - 1;
+        uint32 Bucket = KeyHash & BucketMask;
+        while (Buckets[Bucket] != INDEX_NONE)
+        {
+            Bucket = (Bucket + 1) & BucketMask;
+        }
+        Buckets[Bucket] = Id;
+    }
+
+    /** Id를 가리키는 Bucket의 위치를 찾습니다. */
+    uint32 FindBucketOfId(SizeType Id) const
+    {
+        const uint32 BucketMask = static_cast<uint32>(Buckets.Num()) - 1;
+        uint32 Bucket = ElementHashes[Id] & BucketMask;
+        while (Buckets[Bucket] != Id)
+        {
+            Bucket = (Bucket + 1) & BucketMask;
+        }
+        return Bucket;
+    }
+
+    /** Id를 가리키는 Bucket을 비우고, 뒤따르는 Bucket들을 당겨서 Probe 체인을 유지합니다. (Backward Shift Deletion) */
+    void UnlinkElement(SizeType Id)
+    {
+        const uint32 BucketMask = static_cast<uint32>(Buckets.Num()) - 1;
+        uint32 Hole = FindBucketOfId(Id);
+
+        for (uint32 Next = (Hole + 1) & BucketMask; Buckets[Next] != INDEX_NONE; Next = (Next + 1) & BucketMask)
+        {
+            // Next에 있는 Element의 원래 위치(Ideal)에서 Next까지의 거리가 Hole에서 Next까지의 거리보다 크거나 같다면
+            // Hole로 당겨와도 탐색 경로가 끊기지 않음
+            const uint32 Ideal = ElementHashes[Buckets[Next]] & BucketMask;
+            if (((Next - Ideal) & BucketMask) >= ((Next - Hole) & BucketMask))
+            {
+                Buckets[Hole] = Buckets[Next];
+                Hole = Next;
+            }
+        }
+        Buckets[Hole] = INDEX_NONE;
+    }
 };
 
-template <typename ElementType, typename Hasher, class Allocator>
-FArchive& operator<<(FArchive& Ar, TSet<ElementType, Hasher, Allocator>& Set)
+template <typename ElementType, typename Hasher, typename Allocator, typename KeyFuncs>
+FArchive& operator<<(FArchive& Ar, TSet<ElementType, Hasher, Allocator, KeyFuncs>& Set)
 {
-    using SizeType = typename TSet<ElementType, Hasher, Allocator>::SizeType;
+    using SizeType = typename TSet<ElementType, Hasher, Allocator, KeyFuncs>::SizeType;
 
     // 집합 크기 직렬화
     SizeType SetSize = Set.Num();
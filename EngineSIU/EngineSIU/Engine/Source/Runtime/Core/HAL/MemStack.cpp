@@ -0,0 +1,123 @@
+#include "MemStack.h"
+#include <algorithm>
+#include <cstring>
+
+#include "PlatformMemory.h"
+
+
+FMemStack& FMemStack::Get()
+{
+    thread_local FMemStack ThreadMemStack;
+    return ThreadMemStack;
+}
+
+FMemStack::~FMemStack()
+{
+    FreeChunkList(TopChunk);
+    FreeChunkList(UnusedChunks);
+}
+
+void FMemStack::Flush()
+{
+    assert(NumMarks == 0 && "FMemStack::Flush: FMemMark가 남아있는 상태에서 Flush할 수 없습니다.");
+
+    LastFrameBytesUsed = GetNumBytesUsed();
+
+#ifdef _DEBUG
+    // 프레임이 지난 메모리를 참조하는 버그를 찾기 쉽도록 사용한 영역을 덮어씁니다.
+    for (FChunk* Chunk = TopChunk; Chunk; Chunk = Chunk->Next)
+    {
+        const size_t UsedSize = (Chunk == TopChunk) ? static_cast<size_t>(Top - Chunk->GetData()) : Chunk->DataSize;
+        std::memset(Chunk->GetData(), 0xCD, UsedSize);
+    }
+#endif
+
+    FreeChunks(nullptr);
+    Top = nullptr;
+    End = nullptr;
+
+    // 한 프레임에 Chunk가 여러 개 필요했다면, 전부 해제하고 하나의 큰 Chunk로 다시 확보합니다.
+    if (CoalesceSize > 0)
+    {
+        SCOPED_MEMORY_TAG(MemStack);
+
+        FreeChunkList(UnusedChunks);
+        UnusedChunks = nullptr;
+        ReservedBytes = 0;
+
+        FChunk* Chunk = static_cast<FChunk*>(FPlatformMemory::Malloc<EAT_Container>(sizeof(FChunk) + CoalesceSize));
+        Chunk->Next = nullptr;
+        Chunk->DataSize = CoalesceSize;
+        UnusedChunks = Chunk;
+        ReservedBytes = CoalesceSize;
+
+        CoalesceSize = 0;
+    }
+}
+
+size_t FMemStack::GetNumBytesUsed() const
+{
+    size_t Result = 0;
+    for (FChunk* Chunk = TopChunk; Chunk; Chunk = Chunk->Next)
+    {
+        Result += (Chunk == TopChunk) ? static_cast<size_t>(Top - Chunk->GetData()) : Chunk->DataSize;
+    }
+    return Result;
+}
+
+void FMemStack::AllocateNewChunk(size_t MinSize)
+{
+    FChunk* Chunk = nullptr;
+    if (UnusedChunks && UnusedChunks->DataSize >= MinSize)
+    {
+        Chunk = UnusedChunks;
+        UnusedChunks = UnusedChunks->Next;
+    }
+    else
+    {
+        SCOPED_MEMORY_TAG(MemStack);
+
+        const size_t DataSize = std::max(MinSize, DefaultChunkSize);
+        Chunk = static_cast<FChunk*>(FPlatformMemory::Malloc<EAT_Container>(sizeof(FChunk) + DataSize));
+        Chunk->DataSize = DataSize;
+        ReservedBytes += DataSize;
+    }
+
+    Chunk->Next = TopChunk;
+    TopChunk = Chunk;
+    Top = Chunk->GetData();
+    End = Top + Chunk->DataSize;
+
+    // 두 번째 Chunk부터는 프레임 전체 사용량을 합쳐둡니다.
+    if (Chunk->Next)
+    {
+        size_t TotalSize = 0;
+        for (FChunk* Used = TopChunk; Used; Used = Used->Next)
+        {
+            TotalSize += Used->DataSize;
+        }
+        CoalesceSize = std::max(CoalesceSize, TotalSize);
+    }
+}
+
+void FMemStack::FreeChunks(FChunk* NewTopChunk)
+{
+    while (TopChunk != NewTopChunk)
+    {
+        FChunk* Chunk = TopChunk;
+        TopChunk = TopChunk->Next;
+
+        Chunk->Next = UnusedChunks;
+        UnusedChunks = Chunk;
+    }
+}
+
+void FMemStack::FreeChunkList(FChunk* Chunk)
+{
+    while (Chunk)
+    {
+        FChunk* Next = Chunk->Next;
+        FPlatformMemory::Free<EAT_Container>(Chunk, sizeof(FChunk) + Chunk->DataSize);
+        Chunk = Next;
+    }
+}
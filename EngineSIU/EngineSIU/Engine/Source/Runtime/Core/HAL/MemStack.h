@@ -0,0 +1,176 @@
+#pragma once
+#include <cassert>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 스레드마다 하나씩 존재하는 선형(Stack) Allocator입니다.
+ * Top 포인터를 밀어올리는 방식으로 할당하며, 개별 해제 대신 Frame 경계(Flush)나 FMemMark 범위에서 한 번에 되돌립니다.
+ *
+ * - Game Thread: FEngineLoop::Tick에서 매 프레임 Flush되므로, 한 프레임 안에서만 사용하는 임시 메모리에 사용합니다.
+ * - 그 외 Thread: Flush가 호출되지 않으므로, 반드시 FMemMark 범위 안에서만 할당해야 합니다.
+ *
+ * 사용한 Chunk는 해제하지 않고 재사용하므로, 워밍업 이후에는 Heap 할당이 발생하지 않습니다.
+ */
+class FMemStack
+{
+public:
+    /** Chunk 하나의 기본 크기 */
+    static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+    /** 현재 스레드의 FMemStack을 반환합니다. */
+    static FMemStack& Get();
+
+    FMemStack() = default;
+    ~FMemStack();
+
+    FMemStack(const FMemStack&) = delete;
+    FMemStack& operator=(const FMemStack&) = delete;
+    FMemStack(FMemStack&&) = delete;
+    FMemStack& operator=(FMemStack&&) = delete;
+
+public:
+    FORCEINLINE void* Alloc(size_t Size, size_t Alignment)
+    {
+        assert((bIsFrameScoped || NumMarks > 0) && "FMemStack: 프레임 경계가 없는 스레드에서는 FMemMark 범위 안에서만 할당할 수 있습니다.");
+        assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+
+        uint8* Result = AlignPtr(Top, Alignment);
+        if (Result + Size > End)
+        {
+            AllocateNewChunk(Size + Alignment);
+            Result = AlignPtr(Top, Alignment);
+        }
+        Top = Result + Size;
+        return Result;
+    }
+
+    /**
+     * 가장 마지막에 할당된 블록이라면 Top을 되돌리고, 그 외에는 아무것도 하지 않습니다.
+     * 나머지 메모리는 Flush나 FMemMark가 끝날 때 회수됩니다.
+     */
+    FORCEINLINE void Free(void* Ptr, size_t Size)
+    {
+        if (Ptr && static_cast<uint8*>(Ptr) + Size == Top)
+        {
+            Top = static_cast<uint8*>(Ptr);
+        }
+    }
+
+    /**
+     * 이 스택의 모든 할당을 되돌립니다.
+     * 이전 프레임에 여러 Chunk를 사용했다면, 다음 프레임에는 하나의 큰 Chunk로 합쳐서 사용합니다.
+     */
+    void Flush();
+
+    /** 이 스택을 매 프레임 Flush되는 스택으로 표시합니다. (Game Thread 전용) */
+    void SetFrameScoped(bool bInFrameScoped) { bIsFrameScoped = bInFrameScoped; }
+    bool IsFrameScoped() const { return bIsFrameScoped; }
+
+    /** 현재 할당되어 있는 바이트 수 */
+    size_t GetNumBytesUsed() const;
+
+    /** Chunk로 확보해둔 전체 바이트 수 */
+    size_t GetNumBytesReserved() const { return ReservedBytes; }
+
+    /** 가장 최근 Flush 이전 프레임에 사용한 바이트 수 */
+    size_t GetLastFrameBytesUsed() const { return LastFrameBytesUsed; }
+
+    int32 GetNumMarks() const { return NumMarks; }
+
+private:
+    friend class FMemMark;
+
+    struct FChunk
+    {
+        FChunk* Next;
+        size_t DataSize;
+
+        uint8* GetData() { return reinterpret_cast<uint8*>(this + 1); }
+    };
+
+    static FORCEINLINE uint8* AlignPtr(uint8* Ptr, size_t Alignment)
+    {
+        return reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(Ptr) + Alignment - 1) & ~(Alignment - 1));
+    }
+
+    /** MinSize 이상의 여유 공간을 가진 Chunk를 TopChunk로 설정합니다. */
+    void AllocateNewChunk(size_t MinSize);
+
+    /** TopChunk가 NewTopChunk가 될 때까지 사용중인 Chunk를 UnusedChunks로 되돌립니다. */
+    void FreeChunks(FChunk* NewTopChunk);
+
+    static void FreeChunkList(FChunk* Chunk);
+
+private:
+    uint8* Top = nullptr;
+    uint8* End = nullptr;
+
+    /** 사용중인 Chunk 목록, Next는 이전 Chunk를 가리킵니다. */
+    FChunk* TopChunk = nullptr;
+
+    /** 재사용을 위해 보관중인 Chunk 목록 */
+    FChunk* UnusedChunks = nullptr;
+
+    size_t ReservedBytes = 0;
+    size_t LastFrameBytesUsed = 0;
+
+    /** 이번 프레임에 여러 Chunk가 필요했다면, 다음 Flush에서 합칠 크기 */
+    size_t CoalesceSize = 0;
+
+    int32 NumMarks = 0;
+    bool bIsFrameScoped = false;
+};
+
+
+/**
+ * 생성 시점의 FMemStack 위치를 기억하고, 소멸 시 그 위치로 되돌립니다.
+ * Worker Thread에서 FMemStack을 사용하거나, 한 프레임 안에서 더 짧은 범위로 메모리를 회수할 때 사용합니다.
+ *
+ * @note FMemMark는 반드시 생성의 역순으로 소멸되어야 합니다.
+ */
+class FMemMark
+{
+public:
+    explicit FMemMark(FMemStack& InMem = FMemStack::Get())
+        : Mem(InMem)
+        , SavedTop(InMem.Top)
+        , SavedEnd(InMem.End)
+        , SavedChunk(InMem.TopChunk)
+    {
+        ++Mem.NumMarks;
+    }
+
+    ~FMemMark()
+    {
+        Pop();
+    }
+
+    FMemMark(const FMemMark&) = delete;
+    FMemMark& operator=(const FMemMark&) = delete;
+
+    void Pop()
+    {
+        if (bPopped)
+        {
+            return;
+        }
+        bPopped = true;
+
+        if (Mem.TopChunk != SavedChunk)
+        {
+            Mem.FreeChunks(SavedChunk);
+        }
+        Mem.Top = SavedTop;
+        Mem.End = SavedEnd;
+        --Mem.NumMarks;
+    }
+
+private:
+    FMemStack& Mem;
+    uint8* SavedTop;
+    uint8* SavedEnd;
+    FMemStack::FChunk* SavedChunk;
+    bool bPopped = false;
+};
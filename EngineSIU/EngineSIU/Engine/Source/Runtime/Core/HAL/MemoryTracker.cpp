@@ -0,0 +1,165 @@
+#include "MemoryTracker.h"
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+
+
+FMemoryTracker::FTagCounters FMemoryTracker::Counters[static_cast<size_t>(EMemoryTag::Count)];
+thread_local EMemoryTag FMemoryTracker::CurrentTag = EMemoryTag::Untagged;
+
+namespace
+{
+FILE* OpenReportFile(const char* FilePath)
+{
+    const std::filesystem::path Path(FilePath);
+    if (Path.has_parent_path())
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+    }
+
+    FILE* File = nullptr;
+    if (fopen_s(&File, FilePath, "w") != 0)
+    {
+        return nullptr;
+    }
+    return File;
+}
+}
+
+
+const char* FMemoryTracker::GetTagName(EMemoryTag Tag)
+{
+    switch (Tag)
+    {
+#define MEMORY_TAG_NAME(Tag) case EMemoryTag::Tag: return #Tag;
+    MEMORY_TAG_LIST(MEMORY_TAG_NAME)
+#undef MEMORY_TAG_NAME
+    default:
+        return "Unknown";
+    }
+}
+
+FMemoryTagStats FMemoryTracker::GetStats(EMemoryTag Tag)
+{
+    const FTagCounters& Counter = Counters[static_cast<size_t>(Tag)];
+
+    FMemoryTagStats Stats;
+    Stats.CurrentBytes = Counter.CurrentBytes.load(std::memory_order_relaxed);
+    Stats.PeakBytes = Counter.PeakBytes.load(std::memory_order_relaxed);
+    Stats.CurrentCount = Counter.CurrentCount.load(std::memory_order_relaxed);
+    Stats.TotalCount = Counter.TotalCount.load(std::memory_order_relaxed);
+    Stats.BudgetBytes = Counter.BudgetBytes.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+void FMemoryTracker::SetBudget(EMemoryTag Tag, uint64 BudgetBytes)
+{
+    Counters[static_cast<size_t>(Tag)].BudgetBytes.store(BudgetBytes, std::memory_order_relaxed);
+}
+
+void* FMemoryTracker::TagAllocation(void* Base, size_t Offset, size_t Size, EMemoryTag Tag)
+{
+    assert(Offset >= sizeof(FMemoryTagHeader));
+
+    uint8* Ptr = static_cast<uint8*>(Base) + Offset;
+    FMemoryTagHeader* Header = reinterpret_cast<FMemoryTagHeader*>(Ptr) - 1;
+    Header->Offset = static_cast<uint32>(Offset);
+    Header->Tag = Tag;
+
+    OnAlloc(Tag, Size);
+    return Ptr;
+}
+
+void* FMemoryTracker::UntagAllocation(void* Ptr, size_t Size)
+{
+    const FMemoryTagHeader* Header = static_cast<FMemoryTagHeader*>(Ptr) - 1;
+    assert(Header->Tag < EMemoryTag::Count && "FMemoryTracker: 손상되었거나 Tag가 없는 할당입니다.");
+
+    OnFree(Header->Tag, Size);
+    return static_cast<uint8*>(Ptr) - Header->Offset;
+}
+
+void FMemoryTracker::OnAlloc(EMemoryTag Tag, size_t Size)
+{
+    FTagCounters& Counter = Counters[static_cast<size_t>(Tag)];
+
+    const int64 NewBytes = Counter.CurrentBytes.fetch_add(static_cast<int64>(Size), std::memory_order_relaxed) + static_cast<int64>(Size);
+    Counter.CurrentCount.fetch_add(1, std::memory_order_relaxed);
+    Counter.TotalCount.fetch_add(1, std::memory_order_relaxed);
+
+    int64 Peak = Counter.PeakBytes.load(std::memory_order_relaxed);
+    while (NewBytes > Peak && !Counter.PeakBytes.compare_exchange_weak(Peak, NewBytes, std::memory_order_relaxed))
+    {
+    }
+}
+
+void FMemoryTracker::OnFree(EMemoryTag Tag, size_t Size)
+{
+    FTagCounters& Counter = Counters[static_cast<size_t>(Tag)];
+    Counter.CurrentBytes.fetch_sub(static_cast<int64>(Size), std::memory_order_relaxed);
+    Counter.CurrentCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool FMemoryTracker::DumpCsv(const char* FilePath)
+{
+    FILE* File = OpenReportFile(FilePath);
+    if (!File)
+    {
+        return false;
+    }
+
+    fprintf(File, "Tag,CurrentBytes,PeakBytes,CurrentCount,TotalCount,BudgetBytes,OverBudget\n");
+    for (size_t Index = 0; Index < static_cast<size_t>(EMemoryTag::Count); ++Index)
+    {
+        const EMemoryTag Tag = static_cast<EMemoryTag>(Index);
+        const FMemoryTagStats Stats = GetStats(Tag);
+        fprintf(
+            File, "%s,%lld,%lld,%lld,%llu,%llu,%d\n",
+            GetTagName(Tag), Stats.CurrentBytes, Stats.PeakBytes, Stats.CurrentCount,
+            Stats.TotalCount, Stats.BudgetBytes, Stats.IsOverBudget() ? 1 : 0
+        );
+    }
+
+    fclose(File);
+    return true;
+}
+
+bool FMemoryTracker::DumpLeakReport(const char* FilePath)
+{
+    FILE* File = OpenReportFile(FilePath);
+    if (!File)
+    {
+        return false;
+    }
+
+    int64 TotalBytes = 0;
+    int64 TotalCount = 0;
+
+    fprintf(File, "=== Memory Leak Report ===\n");
+    fprintf(File, "Allocations still alive at shutdown, grouped by memory tag.\n");
+    fprintf(File, "Engine-lifetime statics (class registry, name table, ...) are expected to remain.\n\n");
+
+    for (size_t Index = 0; Index < static_cast<size_t>(EMemoryTag::Count); ++Index)
+    {
+        const EMemoryTag Tag = static_cast<EMemoryTag>(Index);
+        const FMemoryTagStats Stats = GetStats(Tag);
+        if (Stats.CurrentCount == 0 && Stats.CurrentBytes == 0)
+        {
+            continue;
+        }
+
+        fprintf(
+            File, "%-12s %12lld Bytes in %8lld allocations (Peak %lld Bytes)%s\n",
+            GetTagName(Tag), Stats.CurrentBytes, Stats.CurrentCount, Stats.PeakBytes,
+            Stats.IsOverBudget() ? " [OVER BUDGET]" : ""
+        );
+        TotalBytes += Stats.CurrentBytes;
+        TotalCount += Stats.CurrentCount;
+    }
+
+    fprintf(File, "\nTotal: %lld Bytes in %lld allocations\n", TotalBytes, TotalCount);
+
+    fclose(File);
+    return true;
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include <atomic>
+
+#include "Core/HAL/PlatformType.h"
+
+/** 0으로 설정하면 할당마다 붙는 Tag 헤더와 Tag별 통계 수집이 비활성화됩니다. */
+#ifndef ENABLE_MEMORY_TAGS
+    #define ENABLE_MEMORY_TAGS 1
+#endif
+
+
+/**
+ * 메모리 사용처를 구분하기 위한 Tag 목록입니다.
+ * 새로운 Tag는 여기에 추가하면 Enum, 이름, 통계가 함께 생성됩니다.
+ */
+#define MEMORY_TAG_LIST(Op) \
+    Op(Untagged)            \
+    Op(UObject)             \
+    Op(MemStack)            \
+    Op(Names)               \
+    Op(World)               \
+    Op(Animation)           \
+    Op(Fbx)                 \
+    Op(StaticMesh)          \
+    Op(Rendering)           \
+    Op(Editor)              \
+    Op(UI)
+
+enum class EMemoryTag : uint8
+{
+#define MEMORY_TAG_ENUM(Tag) Tag,
+    MEMORY_TAG_LIST(MEMORY_TAG_ENUM)
+#undef MEMORY_TAG_ENUM
+    Count
+};
+
+/** Tag 하나의 메모리 사용 통계 */
+struct FMemoryTagStats
+{
+    /** 현재 할당되어 있는 바이트 수 */
+    int64 CurrentBytes = 0;
+
+    /** 최대 사용량 (High-water mark) */
+    int64 PeakBytes = 0;
+
+    /** 현재 살아있는 할당 개수 */
+    int64 CurrentCount = 0;
+
+    /** 프로그램 시작 이후의 누적 할당 횟수 */
+    uint64 TotalCount = 0;
+
+    /** 예산, 0이면 제한 없음 */
+    uint64 BudgetBytes = 0;
+
+    bool IsOverBudget() const { return BudgetBytes > 0 && static_cast<uint64>(PeakBytes) > BudgetBytes; }
+};
+
+/**
+ * 할당 앞에 붙는 Tag 헤더, 사용자 포인터 바로 앞에 위치합니다.
+ * Offset은 실제 할당 시작 주소에서 사용자 포인터까지의 거리입니다.
+ */
+struct FMemoryTagHeader
+{
+    uint32 Offset;
+    EMemoryTag Tag;
+};
+
+
+/**
+ * Tag별 메모리 사용량을 추적합니다.
+ *
+ * FPlatformMemory::Malloc/AlignedMalloc과 UObject Pool에서 할당할 때의 현재 Tag(SCOPED_MEMORY_TAG)를 헤더에 기록하고,
+ * 해제할 때 헤더의 Tag로 통계를 되돌리므로 TArray, TMap 등 TContainerAllocator를 사용하는 모든 컨테이너에 Tag가 전파됩니다.
+ */
+class FMemoryTracker
+{
+public:
+    static const char* GetTagName(EMemoryTag Tag);
+
+    /** 현재 스레드의 Tag */
+    static EMemoryTag GetCurrentTag() { return CurrentTag; }
+
+    static FMemoryTagStats GetStats(EMemoryTag Tag);
+
+    /** Tag의 예산을 설정합니다. Peak가 예산을 넘으면 Stat Overlay와 리포트에 표시됩니다. */
+    static void SetBudget(EMemoryTag Tag, uint64 BudgetBytes);
+
+    /**
+     * Base부터 시작하는 할당에 Tag 헤더를 기록하고, 사용자 포인터(Base + Offset)를 반환합니다.
+     * @param Offset FMemoryTagHeader보다 크고, 요구 정렬의 배수여야 합니다.
+     */
+    static void* TagAllocation(void* Base, size_t Offset, size_t Size, EMemoryTag Tag = CurrentTag);
+
+    /** TagAllocation으로 기록된 헤더를 읽어 통계를 되돌리고, 실제 할당 시작 주소를 반환합니다. */
+    static void* UntagAllocation(void* Ptr, size_t Size);
+
+    /** Tag별 통계를 CSV 파일로 저장합니다. */
+    static bool DumpCsv(const char* FilePath);
+
+    /**
+     * 아직 해제되지 않은 할당을 Tag별로 정리한 리포트를 저장합니다.
+     * 종료 직전에 호출하면 누수 후보를 확인할 수 있습니다.
+     */
+    static bool DumpLeakReport(const char* FilePath);
+
+private:
+    friend class FMemoryTagScope;
+
+    static void OnAlloc(EMemoryTag Tag, size_t Size);
+    static void OnFree(EMemoryTag Tag, size_t Size);
+
+    struct FTagCounters
+    {
+        std::atomic<int64> CurrentBytes = 0;
+        std::atomic<int64> PeakBytes = 0;
+        std::atomic<int64> CurrentCount = 0;
+        std::atomic<uint64> TotalCount = 0;
+        std::atomic<uint64> BudgetBytes = 0;
+    };
+
+    static FTagCounters Counters[static_cast<size_t>(EMemoryTag::Count)];
+
+    static thread_local EMemoryTag CurrentTag;
+};
+
+
+/** 생성 시점부터 소멸할 때까지 현재 스레드의 메모리 Tag를 변경합니다. */
+class FMemoryTagScope
+{
+public:
+    explicit FMemoryTagScope(EMemoryTag InTag)
+        : PrevTag(FMemoryTracker::CurrentTag)
+    {
+        FMemoryTracker::CurrentTag = InTag;
+    }
+
+    ~FMemoryTagScope()
+    {
+        FMemoryTracker::CurrentTag = PrevTag;
+    }
+
+    FMemoryTagScope(const FMemoryTagScope&) = delete;
+    FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+    EMemoryTag PrevTag;
+};
+
+#if ENABLE_MEMORY_TAGS
+    #define SCOPED_MEMORY_TAG(Tag) FMemoryTagScope MemoryTagScope_##Tag(EMemoryTag::Tag)
+#else
+    #define SCOPED_MEMORY_TAG(Tag)
+#endif
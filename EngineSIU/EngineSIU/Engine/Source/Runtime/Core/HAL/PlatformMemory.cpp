@@ -4,3 +4,44 @@ std::atomic<uint64> FPlatformMemory::ObjectAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ObjectAllocationCount = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationCount = 0;
+
+std::atomic<uint64> FPlatformMemory::ObjectTotalAllocationCount = 0;
+std::atomic<uint64> FPlatformMemory::ContainerTotalAllocationCount = 0;
+
+uint64 FPlatformMemory::ObjectFrameStartAllocationCount = 0;
+uint64 FPlatformMemory::ContainerFrameStartAllocationCount = 0;
+uint64 FPlatformMemory::ObjectLastFrameAllocationCount = 0;
+uint64 FPlatformMemory::ContainerLastFrameAllocationCount = 0;
+
+std::atomic<uint64> FPlatformMemory::PoolReservedBytes = 0;
+
+void FPlatformMemory::BeginFrame()
+{
+    const uint64 ObjectTotal = ObjectTotalAllocationCount.load(std::memory_order_relaxed);
+    const uint64 ContainerTotal = ContainerTotalAllocationCount.load(std::memory_order_relaxed);
+
+    ObjectLastFrameAllocationCount = ObjectTotal - ObjectFrameStartAllocationCount;
+    ContainerLastFrameAllocationCount = ContainerTotal - ContainerFrameStartAllocationCount;
+
+    ObjectFrameStartAllocationCount = ObjectTotal;
+    ContainerFrameStartAllocationCount = ContainerTotal;
+}
+
+void* FPlatformMemory::PoolMalloc(size_t Size, size_t Alignment)
+{
+    void* Ptr = _aligned_malloc(Size, Alignment);
+    if (Ptr)
+    {
+        PoolReservedBytes.fetch_add(Size, std::memory_order_relaxed);
+    }
+    return Ptr;
+}
+
+void FPlatformMemory::PoolFree(void* Address, size_t Size)
+{
+    if (Address)
+    {
+        PoolReservedBytes.fetch_sub(Size, std::memory_order_relaxed);
+        _aligned_free(Address);
+    }
+}
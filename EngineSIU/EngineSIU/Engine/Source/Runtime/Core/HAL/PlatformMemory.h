@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "Core/HAL/PlatformType.h"
+#include "Core/HAL/MemoryTracker.h"
 
 enum EAllocationType : uint8
 {
@@ -23,6 +24,19 @@ private:
     static std::atomic<uint64> ContainerAllocationBytes;
     static std::atomic<uint64> ContainerAllocationCount;
 
+    // 누적 할당 횟수 (해제해도 감소하지 않음)
+    static std::atomic<uint64> ObjectTotalAllocationCount;
+    static std::atomic<uint64> ContainerTotalAllocationCount;
+
+    // 프레임 단위 할당 횟수
+    static uint64 ObjectFrameStartAllocationCount;
+    static uint64 ContainerFrameStartAllocationCount;
+    static uint64 ObjectLastFrameAllocationCount;
+    static uint64 ContainerLastFrameAllocationCount;
+
+    // Pool Allocator가 확보해둔 전체 메모리
+    static std::atomic<uint64> PoolReservedBytes;
+
     template <EAllocationType AllocType>
     static void IncrementStats(size_t Size);
 
@@ -50,11 +64,38 @@ public:
     template <EAllocationType AllocType>
     static void AlignedFree(void* Address, size_t Size);
 
+    /**
+     * Pool Allocator가 사용할 큰 메모리 블록을 할당합니다.
+     * 이 메모리는 AllocType 통계에 포함되지 않으며, Pool이 나눠준 블록은 TrackAlloc/TrackFree로 따로 집계합니다.
+     */
+    static void* PoolMalloc(size_t Size, size_t Alignment);
+    static void PoolFree(void* Address, size_t Size);
+
+    /** 자체 Allocator(Pool 등)가 나눠준 블록을 통계에 반영합니다. 실제로 메모리를 할당/해제하지는 않습니다. */
+    template <EAllocationType AllocType>
+    static void TrackAlloc(size_t Size) { IncrementStats<AllocType>(Size); }
+
+    template <EAllocationType AllocType>
+    static void TrackFree(size_t Size) { DecrementStats<AllocType>(Size); }
+
+    static uint64 GetPoolReservedBytes() { return PoolReservedBytes; }
+
     template <EAllocationType AllocType>
     static uint64 GetAllocationBytes();
 
     template <EAllocationType AllocType>
     static uint64 GetAllocationCount();
+
+    /** 프로그램 시작 이후의 누적 할당 횟수 */
+    template <EAllocationType AllocType>
+    static uint64 GetTotalAllocationCount();
+
+    /** 직전 프레임 동안 발생한 할당 횟수 */
+    template <EAllocationType AllocType>
+    static uint64 GetLastFrameAllocationCount();
+
+    /** 프레임 경계에서 호출되어, 직전 프레임의 할당 횟수를 기록합니다. */
+    static void BeginFrame();
 };
 
 
@@ -68,11 +109,13 @@ void FPlatformMemory::IncrementStats(size_t Size)
     {
         ContainerAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ContainerAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        ContainerTotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
     else if constexpr (AllocType == EAT_Object)
     {
         ObjectAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        ObjectTotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
     else
     {
@@ -112,22 +155,43 @@ void FPlatformMemory::Memcpy(T& Dest, const T& Src)
 template <EAllocationType AllocType>
 void* FPlatformMemory::Malloc(size_t Size)
 {
+#if ENABLE_MEMORY_TAGS
+    // malloc의 기본 정렬(16)을 유지하도록 Tag 헤더 공간을 16바이트 확보합니다.
+    constexpr size_t TagOffset = 16;
+    void* Ptr = std::malloc(Size + TagOffset);
+    if (Ptr)
+    {
+        IncrementStats<AllocType>(Size);
+        Ptr = FMemoryTracker::TagAllocation(Ptr, TagOffset, Size);
+    }
+#else
     void* Ptr = std::malloc(Size);
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
     }
+#endif
     return Ptr;
 }
 
 template <EAllocationType AllocType>
 void* FPlatformMemory::AlignedMalloc(size_t Size, size_t Alignment)
 {
+#if ENABLE_MEMORY_TAGS
+    const size_t TagOffset = Alignment > 16 ? Alignment : 16;
+    void* Ptr = _aligned_malloc(Size + TagOffset, Alignment);
+    if (Ptr)
+    {
+        IncrementStats<AllocType>(Size);
+        Ptr = FMemoryTracker::TagAllocation(Ptr, TagOffset, Size);
+    }
+#else
     void* Ptr = _aligned_malloc(Size, Alignment);
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
     }
+#endif
     return Ptr;
 }
 
@@ -137,6 +201,9 @@ void FPlatformMemory::Free(void* Address, size_t Size)
     if (Address)
     {
         DecrementStats<AllocType>(Size);
+#if ENABLE_MEMORY_TAGS
+        Address = FMemoryTracker::UntagAllocation(Address, Size);
+#endif
         std::free(Address);
     }
 }
@@ -147,6 +214,9 @@ void FPlatformMemory::AlignedFree(void* Address, size_t Size)
     if (Address)
     {
         DecrementStats<AllocType>(Size);
+#if ENABLE_MEMORY_TAGS
+        Address = FMemoryTracker::UntagAllocation(Address, Size);
+#endif
         _aligned_free(Address);
     }
 }
@@ -187,3 +257,38 @@ uint64 FPlatformMemory::GetAllocationCount()
     }
 }
 
+template <EAllocationType AllocType>
+uint64 FPlatformMemory::GetTotalAllocationCount()
+{
+    if constexpr (AllocType == EAT_Container)
+    {
+        return ContainerTotalAllocationCount;
+    }
+    else if constexpr (AllocType == EAT_Object)
+    {
+        return ObjectTotalAllocationCount;
+    }
+    else
+    {
+        //static_assert(false, "Unknown AllocationType");
+        return -1;
+    }
+}
+
+template <EAllocationType AllocType>
+uint64 FPlatformMemory::GetLastFrameAllocationCount()
+{
+    if constexpr (AllocType == EAT_Container)
+    {
+        return ContainerLastFrameAllocationCount;
+    }
+    else if constexpr (AllocType == EAT_Object)
+    {
+        return ObjectLastFrameAllocationCount;
+    }
+    else
+    {
+        //static_assert(false, "Unknown AllocationType");
+        return -1;
+    }
+}
@@ -21,6 +21,9 @@
 // inline을 하지않는 매크로
 #define FORCENOINLINE __declspec(noinline)
 
+// 스레드 간 False Sharing을 피하기 위한 캐시 라인 크기
+#define PLATFORM_CACHE_LINE_SIZE 64
+
 #ifdef _DEBUG
     #define FORCEINLINE_DEBUGGABLE inline
 #else
@@ -0,0 +1,157 @@
+#include "LogBuffer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <iterator>
+
+
+namespace
+{
+    std::atomic<uint64> NextBufferId = 1;
+
+    thread_local uint64 CachedBufferId = 0;
+    thread_local void* CachedThreadQueue = nullptr;
+}
+
+
+FString FormatLogMessageV(const ANSICHAR* Fmt, va_list Args)
+{
+    char Buf[1024];
+    vsnprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
+    return FString(Buf);
+}
+
+FString FormatLogMessageV(const WIDECHAR* Fmt, va_list Args)
+{
+    wchar_t Buf[1024];
+    _vsnwprintf_s(Buf, std::size(Buf), _TRUNCATE, Fmt, Args);
+    return FString(Buf);
+}
+
+FString FormatLogMessage(const ANSICHAR* Fmt, ...)
+{
+    va_list Args;
+    va_start(Args, Fmt);
+    FString Message = FormatLogMessageV(Fmt, Args);
+    va_end(Args);
+    return Message;
+}
+
+FString FormatLogMessage(const WIDECHAR* Fmt, ...)
+{
+    va_list Args;
+    va_start(Args, Fmt);
+    FString Message = FormatLogMessageV(Fmt, Args);
+    va_end(Args);
+    return Message;
+}
+
+
+FLogBuffer::FLogBuffer(uint32 InCapacity, uint32 InThreadQueueCapacity)
+    : ConsumerThreadId(std::this_thread::get_id())
+    , BufferId(NextBufferId.fetch_add(1, std::memory_order_relaxed))
+    , ThreadQueueCapacity(InThreadQueueCapacity)
+{
+    const uint32 Capacity = std::bit_ceil(std::max<uint32>(InCapacity, 2));
+    Records.SetNum(static_cast<int32>(Capacity));
+    IndexMask = Capacity - 1;
+}
+
+FLogBuffer::~FLogBuffer()
+{
+    // 소멸 시점에는 다른 스레드가 로그를 남기지 않아야 합니다.
+    const int32 NumQueues = std::min(NumThreadQueues.load(std::memory_order_acquire), MaxProducerThreads);
+    for (int32 Index = 0; Index < NumQueues; ++Index)
+    {
+        delete ThreadQueues[Index].load(std::memory_order_acquire);
+    }
+}
+
+void FLogBuffer::Add(FLogRecord&& Record)
+{
+    if (IsInConsumerThread())
+    {
+        Push(std::move(Record));
+        return;
+    }
+
+    FThreadQueue* Queue = GetThreadQueue();
+    if (!Queue || !Queue->Enqueue(std::move(Record)))
+    {
+        NumDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void FLogBuffer::Flush()
+{
+    const int32 NumQueues = std::min(NumThreadQueues.load(std::memory_order_acquire), MaxProducerThreads);
+    for (int32 Index = 0; Index < NumQueues; ++Index)
+    {
+        FThreadQueue* Queue = ThreadQueues[Index].load(std::memory_order_acquire);
+        if (!Queue)
+        {
+            continue;
+        }
+
+        FlushScratch.Empty(FlushScratch.Max());
+        Queue->DequeueBatch(FlushScratch);
+        for (FPendingLogRecord& Pending : FlushScratch)
+        {
+            if (Pending.Message.IsSet())
+            {
+                Pending.Record.Message = Pending.Message.Format();
+            }
+            Push(std::move(Pending.Record));
+        }
+    }
+    FlushScratch.Empty(FlushScratch.Max());
+}
+
+void FLogBuffer::Clear()
+{
+    for (uint64 Sequence = FirstSequence; Sequence < EndSequence; ++Sequence)
+    {
+        Records[static_cast<int32>(Sequence & IndexMask)] = FLogRecord();
+    }
+    FirstSequence = EndSequence;
+    std::ranges::fill(NumRecordsPerLevel, 0);
+}
+
+FLogBuffer::FThreadQueue* FLogBuffer::GetThreadQueue()
+{
+    if (CachedBufferId == BufferId)
+    {
+        return static_cast<FThreadQueue*>(CachedThreadQueue);
+    }
+
+    // 스레드마다 한 번만 실행됩니다. 등록에 실패해도 다시 시도하지 않도록 nullptr를 캐시합니다.
+    CachedBufferId = BufferId;
+    CachedThreadQueue = nullptr;
+
+    const int32 Index = NumThreadQueues.fetch_add(1, std::memory_order_acq_rel);
+    if (Index >= MaxProducerThreads)
+    {
+        return nullptr;
+    }
+
+    FThreadQueue* Queue = new FThreadQueue(ThreadQueueCapacity);
+    ThreadQueues[Index].store(Queue, std::memory_order_release);
+    CachedThreadQueue = Queue;
+    return Queue;
+}
+
+void FLogBuffer::Push(FLogRecord&& Record)
+{
+    const uint64 Capacity = IndexMask + 1;
+    if (EndSequence - FirstSequence == Capacity)
+    {
+        // 가장 오래된 로그를 덮어씁니다.
+        --NumRecordsPerLevel[static_cast<uint8>(Get(FirstSequence).Level)];
+        ++FirstSequence;
+    }
+
+    ++NumRecordsPerLevel[static_cast<uint8>(Record.Level)];
+    Records[static_cast<int32>(EndSequence & IndexMask)] = std::move(Record);
+    ++EndSequence;
+}
@@ -0,0 +1,343 @@
+#pragma once
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#include "LogCategory.h"
+#include "Container/Array.h"
+#include "Container/LockFreeQueue.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/** FLogBuffer에 저장되는 로그 한 줄 */
+struct FLogRecord
+{
+    const FLogCategory* Category = nullptr;
+
+    /** 로그를 남긴 파일 이름과 줄, "[File:Line] " 접두어는 화면에 그릴 때 붙입니다. File이 nullptr이면 붙이지 않습니다. */
+    const ANSICHAR* File = nullptr;
+    int32 Line = 0;
+
+    ELogLevel Level = ELogLevel::Display;
+
+    FString Message;
+};
+
+
+/** printf 형식으로 로그 메시지를 만듭니다. 1023자를 넘는 부분은 잘립니다. */
+FString FormatLogMessageV(const ANSICHAR* Fmt, va_list Args);
+FString FormatLogMessageV(const WIDECHAR* Fmt, va_list Args);
+FString FormatLogMessage(const ANSICHAR* Fmt, ...);
+FString FormatLogMessage(const WIDECHAR* Fmt, ...);
+
+
+namespace LogBufferPrivate
+{
+    /** 산술 타입, 열거형, 포인터는 값으로 보관합니다. 그 외의 타입은 보관할 수 없습니다. */
+    template <typename T>
+    struct TLogArgStorage
+    {
+        using Type = T;
+        static constexpr bool bCanDefer = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> || std::is_null_pointer_v<T>;
+
+        static T Capture(T Arg) { return Arg; }
+    };
+
+    /** %s 인자는 호출한 쪽의 버퍼가 Flush 전에 사라질 수 있으므로 복사합니다. nullptr는 MSVC printf처럼 "(null)"로 남깁니다. */
+    template <typename CharType, typename StringType>
+    struct TLogStringArgStorage
+    {
+        using Type = StringType;
+        static constexpr bool bCanDefer = true;
+
+        static StringType Capture(const CharType* Arg) { return StringType(Arg ? Arg : NullString()); }
+
+    private:
+        static const CharType* NullString()
+        {
+            if constexpr (std::is_same_v<CharType, WIDECHAR>) { return L"(null)"; }
+            else { return "(null)"; }
+        }
+    };
+
+    template <> struct TLogArgStorage<ANSICHAR*> : TLogStringArgStorage<ANSICHAR, std::string> {};
+    template <> struct TLogArgStorage<const ANSICHAR*> : TLogStringArgStorage<ANSICHAR, std::string> {};
+    template <> struct TLogArgStorage<WIDECHAR*> : TLogStringArgStorage<WIDECHAR, std::wstring> {};
+    template <> struct TLogArgStorage<const WIDECHAR*> : TLogStringArgStorage<WIDECHAR, std::wstring> {};
+
+    template <typename T>
+    using TLogArgStorageOf = TLogArgStorage<std::decay_t<T>>;
+
+    inline const ANSICHAR* GetLogArg(const std::string& Arg) { return Arg.c_str(); }
+    inline const WIDECHAR* GetLogArg(const std::wstring& Arg) { return Arg.c_str(); }
+
+    template <typename T>
+    const T& GetLogArg(const T& Arg) { return Arg; }
+}
+
+
+/**
+ * 나중에 만들 로그 메시지, 형식 문자열 포인터와 인자의 복사본을 Inline 버퍼에 보관합니다.
+ * 형식 문자열은 복사하지 않으므로 Format을 호출할 때까지 유효해야 합니다. (문자열 리터럴)
+ */
+class FDeferredLogMessage
+{
+public:
+    static constexpr size_t InlineSize = 96;
+
+private:
+    template <typename CharType, typename... StoredTypes>
+    struct TPayload
+    {
+        const CharType* Fmt;
+        std::tuple<StoredTypes...> Args;
+
+        FString Format() const
+        {
+            return std::apply([this](const StoredTypes&... InArgs)
+            {
+                return FormatLogMessage(Fmt, LogBufferPrivate::GetLogArg(InArgs)...);
+            }, Args);
+        }
+    };
+
+    template <typename CharType, typename... ArgTypes>
+    using TPayloadOf = TPayload<CharType, typename LogBufferPrivate::TLogArgStorageOf<ArgTypes>::Type...>;
+
+public:
+    /** 모든 인자를 보관할 수 있고 Inline 버퍼에 들어가는지 여부 */
+    template <typename CharType, typename... ArgTypes>
+    static constexpr bool CanDefer()
+    {
+        if constexpr ((LogBufferPrivate::TLogArgStorageOf<ArgTypes>::bCanDefer && ...))
+        {
+            using FPayload = TPayloadOf<CharType, ArgTypes...>;
+            return sizeof(FPayload) <= InlineSize && alignof(FPayload) <= alignof(std::max_align_t);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    FDeferredLogMessage() = default;
+
+    template <typename CharType, typename... ArgTypes>
+    explicit FDeferredLogMessage(const CharType* Fmt, ArgTypes&&... Args)
+    {
+        static_assert(CanDefer<CharType, ArgTypes...>(), "FDeferredLogMessage: 보관할 수 없는 인자입니다.");
+
+        using FPayload = TPayloadOf<CharType, ArgTypes...>;
+        new (Storage) FPayload{ Fmt, { LogBufferPrivate::TLogArgStorageOf<ArgTypes>::Capture(Args)... } };
+        Ops = &OpsFor<FPayload>;
+    }
+
+    FDeferredLogMessage(FDeferredLogMessage&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    FDeferredLogMessage& operator=(FDeferredLogMessage&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    FDeferredLogMessage(const FDeferredLogMessage&) = delete;
+    FDeferredLogMessage& operator=(const FDeferredLogMessage&) = delete;
+
+    ~FDeferredLogMessage() { Reset(); }
+
+    bool IsSet() const { return Ops != nullptr; }
+
+    FString Format() const { return Ops ? Ops->Format(Storage) : FString(); }
+
+    void Reset()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
+    }
+
+private:
+    struct FOps
+    {
+        FString (*Format)(const void* Payload);
+
+        /** Src의 Payload를 Dest로 옮기고 Src를 소멸시킵니다. */
+        void (*Relocate)(void* Dest, void* Src);
+
+        void (*Destroy)(void* Payload);
+    };
+
+    template <typename PayloadType>
+    static constexpr FOps OpsFor = {
+        [](const void* Payload) { return static_cast<const PayloadType*>(Payload)->Format(); },
+        [](void* Dest, void* Src)
+        {
+            PayloadType* SrcPayload = static_cast<PayloadType*>(Src);
+            new (Dest) PayloadType(std::move(*SrcPayload));
+            SrcPayload->~PayloadType();
+        },
+        [](void* Payload) { static_cast<PayloadType*>(Payload)->~PayloadType(); }
+    };
+
+    void MoveFrom(FDeferredLogMessage& Other)
+    {
+        Ops = Other.Ops;
+        if (Ops)
+        {
+            Ops->Relocate(Storage, Other.Storage);
+            Other.Ops = nullptr;
+        }
+    }
+
+private:
+    alignas(std::max_align_t) uint8 Storage[InlineSize];
+    const FOps* Ops = nullptr;
+};
+
+
+/** 스레드 Queue에 들어가는 로그, Message가 있으면 Flush에서 Record.Message를 만듭니다. */
+struct FPendingLogRecord
+{
+    FLogRecord Record;
+    FDeferredLogMessage Message;
+
+    FPendingLogRecord() = default;
+
+    explicit FPendingLogRecord(FLogRecord&& InRecord)
+        : Record(std::move(InRecord))
+    {
+    }
+
+    template <typename CharType, typename... ArgTypes>
+    FPendingLogRecord(FLogRecord&& InRecord, const CharType* Fmt, ArgTypes&&... Args)
+        : Record(std::move(InRecord))
+        , Message(Fmt, std::forward<ArgTypes>(Args)...)
+    {
+    }
+};
+
+
+/**
+ * 고정 크기의 로그 Ring Buffer
+ *
+ * - 생성한 스레드(게임 스레드)가 Consumer이며, Consumer에서 남긴 로그는 Ring에 바로 추가됩니다.
+ * - 다른 스레드는 처음 로그를 남길 때 자기 전용 Spsc Queue를 등록하고, 이후에는 Lock 없이 Queue에 넣습니다.
+ *   Queue가 가득 차면 그 로그는 버리고 GetNumDropped를 늘립니다.
+ * - Consumer는 Flush로 Queue들을 Ring으로 옮깁니다. Ring이 가득 차면 가장 오래된 로그부터 덮어씁니다.
+ * - AddFormatted로 남긴 다른 스레드의 로그는 형식 문자열과 인자만 Queue에 넣고, 메시지는 Flush에서 Consumer가 만듭니다.
+ *
+ * 로그는 0부터 증가하는 Sequence 번호로 접근하며, [GetFirstSequence, GetEndSequence) 범위만 유효합니다.
+ * Flush, Clear, Get 등 Ring에 접근하는 함수는 Consumer 스레드에서만 호출해야 합니다.
+ */
+class FLogBuffer
+{
+public:
+    /** 로그를 남길 수 있는 Consumer 외 스레드의 최대 수, 넘어서면 그 스레드의 로그는 버려집니다. */
+    static constexpr int32 MaxProducerThreads = 64;
+
+    /**
+     * @param InCapacity Ring에 보관할 최대 로그 수, 2의 거듭제곱으로 올림됩니다.
+     * @param InThreadQueueCapacity 스레드마다 Flush 전까지 쌓아둘 수 있는 최대 로그 수
+     */
+    explicit FLogBuffer(uint32 InCapacity = 16384, uint32 InThreadQueueCapacity = 4096);
+    ~FLogBuffer();
+
+    FLogBuffer(const FLogBuffer&) = delete;
+    FLogBuffer& operator=(const FLogBuffer&) = delete;
+
+    /** 로그를 추가합니다. 아무 스레드에서나 호출할 수 있습니다. */
+    void Add(FLogRecord&& Record);
+
+    /**
+     * Fmt와 Args로 Record.Message를 만들어 추가합니다. 아무 스레드에서나 호출할 수 있습니다.
+     * Consumer가 아닌 스레드에서는 메시지를 만들지 않고 인자를 복사해 Queue에 넣으므로, Fmt는 Flush까지 유효한 문자열 리터럴이어야 합니다.
+     * 보관할 수 없는 인자(클래스 타입 등)가 있거나 인자가 InlineSize를 넘으면 호출한 스레드에서 바로 만듭니다.
+     */
+    template <typename CharType, typename... ArgTypes>
+    void AddFormatted(FLogRecord&& Record, const CharType* Fmt, ArgTypes&&... Args)
+    {
+        if constexpr (FDeferredLogMessage::CanDefer<CharType, ArgTypes...>())
+        {
+            if (!IsInConsumerThread())
+            {
+                // Queue에 자리가 있을 때만 Cell 안에서 인자를 복사합니다.
+                FThreadQueue* Queue = GetThreadQueue();
+                if (!Queue || !Queue->Enqueue(std::move(Record), Fmt, std::forward<ArgTypes>(Args)...))
+                {
+                    NumDropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                return;
+            }
+        }
+
+        Record.Message = FormatLogMessage(Fmt, std::forward<ArgTypes>(Args)...);
+        Add(std::move(Record));
+    }
+
+    /** 다른 스레드의 Queue에 쌓인 로그를 Ring으로 옮깁니다. */
+    void Flush();
+
+    /** Ring의 로그를 모두 버립니다. Sequence 번호는 이어집니다. */
+    void Clear();
+
+    uint64 GetFirstSequence() const { return FirstSequence; }
+    uint64 GetEndSequence() const { return EndSequence; }
+
+    const FLogRecord& Get(uint64 Sequence) const { return Records[static_cast<int32>(Sequence & IndexMask)]; }
+
+    /** Ring에 남아있는 Level 로그의 수 */
+    int32 GetNumRecords(ELogLevel Level) const { return NumRecordsPerLevel[static_cast<uint8>(Level)]; }
+
+    /** 스레드 Queue가 가득 차서 버려진 로그의 수 */
+    uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+    bool IsInConsumerThread() const { return std::this_thread::get_id() == ConsumerThreadId; }
+
+private:
+    using FThreadQueue = TBoundedQueue<FPendingLogRecord, EQueueMode::Spsc>;
+
+    /** 현재 스레드의 Queue, 처음 호출될 때 등록합니다. 등록할 수 없으면 nullptr */
+    FThreadQueue* GetThreadQueue();
+
+    void Push(FLogRecord&& Record);
+
+private:
+    TArray<FLogRecord> Records;
+    uint64 IndexMask = 0;
+
+    uint64 FirstSequence = 0;
+    uint64 EndSequence = 0;
+
+    int32 NumRecordsPerLevel[static_cast<uint8>(ELogLevel::Error) + 1] = {};
+
+    std::thread::id ConsumerThreadId;
+
+    /** 스레드의 thread_local 캐시가 다른 FLogBuffer의 Queue를 가리키지 않도록 구분하는 번호 */
+    uint64 BufferId;
+
+    uint32 ThreadQueueCapacity;
+
+    /** 등록된 스레드 Queue, Consumer는 NumThreadQueues까지 읽으며 아직 저장되지 않은 nullptr는 건너뜁니다. */
+    std::atomic<FThreadQueue*> ThreadQueues[MaxProducerThreads] = {};
+    std::atomic<int32> NumThreadQueues = 0;
+
+    std::atomic<uint64> NumDropped = 0;
+
+    /** Flush에서 재사용하는 임시 배열 */
+    TArray<FPendingLogRecord> FlushScratch;
+};
@@ -0,0 +1,42 @@
+#include "LogCategory.h"
+
+#include <cstring>
+
+
+DEFINE_LOG_CATEGORY(LogTemp)
+
+FLogCategory* FLogCategory::FirstCategory = nullptr;
+
+
+const ANSICHAR* LexToString(ELogLevel Level)
+{
+    switch (Level)
+    {
+    case ELogLevel::Verbose: return "Verbose";
+    case ELogLevel::Display: return "Display";
+    case ELogLevel::Warning: return "Warning";
+    case ELogLevel::Error:   return "Error";
+    }
+    return "Unknown";
+}
+
+FLogCategory::FLogCategory(const ANSICHAR* InName, ELogLevel InDefaultVerbosity)
+    : Name(InName)
+    , Verbosity(InDefaultVerbosity)
+{
+    // 전역 변수로만 생성되므로, 정적 초기화 중에 단일 스레드에서 등록됩니다.
+    NextCategory = FirstCategory;
+    FirstCategory = this;
+}
+
+FLogCategory* FLogCategory::Find(const ANSICHAR* InName)
+{
+    for (FLogCategory* Category = FirstCategory; Category; Category = Category->NextCategory)
+    {
+        if (_stricmp(Category->Name, InName) == 0)
+        {
+            return Category;
+        }
+    }
+    return nullptr;
+}
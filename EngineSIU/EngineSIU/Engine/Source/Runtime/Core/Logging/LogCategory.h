@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+
+#include "HAL/PlatformType.h"
+
+
+/** 로그의 심각도, 뒤에 있을수록 심각합니다. */
+enum class ELogLevel : uint8
+{
+    /** 생성/삭제처럼 자주 발생하는 상세 로그, 기본적으로 출력되지 않습니다. */
+    Verbose,
+
+    Display,
+    Warning,
+    Error
+};
+
+const ANSICHAR* LexToString(ELogLevel Level);
+
+
+/**
+ * 로그 카테고리, 카테고리마다 출력할 최소 Verbosity를 가집니다.
+ *
+ * UE_LOG_CAT은 호출하는 곳에서 IsSuppressed를 먼저 확인하므로, 걸러진 로그는 인자를 평가하지도, 문자열을 만들지도 않습니다.
+ * Verbosity는 아무 스레드에서나 읽고 바꿀 수 있습니다.
+ */
+class FLogCategory
+{
+public:
+    FLogCategory(const ANSICHAR* InName, ELogLevel InDefaultVerbosity);
+
+    FLogCategory(const FLogCategory&) = delete;
+    FLogCategory& operator=(const FLogCategory&) = delete;
+
+    const ANSICHAR* GetName() const { return Name; }
+
+    ELogLevel GetVerbosity() const { return Verbosity.load(std::memory_order_relaxed); }
+    void SetVerbosity(ELogLevel InVerbosity) { Verbosity.store(InVerbosity, std::memory_order_relaxed); }
+
+    /** Level이 이 카테고리의 Verbosity보다 낮으면 true */
+    bool IsSuppressed(ELogLevel Level) const { return Level < GetVerbosity(); }
+
+    /** 이름으로 카테고리를 찾습니다. 대소문자를 구분하지 않습니다. */
+    static FLogCategory* Find(const ANSICHAR* InName);
+
+    /** 등록된 모든 카테고리를 순회합니다. 정적 초기화가 끝난 뒤에만 호출해야 합니다. */
+    template <typename FuncType>
+    static void ForEach(FuncType&& Func)
+    {
+        for (FLogCategory* Category = FirstCategory; Category; Category = Category->NextCategory)
+        {
+            Func(*Category);
+        }
+    }
+
+private:
+    const ANSICHAR* Name;
+    std::atomic<ELogLevel> Verbosity;
+
+    /** 등록된 카테고리의 연결 리스트, 정적 초기화 중에만 추가됩니다. */
+    FLogCategory* NextCategory = nullptr;
+    static FLogCategory* FirstCategory;
+};
+
+
+/**
+ * 헤더에서 로그 카테고리를 선언합니다. 정의는 한 cpp에서 DEFINE_LOG_CATEGORY로 합니다.
+ * @param CategoryName 카테고리 이름, LogObject처럼 Log로 시작합니다.
+ * @param DefaultVerbosity 기본으로 출력할 최소 ELogLevel (Verbose, Display, Warning, Error)
+ */
+#define DECLARE_LOG_CATEGORY_EXTERN(CategoryName, DefaultVerbosity) \
+    struct FLogCategory##CategoryName : public FLogCategory \
+    { \
+        FLogCategory##CategoryName() : FLogCategory(#CategoryName, ELogLevel::DefaultVerbosity) {} \
+    }; \
+    extern FLogCategory##CategoryName CategoryName;
+
+#define DEFINE_LOG_CATEGORY(CategoryName) FLogCategory##CategoryName CategoryName;
+
+
+/** 카테고리를 지정하지 않은 UE_LOG가 사용하는 카테고리 */
+DECLARE_LOG_CATEGORY_EXTERN(LogTemp, Display)
@@ -0,0 +1,1516 @@
+#include "MathKernels.h"
+#include <cmath>
+#include <cstring>
+#include <intrin.h>
+#include <immintrin.h>
+#include <iterator>
+
+#include "Define.h"
+#include "MathSSE.h"
+#include "Matrix.h"
+#include "Quat.h"
+#include "Vector.h"
+#include "Vector4.h"
+
+
+namespace
+{
+struct FCpuFeatures
+{
+    bool bSSE41 = false;
+    bool bAVX2 = false;
+    bool bFMA = false;
+
+    FCpuFeatures()
+    {
+        int32 Info[4];
+        __cpuid(Info, 0);
+        const int32 MaxLeaf = Info[0];
+
+        __cpuid(Info, 1);
+        const uint32 Ecx = static_cast<uint32>(Info[2]);
+        bSSE41 = (Ecx & (1u << 19)) != 0;
+        bFMA = (Ecx & (1u << 12)) != 0;
+
+        // AVX는 CPU뿐 아니라 OS가 YMM 레지스터를 저장해야(XCR0의 XMM, YMM 비트) 사용할 수 있습니다.
+        const bool bOSXSAVE = (Ecx & (1u << 27)) != 0;
+        const bool bAVX = (Ecx & (1u << 28)) != 0;
+        const bool bOSSupportsYMM = bOSXSAVE && (_xgetbv(0) & 0x6) == 0x6;
+
+        if (bAVX && bOSSupportsYMM && MaxLeaf >= 7)
+        {
+            __cpuidex(Info, 7, 0);
+            bAVX2 = (static_cast<uint32>(Info[1]) & (1u << 5)) != 0;
+        }
+        bFMA = bFMA && bOSSupportsYMM;
+    }
+};
+
+const FCpuFeatures& GetCpuFeatures()
+{
+    static const FCpuFeatures Features;
+    return Features;
+}
+
+
+namespace Scalar
+{
+void MultiplyMatrix(FMatrix* Out, const FMatrix* A, const FMatrix* B)
+{
+    // SSE 구현과 같은 순서로 더합니다.
+    FMatrix Result;
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            Result.M[Row][Col] = A->M[Row][0] * B->M[0][Col] + A->M[Row][1] * B->M[1][Col] + A->M[Row][2] * B->M[2][Col] + A->M[Row][3] * B->M[3][Col];
+        }
+    }
+    *Out = Result;
+}
+
+bool InverseMatrix(FMatrix* Out, const FMatrix* In)
+{
+    const FMatrix& Mat = *In;
+    FMatrix Result;
+
+    FMatrix Tmp;
+    float Det[4];
+
+    Tmp.M[0][0] = Mat.M[2][2] * Mat.M[3][3] - Mat.M[2][3] * Mat.M[3][2];
+    Tmp.M[0][1] = Mat.M[1][2] * Mat.M[3][3] - Mat.M[1][3] * Mat.M[3][2];
+    Tmp.M[0][2] = Mat.M[1][2] * Mat.M[2][3] - Mat.M[1][3] * Mat.M[2][2];
+
+    Tmp.M[1][0] = Mat.M[2][2] * Mat.M[3][3] - Mat.M[2][3] * Mat.M[3][2];
+    Tmp.M[1][1] = Mat.M[0][2] * Mat.M[3][3] - Mat.M[0][3] * Mat.M[3][2];
+    Tmp.M[1][2] = Mat.M[0][2] * Mat.M[2][3] - Mat.M[0][3] * Mat.M[2][2];
+
+    Tmp.M[2][0] = Mat.M[1][2] * Mat.M[3][3] - Mat.M[1][3] * Mat.M[3][2];
+    Tmp.M[2][1] = Mat.M[0][2] * Mat.M[3][3] - Mat.M[0][3] * Mat.M[3][2];
+    Tmp.M[2][2] = Mat.M[0][2] * Mat.M[1][3] - Mat.M[0][3] * Mat.M[1][2];
+
+    Tmp.M[3][0] = Mat.M[1][2] * Mat.M[2][3] - Mat.M[1][3] * Mat.M[2][2];
+    Tmp.M[3][1] = Mat.M[0][2] * Mat.M[2][3] - Mat.M[0][3] * Mat.M[2][2];
+    Tmp.M[3][2] = Mat.M[0][2] * Mat.M[1][3] - Mat.M[0][3] * Mat.M[1][2];
+
+    Det[0] = Mat.M[1][1] * Tmp.M[0][0] - Mat.M[2][1] * Tmp.M[0][1] + Mat.M[3][1] * Tmp.M[0][2];
+    Det[1] = Mat.M[0][1] * Tmp.M[1][0] - Mat.M[2][1] * Tmp.M[1][1] + Mat.M[3][1] * Tmp.M[1][2];
+    Det[2] = Mat.M[0][1] * Tmp.M[2][0] - Mat.M[1][1] * Tmp.M[2][1] + Mat.M[3][1] * Tmp.M[2][2];
+    Det[3] = Mat.M[0][1] * Tmp.M[3][0] - Mat.M[1][1] * Tmp.M[3][1] + Mat.M[2][1] * Tmp.M[3][2];
+
+    const float Determinant = Mat.M[0][0] * Det[0] - Mat.M[1][0] * Det[1] + Mat.M[2][0] * Det[2] - Mat.M[3][0] * Det[3];
+
+    if (Determinant == 0.0f || !std::isfinite(Determinant))
+    {
+        return false;
+    }
+
+    const float RDet = 1.0f / Determinant;
+
+    Result.M[0][0] = RDet * Det[0];
+    Result.M[0][1] = -RDet * Det[1];
+    Result.M[0][2] = RDet * Det[2];
+    Result.M[0][3] = -RDet * Det[3];
+    Result.M[1][0] = -RDet * (Mat.M[1][0] * Tmp.M[0][0] - Mat.M[2][0] * Tmp.M[0][1] + Mat.M[3][0] * Tmp.M[0][2]);
+    Result.M[1][1] = RDet * (Mat.M[0][0] * Tmp.M[1][0] - Mat.M[2][0] * Tmp.M[1][1] + Mat.M[3][0] * Tmp.M[1][2]);
+    Result.M[1][2] = -RDet * (Mat.M[0][0] * Tmp.M[2][0] - Mat.M[1][0] * Tmp.M[2][1] + Mat.M[3][0] * Tmp.M[2][2]);
+    Result.M[1][3] = RDet * (Mat.M[0][0] * Tmp.M[3][0] - Mat.M[1][0] * Tmp.M[3][1] + Mat.M[2][0] * Tmp.M[3][2]);
+    Result.M[2][0] = RDet * (
+        Mat.M[1][0] * (Mat.M[2][1] * Mat.M[3][3] - Mat.M[2][3] * Mat.M[3][1]) -
+        Mat.M[2][0] * (Mat.M[1][1] * Mat.M[3][3] - Mat.M[1][3] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[1][1] * Mat.M[2][3] - Mat.M[1][3] * Mat.M[2][1])
+    );
+    Result.M[2][1] = -RDet * (
+        Mat.M[0][0] * (Mat.M[2][1] * Mat.M[3][3] - Mat.M[2][3] * Mat.M[3][1]) -
+        Mat.M[2][0] * (Mat.M[0][1] * Mat.M[3][3] - Mat.M[0][3] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[0][1] * Mat.M[2][3] - Mat.M[0][3] * Mat.M[2][1])
+    );
+    Result.M[2][2] = RDet * (
+        Mat.M[0][0] * (Mat.M[1][1] * Mat.M[3][3] - Mat.M[1][3] * Mat.M[3][1]) -
+        Mat.M[1][0] * (Mat.M[0][1] * Mat.M[3][3] - Mat.M[0][3] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[0][1] * Mat.M[1][3] - Mat.M[0][3] * Mat.M[1][1])
+    );
+    Result.M[2][3] = -RDet * (
+        Mat.M[0][0] * (Mat.M[1][1] * Mat.M[2][3] - Mat.M[1][3] * Mat.M[2][1]) -
+        Mat.M[1][0] * (Mat.M[0][1] * Mat.M[2][3] - Mat.M[0][3] * Mat.M[2][1]) +
+        Mat.M[2][0] * (Mat.M[0][1] * Mat.M[1][3] - Mat.M[0][3] * Mat.M[1][1])
+    );
+    Result.M[3][0] = -RDet * (
+        Mat.M[1][0] * (Mat.M[2][1] * Mat.M[3][2] - Mat.M[2][2] * Mat.M[3][1]) -
+        Mat.M[2][0] * (Mat.M[1][1] * Mat.M[3][2] - Mat.M[1][2] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[1][1] * Mat.M[2][2] - Mat.M[1][2] * Mat.M[2][1])
+    );
+    Result.M[3][1] = RDet * (
+        Mat.M[0][0] * (Mat.M[2][1] * Mat.M[3][2] - Mat.M[2][2] * Mat.M[3][1]) -
+        Mat.M[2][0] * (Mat.M[0][1] * Mat.M[3][2] - Mat.M[0][2] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[0][1] * Mat.M[2][2] - Mat.M[0][2] * Mat.M[2][1])
+    );
+    Result.M[3][2] = -RDet * (
+        Mat.M[0][0] * (Mat.M[1][1] * Mat.M[3][2] - Mat.M[1][2] * Mat.M[3][1]) -
+        Mat.M[1][0] * (Mat.M[0][1] * Mat.M[3][2] - Mat.M[0][2] * Mat.M[3][1]) +
+        Mat.M[3][0] * (Mat.M[0][1] * Mat.M[1][2] - Mat.M[0][2] * Mat.M[1][1])
+    );
+    Result.M[3][3] = RDet * (
+        Mat.M[0][0] * (Mat.M[1][1] * Mat.M[2][2] - Mat.M[1][2] * Mat.M[2][1]) -
+        Mat.M[1][0] * (Mat.M[0][1] * Mat.M[2][2] - Mat.M[0][2] * Mat.M[2][1]) +
+        Mat.M[2][0] * (Mat.M[0][1] * Mat.M[1][2] - Mat.M[0][2] * Mat.M[1][1])
+    );
+
+    *Out = Result;
+    return true;
+}
+
+void MultiplyMatrices(FMatrix* Out, const FMatrix* A, const FMatrix* B, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        MultiplyMatrix(&Out[Index], &A[Index], &B[Index]);
+    }
+}
+
+void TransformVector4s(FVector4* Out, const FVector4* In, int32 Num, const FMatrix& Matrix)
+{
+    const auto& M = Matrix.M;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FVector4 V = In[Index];
+        Out[Index] = FVector4(
+            M[0][0] * V.X + M[1][0] * V.Y + M[2][0] * V.Z + M[3][0] * V.W,
+            M[0][1] * V.X + M[1][1] * V.Y + M[2][1] * V.Z + M[3][1] * V.W,
+            M[0][2] * V.X + M[1][2] * V.Y + M[2][2] * V.Z + M[3][2] * V.W,
+            M[0][3] * V.X + M[1][3] * V.Y + M[2][3] * V.Z + M[3][3] * V.W
+        );
+    }
+}
+
+void TransformPositions(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    const auto& M = Matrix.M;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FVector V = In[Index];
+        const float X = M[0][0] * V.X + M[1][0] * V.Y + M[2][0] * V.Z + M[3][0];
+        const float Y = M[0][1] * V.X + M[1][1] * V.Y + M[2][1] * V.Z + M[3][1];
+        const float Z = M[0][2] * V.X + M[1][2] * V.Y + M[2][2] * V.Z + M[3][2];
+        const float W = M[0][3] * V.X + M[1][3] * V.Y + M[2][3] * V.Z + M[3][3];
+        Out[Index] = W != 0.0f ? FVector(X / W, Y / W, Z / W) : FVector(X, Y, Z);
+    }
+}
+
+void TransformVectors(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    const auto& M = Matrix.M;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FVector V = In[Index];
+        Out[Index] = FVector(
+            M[0][0] * V.X + M[1][0] * V.Y + M[2][0] * V.Z,
+            M[0][1] * V.X + M[1][1] * V.Y + M[2][1] * V.Z,
+            M[0][2] * V.X + M[1][2] * V.Y + M[2][2] * V.Z
+        );
+    }
+}
+
+void TransformPositionsSoA(float* OutX, float* OutY, float* OutZ, const float* InX, const float* InY, const float* InZ, int32 Num, const FMatrix& Matrix)
+{
+    const auto& M = Matrix.M;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const float X = InX[Index];
+        const float Y = InY[Index];
+        const float Z = InZ[Index];
+        OutX[Index] = M[0][0] * X + M[1][0] * Y + M[2][0] * Z + M[3][0];
+        OutY[Index] = M[0][1] * X + M[1][1] * Y + M[2][1] * Z + M[3][1];
+        OutZ[Index] = M[0][2] * X + M[1][2] * Y + M[2][2] * Z + M[3][2];
+    }
+}
+
+void TransformBoxes(FBoundingBox* Out, const FBoundingBox* In, const FMatrix* Matrices, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const auto& M = Matrices[Index].M;
+        const FVector Center = (In[Index].MinLocation + In[Index].MaxLocation) * 0.5f;
+        const FVector Extent = (In[Index].MaxLocation - In[Index].MinLocation) * 0.5f;
+
+        FVector NewCenter, NewExtent;
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            NewCenter[Col] = M[0][Col] * Center.X + M[1][Col] * Center.Y + M[2][Col] * Center.Z + M[3][Col];
+            NewExtent[Col] = std::abs(M[0][Col]) * Extent.X + std::abs(M[1][Col]) * Extent.Y + std::abs(M[2][Col]) * Extent.Z;
+        }
+        Out[Index].MinLocation = NewCenter - NewExtent;
+        Out[Index].MaxLocation = NewCenter + NewExtent;
+    }
+}
+
+void QuatsToMatrices(FMatrix* Out, const FQuat* In, int32 Num)
+{
+    // FQuat::ToMatrix와 같은 식입니다.
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FQuat& Q = In[Index];
+        const float X2 = Q.X + Q.X;    const float Y2 = Q.Y + Q.Y;    const float Z2 = Q.Z + Q.Z;
+        const float XX = Q.X * X2;     const float XY = Q.X * Y2;     const float XZ = Q.X * Z2;
+        const float YY = Q.Y * Y2;     const float YZ = Q.Y * Z2;     const float ZZ = Q.Z * Z2;
+        const float WX = Q.W * X2;     const float WY = Q.W * Y2;     const float WZ = Q.W * Z2;
+
+        auto& M = Out[Index].M;
+        M[0][0] = 1.0f - (YY + ZZ);    M[0][1] = XY + WZ;             M[0][2] = XZ - WY;             M[0][3] = 0.0f;
+        M[1][0] = XY - WZ;             M[1][1] = 1.0f - (XX + ZZ);    M[1][2] = YZ + WX;             M[1][3] = 0.0f;
+        M[2][0] = XZ + WY;             M[2][1] = YZ - WX;             M[2][2] = 1.0f - (XX + YY);    M[2][3] = 0.0f;
+        M[3][0] = 0.0f;                M[3][1] = 0.0f;                M[3][2] = 0.0f;                M[3][3] = 1.0f;
+    }
+}
+
+void MultiplyQuats(FQuat* Out, const FQuat* A, const FQuat* B, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FQuat Q1 = A[Index];
+        const FQuat Q2 = B[Index];
+        Out[Index] = FQuat(
+            Q1.W * Q2.X + Q1.X * Q2.W + Q1.Y * Q2.Z - Q1.Z * Q2.Y,
+            Q1.W * Q2.Y - Q1.X * Q2.Z + Q1.Y * Q2.W + Q1.Z * Q2.X,
+            Q1.W * Q2.Z + Q1.X * Q2.Y - Q1.Y * Q2.X + Q1.Z * Q2.W,
+            Q1.W * Q2.W - Q1.X * Q2.X - Q1.Y * Q2.Y - Q1.Z * Q2.Z
+        );
+    }
+}
+
+FORCEINLINE FQuat NormalizeQuat(const FQuat& Q)
+{
+    const float SquareSum = Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W;
+    if (SquareSum >= SMALL_NUMBER)
+    {
+        const float Scale = 1.0f / std::sqrt(SquareSum);
+        return FQuat(Q.X * Scale, Q.Y * Scale, Q.Z * Scale, Q.W * Scale);
+    }
+    return FQuat::Identity;
+}
+
+void NormalizeQuats(FQuat* Out, const FQuat* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = NormalizeQuat(In[Index]);
+    }
+}
+
+void NlerpQuats(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FQuat Q1 = A[Index];
+        const FQuat Q2 = B[Index];
+        const float Dot = Q1.X * Q2.X + Q1.Y * Q2.Y + Q1.Z * Q2.Z + Q1.W * Q2.W;
+        const float Scale0 = 1.0f - Alpha;
+        const float Scale1 = Dot >= 0.0f ? Alpha : -Alpha;
+        Out[Index] = NormalizeQuat(FQuat(
+            Scale0 * Q1.X + Scale1 * Q2.X,
+            Scale0 * Q1.Y + Scale1 * Q2.Y,
+            Scale0 * Q1.Z + Scale1 * Q2.Z,
+            Scale0 * Q1.W + Scale1 * Q2.W
+        ));
+    }
+}
+
+void SlerpQuats(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FQuat::Slerp(A[Index], B[Index], Alpha);
+    }
+}
+
+void RotateVectors(FVector* Out, const FQuat* Quats, const FVector* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const FQuat& Q = Quats[Index];
+        const FVector V = In[Index];
+
+        // T = 2 * (Q x V), V + W * T + Q x T
+        const FVector T(
+            2.0f * (Q.Y * V.Z - Q.Z * V.Y),
+            2.0f * (Q.Z * V.X - Q.X * V.Z),
+            2.0f * (Q.X * V.Y - Q.Y * V.X)
+        );
+        Out[Index] = FVector(
+            V.X + Q.W * T.X + (Q.Y * T.Z - Q.Z * T.Y),
+            V.Y + Q.W * T.Y + (Q.Z * T.X - Q.X * T.Z),
+            V.Z + Q.W * T.Z + (Q.X * T.Y - Q.Y * T.X)
+        );
+    }
+}
+
+void Sin(float* Out, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::Sin(In[Index]);
+    }
+}
+
+void Cos(float* Out, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::Cos(In[Index]);
+    }
+}
+
+void SinCos(float* OutSin, float* OutCos, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        FMath::SinCos(&OutSin[Index], &OutCos[Index], In[Index]);
+    }
+}
+
+void Atan2(float* Out, const float* Y, const float* X, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::Atan2(Y[Index], X[Index]);
+    }
+}
+
+void Exp(float* Out, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::Exp(In[Index]);
+    }
+}
+
+void InvSqrt(float* Out, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::InvSqrt(In[Index]);
+    }
+}
+
+void PerlinNoise1D(float* Out, const float* In, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Out[Index] = FMath::PerlinNoise1D(In[Index]);
+    }
+}
+}
+
+
+namespace SSE41
+{
+using SSE::VectorReplicateTemplate;
+
+void MultiplyMatrix(FMatrix* Out, const FMatrix* A, const FMatrix* B)
+{
+    SSE::VectorMatrixMultiply(Out, A, B);
+}
+
+bool InverseMatrix(FMatrix* Out, const FMatrix* In)
+{
+    return SSE::InverseMatrix(Out, In);
+}
+
+void MultiplyMatrices(FMatrix* Out, const FMatrix* A, const FMatrix* B, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        SSE::VectorMatrixMultiply(&Out[Index], &A[Index], &B[Index]);
+    }
+}
+
+void TransformVector4s(FVector4* Out, const FVector4* In, int32 Num, const FMatrix& Matrix)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        SSE::TransformVector4_SSE(&Out[Index], &In[Index], &Matrix);
+    }
+}
+
+void TransformPositions(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const VectorRegister4Float V = SSE::VectorLoadFloat3(&In[Index].X);
+        SSE::VectorStoreFloat3(SSE::VectorDivideByW(SSE::VectorTransformPosition(V, &Matrix)), &Out[Index].X);
+    }
+}
+
+void TransformVectors(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const VectorRegister4Float V = SSE::VectorLoadFloat3(&In[Index].X);
+        SSE::VectorStoreFloat3(SSE::VectorTransformNormal(V, &Matrix), &Out[Index].X);
+    }
+}
+
+void TransformPositionsSoA(float* OutX, float* OutY, float* OutZ, const float* InX, const float* InY, const float* InZ, int32 Num, const FMatrix& Matrix)
+{
+    // 행렬의 원소를 하나씩 레지스터 전체에 복제해 두고, 4개의 점을 한 번에 변환합니다.
+    VectorRegister4Float M[4][3];
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            M[Row][Col] = _mm_set1_ps(Matrix.M[Row][Col]);
+        }
+    }
+    float* const Outs[3] = { OutX, OutY, OutZ };
+
+    int32 Index = 0;
+    for (; Index + 4 <= Num; Index += 4)
+    {
+        const VectorRegister4Float X = _mm_loadu_ps(InX + Index);
+        const VectorRegister4Float Y = _mm_loadu_ps(InY + Index);
+        const VectorRegister4Float Z = _mm_loadu_ps(InZ + Index);
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            VectorRegister4Float Result = _mm_add_ps(_mm_mul_ps(X, M[0][Col]), M[3][Col]);
+            Result = _mm_add_ps(Result, _mm_mul_ps(Y, M[1][Col]));
+            Result = _mm_add_ps(Result, _mm_mul_ps(Z, M[2][Col]));
+            _mm_storeu_ps(Outs[Col] + Index, Result);
+        }
+    }
+    Scalar::TransformPositionsSoA(OutX + Index, OutY + Index, OutZ + Index, InX + Index, InY + Index, InZ + Index, Num - Index, Matrix);
+}
+
+/** FBoundingBox의 MinLocation, MaxLocation은 각각 pad를 포함해 16byte이므로 한 번에 읽고 씁니다. */
+void TransformBoxes(FBoundingBox* Out, const FBoundingBox* In, const FMatrix* Matrices, int32 Num)
+{
+    const VectorRegister4Float Half = _mm_set1_ps(0.5f);
+    const VectorRegister4Float SignMask = _mm_set1_ps(-0.0f);
+
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const VectorRegister4Float Min = _mm_loadu_ps(&In[Index].MinLocation.X);
+        const VectorRegister4Float Max = _mm_loadu_ps(&In[Index].MaxLocation.X);
+        const VectorRegister4Float Center = _mm_mul_ps(_mm_add_ps(Min, Max), Half);
+        const VectorRegister4Float Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+        const FMatrix& Matrix = Matrices[Index];
+        const VectorRegister4Float Row0 = _mm_loadu_ps(Matrix.M[0]);
+        const VectorRegister4Float Row1 = _mm_loadu_ps(Matrix.M[1]);
+        const VectorRegister4Float Row2 = _mm_loadu_ps(Matrix.M[2]);
+        const VectorRegister4Float Row3 = _mm_loadu_ps(Matrix.M[3]);
+
+        VectorRegister4Float NewCenter = _mm_add_ps(_mm_mul_ps(VectorReplicate(Center, 0), Row0), Row3);
+        NewCenter = _mm_add_ps(NewCenter, _mm_mul_ps(VectorReplicate(Center, 1), Row1));
+        NewCenter = _mm_add_ps(NewCenter, _mm_mul_ps(VectorReplicate(Center, 2), Row2));
+
+        // 절반 크기는 행렬 원소의 절대값으로 변환해야 모든 꼭짓점을 담습니다.
+        VectorRegister4Float NewExtent = _mm_mul_ps(VectorReplicate(Extent, 0), _mm_andnot_ps(SignMask, Row0));
+        NewExtent = _mm_add_ps(NewExtent, _mm_mul_ps(VectorReplicate(Extent, 1), _mm_andnot_ps(SignMask, Row1)));
+        NewExtent = _mm_add_ps(NewExtent, _mm_mul_ps(VectorReplicate(Extent, 2), _mm_andnot_ps(SignMask, Row2)));
+
+        _mm_storeu_ps(&Out[Index].MinLocation.X, _mm_sub_ps(NewCenter, NewExtent));
+        _mm_storeu_ps(&Out[Index].MaxLocation.X, _mm_add_ps(NewCenter, NewExtent));
+    }
+}
+
+/** 4개의 Quat를 전치해 성분별 레지스터로 계산한 뒤, 다시 전치해 각 행렬의 행으로 씁니다. */
+void QuatsToMatrices(FMatrix* Out, const FQuat* In, int32 Num)
+{
+    const VectorRegister4Float One = _mm_set1_ps(1.0f);
+    const VectorRegister4Float LastRow = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+    int32 Index = 0;
+    for (; Index + 4 <= Num; Index += 4)
+    {
+        VectorRegister4Float X = _mm_loadu_ps(&In[Index + 0].X);
+        VectorRegister4Float Y = _mm_loadu_ps(&In[Index + 1].X);
+        VectorRegister4Float Z = _mm_loadu_ps(&In[Index + 2].X);
+        VectorRegister4Float W = _mm_loadu_ps(&In[Index + 3].X);
+        _MM_TRANSPOSE4_PS(X, Y, Z, W);
+
+        const VectorRegister4Float X2 = _mm_add_ps(X, X);
+        const VectorRegister4Float Y2 = _mm_add_ps(Y, Y);
+        const VectorRegister4Float Z2 = _mm_add_ps(Z, Z);
+        const VectorRegister4Float XX = _mm_mul_ps(X, X2);
+        const VectorRegister4Float XY = _mm_mul_ps(X, Y2);
+        const VectorRegister4Float XZ = _mm_mul_ps(X, Z2);
+        const VectorRegister4Float YY = _mm_mul_ps(Y, Y2);
+        const VectorRegister4Float YZ = _mm_mul_ps(Y, Z2);
+        const VectorRegister4Float ZZ = _mm_mul_ps(Z, Z2);
+        const VectorRegister4Float WX = _mm_mul_ps(W, X2);
+        const VectorRegister4Float WY = _mm_mul_ps(W, Y2);
+        const VectorRegister4Float WZ = _mm_mul_ps(W, Z2);
+
+        VectorRegister4Float Row0[4] = { _mm_sub_ps(One, _mm_add_ps(YY, ZZ)), _mm_add_ps(XY, WZ), _mm_sub_ps(XZ, WY), _mm_setzero_ps() };
+        VectorRegister4Float Row1[4] = { _mm_sub_ps(XY, WZ), _mm_sub_ps(One, _mm_add_ps(XX, ZZ)), _mm_add_ps(YZ, WX), _mm_setzero_ps() };
+        VectorRegister4Float Row2[4] = { _mm_add_ps(XZ, WY), _mm_sub_ps(YZ, WX), _mm_sub_ps(One, _mm_add_ps(XX, YY)), _mm_setzero_ps() };
+        _MM_TRANSPOSE4_PS(Row0[0], Row0[1], Row0[2], Row0[3]);
+        _MM_TRANSPOSE4_PS(Row1[0], Row1[1], Row1[2], Row1[3]);
+        _MM_TRANSPOSE4_PS(Row2[0], Row2[1], Row2[2], Row2[3]);
+
+        for (int32 Offset = 0; Offset < 4; ++Offset)
+        {
+            FMatrix& Result = Out[Index + Offset];
+            _mm_storeu_ps(Result.M[0], Row0[Offset]);
+            _mm_storeu_ps(Result.M[1], Row1[Offset]);
+            _mm_storeu_ps(Result.M[2], Row2[Offset]);
+            _mm_storeu_ps(Result.M[3], LastRow);
+        }
+    }
+    Scalar::QuatsToMatrices(Out + Index, In + Index, Num - Index);
+}
+}
+
+
+/**
+ * 256bit 레지스터의 두 128bit Lane에 서로 다른 Vector를 넣고, 행렬의 각 행을 양쪽 Lane에 복제해 두 개씩 변환합니다.
+ * MSVC는 /arch 옵션과 관계없이 AVX2 Intrinsic을 컴파일하므로, 이 함수들은 CPU가 지원할 때만 호출되어야 합니다.
+ */
+namespace AVX2
+{
+using VectorRegister8Float = __m256;
+
+/** 각 Lane의 Index번째 원소를 그 Lane 전체에 복제합니다. */
+template <int Index>
+FORCEINLINE VectorRegister8Float VectorReplicate8(const VectorRegister8Float& Vector)
+{
+    return _mm256_shuffle_ps(Vector, Vector, SHUFFLEMASK(Index, Index, Index, Index));
+}
+
+struct FMatrixRows8
+{
+    VectorRegister8Float Rows[4];
+
+    explicit FMatrixRows8(const FMatrix& Matrix)
+    {
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            Rows[Row] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.M[Row]));
+        }
+    }
+
+    FORCEINLINE VectorRegister8Float TransformVector4(const VectorRegister8Float& V) const
+    {
+        VectorRegister8Float Result = _mm256_mul_ps(VectorReplicate8<0>(V), Rows[0]);
+        Result = _mm256_fmadd_ps(VectorReplicate8<1>(V), Rows[1], Result);
+        Result = _mm256_fmadd_ps(VectorReplicate8<2>(V), Rows[2], Result);
+        return _mm256_fmadd_ps(VectorReplicate8<3>(V), Rows[3], Result);
+    }
+
+    /** W를 1로 봅니다. */
+    FORCEINLINE VectorRegister8Float TransformPosition(const VectorRegister8Float& V) const
+    {
+        VectorRegister8Float Result = _mm256_fmadd_ps(VectorReplicate8<0>(V), Rows[0], Rows[3]);
+        Result = _mm256_fmadd_ps(VectorReplicate8<1>(V), Rows[1], Result);
+        return _mm256_fmadd_ps(VectorReplicate8<2>(V), Rows[2], Result);
+    }
+
+    /** W를 0으로 봅니다. */
+    FORCEINLINE VectorRegister8Float TransformVector(const VectorRegister8Float& V) const
+    {
+        VectorRegister8Float Result = _mm256_mul_ps(VectorReplicate8<0>(V), Rows[0]);
+        Result = _mm256_fmadd_ps(VectorReplicate8<1>(V), Rows[1], Result);
+        return _mm256_fmadd_ps(VectorReplicate8<2>(V), Rows[2], Result);
+    }
+};
+
+/** 네 레지스터를 각 128bit Lane 안에서 4x4 행렬처럼 전치합니다. (_MM_TRANSPOSE4_PS의 256bit 판) */
+FORCEINLINE void TransposeInLanes(VectorRegister8Float& V0, VectorRegister8Float& V1, VectorRegister8Float& V2, VectorRegister8Float& V3)
+{
+    const VectorRegister8Float T0 = _mm256_unpacklo_ps(V0, V1);
+    const VectorRegister8Float T1 = _mm256_unpacklo_ps(V2, V3);
+    const VectorRegister8Float T2 = _mm256_unpackhi_ps(V0, V1);
+    const VectorRegister8Float T3 = _mm256_unpackhi_ps(V2, V3);
+    V0 = _mm256_shuffle_ps(T0, T1, SHUFFLEMASK(0, 1, 0, 1));
+    V1 = _mm256_shuffle_ps(T0, T1, SHUFFLEMASK(2, 3, 2, 3));
+    V2 = _mm256_shuffle_ps(T2, T3, SHUFFLEMASK(0, 1, 0, 1));
+    V3 = _mm256_shuffle_ps(T2, T3, SHUFFLEMASK(2, 3, 2, 3));
+}
+
+/** 두 128bit 값을 아래, 위 Lane에 넣습니다. */
+FORCEINLINE VectorRegister8Float VectorLoadPair(const float* Low, const float* High)
+{
+    return _mm256_set_m128(_mm_loadu_ps(High), _mm_loadu_ps(Low));
+}
+
+void MultiplyMatrix(FMatrix* Out, const FMatrix* A, const FMatrix* B)
+{
+    // A의 두 행을 한 레지스터에 넣고 B로 변환합니다.
+    const FMatrixRows8 BRows(*B);
+    const VectorRegister8Float R01 = BRows.TransformVector4(_mm256_loadu_ps(A->M[0]));
+    const VectorRegister8Float R23 = BRows.TransformVector4(_mm256_loadu_ps(A->M[2]));
+
+    // Out이 A나 B와 같을 수 있으므로 모두 계산한 뒤에 씁니다.
+    _mm256_storeu_ps(Out->M[0], R01);
+    _mm256_storeu_ps(Out->M[2], R23);
+}
+
+void MultiplyMatrices(FMatrix* Out, const FMatrix* A, const FMatrix* B, int32 Num)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        MultiplyMatrix(&Out[Index], &A[Index], &B[Index]);
+    }
+}
+
+void TransformVector4s(FVector4* Out, const FVector4* In, int32 Num, const FMatrix& Matrix)
+{
+    const FMatrixRows8 Rows(Matrix);
+
+    int32 Index = 0;
+    for (; Index + 2 <= Num; Index += 2)
+    {
+        const VectorRegister8Float V = _mm256_loadu_ps(&In[Index].X);
+        _mm256_storeu_ps(&Out[Index].X, Rows.TransformVector4(V));
+    }
+    if (Index < Num)
+    {
+        SSE::TransformVector4_SSE(&Out[Index], &In[Index], &Matrix);
+    }
+}
+
+void TransformPositions(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    const FMatrixRows8 Rows(Matrix);
+    const VectorRegister8Float Zero = _mm256_setzero_ps();
+
+    int32 Index = 0;
+    for (; Index + 2 <= Num; Index += 2)
+    {
+        const VectorRegister8Float V = _mm256_set_m128(SSE::VectorLoadFloat3(&In[Index + 1].X), SSE::VectorLoadFloat3(&In[Index].X));
+        VectorRegister8Float Result = Rows.TransformPosition(V);
+
+        // W가 0이 아닌 경우에만 W로 나눕니다.
+        const VectorRegister8Float W = VectorReplicate8<3>(Result);
+        Result = _mm256_blendv_ps(Result, _mm256_div_ps(Result, W), _mm256_cmp_ps(W, Zero, _CMP_NEQ_UQ));
+
+        SSE::VectorStoreFloat3(_mm256_castps256_ps128(Result), &Out[Index].X);
+        SSE::VectorStoreFloat3(_mm256_extractf128_ps(Result, 1), &Out[Index + 1].X);
+    }
+    if (Index < Num)
+    {
+        const VectorRegister4Float V = SSE::VectorLoadFloat3(&In[Index].X);
+        SSE::VectorStoreFloat3(SSE::VectorDivideByW(SSE::VectorTransformPosition(V, &Matrix)), &Out[Index].X);
+    }
+}
+
+void TransformVectors(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix)
+{
+    const FMatrixRows8 Rows(Matrix);
+
+    int32 Index = 0;
+    for (; Index + 2 <= Num; Index += 2)
+    {
+        const VectorRegister8Float V = _mm256_set_m128(SSE::VectorLoadFloat3(&In[Index + 1].X), SSE::VectorLoadFloat3(&In[Index].X));
+        const VectorRegister8Float Result = Rows.TransformVector(V);
+        SSE::VectorStoreFloat3(_mm256_castps256_ps128(Result), &Out[Index].X);
+        SSE::VectorStoreFloat3(_mm256_extractf128_ps(Result, 1), &Out[Index + 1].X);
+    }
+    if (Index < Num)
+    {
+        SSE41::TransformVectors(&Out[Index], &In[Index], 1, Matrix);
+    }
+}
+
+void TransformPositionsSoA(float* OutX, float* OutY, float* OutZ, const float* InX, const float* InY, const float* InZ, int32 Num, const FMatrix& Matrix)
+{
+    VectorRegister8Float M[4][3];
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            M[Row][Col] = _mm256_set1_ps(Matrix.M[Row][Col]);
+        }
+    }
+    float* const Outs[3] = { OutX, OutY, OutZ };
+
+    int32 Index = 0;
+    for (; Index + 8 <= Num; Index += 8)
+    {
+        const VectorRegister8Float X = _mm256_loadu_ps(InX + Index);
+        const VectorRegister8Float Y = _mm256_loadu_ps(InY + Index);
+        const VectorRegister8Float Z = _mm256_loadu_ps(InZ + Index);
+        for (int32 Col = 0; Col < 3; ++Col)
+        {
+            VectorRegister8Float Result = _mm256_fmadd_ps(X, M[0][Col], M[3][Col]);
+            Result = _mm256_fmadd_ps(Y, M[1][Col], Result);
+            Result = _mm256_fmadd_ps(Z, M[2][Col], Result);
+            _mm256_storeu_ps(Outs[Col] + Index, Result);
+        }
+    }
+    SSE41::TransformPositionsSoA(OutX + Index, OutY + Index, OutZ + Index, InX + Index, InY + Index, InZ + Index, Num - Index, Matrix);
+}
+
+/** SSE4.1 구현과 같지만, 아래 Lane에 0~3번, 위 Lane에 4~7번 Quat를 넣어 8개씩 계산합니다. */
+void QuatsToMatrices(FMatrix* Out, const FQuat* In, int32 Num)
+{
+    const VectorRegister8Float One = _mm256_set1_ps(1.0f);
+    const VectorRegister8Float Zero = _mm256_setzero_ps();
+    const VectorRegister8Float LastRow = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+    int32 Index = 0;
+    for (; Index + 8 <= Num; Index += 8)
+    {
+        VectorRegister8Float X = VectorLoadPair(&In[Index + 0].X, &In[Index + 4].X);
+        VectorRegister8Float Y = VectorLoadPair(&In[Index + 1].X, &In[Index + 5].X);
+        VectorRegister8Float Z = VectorLoadPair(&In[Index + 2].X, &In[Index + 6].X);
+        VectorRegister8Float W = VectorLoadPair(&In[Index + 3].X, &In[Index + 7].X);
+        TransposeInLanes(X, Y, Z, W);
+
+        const VectorRegister8Float X2 = _mm256_add_ps(X, X);
+        const VectorRegister8Float Y2 = _mm256_add_ps(Y, Y);
+        const VectorRegister8Float Z2 = _mm256_add_ps(Z, Z);
+        const VectorRegister8Float XX = _mm256_mul_ps(X, X2);
+        const VectorRegister8Float XY = _mm256_mul_ps(X, Y2);
+        const VectorRegister8Float XZ = _mm256_mul_ps(X, Z2);
+        const VectorRegister8Float YY = _mm256_mul_ps(Y, Y2);
+        const VectorRegister8Float YZ = _mm256_mul_ps(Y, Z2);
+        const VectorRegister8Float ZZ = _mm256_mul_ps(Z, Z2);
+        const VectorRegister8Float WX = _mm256_mul_ps(W, X2);
+        const VectorRegister8Float WY = _mm256_mul_ps(W, Y2);
+        const VectorRegister8Float WZ = _mm256_mul_ps(W, Z2);
+
+        VectorRegister8Float Row0[4] = { _mm256_sub_ps(One, _mm256_add_ps(YY, ZZ)), _mm256_add_ps(XY, WZ), _mm256_sub_ps(XZ, WY), Zero };
+        VectorRegister8Float Row1[4] = { _mm256_sub_ps(XY, WZ), _mm256_sub_ps(One, _mm256_add_ps(XX, ZZ)), _mm256_add_ps(YZ, WX), Zero };
+        VectorRegister8Float Row2[4] = { _mm256_add_ps(XZ, WY), _mm256_sub_ps(YZ, WX), _mm256_sub_ps(One, _mm256_add_ps(XX, YY)), Zero };
+        TransposeInLanes(Row0[0], Row0[1], Row0[2], Row0[3]);
+        TransposeInLanes(Row1[0], Row1[1], Row1[2], Row1[3]);
+        TransposeInLanes(Row2[0], Row2[1], Row2[2], Row2[3]);
+
+        // RowN[Offset]의 아래 Lane은 Index + Offset번, 위 Lane은 Index + Offset + 4번 행렬의 N번째 행입니다.
+        for (int32 Offset = 0; Offset < 4; ++Offset)
+        {
+            FMatrix& Low = Out[Index + Offset];
+            FMatrix& High = Out[Index + Offset + 4];
+            _mm256_storeu_ps(Low.M[0], _mm256_permute2f128_ps(Row0[Offset], Row1[Offset], 0x20));
+            _mm256_storeu_ps(Low.M[2], _mm256_permute2f128_ps(Row2[Offset], LastRow, 0x20));
+            _mm256_storeu_ps(High.M[0], _mm256_permute2f128_ps(Row0[Offset], Row1[Offset], 0x31));
+            _mm256_storeu_ps(High.M[2], _mm256_permute2f128_ps(Row2[Offset], LastRow, 0x31));
+        }
+    }
+    SSE41::QuatsToMatrices(Out + Index, In + Index, Num - Index);
+}
+}
+
+
+/**
+ * Quat 배열 연산은 Quat 여러 개를 전치해 성분별 레지스터(X, Y, Z, W)로 계산합니다.
+ * SSE4.1(4개씩)과 AVX2(8개씩) 구현이 같은 식을 공유하도록, 레지스터 폭마다 연산을 오버로드로 둡니다.
+ * float 배열에 대한 FMath 함수(Sin, Exp 등)도 같은 방식으로 FMath::Fast*의 식을 Lane마다 계산합니다.
+ */
+namespace Wide
+{
+using AVX2::VectorRegister8Float;
+
+template <typename VectorType>
+struct TQuatLanes
+{
+    VectorType X, Y, Z, W;
+};
+
+FORCEINLINE VectorRegister4Float Add(VectorRegister4Float A, VectorRegister4Float B) { return _mm_add_ps(A, B); }
+FORCEINLINE VectorRegister4Float Subtract(VectorRegister4Float A, VectorRegister4Float B) { return _mm_sub_ps(A, B); }
+FORCEINLINE VectorRegister4Float Multiply(VectorRegister4Float A, VectorRegister4Float B) { return _mm_mul_ps(A, B); }
+FORCEINLINE VectorRegister4Float MultiplyAdd(VectorRegister4Float A, VectorRegister4Float B, VectorRegister4Float C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+FORCEINLINE VectorRegister4Float Divide(VectorRegister4Float A, VectorRegister4Float B) { return _mm_div_ps(A, B); }
+FORCEINLINE VectorRegister4Float Sqrt(VectorRegister4Float A) { return _mm_sqrt_ps(A); }
+FORCEINLINE VectorRegister4Float Xor(VectorRegister4Float A, VectorRegister4Float B) { return _mm_xor_ps(A, B); }
+FORCEINLINE VectorRegister4Float And(VectorRegister4Float A, VectorRegister4Float B) { return _mm_and_ps(A, B); }
+FORCEINLINE VectorRegister4Float CompareLess(VectorRegister4Float A, VectorRegister4Float B) { return _mm_cmplt_ps(A, B); }
+FORCEINLINE VectorRegister4Float CompareGreaterEqual(VectorRegister4Float A, VectorRegister4Float B) { return _mm_cmpge_ps(A, B); }
+/** Mask가 참인 Lane은 A, 아니면 B */
+FORCEINLINE VectorRegister4Float Select(VectorRegister4Float Mask, VectorRegister4Float A, VectorRegister4Float B) { return _mm_blendv_ps(B, A, Mask); }
+FORCEINLINE void Splat(VectorRegister4Float& Out, float Value) { Out = _mm_set1_ps(Value); }
+FORCEINLINE VectorRegister4Float Min(VectorRegister4Float A, VectorRegister4Float B) { return _mm_min_ps(A, B); }
+FORCEINLINE VectorRegister4Float Max(VectorRegister4Float A, VectorRegister4Float B) { return _mm_max_ps(A, B); }
+/** ~A & B */
+FORCEINLINE VectorRegister4Float AndNot(VectorRegister4Float A, VectorRegister4Float B) { return _mm_andnot_ps(A, B); }
+FORCEINLINE VectorRegister4Float CompareGreater(VectorRegister4Float A, VectorRegister4Float B) { return _mm_cmpgt_ps(A, B); }
+FORCEINLINE VectorRegister4Float Floor(VectorRegister4Float A) { return _mm_floor_ps(A); }
+FORCEINLINE VectorRegister4Float Round(VectorRegister4Float A) { return _mm_round_ps(A, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+FORCEINLINE VectorRegister4Float ReciprocalSqrtEstimate(VectorRegister4Float A) { return _mm_rsqrt_ps(A); }
+FORCEINLINE void Load(VectorRegister4Float& Out, const float* In) { Out = _mm_loadu_ps(In); }
+FORCEINLINE void Store(float* Out, VectorRegister4Float V) { _mm_storeu_ps(Out, V); }
+
+/** 정수 Lane, 실수 Lane과 비트를 그대로 바꿔 지수나 부호 비트를 다룹니다. */
+FORCEINLINE __m128i ToInt(VectorRegister4Float A) { return _mm_cvttps_epi32(A); }
+FORCEINLINE VectorRegister4Float ToFloat(__m128i A) { return _mm_cvtepi32_ps(A); }
+FORCEINLINE __m128i AsInt(VectorRegister4Float A) { return _mm_castps_si128(A); }
+FORCEINLINE VectorRegister4Float AsFloat(__m128i A) { return _mm_castsi128_ps(A); }
+FORCEINLINE __m128i Add(__m128i A, __m128i B) { return _mm_add_epi32(A, B); }
+FORCEINLINE __m128i And(__m128i A, __m128i B) { return _mm_and_si128(A, B); }
+template <int32 Count> FORCEINLINE __m128i ShiftLeft(__m128i A) { return _mm_slli_epi32(A, Count); }
+template <int32 Count> FORCEINLINE __m128i ShiftRightArithmetic(__m128i A) { return _mm_srai_epi32(A, Count); }
+FORCEINLINE void Splat(__m128i& Out, int32 Value) { Out = _mm_set1_epi32(Value); }
+
+/** Table[Index[i]]를 Lane마다 읽습니다. SSE4.1에는 Gather가 없어 하나씩 읽습니다. */
+FORCEINLINE __m128i Gather(const int32* Table, __m128i Index)
+{
+    return _mm_setr_epi32(
+        Table[_mm_extract_epi32(Index, 0)], Table[_mm_extract_epi32(Index, 1)],
+        Table[_mm_extract_epi32(Index, 2)], Table[_mm_extract_epi32(Index, 3)]
+    );
+}
+
+FORCEINLINE VectorRegister8Float Add(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_add_ps(A, B); }
+FORCEINLINE VectorRegister8Float Subtract(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_sub_ps(A, B); }
+FORCEINLINE VectorRegister8Float Multiply(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_mul_ps(A, B); }
+FORCEINLINE VectorRegister8Float MultiplyAdd(VectorRegister8Float A, VectorRegister8Float B, VectorRegister8Float C) { return _mm256_fmadd_ps(A, B, C); }
+FORCEINLINE VectorRegister8Float Divide(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_div_ps(A, B); }
+FORCEINLINE VectorRegister8Float Sqrt(VectorRegister8Float A) { return _mm256_sqrt_ps(A); }
+FORCEINLINE VectorRegister8Float Xor(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_xor_ps(A, B); }
+FORCEINLINE VectorRegister8Float And(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_and_ps(A, B); }
+FORCEINLINE VectorRegister8Float CompareLess(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+FORCEINLINE VectorRegister8Float CompareGreaterEqual(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_cmp_ps(A, B, _CMP_GE_OQ); }
+FORCEINLINE VectorRegister8Float Select(VectorRegister8Float Mask, VectorRegister8Float A, VectorRegister8Float B) { return _mm256_blendv_ps(B, A, Mask); }
+FORCEINLINE void Splat(VectorRegister8Float& Out, float Value) { Out = _mm256_set1_ps(Value); }
+FORCEINLINE VectorRegister8Float Min(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_min_ps(A, B); }
+FORCEINLINE VectorRegister8Float Max(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_max_ps(A, B); }
+FORCEINLINE VectorRegister8Float AndNot(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_andnot_ps(A, B); }
+FORCEINLINE VectorRegister8Float CompareGreater(VectorRegister8Float A, VectorRegister8Float B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+FORCEINLINE VectorRegister8Float Floor(VectorRegister8Float A) { return _mm256_floor_ps(A); }
+FORCEINLINE VectorRegister8Float Round(VectorRegister8Float A) { return _mm256_round_ps(A, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+FORCEINLINE VectorRegister8Float ReciprocalSqrtEstimate(VectorRegister8Float A) { return _mm256_rsqrt_ps(A); }
+FORCEINLINE void Load(VectorRegister8Float& Out, const float* In) { Out = _mm256_loadu_ps(In); }
+FORCEINLINE void Store(float* Out, VectorRegister8Float V) { _mm256_storeu_ps(Out, V); }
+
+FORCEINLINE __m256i ToInt(VectorRegister8Float A) { return _mm256_cvttps_epi32(A); }
+FORCEINLINE VectorRegister8Float ToFloat(__m256i A) { return _mm256_cvtepi32_ps(A); }
+FORCEINLINE __m256i AsInt(VectorRegister8Float A) { return _mm256_castps_si256(A); }
+FORCEINLINE VectorRegister8Float AsFloat(__m256i A) { return _mm256_castsi256_ps(A); }
+FORCEINLINE __m256i Add(__m256i A, __m256i B) { return _mm256_add_epi32(A, B); }
+FORCEINLINE __m256i And(__m256i A, __m256i B) { return _mm256_and_si256(A, B); }
+template <int32 Count> FORCEINLINE __m256i ShiftLeft(__m256i A) { return _mm256_slli_epi32(A, Count); }
+template <int32 Count> FORCEINLINE __m256i ShiftRightArithmetic(__m256i A) { return _mm256_srai_epi32(A, Count); }
+FORCEINLINE void Splat(__m256i& Out, int32 Value) { Out = _mm256_set1_epi32(Value); }
+FORCEINLINE __m256i Gather(const int32* Table, __m256i Index) { return _mm256_i32gather_epi32(Table, Index, 4); }
+
+template <typename VectorType>
+FORCEINLINE VectorType Splat(float Value)
+{
+    VectorType Result;
+    Splat(Result, Value);
+    return Result;
+}
+
+/** 실수 레지스터와 같은 폭의 정수 레지스터 */
+template <typename VectorType>
+using TIntVector = decltype(ToInt(std::declval<VectorType>()));
+
+template <typename VectorType>
+FORCEINLINE TIntVector<VectorType> SplatInt(int32 Value)
+{
+    TIntVector<VectorType> Result;
+    Splat(Result, Value);
+    return Result;
+}
+
+/** In에서 Count개를 읽고, 레지스터 폭에 모자라는 Lane은 0으로 채웁니다. */
+template <typename VectorType>
+FORCEINLINE VectorType LoadFloats(const float* In, int32 Count)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+
+    VectorType Result;
+    if (Count == Width)
+    {
+        Load(Result, In);
+    }
+    else
+    {
+        alignas(32) float Buffer[Width] = {};
+        std::memcpy(Buffer, In, sizeof(float) * Count);
+        Load(Result, Buffer);
+    }
+    return Result;
+}
+
+template <typename VectorType>
+FORCEINLINE void StoreFloats(float* Out, const VectorType& V, int32 Count)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+
+    if (Count == Width)
+    {
+        Store(Out, V);
+    }
+    else
+    {
+        alignas(32) float Buffer[Width];
+        Store(Buffer, V);
+        std::memcpy(Out, Buffer, sizeof(float) * Count);
+    }
+}
+
+/** In[0..3]을 전치해 읽습니다. */
+FORCEINLINE void Load(TQuatLanes<VectorRegister4Float>& Out, const FQuat* In)
+{
+    Out = { _mm_loadu_ps(&In[0].X), _mm_loadu_ps(&In[1].X), _mm_loadu_ps(&In[2].X), _mm_loadu_ps(&In[3].X) };
+    _MM_TRANSPOSE4_PS(Out.X, Out.Y, Out.Z, Out.W);
+}
+
+FORCEINLINE void Store(FQuat* Out, TQuatLanes<VectorRegister4Float> Quats)
+{
+    _MM_TRANSPOSE4_PS(Quats.X, Quats.Y, Quats.Z, Quats.W);
+    _mm_storeu_ps(&Out[0].X, Quats.X);
+    _mm_storeu_ps(&Out[1].X, Quats.Y);
+    _mm_storeu_ps(&Out[2].X, Quats.Z);
+    _mm_storeu_ps(&Out[3].X, Quats.W);
+}
+
+/** W는 0으로 채웁니다. */
+FORCEINLINE void Load(TQuatLanes<VectorRegister4Float>& Out, const FVector* In)
+{
+    Out = { SSE::VectorLoadFloat3(&In[0].X), SSE::VectorLoadFloat3(&In[1].X), SSE::VectorLoadFloat3(&In[2].X), SSE::VectorLoadFloat3(&In[3].X) };
+    _MM_TRANSPOSE4_PS(Out.X, Out.Y, Out.Z, Out.W);
+}
+
+FORCEINLINE void Store(FVector* Out, TQuatLanes<VectorRegister4Float> Vectors)
+{
+    _MM_TRANSPOSE4_PS(Vectors.X, Vectors.Y, Vectors.Z, Vectors.W);
+    SSE::VectorStoreFloat3(Vectors.X, &Out[0].X);
+    SSE::VectorStoreFloat3(Vectors.Y, &Out[1].X);
+    SSE::VectorStoreFloat3(Vectors.Z, &Out[2].X);
+    SSE::VectorStoreFloat3(Vectors.W, &Out[3].X);
+}
+
+/** 아래 Lane에 In[0..3], 위 Lane에 In[4..7]을 전치해 읽습니다. */
+FORCEINLINE void Load(TQuatLanes<VectorRegister8Float>& Out, const FQuat* In)
+{
+    Out = {
+        AVX2::VectorLoadPair(&In[0].X, &In[4].X), AVX2::VectorLoadPair(&In[1].X, &In[5].X),
+        AVX2::VectorLoadPair(&In[2].X, &In[6].X), AVX2::VectorLoadPair(&In[3].X, &In[7].X)
+    };
+    AVX2::TransposeInLanes(Out.X, Out.Y, Out.Z, Out.W);
+}
+
+FORCEINLINE void Store(FQuat* Out, TQuatLanes<VectorRegister8Float> Quats)
+{
+    // 전치하면 Quats.X는 (Out[0] | Out[4]), Quats.Y는 (Out[1] | Out[5])이므로 두 개씩 이어 붙여 씁니다.
+    AVX2::TransposeInLanes(Quats.X, Quats.Y, Quats.Z, Quats.W);
+    _mm256_storeu_ps(&Out[0].X, _mm256_permute2f128_ps(Quats.X, Quats.Y, 0x20));
+    _mm256_storeu_ps(&Out[2].X, _mm256_permute2f128_ps(Quats.Z, Quats.W, 0x20));
+    _mm256_storeu_ps(&Out[4].X, _mm256_permute2f128_ps(Quats.X, Quats.Y, 0x31));
+    _mm256_storeu_ps(&Out[6].X, _mm256_permute2f128_ps(Quats.Z, Quats.W, 0x31));
+}
+
+FORCEINLINE void Load(TQuatLanes<VectorRegister8Float>& Out, const FVector* In)
+{
+    Out = {
+        _mm256_set_m128(SSE::VectorLoadFloat3(&In[4].X), SSE::VectorLoadFloat3(&In[0].X)),
+        _mm256_set_m128(SSE::VectorLoadFloat3(&In[5].X), SSE::VectorLoadFloat3(&In[1].X)),
+        _mm256_set_m128(SSE::VectorLoadFloat3(&In[6].X), SSE::VectorLoadFloat3(&In[2].X)),
+        _mm256_set_m128(SSE::VectorLoadFloat3(&In[7].X), SSE::VectorLoadFloat3(&In[3].X))
+    };
+    AVX2::TransposeInLanes(Out.X, Out.Y, Out.Z, Out.W);
+}
+
+FORCEINLINE void Store(FVector* Out, TQuatLanes<VectorRegister8Float> Vectors)
+{
+    AVX2::TransposeInLanes(Vectors.X, Vectors.Y, Vectors.Z, Vectors.W);
+    const VectorRegister8Float* Rows = &Vectors.X;
+    for (int32 Offset = 0; Offset < 4; ++Offset)
+    {
+        SSE::VectorStoreFloat3(_mm256_castps256_ps128(Rows[Offset]), &Out[Offset].X);
+        SSE::VectorStoreFloat3(_mm256_extractf128_ps(Rows[Offset], 1), &Out[Offset + 4].X);
+    }
+}
+
+template <typename VectorType>
+FORCEINLINE VectorType Dot(const TQuatLanes<VectorType>& A, const TQuatLanes<VectorType>& B)
+{
+    VectorType Result = Multiply(A.X, B.X);
+    Result = MultiplyAdd(A.Y, B.Y, Result);
+    Result = MultiplyAdd(A.Z, B.Z, Result);
+    return MultiplyAdd(A.W, B.W, Result);
+}
+
+/** FQuat::Normalize와 같이, 크기의 제곱이 SMALL_NUMBER보다 작으면 Identity가 됩니다. */
+template <typename VectorType>
+FORCEINLINE void Normalize(TQuatLanes<VectorType>& Q)
+{
+    const VectorType SquareSum = Dot(Q, Q);
+    const VectorType Scale = Divide(Splat<VectorType>(1.0f), Sqrt(SquareSum));
+    const VectorType ValidMask = CompareGreaterEqual(SquareSum, Splat<VectorType>(SMALL_NUMBER));
+    const VectorType Zero = Splat<VectorType>(0.0f);
+
+    Q.X = Select(ValidMask, Multiply(Q.X, Scale), Zero);
+    Q.Y = Select(ValidMask, Multiply(Q.Y, Scale), Zero);
+    Q.Z = Select(ValidMask, Multiply(Q.Z, Scale), Zero);
+    Q.W = Select(ValidMask, Multiply(Q.W, Scale), Splat<VectorType>(1.0f));
+}
+
+/** Dot이 음수인 Lane은 B의 부호를 뒤집어 짧은 경로로 보간하게 합니다. */
+template <typename VectorType>
+FORCEINLINE void AlignHemisphere(const VectorType& Dot, TQuatLanes<VectorType>& B)
+{
+    const VectorType SignFlip = And(CompareLess(Dot, Splat<VectorType>(0.0f)), Splat<VectorType>(-0.0f));
+    B.X = Xor(B.X, SignFlip);
+    B.Y = Xor(B.Y, SignFlip);
+    B.Z = Xor(B.Z, SignFlip);
+    B.W = Xor(B.W, SignFlip);
+}
+
+/** Scale0 * A + Scale1 * B */
+template <typename VectorType>
+FORCEINLINE TQuatLanes<VectorType> Blend(const TQuatLanes<VectorType>& A, const VectorType& Scale0, const TQuatLanes<VectorType>& B, const VectorType& Scale1)
+{
+    return {
+        MultiplyAdd(A.X, Scale0, Multiply(B.X, Scale1)),
+        MultiplyAdd(A.Y, Scale0, Multiply(B.Y, Scale1)),
+        MultiplyAdd(A.Z, Scale0, Multiply(B.Z, Scale1)),
+        MultiplyAdd(A.W, Scale0, Multiply(B.W, Scale1))
+    };
+}
+
+template <typename VectorType>
+void MultiplyQuats(FQuat* Out, const FQuat* A, const FQuat* B, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+
+    int32 Index = 0;
+    for (; Index + Width <= Num; Index += Width)
+    {
+        TQuatLanes<VectorType> Q1, Q2;
+        Load(Q1, A + Index);
+        Load(Q2, B + Index);
+
+        TQuatLanes<VectorType> Result;
+        Result.X = Subtract(MultiplyAdd(Q1.Y, Q2.Z, MultiplyAdd(Q1.X, Q2.W, Multiply(Q1.W, Q2.X))), Multiply(Q1.Z, Q2.Y));
+        Result.Y = MultiplyAdd(Q1.Z, Q2.X, MultiplyAdd(Q1.Y, Q2.W, Subtract(Multiply(Q1.W, Q2.Y), Multiply(Q1.X, Q2.Z))));
+        Result.Z = MultiplyAdd(Q1.Z, Q2.W, Subtract(MultiplyAdd(Q1.X, Q2.Y, Multiply(Q1.W, Q2.Z)), Multiply(Q1.Y, Q2.X)));
+        Result.W = Subtract(Subtract(Subtract(Multiply(Q1.W, Q2.W), Multiply(Q1.X, Q2.X)), Multiply(Q1.Y, Q2.Y)), Multiply(Q1.Z, Q2.Z));
+        Store(Out + Index, Result);
+    }
+    Scalar::MultiplyQuats(Out + Index, A + Index, B + Index, Num - Index);
+}
+
+template <typename VectorType>
+void NormalizeQuats(FQuat* Out, const FQuat* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+
+    int32 Index = 0;
+    for (; Index + Width <= Num; Index += Width)
+    {
+        TQuatLanes<VectorType> Q;
+        Load(Q, In + Index);
+        Normalize(Q);
+        Store(Out + Index, Q);
+    }
+    Scalar::NormalizeQuats(Out + Index, In + Index, Num - Index);
+}
+
+template <typename VectorType>
+void NlerpQuats(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    const VectorType Scale0 = Splat<VectorType>(1.0f - Alpha);
+    const VectorType Scale1 = Splat<VectorType>(Alpha);
+
+    int32 Index = 0;
+    for (; Index + Width <= Num; Index += Width)
+    {
+        TQuatLanes<VectorType> Q1, Q2;
+        Load(Q1, A + Index);
+        Load(Q2, B + Index);
+        AlignHemisphere(Dot(Q1, Q2), Q2);
+
+        TQuatLanes<VectorType> Result = Blend(Q1, Scale0, Q2, Scale1);
+        Normalize(Result);
+        Store(Out + Index, Result);
+    }
+    Scalar::NlerpQuats(Out + Index, A + Index, B + Index, Alpha, Num - Index);
+}
+
+/**
+ * Slerp의 계수 Sin(T * Omega) / Sin(Omega)를 Cos(Omega) - 1에 대한 급수로 전개하고 12항까지 계산합니다.
+ * 마지막 항은 잘라낸 나머지 항을 보정하도록 Mu를 곱합니다.
+ * Eberly, "A Fast and Accurate Algorithm for Computing SLERP", Journal of Graphics, GPU, and Game Tools (2011)
+ *
+ * 논문의 8항(Mu = 1.85298)은 계수 오차가 2e-5까지 커지므로,
+ * 항을 늘리고 Mu를 다시 맞췄습니다. 계수 오차는 7.2e-7 이하입니다.
+ */
+struct FSlerpSeries
+{
+    static constexpr int32 NumTerms = 12;
+    static constexpr float Mu = 1.89371800f;
+
+    /** 각 항의 (U[i] * T^2 - V[i]), T는 1 - Alpha와 Alpha 두 가지입니다. 배열 전체에서 Alpha가 같으므로 미리 계산합니다. */
+    float Coefficients0[NumTerms];
+    float Coefficients1[NumTerms];
+
+    explicit FSlerpSeries(float Alpha)
+    {
+        const float T0 = 1.0f - Alpha;
+        const float T1 = Alpha;
+        for (int32 Term = 0; Term < NumTerms; ++Term)
+        {
+            // U = 1 / (i * (2i + 1)), V = i / (2i + 1), i = Term + 1
+            const float I = static_cast<float>(Term + 1);
+            const float Scale = Term == NumTerms - 1 ? Mu : 1.0f;
+            const float U = Scale / (I * (2.0f * I + 1.0f));
+            const float V = Scale * I / (2.0f * I + 1.0f);
+            Coefficients0[Term] = U * T0 * T0 - V;
+            Coefficients1[Term] = U * T1 * T1 - V;
+        }
+    }
+};
+
+template <typename VectorType>
+void SlerpQuats(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    const FSlerpSeries Series(Alpha);
+
+    VectorType Coefficients0[FSlerpSeries::NumTerms];
+    VectorType Coefficients1[FSlerpSeries::NumTerms];
+    for (int32 Term = 0; Term < FSlerpSeries::NumTerms; ++Term)
+    {
+        Coefficients0[Term] = Splat<VectorType>(Series.Coefficients0[Term]);
+        Coefficients1[Term] = Splat<VectorType>(Series.Coefficients1[Term]);
+    }
+    const VectorType T0 = Splat<VectorType>(1.0f - Alpha);
+    const VectorType T1 = Splat<VectorType>(Alpha);
+    const VectorType One = Splat<VectorType>(1.0f);
+
+    int32 Index = 0;
+    for (; Index + Width <= Num; Index += Width)
+    {
+        TQuatLanes<VectorType> Q1, Q2;
+        Load(Q1, A + Index);
+        Load(Q2, B + Index);
+
+        // 짧은 경로로 맞춘 뒤의 Cos(Omega)는 0 이상입니다.
+        const VectorType Cos = Dot(Q1, Q2);
+        AlignHemisphere(Cos, Q2);
+        const VectorType CosMinusOne = Subtract(Xor(Cos, And(Cos, Splat<VectorType>(-0.0f))), One);
+
+        VectorType Term0 = T0, Term1 = T1;
+        VectorType Scale0 = T0, Scale1 = T1;
+        for (int32 Term = 0; Term < FSlerpSeries::NumTerms; ++Term)
+        {
+            Term0 = Multiply(Term0, Multiply(Coefficients0[Term], CosMinusOne));
+            Term1 = Multiply(Term1, Multiply(Coefficients1[Term], CosMinusOne));
+            Scale0 = Add(Scale0, Term0);
+            Scale1 = Add(Scale1, Term1);
+        }
+
+        // FQuat::Slerp와 같이 결과를 정규화합니다.
+        TQuatLanes<VectorType> Result = Blend(Q1, Scale0, Q2, Scale1);
+        Normalize(Result);
+        Store(Out + Index, Result);
+    }
+    Scalar::SlerpQuats(Out + Index, A + Index, B + Index, Alpha, Num - Index);
+}
+
+template <typename VectorType>
+void RotateVectors(FVector* Out, const FQuat* Quats, const FVector* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    const VectorType Two = Splat<VectorType>(2.0f);
+
+    int32 Index = 0;
+    for (; Index + Width <= Num; Index += Width)
+    {
+        TQuatLanes<VectorType> Q, V;
+        Load(Q, Quats + Index);
+        Load(V, In + Index);
+
+        // T = 2 * (Q x V), V + W * T + Q x T
+        const VectorType TX = Multiply(Two, Subtract(Multiply(Q.Y, V.Z), Multiply(Q.Z, V.Y)));
+        const VectorType TY = Multiply(Two, Subtract(Multiply(Q.Z, V.X), Multiply(Q.X, V.Z)));
+        const VectorType TZ = Multiply(Two, Subtract(Multiply(Q.X, V.Y), Multiply(Q.Y, V.X)));
+
+        TQuatLanes<VectorType> Result;
+        Result.X = Add(MultiplyAdd(Q.W, TX, V.X), Subtract(Multiply(Q.Y, TZ), Multiply(Q.Z, TY)));
+        Result.Y = Add(MultiplyAdd(Q.W, TY, V.Y), Subtract(Multiply(Q.Z, TX), Multiply(Q.X, TZ)));
+        Result.Z = Add(MultiplyAdd(Q.W, TZ, V.Z), Subtract(Multiply(Q.X, TY), Multiply(Q.Y, TX)));
+        Result.W = V.W;
+        Store(Out + Index, Result);
+    }
+    Scalar::RotateVectors(Out + Index, Quats + Index, In + Index, Num - Index);
+}
+
+/** FMath::FastSinCos */
+template <typename VectorType>
+FORCEINLINE void VectorSinCos(VectorType& OutSin, VectorType& OutCos, const VectorType& Value)
+{
+    const VectorType Quadrant = Round(Multiply(Value, Splat<VectorType>(FastMath::TwoOverPi)));
+    VectorType R = Subtract(Value, Multiply(Quadrant, Splat<VectorType>(FastMath::PiOverTwoHigh)));
+    R = Subtract(R, Multiply(Quadrant, Splat<VectorType>(FastMath::PiOverTwoMid)));
+    R = Subtract(R, Multiply(Quadrant, Splat<VectorType>(FastMath::PiOverTwoLow)));
+    const VectorType R2 = Multiply(R, R);
+
+    const float* S = FastMath::SinCoefficients;
+    VectorType Sin = MultiplyAdd(R2, Splat<VectorType>(S[2]), Splat<VectorType>(S[1]));
+    Sin = MultiplyAdd(R2, Sin, Splat<VectorType>(S[0]));
+    Sin = MultiplyAdd(Multiply(R, R2), Sin, R);
+
+    const float* C = FastMath::CosCoefficients;
+    VectorType Cos = MultiplyAdd(R2, Splat<VectorType>(C[2]), Splat<VectorType>(C[1]));
+    Cos = MultiplyAdd(R2, Cos, Splat<VectorType>(C[0]));
+    Cos = MultiplyAdd(Multiply(R2, R2), Cos, Subtract(Splat<VectorType>(1.0f), Multiply(Splat<VectorType>(0.5f), R2)));
+
+    // Quadrant의 첫 번째 비트는 부호 비트까지 밀었다가 되돌려 Mask로, 두 번째 비트는 부호 비트로 옮겨 씁니다.
+    const auto QuadrantIndex = ToInt(Quadrant);
+    const VectorType SwapMask = AsFloat(ShiftRightArithmetic<31>(ShiftLeft<31>(QuadrantIndex)));
+    const VectorType SignMask = Splat<VectorType>(-0.0f);
+    const VectorType SinSign = And(AsFloat(ShiftLeft<30>(QuadrantIndex)), SignMask);
+    const VectorType CosSign = And(AsFloat(ShiftLeft<30>(Add(QuadrantIndex, SplatInt<VectorType>(1)))), SignMask);
+    OutSin = Xor(Select(SwapMask, Cos, Sin), SinSign);
+    OutCos = Xor(Select(SwapMask, Sin, Cos), CosSign);
+}
+
+/** FMath::FastAtan2 */
+template <typename VectorType>
+FORCEINLINE VectorType VectorAtan2(const VectorType& Y, const VectorType& X)
+{
+    const VectorType Zero = Splat<VectorType>(0.0f);
+    const VectorType One = Splat<VectorType>(1.0f);
+    const VectorType SignMask = Splat<VectorType>(-0.0f);
+    const VectorType AbsX = AndNot(SignMask, X);
+    const VectorType AbsY = AndNot(SignMask, Y);
+    const VectorType MaxXY = Max(AbsX, AbsY);
+
+    VectorType T = Select(CompareGreater(MaxXY, Zero), Divide(Min(AbsX, AbsY), MaxXY), Zero);
+    const VectorType ReduceMask = CompareGreater(T, Splat<VectorType>(FastMath::TanPiOverEight));
+    T = Select(ReduceMask, Divide(Subtract(T, One), Add(T, One)), T);
+    const VectorType Base = And(ReduceMask, Splat<VectorType>(PI * 0.25f));
+
+    const VectorType T2 = Multiply(T, T);
+    const float* A = FastMath::AtanCoefficients;
+    VectorType Polynomial = MultiplyAdd(Splat<VectorType>(A[0]), T2, Splat<VectorType>(A[1]));
+    Polynomial = MultiplyAdd(Polynomial, T2, Splat<VectorType>(A[2]));
+    Polynomial = MultiplyAdd(Polynomial, T2, Splat<VectorType>(A[3]));
+
+    VectorType Angle = Add(Base, MultiplyAdd(Multiply(T, T2), Polynomial, T));
+    Angle = Select(CompareGreater(AbsY, AbsX), Subtract(Splat<VectorType>(HALF_PI), Angle), Angle);
+    Angle = Select(CompareLess(X, Zero), Subtract(Splat<VectorType>(PI), Angle), Angle);
+    return Xor(Angle, And(Y, SignMask));
+}
+
+/** FMath::FastExp */
+template <typename VectorType>
+FORCEINLINE VectorType VectorExp(const VectorType& Value)
+{
+    const VectorType X = Min(Max(Value, Splat<VectorType>(FastMath::ExpMinInput)), Splat<VectorType>(FastMath::ExpMaxInput));
+    const VectorType N = Round(Multiply(X, Splat<VectorType>(FastMath::Log2e)));
+    VectorType R = Subtract(X, Multiply(N, Splat<VectorType>(FastMath::Ln2High)));
+    R = Subtract(R, Multiply(N, Splat<VectorType>(FastMath::Ln2Low)));
+
+    const float* E = FastMath::ExpCoefficients;
+    VectorType Polynomial = MultiplyAdd(Splat<VectorType>(E[0]), R, Splat<VectorType>(E[1]));
+    for (int32 Term = 2; Term < static_cast<int32>(std::size(FastMath::ExpCoefficients)); ++Term)
+    {
+        Polynomial = MultiplyAdd(Polynomial, R, Splat<VectorType>(E[Term]));
+    }
+    const VectorType ExpR = MultiplyAdd(Multiply(R, R), Polynomial, Add(R, Splat<VectorType>(1.0f)));
+
+    const VectorType Scale = AsFloat(ShiftLeft<23>(Add(ToInt(N), SplatInt<VectorType>(127))));
+    return Multiply(ExpR, Scale);
+}
+
+/** FMath::FastInvSqrt */
+template <typename VectorType>
+FORCEINLINE VectorType VectorInvSqrt(const VectorType& Value)
+{
+    const VectorType Estimate = ReciprocalSqrtEstimate(Value);
+    const VectorType HalfValue = Multiply(Splat<VectorType>(0.5f), Value);
+    return Multiply(Estimate, Subtract(Splat<VectorType>(1.5f), Multiply(HalfValue, Multiply(Estimate, Estimate))));
+}
+
+/** FMath::PerlinNoise1D의 Gradient, Hash의 아래 3비트로 크기(1~8)를, 4번째 비트로 부호를 정합니다. */
+template <typename VectorType>
+FORCEINLINE VectorType PerlinGradient(const TIntVector<VectorType>& Hash, const VectorType& X)
+{
+    const VectorType Gradient = Add(ToFloat(And(Hash, SplatInt<VectorType>(7))), Splat<VectorType>(1.0f));
+    const VectorType Sign = AsFloat(ShiftLeft<28>(And(Hash, SplatInt<VectorType>(8))));
+    return Multiply(Xor(Gradient, Sign), X);
+}
+
+/** FMath::PerlinNoise1D, 같은 식을 같은 순서로 계산합니다. */
+template <typename VectorType>
+FORCEINLINE VectorType VectorPerlinNoise1D(const VectorType& Value)
+{
+    const VectorType Cell = Floor(Value);
+    const auto Index = And(ToInt(Cell), SplatInt<VectorType>(255));
+    const VectorType T = Subtract(Value, Cell);
+
+    // Fade = T^3 * (T * (T * 6 - 15) + 10)
+    const VectorType Inner = Add(Multiply(T, Subtract(Multiply(T, Splat<VectorType>(6.0f)), Splat<VectorType>(15.0f))), Splat<VectorType>(10.0f));
+    const VectorType Fade = Multiply(Multiply(Multiply(T, T), T), Inner);
+
+    const VectorType GradientA = PerlinGradient(Gather(FMath::PerlinPermutation, Index), T);
+    const VectorType GradientB = PerlinGradient(Gather(FMath::PerlinPermutation, Add(Index, SplatInt<VectorType>(1))), Subtract(T, Splat<VectorType>(1.0f)));
+    return Add(GradientA, Multiply(Fade, Subtract(GradientB, GradientA)));
+}
+
+template <typename VectorType>
+void Sin(float* Out, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        VectorType SinValue, CosValue;
+        VectorSinCos(SinValue, CosValue, LoadFloats<VectorType>(In + Index, Count));
+        StoreFloats(Out + Index, SinValue, Count);
+    }
+}
+
+template <typename VectorType>
+void Cos(float* Out, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        VectorType SinValue, CosValue;
+        VectorSinCos(SinValue, CosValue, LoadFloats<VectorType>(In + Index, Count));
+        StoreFloats(Out + Index, CosValue, Count);
+    }
+}
+
+template <typename VectorType>
+void SinCos(float* OutSin, float* OutCos, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        VectorType SinValue, CosValue;
+        VectorSinCos(SinValue, CosValue, LoadFloats<VectorType>(In + Index, Count));
+        StoreFloats(OutSin + Index, SinValue, Count);
+        StoreFloats(OutCos + Index, CosValue, Count);
+    }
+}
+
+template <typename VectorType>
+void Atan2(float* Out, const float* Y, const float* X, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        const VectorType Result = VectorAtan2(LoadFloats<VectorType>(Y + Index, Count), LoadFloats<VectorType>(X + Index, Count));
+        StoreFloats(Out + Index, Result, Count);
+    }
+}
+
+template <typename VectorType>
+void Exp(float* Out, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        StoreFloats(Out + Index, VectorExp(LoadFloats<VectorType>(In + Index, Count)), Count);
+    }
+}
+
+template <typename VectorType>
+void InvSqrt(float* Out, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        StoreFloats(Out + Index, VectorInvSqrt(LoadFloats<VectorType>(In + Index, Count)), Count);
+    }
+}
+
+template <typename VectorType>
+void PerlinNoise1D(float* Out, const float* In, int32 Num)
+{
+    constexpr int32 Width = sizeof(VectorType) / sizeof(float);
+    for (int32 Index = 0; Index < Num; Index += Width)
+    {
+        const int32 Count = FMath::Min(Width, Num - Index);
+        StoreFloats(Out + Index, VectorPerlinNoise1D(LoadFloats<VectorType>(In + Index, Count)), Count);
+    }
+}
+}
+
+
+const FMathKernels KernelTable[] = {
+    {
+        EMathISA::Scalar, Scalar::MultiplyMatrix, Scalar::InverseMatrix, Scalar::MultiplyMatrices, Scalar::TransformVector4s, Scalar::TransformPositions,
+        Scalar::TransformVectors, Scalar::TransformPositionsSoA, Scalar::TransformBoxes, Scalar::QuatsToMatrices,
+        Scalar::MultiplyQuats, Scalar::NormalizeQuats, Scalar::NlerpQuats, Scalar::SlerpQuats, Scalar::RotateVectors,
+        Scalar::Sin, Scalar::Cos, Scalar::SinCos, Scalar::Atan2, Scalar::Exp, Scalar::InvSqrt, Scalar::PerlinNoise1D
+    },
+    {
+        EMathISA::SSE41, SSE41::MultiplyMatrix, SSE41::InverseMatrix, SSE41::MultiplyMatrices, SSE41::TransformVector4s, SSE41::TransformPositions,
+        SSE41::TransformVectors, SSE41::TransformPositionsSoA, SSE41::TransformBoxes, SSE41::QuatsToMatrices,
+        Wide::MultiplyQuats<VectorRegister4Float>, Wide::NormalizeQuats<VectorRegister4Float>, Wide::NlerpQuats<VectorRegister4Float>,
+        Wide::SlerpQuats<VectorRegister4Float>, Wide::RotateVectors<VectorRegister4Float>,
+        Wide::Sin<VectorRegister4Float>, Wide::Cos<VectorRegister4Float>, Wide::SinCos<VectorRegister4Float>, Wide::Atan2<VectorRegister4Float>,
+        Wide::Exp<VectorRegister4Float>, Wide::InvSqrt<VectorRegister4Float>, Wide::PerlinNoise1D<VectorRegister4Float>
+    },
+    // 역행렬은 대부분 Lane 안의 Shuffle이라 256bit로 넓혀도 이득이 없어 SSE4.1 구현을 사용합니다.
+    // AABB 변환도 상자마다 행렬이 달라, 두 상자를 Lane에 나눠 담는 비용이 더 커서 SSE4.1 구현을 사용합니다.
+    {
+        EMathISA::AVX2, AVX2::MultiplyMatrix, SSE41::InverseMatrix, AVX2::MultiplyMatrices, AVX2::TransformVector4s, AVX2::TransformPositions,
+        AVX2::TransformVectors, AVX2::TransformPositionsSoA, SSE41::TransformBoxes, AVX2::QuatsToMatrices,
+        Wide::MultiplyQuats<AVX2::VectorRegister8Float>, Wide::NormalizeQuats<AVX2::VectorRegister8Float>, Wide::NlerpQuats<AVX2::VectorRegister8Float>,
+        Wide::SlerpQuats<AVX2::VectorRegister8Float>, Wide::RotateVectors<AVX2::VectorRegister8Float>,
+        Wide::Sin<AVX2::VectorRegister8Float>, Wide::Cos<AVX2::VectorRegister8Float>, Wide::SinCos<AVX2::VectorRegister8Float>, Wide::Atan2<AVX2::VectorRegister8Float>,
+        Wide::Exp<AVX2::VectorRegister8Float>, Wide::InvSqrt<AVX2::VectorRegister8Float>, Wide::PerlinNoise1D<AVX2::VectorRegister8Float>
+    },
+};
+static_assert(std::size(KernelTable) == static_cast<size_t>(EMathISA::Num));
+}
+
+
+const FMathKernels& FMathKernels::Get()
+{
+    static const FMathKernels& Kernels = []() -> const FMathKernels&
+    {
+        for (int32 Index = static_cast<int32>(EMathISA::Num) - 1; Index > 0; --Index)
+        {
+            if (IsSupported(static_cast<EMathISA>(Index)))
+            {
+                return KernelTable[Index];
+            }
+        }
+        return KernelTable[0];
+    }();
+    return Kernels;
+}
+
+const FMathKernels* FMathKernels::Get(EMathISA ISA)
+{
+    return IsSupported(ISA) ? &KernelTable[static_cast<int32>(ISA)] : nullptr;
+}
+
+bool FMathKernels::IsSupported(EMathISA ISA)
+{
+    const FCpuFeatures& Features = GetCpuFeatures();
+    switch (ISA)
+    {
+    case EMathISA::Scalar:
+        return true;
+    case EMathISA::SSE41:
+        return Features.bSSE41;
+    case EMathISA::AVX2:
+        return Features.bAVX2 && Features.bFMA;
+    default:
+        return false;
+    }
+}
+
+const ANSICHAR* FMathKernels::GetISAName(EMathISA ISA)
+{
+    switch (ISA)
+    {
+    case EMathISA::Scalar:
+        return "Scalar";
+    case EMathISA::SSE41:
+        return "SSE4.1";
+    case EMathISA::AVX2:
+        return "AVX2";
+    default:
+        return "Unknown";
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+struct FBoundingBox;
+struct FMatrix;
+struct FQuat;
+struct FVector;
+struct FVector4;
+
+
+/** FMathKernels 구현이 사용하는 명령어 집합, 뒤로 갈수록 넓습니다. */
+enum class EMathISA : uint8
+{
+    Scalar,
+    SSE41,
+
+    /** AVX2와 FMA, FMA는 곱셈 결과를 반올림하지 않으므로 Scalar와 마지막 자리가 다를 수 있습니다. */
+    AVX2,
+
+    Num
+};
+
+
+/**
+ * 같은 행렬 연산의 Scalar / SSE4.1 / AVX2 구현을 묶은 함수 테이블입니다.
+ *
+ * - Get()은 처음 호출될 때 CPUID로 실행 중인 CPU를 검사해 가장 넓은 구현을 고릅니다.
+ * - SSE4.1은 엔진의 최소 요구 사항입니다. FMatrix, FQuat의 멤버 함수는 SSE4.1 구현(MathSSE.h)을 inline으로 직접 사용하므로,
+ *   FEngineLoop::PreInit에서 IsSupported(EMathISA::SSE41)를 검사하고 지원하지 않으면 시작하지 않습니다.
+ *   함수 포인터를 거치는 비용이 연산보다 크지 않은 배열 단위 연산은 이 테이블을 사용합니다.
+ * - Scalar 구현은 SIMD 구현의 결과를 검증하는 기준으로 남겨 둡니다. (MathBenchmarks.cpp)
+ */
+struct FMathKernels
+{
+    EMathISA ISA;
+
+    /** Out = A * B, Out은 A나 B와 같아도 됩니다. */
+    void (*MultiplyMatrix)(FMatrix* Out, const FMatrix* A, const FMatrix* B);
+
+    /** FMatrix::Inverse와 같습니다. @return 역행렬이 없으면 false, 이때 Out은 정의되지 않습니다. */
+    bool (*InverseMatrix)(FMatrix* Out, const FMatrix* In);
+
+    /** Out[i] = A[i] * B[i] */
+    void (*MultiplyMatrices)(FMatrix* Out, const FMatrix* A, const FMatrix* B, int32 Num);
+
+    /** Out[i] = Matrix.TransformFVector4(In[i]), Out은 In과 같아도 됩니다. */
+    void (*TransformVector4s)(FVector4* Out, const FVector4* In, int32 Num, const FMatrix& Matrix);
+
+    /** Out[i] = Matrix.TransformPosition(In[i]), Out은 In과 같아도 됩니다. */
+    void (*TransformPositions)(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix);
+
+    /** Out[i] = FMatrix::TransformVector(In[i], Matrix), 이동은 적용하지 않습니다. Out은 In과 같아도 됩니다. */
+    void (*TransformVectors)(FVector* Out, const FVector* In, int32 Num, const FMatrix& Matrix);
+
+    /**
+     * X, Y, Z 성분을 따로 담은 SoA 배열의 점을 변환합니다.
+     * 아핀 행렬만 다루므로 W로 나누지 않습니다. 출력 배열은 같은 성분의 입력 배열과 같아도 됩니다.
+     */
+    void (*TransformPositionsSoA)(float* OutX, float* OutY, float* OutZ, const float* InX, const float* InY, const float* InZ, int32 Num, const FMatrix& Matrix);
+
+    /**
+     * In[i]를 Matrices[i]로 변환한 8개 꼭짓점을 모두 담는 AABB를 Out[i]에 씁니다.
+     * 꼭짓점 대신 중심과 절반 크기를 변환하므로(Arvo) 아핀 행렬만 다룹니다. Out은 In과 같아도 됩니다.
+     */
+    void (*TransformBoxes)(FBoundingBox* Out, const FBoundingBox* In, const FMatrix* Matrices, int32 Num);
+
+    /** Out[i] = In[i].ToMatrix() */
+    void (*QuatsToMatrices)(FMatrix* Out, const FQuat* In, int32 Num);
+
+    /** Out[i] = A[i] * B[i], Out은 A나 B와 같아도 됩니다. */
+    void (*MultiplyQuats)(FQuat* Out, const FQuat* A, const FQuat* B, int32 Num);
+
+    /** Out[i] = In[i].GetNormalized() */
+    void (*NormalizeQuats)(FQuat* Out, const FQuat* In, int32 Num);
+
+    /**
+     * 짧은 경로로 선형 보간한 뒤 정규화합니다(Nlerp). 가장 빠르지만 각속도가 일정하지 않아,
+     * 두 Quat 사이의 각이 클수록 Slerp와 차이가 커집니다. 인접한 Key 사이처럼 각이 작을 때 사용합니다.
+     * Out은 A나 B와 같아도 됩니다.
+     */
+    void (*NlerpQuats)(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num);
+
+    /**
+     * Out[i] = FQuat::Slerp(A[i], B[i], Alpha)
+     * Scalar는 FQuat::Slerp를 그대로 사용하고, SIMD 구현은 Acos, Sin 대신 다항식 근사를 사용합니다.
+     * (Eberly, "A Fast and Accurate Algorithm for Computing SLERP") FQuat::Slerp와 성분의 차이는 5e-7 이하입니다.
+     * Out은 A나 B와 같아도 됩니다.
+     */
+    void (*SlerpQuats)(FQuat* Out, const FQuat* A, const FQuat* B, float Alpha, int32 Num);
+
+    /** Out[i] = Quats[i].RotateVector(In[i]), Out은 In과 같아도 됩니다. */
+    void (*RotateVectors)(FVector* Out, const FQuat* Quats, const FVector* In, int32 Num);
+
+    /**
+     * 아래는 float 배열에 대한 FMath 함수입니다. Out은 In과 같아도 됩니다.
+     * Scalar는 std 함수를 그대로 사용하고, SIMD 구현은 FMath::Fast*와 같은 다항식을 사용하므로 입력 범위와 오차도 같습니다.
+     */
+    void (*Sin)(float* Out, const float* In, int32 Num);
+    void (*Cos)(float* Out, const float* In, int32 Num);
+    void (*SinCos)(float* OutSin, float* OutCos, const float* In, int32 Num);
+
+    /** Out[i] = FMath::Atan2(Y[i], X[i]) */
+    void (*Atan2)(float* Out, const float* Y, const float* X, int32 Num);
+
+    void (*Exp)(float* Out, const float* In, int32 Num);
+    void (*InvSqrt)(float* Out, const float* In, int32 Num);
+
+    /** Out[i] = FMath::PerlinNoise1D(In[i]), SIMD 구현도 같은 식을 같은 순서로 계산합니다. */
+    void (*PerlinNoise1D)(float* Out, const float* In, int32 Num);
+
+    /** 실행 중인 CPU가 지원하는 가장 넓은 구현 */
+    static const FMathKernels& Get();
+
+    /** @return CPU가 ISA를 지원하지 않으면 nullptr */
+    static const FMathKernels* Get(EMathISA ISA);
+
+    static bool IsSupported(EMathISA ISA);
+
+    static const ANSICHAR* GetISAName(EMathISA ISA);
+};
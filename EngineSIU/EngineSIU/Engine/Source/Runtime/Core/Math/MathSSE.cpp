@@ -1,10 +1,8 @@
 #include "MathSSE.h"
+#include <cmath>
 
-#ifdef __SSE_EXPERIMENTAL__
-// General한 방법으로, Transform에는 사용하지 말것.
-// SRT만을 사용한 경우에는 InverseTransformNoScale / InverseTransform 사용하기.
-// Transform의 경우에는 determinant가 작아서 FMatrix::Inverse와 결과가 다르게 나옴.
-void SSE::InverseMatrix(FMatrix* OutMat, const FMatrix* InMat)
+// General한 방법으로, FMatrix::Inverse가 사용합니다.
+bool SSE::InverseMatrix(FMatrix* OutMat, const FMatrix* InMat)
 {
     // 레지스터에 값 로드
     const VectorRegister4Float* InMatrixPtr = reinterpret_cast<const VectorRegister4Float*>(InMat);
@@ -59,6 +57,13 @@ void SSE::InverseMatrix(FMatrix* OutMat, const FMatrix* InMat)
     // |M| = |A|*|D| + |B|*|C| - tr((A#B)(D#C)
     detM = _mm_sub_ps(detM, tr);
 
+    // Scalar 구현과 같이, 역행렬이 없으면 호출자가 Identity 등을 대신 사용합니다.
+    const float Determinant = _mm_cvtss_f32(detM);
+    if (Determinant == 0.0f || !std::isfinite(Determinant))
+    {
+        return false;
+    }
+
     const __m128 adjSignMask = _mm_setr_ps(1.f, -1.f, -1.f, 1.f);
     // (1/|M|, -1/|M|, -1/|M|, 1/|M|)
     __m128 rDetM = _mm_div_ps(adjSignMask, detM);
@@ -74,6 +79,7 @@ void SSE::InverseMatrix(FMatrix* OutMat, const FMatrix* InMat)
     OutMatrixPtr[1] = VecShuffle(X_, Y_, 2, 0, 2, 0);
     OutMatrixPtr[2] = VecShuffle(Z_, W_, 3, 1, 3, 1);
     OutMatrixPtr[3] = VecShuffle(Z_, W_, 2, 0, 2, 0);
+    return true;
 }
 
 // SRT 변환 행렬 중 Scale=(1,1,1)인 경우에만 사용
@@ -136,4 +142,3 @@ void SSE::InverseTransform(FMatrix* OutMat, const FMatrix* InMat)
     OutMatrixPtr[3] = _mm_add_ps(OutMatrixPtr[3], _mm_mul_ps(OutMatrixPtr[2], VecSwizzle1(InMatrixPtr[3], 2)));
     OutMatrixPtr[3] = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), OutMatrixPtr[3]);
 }
-#endif // __SSE_EXPERIMENTAL__
@@ -2,7 +2,10 @@
 #include <immintrin.h>
 #include "HAL/PlatformType.h"
 
-//#define __SSE_EXPERIMENTAL__
+/*
+ * 이 파일의 함수는 SSE4.1 명령어(_mm_blend_ps, _mm_dp_ps, _mm_round_ps 등)를 CPU 검사 없이 사용합니다.
+ * SSE4.1은 엔진의 최소 요구 사항이며 FEngineLoop::PreInit에서 검사하므로, 그 전에 실행되는 전역 초기화에서는 사용하면 안됩니다.
+ */
 
 /**
  * @param A0    Selects which element (0-3) from 'A' into 1st slot in the result
@@ -95,80 +98,161 @@ inline void VectorMatrixMultiply(FMatrix* Result, const FMatrix* Matrix1, const
     Ret[3] = Temp;
 }
 
-FORCEINLINE void TransformVector4_SSE(FVector4* Result, const FVector4* vector, const FMatrix* mat)
+/** Row Vector 규약(V * M)으로 변환합니다. 곱하고 더하는 순서가 Scalar 구현과 같아 결과도 같습니다. */
+FORCEINLINE VectorRegister4Float VectorTransformVector4(const VectorRegister4Float& V, const FMatrix* Matrix)
 {
-    // reinterpret cast로 포인터 변환
-    const VectorRegister4Float* VectorPtr = reinterpret_cast<const VectorRegister4Float*>(vector);
-    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(mat);
-    VectorRegister4Float* Ret = reinterpret_cast<VectorRegister4Float*>(Result);
+    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(Matrix);
 
-    const VectorRegister4Float V = *VectorPtr;
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(V, 0), MatrixPtr[0]);
+    Result = VectorMultiplyAdd(VectorReplicate(V, 1), MatrixPtr[1], Result);
+    Result = VectorMultiplyAdd(VectorReplicate(V, 2), MatrixPtr[2], Result);
+    return VectorMultiplyAdd(VectorReplicate(V, 3), MatrixPtr[3], Result);
+}
 
-    // 각 행(row)에 대해 벡터 곱 + 누적
-    // DPPS 마스크 설명:
-    // 0xF1 = 결과 x에만 저장, x*y*z*w 모두 곱
-    // 0xF2 = 결과 y에만 저장, ...
-    // 0xF4 = 결과 z에만 저장
-    // 0xF8 = 결과 w에만 저장
+/** W를 1로 보고 변환합니다. V의 W는 읽지 않습니다. */
+FORCEINLINE VectorRegister4Float VectorTransformPosition(const VectorRegister4Float& V, const FMatrix* Matrix)
+{
+    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(Matrix);
+
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(V, 0), MatrixPtr[0]);
+    Result = VectorMultiplyAdd(VectorReplicate(V, 1), MatrixPtr[1], Result);
+    Result = VectorMultiplyAdd(VectorReplicate(V, 2), MatrixPtr[2], Result);
+    return VectorAdd(Result, MatrixPtr[3]);
+}
 
-    VectorRegister4Float R0 = _mm_dp_ps(MatrixPtr[0], V, 0xF1); // X
-    VectorRegister4Float R1 = _mm_dp_ps(MatrixPtr[1], V, 0xF2); // Y
-    VectorRegister4Float R2 = _mm_dp_ps(MatrixPtr[2], V, 0xF4); // Z
-    VectorRegister4Float R3 = _mm_dp_ps(MatrixPtr[3], V, 0xF8); // W
+/** W를 0으로 보고 변환합니다. 결과의 W는 Matrix의 4번째 열에 따라 0이 아닐 수 있습니다. */
+FORCEINLINE VectorRegister4Float VectorTransformNormal(const VectorRegister4Float& V, const FMatrix* Matrix)
+{
+    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(Matrix);
 
-    // OR 연산으로 병합
-    VectorRegister4Float XY = _mm_or_ps(R0, R1);
-    VectorRegister4Float ZW = _mm_or_ps(R2, R3);
-    *Ret = _mm_or_ps(XY, ZW);
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(V, 0), MatrixPtr[0]);
+    Result = VectorMultiplyAdd(VectorReplicate(V, 1), MatrixPtr[1], Result);
+    return VectorMultiplyAdd(VectorReplicate(V, 2), MatrixPtr[2], Result);
 }
 
+/** W가 0이 아닌 경우에만 X, Y, Z, W를 W로 나눕니다. */
+FORCEINLINE VectorRegister4Float VectorDivideByW(const VectorRegister4Float& V)
+{
+    const VectorRegister4Float W = VectorReplicate(V, 3);
+    const VectorRegister4Float NonZeroMask = _mm_cmpneq_ps(W, _mm_setzero_ps());
+    return _mm_blendv_ps(V, _mm_div_ps(V, W), NonZeroMask);
+}
 
-// W값은 1로 강제로 변환될것임.
-FORCEINLINE void TransformPosition_SSE(FVector4* OutResult, const FVector4* InVector, const FMatrix* Matrix)
+/** FVector처럼 연속된 float 3개를 읽고 W를 0으로 채웁니다. 4번째 float을 읽지 않으므로 배열 끝에서도 안전합니다. */
+FORCEINLINE VectorRegister4Float VectorLoadFloat3(const float* Ptr)
 {
-    // reinterpret cast로 포인터 변환
-    const VectorRegister4Float* VectorPtr = reinterpret_cast<const VectorRegister4Float*>(InVector);
-    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(Matrix);
-    VectorRegister4Float* Ret = reinterpret_cast<VectorRegister4Float*>(OutResult);
+    const VectorRegister4Float XY = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Ptr)));
+    return _mm_movelh_ps(XY, _mm_load_ss(Ptr + 2));
+}
 
-    // InVector: {X, Y, Z, ignored} → 강제로 W=1.0 추가
-    VectorRegister4Float V = _mm_insert_ps(*VectorPtr, _mm_set_ss(1.0f), 0x30); // 마지막 요소에 1.0 넣기
+FORCEINLINE void VectorStoreFloat3(const VectorRegister4Float& V, float* Ptr)
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(Ptr), _mm_castps_si128(V));
+    _mm_store_ss(Ptr + 2, VectorReplicate(V, 2));
+}
 
-    VectorRegister4Float R0 = _mm_dp_ps(MatrixPtr[0], V, 0xF1); // X
-    VectorRegister4Float R1 = _mm_dp_ps(MatrixPtr[1], V, 0xF2); // Y
-    VectorRegister4Float R2 = _mm_dp_ps(MatrixPtr[2], V, 0xF4); // Z
-    VectorRegister4Float R3 = _mm_dp_ps(MatrixPtr[3], V, 0xF8); // W
+FORCEINLINE void TransformVector4_SSE(FVector4* Result, const FVector4* vector, const FMatrix* mat)
+{
+    // FVector4는 16 Byte 정렬이 아니므로 unaligned로 읽고 씁니다.
+    const VectorRegister4Float V = _mm_loadu_ps(reinterpret_cast<const float*>(vector));
+    _mm_storeu_ps(reinterpret_cast<float*>(Result), VectorTransformVector4(V, mat));
+}
 
-    VectorRegister4Float XY = _mm_or_ps(R0, R1);
-    VectorRegister4Float ZW = _mm_or_ps(R2, R3);
-    *Ret = _mm_or_ps(XY, ZW);
+// W값은 1로 강제로 변환될것임.
+FORCEINLINE void TransformPosition_SSE(FVector4* OutResult, const FVector4* InVector, const FMatrix* Matrix)
+{
+    const VectorRegister4Float V = _mm_loadu_ps(reinterpret_cast<const float*>(InVector));
+    _mm_storeu_ps(reinterpret_cast<float*>(OutResult), VectorTransformPosition(V, Matrix));
 
     // W 분할은 호출자가 원하면 따로 처리
 }
 
 FORCEINLINE void TransformNormal_SSE(FVector4* OutResult, const FVector4* InVector, const FMatrix* Matrix)
 {
-    // reinterpret cast로 포인터 변환
-    const VectorRegister4Float* VectorPtr = reinterpret_cast<const VectorRegister4Float*>(InVector);
-    const VectorRegister4Float* MatrixPtr = reinterpret_cast<const VectorRegister4Float*>(Matrix);
-    VectorRegister4Float* Ret = reinterpret_cast<VectorRegister4Float*>(OutResult);
+    const VectorRegister4Float V = _mm_loadu_ps(reinterpret_cast<const float*>(InVector));
+    _mm_storeu_ps(reinterpret_cast<float*>(OutResult), VectorTransformNormal(V, Matrix));
+}
+
+
+
+//////////////////////////////////
+// Quaternion, FQuat과 같이 (X, Y, Z, W) 순서입니다.
 
-    // InVector: {X, Y, Z, ignored} → 강제로 W=0.0 설정
-    VectorRegister4Float V = _mm_insert_ps(*VectorPtr, _mm_setzero_ps(), 0x30); // W = 0
+/** Q1 * Q2, FQuat::operator*와 같은 식입니다. 각 항의 부호는 XOR로 뒤집습니다. */
+FORCEINLINE VectorRegister4Float VectorQuaternionMultiply(const VectorRegister4Float& Q1, const VectorRegister4Float& Q2)
+{
+    const VectorRegister4Float SignX = _mm_setr_ps(0.f, -0.f, 0.f, -0.f);
+    const VectorRegister4Float SignY = _mm_setr_ps(0.f, 0.f, -0.f, -0.f);
+    const VectorRegister4Float SignZ = _mm_setr_ps(-0.f, 0.f, 0.f, -0.f);
+
+    // (W1X2, W1Y2, W1Z2, W1W2)
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(Q1, 3), Q2);
+    // (X1W2, -X1Z2, X1Y2, -X1X2)
+    Result = VectorMultiplyAdd(VectorReplicate(Q1, 0), _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, SHUFFLEMASK(3, 2, 1, 0)), SignX), Result);
+    // (Y1Z2, Y1W2, -Y1X2, -Y1Y2)
+    Result = VectorMultiplyAdd(VectorReplicate(Q1, 1), _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, SHUFFLEMASK(2, 3, 0, 1)), SignY), Result);
+    // (-Z1Y2, Z1X2, Z1W2, -Z1Z2)
+    return VectorMultiplyAdd(VectorReplicate(Q1, 2), _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, SHUFFLEMASK(1, 0, 3, 2)), SignZ), Result);
+}
 
-    VectorRegister4Float R0 = _mm_dp_ps(MatrixPtr[0], V, 0xF1); // X
-    VectorRegister4Float R1 = _mm_dp_ps(MatrixPtr[1], V, 0xF2); // Y
-    VectorRegister4Float R2 = _mm_dp_ps(MatrixPtr[2], V, 0xF4); // Z
+/** X, Y, Z의 외적, 결과의 W는 0입니다. */
+FORCEINLINE VectorRegister4Float VectorCross(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+    // A * B.YZX - A.YZX * B = (Cross.Z, Cross.X, Cross.Y)
+    const VectorRegister4Float AYZX = _mm_shuffle_ps(A, A, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float BYZX = _mm_shuffle_ps(B, B, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float Result = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+    return _mm_shuffle_ps(Result, Result, SHUFFLEMASK(1, 2, 0, 3));
+}
 
-    VectorRegister4Float XY = _mm_or_ps(R0, R1);
-    *Ret = _mm_or_ps(XY, R2);
+/**
+ * 단위 Quat로 Vector를 회전합니다. Q * V * Q^-1을 전개한 V + W * T + Q x T (T = 2 * Q x V)를 사용합니다.
+ * Vector의 W는 읽지 않으며, 결과의 W는 정의되지 않습니다.
+ */
+FORCEINLINE VectorRegister4Float VectorQuaternionRotateVector(const VectorRegister4Float& Quat, const VectorRegister4Float& Vector)
+{
+    const VectorRegister4Float Cross = VectorCross(Quat, Vector);
+    const VectorRegister4Float T = _mm_add_ps(Cross, Cross);
+    const VectorRegister4Float Result = VectorMultiplyAdd(VectorReplicate(Quat, 3), T, Vector);
+    return _mm_add_ps(Result, VectorCross(Quat, T));
 }
 
+/** FQuat::ToMatrix와 같은 식을 같은 순서로 계산하므로 결과도 같습니다. */
+FORCEINLINE void QuaternionToMatrix(FMatrix* Out, const VectorRegister4Float& Quat)
+{
+    VectorRegister4Float* OutPtr = reinterpret_cast<VectorRegister4Float*>(Out);
+
+    const VectorRegister4Float Quat2 = _mm_add_ps(Quat, Quat);       // (X2, Y2, Z2, W2)
+    const VectorRegister4Float Square = _mm_mul_ps(Quat, Quat2);     // (XX, YY, ZZ, WW)
+
+    // (1 - (YY + ZZ), 1 - (XX + ZZ), 1 - (XX + YY), 0)
+    const VectorRegister4Float SquareSum = _mm_add_ps(
+        _mm_shuffle_ps(Square, Square, SHUFFLEMASK(1, 0, 0, 3)),
+        _mm_shuffle_ps(Square, Square, SHUFFLEMASK(2, 2, 1, 3))
+    );
+    const VectorRegister4Float Diagonal = _mm_blend_ps(_mm_sub_ps(_mm_set1_ps(1.0f), SquareSum), _mm_setzero_ps(), 0b1000);
+
+    // (XZ, XY, YZ), (WY, WZ, WX)
+    const VectorRegister4Float V0 = _mm_mul_ps(_mm_shuffle_ps(Quat, Quat, SHUFFLEMASK(0, 0, 1, 3)), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(2, 1, 2, 3)));
+    const VectorRegister4Float V1 = _mm_mul_ps(VectorReplicate(Quat, 3), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(1, 2, 0, 3)));
+    const VectorRegister4Float Plus = _mm_add_ps(V0, V1);            // (XZ + WY, XY + WZ, YZ + WX)
+    const VectorRegister4Float Minus = _mm_sub_ps(V0, V1);           // (XZ - WY, XY - WZ, YZ - WX)
+
+    // (1 - (YY + ZZ), XY + WZ, XZ - WY, 0)
+    OutPtr[0] = _mm_blend_ps(_mm_shuffle_ps(Plus, Minus, SHUFFLEMASK(1, 1, 0, 0)), Diagonal, 0b1001);
+    // (XY - WZ, 1 - (XX + ZZ), YZ + WX, 0)
+    OutPtr[1] = _mm_blend_ps(_mm_shuffle_ps(Minus, Plus, SHUFFLEMASK(1, 1, 2, 2)), Diagonal, 0b1010);
+    // (XZ + WY, YZ - WX, 1 - (XX + YY), 0)
+    const VectorRegister4Float Row2 = _mm_shuffle_ps(Plus, Minus, SHUFFLEMASK(0, 0, 2, 2));
+    OutPtr[2] = _mm_blend_ps(_mm_shuffle_ps(Row2, Row2, SHUFFLEMASK(0, 2, 2, 2)), Diagonal, 0b1100);
+    OutPtr[3] = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+}
+// Quaternion
+//////////////////////////////////
 
 
 //////////////////////////////////
-// Inverse Matrix 테스트용
-#ifdef __SSE_EXPERIMENTAL__
+// Inverse Matrix
 #define MakeShuffleMask(x,y,z,w)           (x | (y<<2) | (z<<4) | (w<<6))
 
  // vec(0, 1, 2, 3) -> (vec[x], vec[y], vec[z], vec[w])
@@ -208,19 +292,17 @@ FORCEINLINE void TransformNormal_SSE(FVector4* OutResult, const FVector4* InVect
     }
 
 
-    // General한 방법으로, Transform에는 사용하지 말것.
-    // SRT만을 사용한 경우에는 InverseTransformNoScale / InverseTransform 사용하기.
-    // Transform의 경우에는 determinant가 작아서 FMatrix::Inverse와 결과가 다르게 나옴.
-    void InverseMatrix(FMatrix* OutMat, const FMatrix* InMat);
+    // General한 방법으로, FMatrix::Inverse가 사용합니다.
+    // SRT만을 사용한 경우에는 InverseTransformNoScale / InverseTransform이 더 빠르고 정확합니다.
+    // @return Determinant가 0이거나 유한하지 않으면 false, 이때 OutMat은 정의되지 않습니다.
+    bool InverseMatrix(FMatrix* OutMat, const FMatrix* InMat);
 
     // SRT 변환 행렬 중 Scale=(1,1,1)인 경우에만 사용
     void InverseTransformNoScale(FMatrix* OutMat, const FMatrix* InMat);
 
     // SRT 변환 행렬에만 사용
     void InverseTransform(FMatrix* OutMat, const FMatrix* InMat);
-#else
-#endif
-// Inverse Matrix 테스트용
+// Inverse Matrix
 //////////////////////////////////
 
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <bit>
 #include <cmath>
 #include <concepts>
 #include <numbers>
@@ -48,6 +49,42 @@ template <typename T>
 concept TCustomLerpable = TCustomLerp<T>::Value;
 
 
+/**
+ * FMath::Fast* 함수와 FMathKernels의 SIMD 구현이 함께 쓰는 상수입니다.
+ * 다항식 계수는 Cephes Math Library의 float 버전(sinf, cosf, atanf, expf)입니다.
+ */
+namespace FastMath
+{
+/** Cody-Waite 범위 축소, PI / 2를 세 부분으로 나눠 Quadrant * (PI / 2)를 빼는 동안 생기는 오차를 줄입니다. */
+inline constexpr float TwoOverPi = 0.636619772367581343f;
+inline constexpr float PiOverTwoHigh = 1.5703125f;
+inline constexpr float PiOverTwoMid = 4.837512969970703125e-4f;
+inline constexpr float PiOverTwoLow = 7.54978995489188216e-8f;
+
+/** Sin(R) = R + R^3 * (S0 + R^2 * (S1 + R^2 * S2)), |R| <= PI / 4 */
+inline constexpr float SinCoefficients[] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+
+/** Cos(R) = 1 - R^2 / 2 + R^4 * (C0 + R^2 * (C1 + R^2 * C2)), |R| <= PI / 4 */
+inline constexpr float CosCoefficients[] = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+
+/** Atan(T) = T + T^3 * (((A0 * T^2 + A1) * T^2 + A2) * T^2 + A3), |T| <= Tan(PI / 8) */
+inline constexpr float AtanCoefficients[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f };
+inline constexpr float TanPiOverEight = 0.414213562373095049f;
+
+/** 결과가 float의 정규화된 범위 안에 들도록 Exp의 입력을 제한합니다. */
+inline constexpr float ExpMinInput = -87.3f;
+inline constexpr float ExpMaxInput = 88.0f;
+
+/** e^X = 2^N * e^R, N = Round(X * Log2(e)), R = X - N * Ln(2) */
+inline constexpr float Log2e = 1.44269504088896341f;
+inline constexpr float Ln2High = 0.693359375f;
+inline constexpr float Ln2Low = -2.12194440e-4f;
+
+/** e^R = 1 + R + R^2 * (((((E0 * R + E1) * R + E2) * R + E3) * R + E4) * R + E5), |R| <= Ln(2) / 2 */
+inline constexpr float ExpCoefficients[] = { 1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f, 4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f };
+}
+
+
 struct FMath
 {
 
@@ -534,6 +571,103 @@ struct FMath
         *ScalarCos = cos(Value);
     }
 
+    /**
+     * Fast*는 std 함수 대신 다항식 근사를 사용하는 버전입니다. 배열은 FMathKernels의 같은 이름 함수로 한 번에 계산합니다.
+     * 오차는 std 함수에 대한 최대값이며, MathBenchmarks.cpp의 BM_FMath_Fast*가 측정해 Label로 남깁니다.
+     *
+     *   함수             | 입력 범위         | 최대 오차
+     *   -----------------+-------------------+------------------------------------------------
+     *   FastSin, FastCos | |Value| <= 1e4    | 절대 1e-7, 1e5까지는 1e-6 (범위 축소의 오차가 |Value|에 비례)
+     *   FastAtan2        | 유한한 값          | 절대 3e-7, X = Y = 0이면 0 (부호는 Y를 따름)
+     *   FastExp          | [-87.3, 88]       | 상대 1.2e-7, 범위를 벗어나면 경계값의 결과
+     *   FastInvSqrt      | Value > 0         | 상대 5e-7 (rsqrt 근사값이 CPU마다 조금씩 다름)
+     */
+    static FORCEINLINE void FastSinCos(float* ScalarSin, float* ScalarCos, float Value)
+    {
+        // Value = Quadrant * (PI / 2) + R, |R| <= PI / 4
+        const float Quadrant = RoundToFloat(Value * FastMath::TwoOverPi);
+        const float R = ((Value - Quadrant * FastMath::PiOverTwoHigh) - Quadrant * FastMath::PiOverTwoMid) - Quadrant * FastMath::PiOverTwoLow;
+        const float R2 = R * R;
+
+        const float* S = FastMath::SinCoefficients;
+        const float* C = FastMath::CosCoefficients;
+        const float Sin = R + R * R2 * (S[0] + R2 * (S[1] + R2 * S[2]));
+        const float Cos = 1.0f - 0.5f * R2 + R2 * R2 * (C[0] + R2 * (C[1] + R2 * C[2]));
+
+        // Quadrant가 홀수면 Sin과 Cos이 바뀌고, 두 번째 비트가 부호를 정합니다.
+        const int32 QuadrantIndex = static_cast<int32>(Quadrant);
+        const bool bSwap = (QuadrantIndex & 1) != 0;
+        const float SinValue = bSwap ? Cos : Sin;
+        const float CosValue = bSwap ? Sin : Cos;
+        *ScalarSin = (QuadrantIndex & 2) ? -SinValue : SinValue;
+        *ScalarCos = ((QuadrantIndex + 1) & 2) ? -CosValue : CosValue;
+    }
+
+    [[nodiscard]] static FORCEINLINE float FastSin(float RadVal)
+    {
+        float Sin, Cos;
+        FastSinCos(&Sin, &Cos, RadVal);
+        return Sin;
+    }
+
+    [[nodiscard]] static FORCEINLINE float FastCos(float RadVal)
+    {
+        float Sin, Cos;
+        FastSinCos(&Sin, &Cos, RadVal);
+        return Cos;
+    }
+
+    [[nodiscard]] static FORCEINLINE float FastAtan2(float Y, float X)
+    {
+        // 0 <= T <= 1이 되도록 작은 쪽을 큰 쪽으로 나누고, 마지막에 사분면을 되돌립니다.
+        const float AbsX = Abs(X);
+        const float AbsY = Abs(Y);
+        const float MaxXY = Max(AbsX, AbsY);
+        float T = MaxXY > 0.0f ? Min(AbsX, AbsY) / MaxXY : 0.0f;
+
+        // Atan(T) = PI / 4 + Atan((T - 1) / (T + 1))
+        float Base = 0.0f;
+        if (T > FastMath::TanPiOverEight)
+        {
+            Base = PI * 0.25f;
+            T = (T - 1.0f) / (T + 1.0f);
+        }
+
+        const float T2 = T * T;
+        const float* A = FastMath::AtanCoefficients;
+        float Angle = Base + (T + T * T2 * (((A[0] * T2 + A[1]) * T2 + A[2]) * T2 + A[3]));
+        if (AbsY > AbsX)
+        {
+            Angle = HALF_PI - Angle;
+        }
+        if (X < 0.0f)
+        {
+            Angle = PI - Angle;
+        }
+        return std::signbit(Y) ? -Angle : Angle;
+    }
+
+    [[nodiscard]] static FORCEINLINE float FastExp(float Value)
+    {
+        const float X = Clamp(Value, FastMath::ExpMinInput, FastMath::ExpMaxInput);
+        const float N = RoundToFloat(X * FastMath::Log2e);
+        const float R = (X - N * FastMath::Ln2High) - N * FastMath::Ln2Low;
+
+        const float* E = FastMath::ExpCoefficients;
+        const float Polynomial = (((((E[0] * R + E[1]) * R + E[2]) * R + E[3]) * R + E[4]) * R + E[5]);
+        const float ExpR = 1.0f + R + R * R * Polynomial;
+
+        // 2^N은 지수 비트에 바로 씁니다.
+        return ExpR * std::bit_cast<float>((static_cast<int32>(N) + 127) << 23);
+    }
+
+    /** rsqrt 근사값을 Newton-Raphson으로 한 번 보정합니다. */
+    [[nodiscard]] static FORCEINLINE float FastInvSqrt(float Value)
+    {
+        const float Estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(Value)));
+        return Estimate * (1.5f - 0.5f * Value * Estimate * Estimate);
+    }
+
     [[nodiscard]] static FORCEINLINE int32 CeilToInt(float Value) { return static_cast<int32>(ceilf(Value)); }
     [[nodiscard]] static FORCEINLINE int32 CeilToInt(double Value) { return static_cast<int32>(ceil(Value)); }
 
@@ -584,6 +718,12 @@ struct FMath
         return dist(rng);
     }
 
+    /** PerlinNoise1D의 순열 표, FMathKernels::PerlinNoise1D도 같은 표를 사용합니다. */
+    static constexpr int32 PerlinPermutation[512] = {
+        151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208,89,18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180,
+        151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208,89,18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180
+    };
+
     static float PerlinNoise1D(float x)
     {
         static auto fade = [](float t) -> float
@@ -604,16 +744,11 @@ struct FMath
             return grad * x;
         };
 
-        static int p[512] = {
-            151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208,89,18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180,
-            151,160,137,91,90,15,131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,190,6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,88,237,149,56,87,174,20,125,136,171,168,68,175,74,165,71,134,139,48,27,166,77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,102,143,54,65,25,63,161,1,216,80,73,209,76,132,187,208,89,18,169,200,196,135,130,116,188,159,86,164,100,109,198,173,186,3,64,52,217,226,250,124,123,5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,223,183,170,213,119,248,152,2,44,154,163,70,221,153,101,155,167,43,172,9,129,22,39,253,19,98,108,110,79,113,224,232,178,185,112,104,218,246,97,228,251,34,242,193,238,210,144,12,191,179,162,241,81,51,145,235,249,14,239,107,49,192,214,31,181,199,106,157,184,84,204,176,115,121,50,45,127,4,150,254,138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180
-        };
-
         int xi = static_cast<int>(std::floor(x)) & 255;
         float xf = x - std::floor(x);
         float u = fade(xf);
-        int a = p[xi];
-        int b = p[xi + 1];
+        int a = PerlinPermutation[xi];
+        int b = PerlinPermutation[xi + 1];
         return lerp(grad(a, xf), grad(b, xf - 1.0f), u);
     }
 };
@@ -100,94 +100,12 @@ FMatrix FMatrix::Transpose(const FMatrix& Mat)
 
 FMatrix FMatrix::Inverse(const FMatrix& Mat)
 {
+    // Scalar 구현은 FMathKernels의 Scalar 테이블에 비교용으로 남아 있습니다.
     FMatrix Result;
-#ifdef __SSE_EXPERIMENTAL__
-    SSE::InverseMatrix(&Result, &Mat);
-    return Result;
-#endif // __SSE_EXPERIMENTAL__
-
-    FMatrix Tmp;
-    float Det[4];
-
-    Tmp[0][0] = Mat[2][2] * Mat[3][3] - Mat[2][3] * Mat[3][2];
-    Tmp[0][1] = Mat[1][2] * Mat[3][3] - Mat[1][3] * Mat[3][2];
-    Tmp[0][2] = Mat[1][2] * Mat[2][3] - Mat[1][3] * Mat[2][2];
-
-    Tmp[1][0] = Mat[2][2] * Mat[3][3] - Mat[2][3] * Mat[3][2];
-    Tmp[1][1] = Mat[0][2] * Mat[3][3] - Mat[0][3] * Mat[3][2];
-    Tmp[1][2] = Mat[0][2] * Mat[2][3] - Mat[0][3] * Mat[2][2];
-
-    Tmp[2][0] = Mat[1][2] * Mat[3][3] - Mat[1][3] * Mat[3][2];
-    Tmp[2][1] = Mat[0][2] * Mat[3][3] - Mat[0][3] * Mat[3][2];
-    Tmp[2][2] = Mat[0][2] * Mat[1][3] - Mat[0][3] * Mat[1][2];
-
-    Tmp[3][0] = Mat[1][2] * Mat[2][3] - Mat[1][3] * Mat[2][2];
-    Tmp[3][1] = Mat[0][2] * Mat[2][3] - Mat[0][3] * Mat[2][2];
-    Tmp[3][2] = Mat[0][2] * Mat[1][3] - Mat[0][3] * Mat[1][2];
-
-    Det[0] = Mat[1][1] * Tmp[0][0] - Mat[2][1] * Tmp[0][1] + Mat[3][1] * Tmp[0][2];
-    Det[1] = Mat[0][1] * Tmp[1][0] - Mat[2][1] * Tmp[1][1] + Mat[3][1] * Tmp[1][2];
-    Det[2] = Mat[0][1] * Tmp[2][0] - Mat[1][1] * Tmp[2][1] + Mat[3][1] * Tmp[2][2];
-    Det[3] = Mat[0][1] * Tmp[3][0] - Mat[1][1] * Tmp[3][1] + Mat[2][1] * Tmp[3][2];
-
-    const float Determinant = Mat[0][0] * Det[0] - Mat[1][0] * Det[1] + Mat[2][0] * Det[2] - Mat[3][0] * Det[3];
-
-    if (Determinant == 0.0f || !std::isfinite(Determinant))
+    if (!SSE::InverseMatrix(&Result, &Mat))
     {
         return Identity;
     }
-
-    const float RDet = 1.0f / Determinant;
-
-    Result[0][0] = RDet * Det[0];
-    Result[0][1] = -RDet * Det[1];
-    Result[0][2] = RDet * Det[2];
-    Result[0][3] = -RDet * Det[3];
-    Result[1][0] = -RDet * (Mat[1][0] * Tmp[0][0] - Mat[2][0] * Tmp[0][1] + Mat[3][0] * Tmp[0][2]);
-    Result[1][1] = RDet * (Mat[0][0] * Tmp[1][0] - Mat[2][0] * Tmp[1][1] + Mat[3][0] * Tmp[1][2]);
-    Result[1][2] = -RDet * (Mat[0][0] * Tmp[2][0] - Mat[1][0] * Tmp[2][1] + Mat[3][0] * Tmp[2][2]);
-    Result[1][3] = RDet * (Mat[0][0] * Tmp[3][0] - Mat[1][0] * Tmp[3][1] + Mat[2][0] * Tmp[3][2]);
-    Result[2][0] = RDet * (
-        Mat[1][0] * (Mat[2][1] * Mat[3][3] - Mat[2][3] * Mat[3][1]) -
-        Mat[2][0] * (Mat[1][1] * Mat[3][3] - Mat[1][3] * Mat[3][1]) +
-        Mat[3][0] * (Mat[1][1] * Mat[2][3] - Mat[1][3] * Mat[2][1])
-    );
-    Result[2][1] = -RDet * (
-        Mat[0][0] * (Mat[2][1] * Mat[3][3] - Mat[2][3] * Mat[3][1]) -
-        Mat[2][0] * (Mat[0][1] * Mat[3][3] - Mat[0][3] * Mat[3][1]) +
-        Mat[3][0] * (Mat[0][1] * Mat[2][3] - Mat[0][3] * Mat[2][1])
-    );
-    Result[2][2] = RDet * (
-        Mat[0][0] * (Mat[1][1] * Mat[3][3] - Mat[1][3] * Mat[3][1]) -
-        Mat[1][0] * (Mat[0][1] * Mat[3][3] - Mat[0][3] * Mat[3][1]) +
-        Mat[3][0] * (Mat[0][1] * Mat[1][3] - Mat[0][3] * Mat[1][1])
-    );
-    Result[2][3] = -RDet * (
-        Mat[0][0] * (Mat[1][1] * Mat[2][3] - Mat[1][3] * Mat[2][1]) -
-        Mat[1][0] * (Mat[0][1] * Mat[2][3] - Mat[0][3] * Mat[2][1]) +
-        Mat[2][0] * (Mat[0][1] * Mat[1][3] - Mat[0][3] * Mat[1][1])
-    );
-    Result[3][0] = -RDet * (
-        Mat[1][0] * (Mat[2][1] * Mat[3][2] - Mat[2][2] * Mat[3][1]) -
-        Mat[2][0] * (Mat[1][1] * Mat[3][2] - Mat[1][2] * Mat[3][1]) +
-        Mat[3][0] * (Mat[1][1] * Mat[2][2] - Mat[1][2] * Mat[2][1])
-    );
-    Result[3][1] = RDet * (
-        Mat[0][0] * (Mat[2][1] * Mat[3][2] - Mat[2][2] * Mat[3][1]) -
-        Mat[2][0] * (Mat[0][1] * Mat[3][2] - Mat[0][2] * Mat[3][1]) +
-        Mat[3][0] * (Mat[0][1] * Mat[2][2] - Mat[0][2] * Mat[2][1])
-    );
-    Result[3][2] = -RDet * (
-        Mat[0][0] * (Mat[1][1] * Mat[3][2] - Mat[1][2] * Mat[3][1]) -
-        Mat[1][0] * (Mat[0][1] * Mat[3][2] - Mat[0][2] * Mat[3][1]) +
-        Mat[3][0] * (Mat[0][1] * Mat[1][2] - Mat[0][2] * Mat[1][1])
-    );
-    Result[3][3] = RDet * (
-        Mat[0][0] * (Mat[1][1] * Mat[2][2] - Mat[1][2] * Mat[2][1]) -
-        Mat[1][0] * (Mat[0][1] * Mat[2][2] - Mat[0][2] * Mat[2][1]) +
-        Mat[2][0] * (Mat[0][1] * Mat[1][2] - Mat[0][2] * Mat[1][1])
-    );
-
     return Result;
 }
 
@@ -196,12 +114,9 @@ FMatrix FMatrix::Inverse(const FMatrix& Mat)
 // 그 이외에서 사용할 시 정확한 결과를 보장하지 않음
 FMatrix FMatrix::InverseAffine() const
 {
-#ifdef __SSE_EXPERIMENTAL__
     FMatrix Result;
     SSE::InverseTransform(&Result, this);
     return Result;
-#endif // __SSE_EXPERIMENTAL__
-    return this->Inverse();
 }
 
 FMatrix FMatrix::CreateRotationMatrix(const FRotator& R)
@@ -288,71 +203,33 @@ FMatrix FMatrix::CreateTranslationMatrix(const FVector& position)
 
 FVector FMatrix::TransformVector(const FVector& v, const FMatrix& m)
 {
-#ifdef __SSE_EXPERIMENTAL__
-    FVector4 Result4;
-    FVector4 Vec4 = { v, 1 };
-    SSE::TransformPosition_SSE(&Result4, &Vec4, &m);
-    return FVector(Result4.X, Result4.Y, Result4.Z);
-#endif // __SSE_EXPERIMENTAL__
-    
-    FVector result;
-
     // 4x4 행렬을 사용하여 벡터 변환 (W = 0으로 가정, 방향 벡터)
-    result.X = v.X * m.M[0][0] + v.Y * m.M[1][0] + v.Z * m.M[2][0] + 0.0f * m.M[3][0];
-    result.Y = v.X * m.M[0][1] + v.Y * m.M[1][1] + v.Z * m.M[2][1] + 0.0f * m.M[3][1];
-    result.Z = v.X * m.M[0][2] + v.Y * m.M[1][2] + v.Z * m.M[2][2] + 0.0f * m.M[3][2];
-
-
-    return result;
+    FVector Result;
+    SSE::VectorStoreFloat3(SSE::VectorTransformNormal(SSE::VectorLoadFloat3(&v.X), &m), &Result.X);
+    return Result;
 }
 
 // FVector4를 변환하는 함수
 FVector4 FMatrix::TransformVector(const FVector4& v, const FMatrix& m)
 {
-#ifdef __SSE_EXPERIMENTAL__
-    FVector4 Result4;
-    SSE::TransformVector4_SSE(&Result4, &v, &m);
-    return FVector(Result4.X, Result4.Y, Result4.Z);
-#endif // __SSE_EXPERIMENTAL__
-
-    FVector4 result;
-    result.X = v.X * m.M[0][0] + v.Y * m.M[1][0] + v.Z * m.M[2][0] + v.W * m.M[3][0];
-    result.Y = v.X * m.M[0][1] + v.Y * m.M[1][1] + v.Z * m.M[2][1] + v.W * m.M[3][1];
-    result.Z = v.X * m.M[0][2] + v.Y * m.M[1][2] + v.Z * m.M[2][2] + v.W * m.M[3][2];
-    result.W = v.X * m.M[0][3] + v.Y * m.M[1][3] + v.Z * m.M[2][3] + v.W * m.M[3][3];
-    return result;
+    FVector4 Result;
+    SSE::TransformVector4_SSE(&Result, &v, &m);
+    return Result;
 }
 
 FVector4 FMatrix::TransformFVector4(const FVector4& vector) const
 {
-#ifdef __SSE_EXPERIMENTAL__
-    FVector4 Result4;
-    SSE::TransformVector4_SSE(&Result4, &vector, this);
-    return FVector(Result4.X, Result4.Y, Result4.Z);
-#endif // __SSE_EXPERIMENTAL__
-
-    return FVector4(
-        M[0][0] * vector.X + M[1][0] * vector.Y + M[2][0] * vector.Z + M[3][0] * vector.W,
-        M[0][1] * vector.X + M[1][1] * vector.Y + M[2][1] * vector.Z + M[3][1] * vector.W,
-        M[0][2] * vector.X + M[1][2] * vector.Y + M[2][2] * vector.Z + M[3][2] * vector.W,
-        M[0][3] * vector.X + M[1][3] * vector.Y + M[2][3] * vector.Z + M[3][3] * vector.W
-    );
+    FVector4 Result;
+    SSE::TransformVector4_SSE(&Result, &vector, this);
+    return Result;
 }
 
 FVector FMatrix::TransformPosition(const FVector& vector) const
 {
-#ifdef __SSE_EXPERIMENTAL__
-    FVector4 Result4;
-    FVector4 Vec4 = { vector, 1 };
-    SSE::TransformPosition_SSE(&Result4, &Vec4, this);
-    return FVector(Result4.X, Result4.Y, Result4.Z);
-#endif // __SSE_EXPERIMENTAL__
-
-    float x = M[0][0] * vector.X + M[1][0] * vector.Y + M[2][0] * vector.Z + M[3][0];
-    float y = M[0][1] * vector.X + M[1][1] * vector.Y + M[2][1] * vector.Z + M[3][1];
-    float z = M[0][2] * vector.X + M[1][2] * vector.Y + M[2][2] * vector.Z + M[3][2];
-    float w = M[0][3] * vector.X + M[1][3] * vector.Y + M[2][3] * vector.Z + M[3][3];
-    return w != 0.0f ? FVector{x / w, y / w, z / w} : FVector{x, y, z};
+    // W가 0이 아니면 W로 나눕니다.
+    FVector Result;
+    SSE::VectorStoreFloat3(SSE::VectorDivideByW(SSE::VectorTransformPosition(SSE::VectorLoadFloat3(&vector.X), this)), &Result.X);
+    return Result;
 }
 
 FVector FMatrix::TransformVector(const FVector& vector) const
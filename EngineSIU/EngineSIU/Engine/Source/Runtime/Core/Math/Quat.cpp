@@ -2,6 +2,7 @@
 
 #include "Vector.h"
 #include "Matrix.h"
+#include "MathSSE.h"
 
 const FQuat FQuat::Identity = FQuat{0.0f, 0.0f, 0.0f, 1.0f};
 
@@ -132,24 +133,17 @@ FQuat FQuat::operator*(const FQuat& Other) const
     // (Q1 * Q2).X = (W1*X2 + X1*W2 + Y1*Z2 - Z1*Y2)
     // (Q1 * Q2).Y = (W1*Y2 - X1*Z2 + Y1*W2 + Z1*X2)
     // (Q1 * Q2).Z = (W1*Z2 + X1*Y2 - Y1*X2 + Z1*W2)
-    return FQuat{
-        W * Other.X + X * Other.W + Y * Other.Z - Z * Other.Y,  // New X
-        W * Other.Y - X * Other.Z + Y * Other.W + Z * Other.X,  // New Y
-        W * Other.Z + X * Other.Y - Y * Other.X + Z * Other.W,  // New Z
-        W * Other.W - X * Other.X - Y * Other.Y - Z * Other.Z   // New W
-    };
+    FQuat Result;
+    _mm_store_ps(&Result.X, SSE::VectorQuaternionMultiply(_mm_load_ps(&X), _mm_load_ps(&Other.X)));
+    return Result;
 }
 
 FVector FQuat::RotateVector(const FVector& V) const
 {
-    // Q * V * Q.Conjugate()
-    // V_quat = (V.X, V.Y, V.Z, 0)
-    const FQuat Conjugate = FQuat(-X, -Y, -Z, W); // 쿼터니언의 켤레
-    const FQuat VQuat(V.X, V.Y, V.Z, 0.f);
-    const FQuat Temp = *this * VQuat;
-    const FQuat Result = Temp * Conjugate;
-
-    return FVector{Result.X, Result.Y, Result.Z};
+    // Q * V * Q.Conjugate()를 전개한 식을 사용하므로, 단위 쿼터니언이어야 합니다.
+    FVector Result;
+    SSE::VectorStoreFloat3(SSE::VectorQuaternionRotateVector(_mm_load_ps(&X), SSE::VectorLoadFloat3(&V.X)), &Result.X);
+    return Result;
 }
 
 bool FQuat::IsNormalized() const
@@ -159,16 +153,12 @@ bool FQuat::IsNormalized() const
 
 void FQuat::Normalize(float Tolerance)
 {
-    // TODO: 추후에 SIMD 사용
-    const float SquareSum = X * X + Y * Y + Z * Z + W * W;
+    const VectorRegister4Float Quat = _mm_load_ps(&X);
+    const VectorRegister4Float SquareSum = _mm_dp_ps(Quat, Quat, 0xFF);
 
-    if (SquareSum >= Tolerance)
+    if (_mm_cvtss_f32(SquareSum) >= Tolerance)
     {
-        const float Scale = FMath::InvSqrt(SquareSum);
-        X *= Scale;
-        Y *= Scale;
-        Z *= Scale;
-        W *= Scale;
+        _mm_store_ps(&X, _mm_div_ps(Quat, _mm_sqrt_ps(SquareSum)));
     }
     else
     {
@@ -271,9 +261,10 @@ FQuat FQuat::MakeFromEuler(const FVector& EulerDegrees)
     const float HalfPitch = (EulerDegrees.Y * DegreeToRadian) * 0.5f; // Y축 회전 (Pitch)
     const float HalfYaw   = (EulerDegrees.Z * DegreeToRadian) * 0.5f; // Z축 회전 (Yaw)
 
-    const float SR = FMath::Sin(HalfRoll);  const float CR = FMath::Cos(HalfRoll);
-    const float SP = FMath::Sin(HalfPitch); const float CP = FMath::Cos(HalfPitch);
-    const float SY = FMath::Sin(HalfYaw);   const float CY = FMath::Cos(HalfYaw);
+    float SR, CR, SP, CP, SY, CY;
+    FMath::FastSinCos(&SR, &CR, HalfRoll);
+    FMath::FastSinCos(&SP, &CP, HalfPitch);
+    FMath::FastSinCos(&SY, &CY, HalfYaw);
 
     // ZYX 순서 (Yaw, Pitch, Roll)
     // W = CR*CP*CY + SR*SP*SY;
@@ -309,18 +300,7 @@ FQuat FQuat::MakeFromEuler(const FVector& EulerDegrees)
 FMatrix FQuat::ToMatrix() const
 {
     FMatrix R;
-
-    const float X2 = X + X;    const float Y2 = Y + Y;    const float Z2 = Z + Z;
-    const float XX = X * X2;   const float XY = X * Y2;   const float XZ = X * Z2;
-    const float YY = Y * Y2;   const float YZ = Y * Z2;   const float ZZ = Z * Z2;
-    const float WX = W * X2;   const float WY = W * Y2;   const float WZ = W * Z2;
-
-    R.M[0][0] = 1.0f - (YY + ZZ);    R.M[1][0] = XY - WZ;               R.M[2][0] = XZ + WY;             R.M[3][0] = 0.0f;
-    R.M[0][1] = XY + WZ;             R.M[1][1] = 1.0f - (XX + ZZ);      R.M[2][1] = YZ - WX;             R.M[3][1] = 0.0f;
-    R.M[0][2] = XZ - WY;             R.M[1][2] = YZ + WX;               R.M[2][2] = 1.0f - (XX + YY);    R.M[3][2] = 0.0f;
-    
-    R.M[0][3] = 0.0f;                R.M[1][3] = 0.0f;                  R.M[2][3] = 0.0f;                R.M[3][3] = 1.0f;
-
+    SSE::QuaternionToMatrix(&R, _mm_load_ps(&X));
     return R;
 }
 
@@ -344,20 +324,20 @@ FRotator FQuat::Rotator() const
     if (SingularityTest < -SINGULARITY_THRESHOLD)
     {
         Pitch = -90.f;
-        Yaw = (FMath::Atan2(YawY, YawX) * RAD_TO_DEG);
-        Roll = FRotator::NormalizeAxis(-Yaw - (2.f * FMath::Atan2(X, W) * RAD_TO_DEG));
+        Yaw = (FMath::FastAtan2(YawY, YawX) * RAD_TO_DEG);
+        Roll = FRotator::NormalizeAxis(-Yaw - (2.f * FMath::FastAtan2(X, W) * RAD_TO_DEG));
     }
     else if (SingularityTest > SINGULARITY_THRESHOLD)
     {
         Pitch = 90.f;
-        Yaw = (FMath::Atan2(YawY, YawX) * RAD_TO_DEG);
-        Roll = FRotator::NormalizeAxis(Yaw - (2.f * FMath::Atan2(X, W) * RAD_TO_DEG));
+        Yaw = (FMath::FastAtan2(YawY, YawX) * RAD_TO_DEG);
+        Roll = FRotator::NormalizeAxis(Yaw - (2.f * FMath::FastAtan2(X, W) * RAD_TO_DEG));
     }
     else
     {
         Pitch = (FMath::Asin(2.f * SingularityTest) * RAD_TO_DEG);
-        Yaw = (FMath::Atan2(YawY, YawX) * RAD_TO_DEG);
-        Roll = (FMath::Atan2(-2.f * (W*X + Y*Z), (1.f - 2.f * (FMath::Square(X) + FMath::Square(Y)))) * RAD_TO_DEG);
+        Yaw = (FMath::FastAtan2(YawY, YawX) * RAD_TO_DEG);
+        Roll = (FMath::FastAtan2(-2.f * (W*X + Y*Z), (1.f - 2.f * (FMath::Square(X) + FMath::Square(Y)))) * RAD_TO_DEG);
     }
 
     FRotator RotatorFromQuat = FRotator(Pitch, Yaw, Roll);
@@ -57,7 +57,7 @@ public:
     // 쿼터니언의 곱셈 연산 (회전 결합)
     FQuat operator*(const FQuat& Other) const;
 
-    // (쿼터니언) 벡터 회전
+    // (단위 쿼터니언) 벡터 회전
     FVector RotateVector(const FVector& V) const;
 
     // 단위 쿼터니언 여부 확인
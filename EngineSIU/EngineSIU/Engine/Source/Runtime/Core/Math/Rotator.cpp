@@ -126,8 +126,8 @@ FVector FRotator::ToVector() const
     const float YawNoWinding = FMath::Fmod(Yaw, 360.f);
 
     float CP, SP, CY, SY;
-    FMath::SinCos( &SP, &CP, FMath::DegreesToRadians(PitchNoWinding) );
-    FMath::SinCos( &SY, &CY, FMath::DegreesToRadians(YawNoWinding) );
+    FMath::FastSinCos( &SP, &CP, FMath::DegreesToRadians(PitchNoWinding) );
+    FMath::FastSinCos( &SY, &CY, FMath::DegreesToRadians(YawNoWinding) );
     FVector V = FVector( CP*CY, CP*SY, SP );
 
     if (!_finite(V.X) || !_finite(V.Y) || !_finite(V.Z))
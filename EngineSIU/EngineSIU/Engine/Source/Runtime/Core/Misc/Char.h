@@ -21,6 +21,20 @@ struct FChar
         // unsigned char로 캐스팅하여 isdigit 호출 (음수 char 값 문제를 피하기 위함)
         // isdigit는 int를 받지만 unsigned char는 안전하게 int로 변환됨
         return std::isdigit(static_cast<unsigned char>(Ch)) != 0;
+#endif
+    }
+
+    /**
+     * 주어진 문자가 공백 문자(' ', '\t', '\n' 등)인지 확인합니다.
+     * @param Ch 확인할 TCHAR 문자.
+     * @return 문자가 공백이면 true, 그렇지 않으면 false를 반환합니다.
+     */
+    static inline bool IsWhitespace(TCHAR Ch)
+    {
+#if USE_WIDECHAR
+        return std::iswspace(static_cast<wint_t>(Ch)) != 0;
+#else
+        return std::isspace(static_cast<unsigned char>(Ch)) != 0;
 #endif
     }
 };
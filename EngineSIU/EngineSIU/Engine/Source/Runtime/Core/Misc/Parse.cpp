@@ -259,3 +259,25 @@ bool FParse::Bool(const TCHAR* Stream, const TCHAR* Match, bool& OnOff)
         return false;
     }
 }
+
+//
+// Checks for a switch.
+//
+bool FParse::Param(const TCHAR* Stream, const TCHAR* Param)
+{
+    const TCHAR* Start = Stream;
+    while ((Start = FCString::Strifind(Start, Param, true)) != nullptr)
+    {
+        // -Param 또는 /Param 형태이고, 뒤에 다른 글자가 붙어있지 않아야 합니다.
+        if (Start > Stream && (Start[-1] == '-' || Start[-1] == '/'))
+        {
+            const TCHAR* End = Start + FCString::Strlen(Param);
+            if (*End == '\0' || FChar::IsWhitespace(*End))
+            {
+                return true;
+            }
+        }
+        ++Start;
+    }
+    return false;
+}
@@ -55,5 +55,8 @@ struct FParse
     
     /** Parses a boolean value. */
     static bool Bool( const TCHAR* Stream, const TCHAR* Match, bool& OnOff );
+
+    /** Checks if a command-line switch such as -Param or /Param is present. */
+    static bool Param( const TCHAR* Stream, const TCHAR* Param );
     
 };
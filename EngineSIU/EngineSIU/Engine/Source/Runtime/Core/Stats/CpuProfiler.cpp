@@ -0,0 +1,464 @@
+#include "CpuProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+#include "ProfilerStatsManager.h"
+#include "WindowsPlatformTime.h"
+#include "Container/Map.h"
+#include "UserInterface/Console.h"
+
+
+/** 스레드 하나의 기록 상태, Scopes와 Depth는 소유 스레드만 접근합니다. */
+struct FCpuProfiler::FThreadBuffer
+{
+    struct FOpenScope
+    {
+        TStatId StatId;
+        uint64 StartCycles;
+
+        /** 이 Scope 안에서 끝난 바로 아래 Scope들의 시간 합 */
+        uint64 ChildCycles;
+    };
+
+    explicit FThreadBuffer(uint16 InThreadIndex)
+        : Events(ThreadQueueCapacity)
+        , ThreadIndex(InThreadIndex)
+    {
+    }
+
+    TBoundedQueue<FProfileEvent, EQueueMode::Spsc> Events;
+
+    FOpenScope Scopes[MaxScopeDepth];
+
+    /** 열려있는 Scope 수, MaxScopeDepth를 넘은 Scope는 세기만 하고 기록하지 않습니다. */
+    int32 Depth = 0;
+
+    uint16 ThreadIndex;
+
+    /** ThreadNameMutex로 보호됩니다. */
+    FString Name;
+};
+
+thread_local FCpuProfiler::FThreadBuffer* FCpuProfiler::LocalThreadBuffer = nullptr;
+thread_local bool FCpuProfiler::bLocalThreadRegistrationFailed = false;
+
+
+namespace
+{
+    constexpr int32 DefaultHistorySize = 300;
+
+    /** 정렬된 Values에서 Percent 위치의 값 (Nearest-rank) */
+    double GetPercentile(const TArray<double>& SortedValues, double Percent)
+    {
+        const int32 Rank = static_cast<int32>(std::ceil(Percent * SortedValues.Num())) - 1;
+        return SortedValues[std::clamp(Rank, 0, SortedValues.Num() - 1)];
+    }
+
+    FProfileStatSummary MakeSummary(FName Name, TArray<double>& Values)
+    {
+        FProfileStatSummary Summary;
+        Summary.Name = Name;
+        Summary.NumFrames = Values.Num();
+        if (Values.Num() == 0)
+        {
+            return Summary;
+        }
+
+        std::sort(Values.begin(), Values.end());
+
+        double TotalMs = 0.0;
+        for (const double Value : Values)
+        {
+            TotalMs += Value;
+        }
+
+        Summary.MinMs = Values[0];
+        Summary.MaxMs = Values.Last();
+        Summary.AvgMs = TotalMs / Values.Num();
+        Summary.P50Ms = GetPercentile(Values, 0.50);
+        Summary.P95Ms = GetPercentile(Values, 0.95);
+        Summary.P99Ms = GetPercentile(Values, 0.99);
+        return Summary;
+    }
+
+    std::string EscapeJson(const std::string& Text)
+    {
+        std::string Escaped;
+        Escaped.reserve(Text.size());
+        for (const char Char : Text)
+        {
+            switch (Char)
+            {
+            case '"':  Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\t': Escaped += "\\t"; break;
+            default:
+                if (static_cast<uint8>(Char) < 0x20)
+                {
+                    Escaped += std::format("\\u{:04x}", static_cast<uint8>(Char));
+                }
+                else
+                {
+                    Escaped += Char;
+                }
+                break;
+            }
+        }
+        return Escaped;
+    }
+}
+
+
+double FProfileFrame::GetDurationMs() const
+{
+    return FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+}
+
+FCpuProfiler& FCpuProfiler::Get()
+{
+    static FCpuProfiler Instance;
+    return Instance;
+}
+
+FCpuProfiler::FCpuProfiler()
+{
+    Frames.SetNum(DefaultHistorySize);
+}
+
+FCpuProfiler::~FCpuProfiler()
+{
+    // 정적 소멸 시점에는 Worker가 모두 종료되어 있습니다.
+    const int32 NumBuffers = std::min(NumThreadBuffers.load(std::memory_order_acquire), MaxThreads);
+    for (int32 Index = 0; Index < NumBuffers; ++Index)
+    {
+        delete ThreadBuffers[Index].load(std::memory_order_acquire);
+    }
+}
+
+void FCpuProfiler::BeginScope(TStatId StatId, uint64 StartCycles)
+{
+    FThreadBuffer* Buffer = GetThreadBuffer();
+    if (!Buffer)
+    {
+        return;
+    }
+
+    if (Buffer->Depth < MaxScopeDepth)
+    {
+        Buffer->Scopes[Buffer->Depth] = { StatId, StartCycles, 0 };
+    }
+    ++Buffer->Depth;
+}
+
+void FCpuProfiler::EndScope(uint64 EndCycles)
+{
+    FThreadBuffer* Buffer = GetThreadBuffer();
+    if (!Buffer || Buffer->Depth == 0)
+    {
+        return;
+    }
+
+    const int32 Depth = --Buffer->Depth;
+    if (Depth >= MaxScopeDepth)
+    {
+        NumDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const FThreadBuffer::FOpenScope& Scope = Buffer->Scopes[Depth];
+    const uint64 DurationCycles = EndCycles - Scope.StartCycles;
+    if (Depth > 0)
+    {
+        Buffer->Scopes[Depth - 1].ChildCycles += DurationCycles;
+    }
+
+    FProfileEvent Event;
+    Event.StatId = Scope.StatId;
+    Event.StartCycles = Scope.StartCycles;
+    Event.EndCycles = EndCycles;
+    Event.ExclusiveCycles = DurationCycles - std::min(Scope.ChildCycles, DurationCycles);
+    Event.Depth = static_cast<uint16>(Depth);
+    Event.ThreadIndex = Buffer->ThreadIndex;
+
+    if (!Buffer->Events.Enqueue(Event))
+    {
+        NumDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void FCpuProfiler::SetThreadName(const FString& Name)
+{
+    if (FThreadBuffer* Buffer = GetThreadBuffer())
+    {
+        std::lock_guard Lock(ThreadNameMutex);
+        Buffer->Name = Name;
+    }
+}
+
+FCpuProfiler::FThreadBuffer* FCpuProfiler::GetThreadBuffer()
+{
+    if (LocalThreadBuffer || bLocalThreadRegistrationFailed)
+    {
+        return LocalThreadBuffer;
+    }
+
+    // 스레드마다 한 번만 실행됩니다.
+    const int32 Index = NumThreadBuffers.fetch_add(1, std::memory_order_acq_rel);
+    if (Index >= MaxThreads)
+    {
+        bLocalThreadRegistrationFailed = true;
+        return nullptr;
+    }
+
+    FThreadBuffer* Buffer = new FThreadBuffer(static_cast<uint16>(Index));
+    Buffer->Name = FString::Printf(TEXT("Thread %d"), Index);
+    ThreadBuffers[Index].store(Buffer, std::memory_order_release);
+    LocalThreadBuffer = Buffer;
+    return Buffer;
+}
+
+void FCpuProfiler::BeginFrame()
+{
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+
+    // 첫 호출은 프레임을 시작하기만 합니다.
+    if (CurrentFrameStartCycles != 0)
+    {
+        FProfileFrame& Frame = Frames[static_cast<int32>(NextFrameNumber % Frames.Num())];
+        Frame.FrameNumber = NextFrameNumber;
+        Frame.StartCycles = CurrentFrameStartCycles;
+        Frame.EndCycles = NowCycles;
+        Frame.Events.Empty(Frame.Events.Max());
+
+        const int32 NumBuffers = std::min(NumThreadBuffers.load(std::memory_order_acquire), MaxThreads);
+        for (int32 Index = 0; Index < NumBuffers; ++Index)
+        {
+            if (FThreadBuffer* Buffer = ThreadBuffers[Index].load(std::memory_order_acquire))
+            {
+                Buffer->Events.DequeueBatch(Frame.Events);
+            }
+        }
+
+        ++NextFrameNumber;
+
+        // 같은 Stat이 여러 번 기록되었으면 합산합니다.
+        FProfilerStatsManager::BeginFrame();
+        for (const FProfileEvent& Event : Frame.Events)
+        {
+            FProfilerStatsManager::AddCpuStat(Event.StatId, FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles));
+        }
+
+        if (CaptureFramesRemaining > 0 && --CaptureFramesRemaining == 0)
+        {
+            if (ExportChromeTrace(CapturePath, CaptureNumFrames))
+            {
+                UE_LOG(ELogLevel::Display, "Saved CPU profile of %d frames : %s", CaptureNumFrames, *CapturePath);
+            }
+            else
+            {
+                UE_LOG(ELogLevel::Error, "Failed to save CPU profile : %s", *CapturePath);
+            }
+        }
+    }
+
+    CurrentFrameStartCycles = NowCycles;
+}
+
+void FCpuProfiler::SetHistorySize(int32 NumFrames)
+{
+    Frames.Empty();
+    Frames.SetNum(std::max(NumFrames, 1));
+    HistoryStartFrameNumber = NextFrameNumber;
+}
+
+int32 FCpuProfiler::GetNumFrames() const
+{
+    return static_cast<int32>(std::min<uint64>(NextFrameNumber - HistoryStartFrameNumber, Frames.Num()));
+}
+
+const FProfileFrame& FCpuProfiler::GetFrame(int32 Index) const
+{
+    const uint64 FrameNumber = NextFrameNumber - GetNumFrames() + Index;
+    return Frames[static_cast<int32>(FrameNumber % Frames.Num())];
+}
+
+void FCpuProfiler::GetStatSummaries(TArray<FProfileStatSummary>& OutSummaries, int32 NumFrames) const
+{
+    struct FFrameTotal
+    {
+        double InclusiveMs = 0.0;
+        double ExclusiveMs = 0.0;
+        int32 NumCalls = 0;
+    };
+
+    struct FStatTotal
+    {
+        TArray<double> FrameMs;
+        double ExclusiveMs = 0.0;
+        int64 NumCalls = 0;
+    };
+
+    const int32 NumAvailable = GetNumFrames();
+    const int32 NumToSummarize = NumFrames > 0 ? std::min(NumFrames, NumAvailable) : NumAvailable;
+
+    TMap<FName, FStatTotal> StatTotals;
+    TMap<FName, FFrameTotal> FrameTotals;
+    for (int32 Index = NumAvailable - NumToSummarize; Index < NumAvailable; ++Index)
+    {
+        FrameTotals.Empty();
+        for (const FProfileEvent& Event : GetFrame(Index).Events)
+        {
+            FFrameTotal& Total = FrameTotals.FindOrAdd(Event.StatId.GetName());
+            Total.InclusiveMs += FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles);
+            Total.ExclusiveMs += FPlatformTime::ToMilliseconds(Event.ExclusiveCycles);
+            ++Total.NumCalls;
+        }
+
+        for (const auto& [Name, Total] : FrameTotals)
+        {
+            FStatTotal& StatTotal = StatTotals.FindOrAdd(Name);
+            StatTotal.FrameMs.Add(Total.InclusiveMs);
+            StatTotal.ExclusiveMs += Total.ExclusiveMs;
+            StatTotal.NumCalls += Total.NumCalls;
+        }
+    }
+
+    OutSummaries.Empty();
+    for (auto& [Name, StatTotal] : StatTotals)
+    {
+        FProfileStatSummary Summary = MakeSummary(Name, StatTotal.FrameMs);
+        Summary.AvgCallsPerFrame = static_cast<double>(StatTotal.NumCalls) / Summary.NumFrames;
+        Summary.AvgExclusiveMs = StatTotal.ExclusiveMs / Summary.NumFrames;
+        OutSummaries.Add(Summary);
+    }
+
+    std::sort(OutSummaries.begin(), OutSummaries.end(), [](const FProfileStatSummary& A, const FProfileStatSummary& B)
+    {
+        return A.AvgMs > B.AvgMs;
+    });
+}
+
+FProfileStatSummary FCpuProfiler::GetFrameTimeSummary(int32 NumFrames) const
+{
+    const int32 NumAvailable = GetNumFrames();
+    const int32 NumToSummarize = NumFrames > 0 ? std::min(NumFrames, NumAvailable) : NumAvailable;
+
+    TArray<double> FrameMs;
+    FrameMs.Reserve(NumToSummarize);
+    for (int32 Index = NumAvailable - NumToSummarize; Index < NumAvailable; ++Index)
+    {
+        FrameMs.Add(GetFrame(Index).GetDurationMs());
+    }
+
+    FProfileStatSummary Summary = MakeSummary(FName(TEXT("Frame")), FrameMs);
+    Summary.AvgCallsPerFrame = 1.0;
+    Summary.AvgExclusiveMs = Summary.AvgMs;
+    return Summary;
+}
+
+bool FCpuProfiler::ExportChromeTrace(const FString& Path, int32 NumFrames) const
+{
+    const int32 NumAvailable = GetNumFrames();
+    const int32 NumToExport = NumFrames > 0 ? std::min(NumFrames, NumAvailable) : NumAvailable;
+    if (NumToExport == 0)
+    {
+        return false;
+    }
+
+    const std::filesystem::path FilePath(Path.ToWideString());
+    if (FilePath.has_parent_path())
+    {
+        std::error_code ErrorCode;
+        std::filesystem::create_directories(FilePath.parent_path(), ErrorCode);
+    }
+
+    std::ofstream File(FilePath, std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    const int32 FirstIndex = NumAvailable - NumToExport;
+    const uint64 BaseCycles = GetFrame(FirstIndex).StartCycles;
+    const auto ToMicroseconds = [BaseCycles](uint64 Cycles)
+    {
+        // 이전 프레임에 시작된 Job은 BaseCycles보다 앞설 수 있습니다.
+        return Cycles >= BaseCycles
+            ? FPlatformTime::ToMilliseconds(Cycles - BaseCycles) * 1000.0
+            : -FPlatformTime::ToMilliseconds(BaseCycles - Cycles) * 1000.0;
+    };
+
+    File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    File << R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"EngineSIU"}})";
+
+    {
+        std::lock_guard Lock(ThreadNameMutex);
+        const int32 NumBuffers = std::min(NumThreadBuffers.load(std::memory_order_acquire), MaxThreads);
+        for (int32 Index = 0; Index < NumBuffers; ++Index)
+        {
+            if (const FThreadBuffer* Buffer = ThreadBuffers[Index].load(std::memory_order_acquire))
+            {
+                File << std::format(
+                    ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+                    Buffer->ThreadIndex, EscapeJson(*Buffer->Name)
+                );
+                File << std::format(
+                    ",\n{{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"sort_index\":{}}}}}",
+                    Buffer->ThreadIndex, Buffer->ThreadIndex
+                );
+            }
+        }
+    }
+
+    // FName::ToString은 Lock을 잡으므로 Stat 이름은 한 번씩만 변환합니다.
+    TMap<FName, std::string> EscapedNames;
+    for (int32 Index = FirstIndex; Index < NumAvailable; ++Index)
+    {
+        const FProfileFrame& Frame = GetFrame(Index);
+        File << std::format(
+            ",\n{{\"name\":\"Frame {}\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":{:.3f}}}",
+            Frame.FrameNumber, ToMicroseconds(Frame.StartCycles)
+        );
+
+        for (const FProfileEvent& Event : Frame.Events)
+        {
+            const FName Name = Event.StatId.GetName();
+            std::string& EscapedName = EscapedNames.FindOrAdd(Name);
+            if (EscapedName.empty())
+            {
+                EscapedName = EscapeJson(*Name.ToString());
+            }
+
+            File << std::format(
+                ",\n{{\"name\":\"{}\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                EscapedName, Event.ThreadIndex, ToMicroseconds(Event.StartCycles),
+                FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles) * 1000.0
+            );
+        }
+    }
+
+    File << "\n]}\n";
+    return File.good();
+}
+
+void FCpuProfiler::StartCapture(int32 NumFrames, const FString& Path)
+{
+    CaptureNumFrames = std::max(NumFrames, 1);
+    CaptureFramesRemaining = CaptureNumFrames;
+    CapturePath = Path;
+
+    if (GetHistorySize() < CaptureNumFrames)
+    {
+        SetHistorySize(CaptureNumFrames);
+    }
+}
+
+FString FCpuProfiler::MakeDefaultCapturePath() const
+{
+    return FString::Printf(TEXT("Saved/Profiling/CpuProfile_%llu.json"), NextFrameNumber);
+}
@@ -0,0 +1,178 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+
+#include "StatDefine.h"
+#include "Container/Array.h"
+#include "Container/LockFreeQueue.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/** 끝난 CPU Scope 하나 */
+struct FProfileEvent
+{
+    TStatId StatId;
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+
+    /** 안쪽 Scope들의 시간을 뺀 시간 */
+    uint64 ExclusiveCycles = 0;
+
+    /** 같은 스레드에서 바깥에 열려있던 Scope 수, 0이면 최상위 Scope입니다. */
+    uint16 Depth = 0;
+
+    /** FCpuProfiler에 등록된 스레드 번호 */
+    uint16 ThreadIndex = 0;
+};
+
+
+/** FCpuProfiler::BeginFrame 사이에 끝난 Event들 */
+struct FProfileFrame
+{
+    uint64 FrameNumber = 0;
+    uint64 StartCycles = 0;
+    uint64 EndCycles = 0;
+
+    /** 스레드마다 끝난 순서대로 모여있습니다. 안쪽 Scope가 바깥 Scope보다 먼저 나옵니다. */
+    TArray<FProfileEvent> Events;
+
+    double GetDurationMs() const;
+};
+
+
+/** 여러 프레임에 걸친 Stat 하나의 통계 */
+struct FProfileStatSummary
+{
+    FName Name;
+
+    /** Stat이 한 번이라도 기록된 프레임 수, 아래 값들은 이 프레임들만으로 계산합니다. */
+    int32 NumFrames = 0;
+
+    double AvgCallsPerFrame = 0.0;
+
+    /** 프레임마다 모든 스레드의 Inclusive 시간을 더한 값의 분포 */
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double MaxMs = 0.0;
+    double P50Ms = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+
+    double AvgExclusiveMs = 0.0;
+};
+
+
+/**
+ * 계층형 CPU Profiler
+ *
+ * - QUICK_SCOPE_CYCLE_COUNTER의 Scope를 스레드별로 기록합니다. 스레드마다 열린 Scope의 Stack을 두어
+ *   Depth와 Exclusive 시간을 계산하고, 끝난 Event는 그 스레드 전용 Spsc Queue에 Lock 없이 넣습니다.
+ * - 게임 스레드가 매 프레임 BeginFrame에서 Queue들을 모아 한 프레임으로 만들고, 최근 HistorySize개 프레임을 Ring에 보관합니다.
+ * - 보관된 프레임으로 min/avg/max/percentile 통계를 내거나 Chrome Trace(Perfetto) JSON으로 저장할 수 있습니다.
+ *
+ * BeginScope/EndScope/SetThreadName 외의 함수는 게임 스레드에서만 호출해야 합니다.
+ */
+class FCpuProfiler
+{
+public:
+    /** Event를 기록할 수 있는 최대 스레드 수, 넘어서면 그 스레드의 Event는 기록하지 않습니다. */
+    static constexpr int32 MaxThreads = 64;
+
+    /** 한 스레드에서 동시에 열 수 있는 최대 Scope 깊이 */
+    static constexpr int32 MaxScopeDepth = 64;
+
+    /** 스레드마다 BeginFrame 전까지 쌓아둘 수 있는 최대 Event 수 */
+    static constexpr uint32 ThreadQueueCapacity = 16384;
+
+    static FCpuProfiler& Get();
+
+    FCpuProfiler(const FCpuProfiler&) = delete;
+    FCpuProfiler& operator=(const FCpuProfiler&) = delete;
+
+    /** 현재 스레드에서 Scope를 엽니다. FScopeCycleCounter가 호출합니다. */
+    void BeginScope(TStatId StatId, uint64 StartCycles);
+
+    /** 현재 스레드에서 가장 안쪽 Scope를 닫습니다. */
+    void EndScope(uint64 EndCycles);
+
+    /** 현재 스레드의 이름을 정합니다. Chrome Trace에 표시됩니다. */
+    void SetThreadName(const FString& Name);
+
+    /**
+     * 지난 프레임을 마무리하고 새 프레임을 시작합니다. 매 프레임 시작 시 호출합니다.
+     * 지난 프레임의 Stat별 시간은 FProfilerStatsManager에도 기록됩니다.
+     */
+    void BeginFrame();
+
+    /** 보관할 프레임 수를 바꿉니다. 보관 중인 프레임은 버려집니다. */
+    void SetHistorySize(int32 NumFrames);
+    int32 GetHistorySize() const { return Frames.Num(); }
+
+    /** 보관 중인 프레임 수 */
+    int32 GetNumFrames() const;
+
+    /** @param Index 0이 가장 오래된 프레임 */
+    const FProfileFrame& GetFrame(int32 Index) const;
+
+    /**
+     * 최근 NumFrames개 프레임의 Stat별 통계를 AvgMs가 큰 순서로 구합니다.
+     * @param NumFrames 0이면 보관 중인 모든 프레임
+     */
+    void GetStatSummaries(TArray<FProfileStatSummary>& OutSummaries, int32 NumFrames = 0) const;
+
+    /** 최근 NumFrames개 프레임 시간의 통계, Name은 "Frame"입니다. */
+    FProfileStatSummary GetFrameTimeSummary(int32 NumFrames = 0) const;
+
+    /**
+     * 최근 NumFrames개 프레임을 Chrome Trace JSON으로 저장합니다. chrome://tracing이나 ui.perfetto.dev에서 열 수 있습니다.
+     * @param NumFrames 0이면 보관 중인 모든 프레임
+     */
+    bool ExportChromeTrace(const FString& Path, int32 NumFrames = 0) const;
+
+    /** 앞으로 NumFrames개 프레임이 끝나면 Path에 Chrome Trace로 저장합니다. 필요하면 HistorySize를 늘립니다. */
+    void StartCapture(int32 NumFrames, const FString& Path);
+    bool IsCapturing() const { return CaptureFramesRemaining > 0; }
+
+    /** Queue가 가득 찼거나 Scope가 너무 깊어서 버려진 Event 수 */
+    uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+    /** 파일 이름이 겹치지 않는 기본 저장 경로 */
+    FString MakeDefaultCapturePath() const;
+
+private:
+    FCpuProfiler();
+    ~FCpuProfiler();
+
+    struct FThreadBuffer;
+
+    /** 현재 스레드의 Buffer, 처음 호출될 때 등록합니다. 등록할 수 없으면 nullptr */
+    FThreadBuffer* GetThreadBuffer();
+
+private:
+    static thread_local FThreadBuffer* LocalThreadBuffer;
+    static thread_local bool bLocalThreadRegistrationFailed;
+
+    std::atomic<FThreadBuffer*> ThreadBuffers[MaxThreads] = {};
+    std::atomic<int32> NumThreadBuffers = 0;
+
+    /** FThreadBuffer::Name을 보호합니다. */
+    mutable std::mutex ThreadNameMutex;
+
+    std::atomic<uint64> NumDropped = 0;
+
+    /** 최근 프레임의 Ring, 프레임 번호 % Frames.Num() 위치에 저장됩니다. */
+    TArray<FProfileFrame> Frames;
+
+    /** 다음에 끝날 프레임의 번호, 지금까지 끝난 프레임 수와 같습니다. */
+    uint64 NextFrameNumber = 0;
+
+    /** SetHistorySize 이후 처음 끝난 프레임의 번호, 이전 프레임은 Ring에 없습니다. */
+    uint64 HistoryStartFrameNumber = 0;
+
+    uint64 CurrentFrameStartCycles = 0;
+
+    int32 CaptureFramesRemaining = 0;
+    int32 CaptureNumFrames = 0;
+    FString CapturePath;
+};
@@ -14,10 +14,10 @@ public:
         CPUStatsMS.Empty();
     }
 
-    // Called by FScopeCycleCounter to record CPU time
+    // Called by FCpuProfiler::BeginFrame with the previous frame's scopes, repeated scopes are summed
     static void AddCpuStat(const TStatId& StatId, const double TimeMs)
     {
-        CPUStatsMS.FindOrAdd(StatId.GetName()) = TimeMs;
+        CPUStatsMS.FindOrAdd(StatId.GetName()) += TimeMs;
     }
 
     // Retrieve CPU time for a given StatId
@@ -1,12 +1,13 @@
 #include "Stats.h"
 #include "WindowsPlatformTime.h"
 #include "GpuTimingManager.h"
-#include "ProfilerStatsManager.h"
+#include "CpuProfiler.h"
 
 FScopeCycleCounter::FScopeCycleCounter(TStatId StatId)
     : StartCycles(FPlatformTime::Cycles64())
     , UsedStatId(StatId)
 {
+    FCpuProfiler::Get().BeginScope(UsedStatId, StartCycles);
 }
 
 FScopeCycleCounter::~FScopeCycleCounter()
@@ -19,8 +20,12 @@ uint64 FScopeCycleCounter::Finish()
     const uint64 EndCycles = FPlatformTime::Cycles64();
     const uint64 CycleDiff = EndCycles - StartCycles;
 
-    // FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-    FProfilerStatsManager::AddCpuStat(UsedStatId, FPlatformTime::ToMilliseconds(CycleDiff));
+    // 소멸자에서 다시 호출되어도 Scope는 한 번만 닫습니다.
+    if (!bFinished)
+    {
+        bFinished = true;
+        FCpuProfiler::Get().EndScope(EndCycles);
+    }
 
     return CycleDiff;
 }
@@ -23,8 +23,9 @@ public:
 private:
     uint64 StartCycles;
 
-    [[maybe_unused]]
     TStatId UsedStatId;
+
+    bool bFinished = false;
 };
 
 #define QUICK_SCOPE_CYCLE_COUNTER(Stat) \
@@ -17,11 +17,26 @@ UClass::UClass(
     , ClassSize(InClassSize)
     , ClassAlignment(InAlignment)
     , SuperClass(InSuperClass)
+    , ObjectPool(InClassSize, InAlignment)
 {
     NamePrivate = InClassName;
+
+    // 부모의 StaticClass()가 먼저 생성되므로, 부모의 조상 테이블을 복사하고 자신을 추가합니다.
+    if (SuperClass)
+    {
+        ClassDepth = SuperClass->ClassDepth + 1;
+        for (uint32 Depth = 0; Depth < ClassDepth && Depth < MaxClassBaseChainDepth; ++Depth)
+        {
+            ClassBaseChain[Depth] = SuperClass->ClassBaseChain[Depth];
+        }
+    }
+    if (ClassDepth < MaxClassBaseChainDepth)
+    {
+        ClassBaseChain[ClassDepth] = this;
+    }
 }
 
-bool UClass::IsChildOf(const UClass* SomeBase) const
+bool UClass::IsChildOfBySuperChain(const UClass* SomeBase) const
 {
     assert(this);
     if (!SomeBase) return false;
@@ -67,6 +82,18 @@ void UClass::SerializeBin(FArchive& Ar, void* Data)
     }
 }
 
+void UClass::DestroyObject(UObject* Object)
+{
+    if (!Object)
+    {
+        return;
+    }
+
+    assert(Object->GetClass() == this);
+    Object->~UObject();
+    ObjectPool.Free(Object);
+}
+
 UObject* UClass::CreateDefaultObject()
 {
     if (!ClassDefaultObject)
@@ -2,6 +2,7 @@
 #include <concepts>
 #include "Object.h"
 #include "Property.h"
+#include "UObjectAllocator.h"
 
 
 class FArchive;
@@ -43,9 +44,32 @@ public:
     uint32 GetClassSize() const { return ClassSize; }
     uint32 GetClassAlignment() const { return ClassAlignment; }
 
-    /** SomeBase의 자식 클래스인지 확인합니다. */
+    /** 이 클래스의 인스턴스 하나 크기의 메모리를 클래스 전용 Pool에서 할당합니다. (ClassCTOR 전용) */
+    void* AllocateObjectMemory() { return ObjectPool.Allocate(); }
+
+    /**
+     * ClassCTOR로 생성된 객체를 소멸시키고, 메모리를 이 클래스의 Pool에 반환합니다.
+     * @note Object는 반드시 이 클래스의 ClassCTOR로 생성된 객체여야 합니다.
+     */
+    void DestroyObject(UObject* Object);
+
+    const FUObjectPool& GetObjectPool() const { return ObjectPool; }
+
+    /** ClassBaseChain에 저장하는 최대 상속 깊이, 이보다 깊은 부모 클래스는 SuperClass를 따라가며 확인합니다. */
+    static constexpr uint32 MaxClassBaseChainDepth = 16;
+
+    /**
+     * SomeBase의 자식 클래스인지 확인합니다.
+     * 생성 시점에 만들어둔 조상 테이블(ClassBaseChain)을 사용하므로, 상속 깊이와 관계없이 비교 두 번으로 끝납니다.
+     */
     bool IsChildOf(const UClass* SomeBase) const;
 
+    /** SuperClass를 하나씩 따라가며 IsChildOf를 확인합니다. 검증 및 벤치마크용입니다. */
+    bool IsChildOfBySuperChain(const UClass* SomeBase) const;
+
+    /** UObject를 0으로 하는 상속 깊이 */
+    uint32 GetClassDepth() const { return ClassDepth; }
+
     template <typename T>
         requires std::derived_from<T, UObject>
     bool IsChildOf() const;
@@ -88,9 +112,34 @@ private:
     UClass* SuperClass = nullptr;
     UObject* ClassDefaultObject = nullptr;
 
+    /** UObject를 0으로 하는 상속 깊이 */
+    uint32 ClassDepth = 0;
+
+    /** ClassBaseChain[Depth]는 해당 깊이의 조상 클래스이며, ClassBaseChain[ClassDepth]는 자기 자신입니다. */
+    const UClass* ClassBaseChain[MaxClassBaseChainDepth] = {};
+
+    /** 이 클래스 인스턴스 전용 메모리 Pool */
+    FUObjectPool ObjectPool;
+
     TArray<FProperty> Properties;
 };
 
+FORCEINLINE bool UClass::IsChildOf(const UClass* SomeBase) const
+{
+    if (!SomeBase)
+    {
+        return false;
+    }
+
+    // SomeBase가 조상이라면, 이 클래스의 같은 깊이에 SomeBase가 있어야 합니다.
+    const uint32 BaseDepth = SomeBase->ClassDepth;
+    if (BaseDepth < MaxClassBaseChainDepth)
+    {
+        return BaseDepth <= ClassDepth && ClassBaseChain[BaseDepth] == SomeBase;
+    }
+    return IsChildOfBySuperChain(SomeBase);
+}
+
 template <typename T>
     requires std::derived_from<T, UObject>
 bool UClass::IsChildOf() const
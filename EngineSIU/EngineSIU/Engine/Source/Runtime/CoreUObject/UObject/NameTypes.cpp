@@ -3,9 +3,11 @@
 #include <assert.h>
 #include <atomic>
 #include <cwchar>
+#include <cwctype>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Core/HAL/PlatformMemory.h"
 
 
 enum ENameCase : uint8
@@ -33,16 +35,27 @@ struct FNameStringView
 	bool bIsWide;
 
 	bool IsAnsi() const { return !bIsWide; }
+
+	uint32 CharAt(uint32 Index) const
+	{
+		return bIsWide ? static_cast<uint32>(Wide[Index]) : static_cast<uint32>(static_cast<uint8>(Ansi[Index]));
+	}
 };
 
 
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/**
+ * FNameEntry의 위치, 상위 16비트는 Block 번호, 하위 16비트는 Block 안에서의 Offset(Stride 단위)입니다.
+ * 0은 항상 "None" Entry를 가리킵니다.
+ */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
+	uint32 Value = 0;
 
 	bool IsNone() const { return !Value; }
 
+	uint32 GetBlock() const { return Value >> 16; }
+	uint32 GetOffset() const { return Value & 0xFFFF; }
+
 	bool operator==(const FNameEntryId& Other) const
 	{
 		return Value == Other.Value;
@@ -62,14 +75,16 @@ struct FNameEntryId
 /** Entry에 담기는 Name의 정보 */
 struct FNameEntryHeader
 {
-	uint16 IsWide : 1; // wchar인지 여부
-	uint16 Len : 15;   // FName의 길이 0 ~ 32767
+	uint16 bIsWide : 1; // wchar인지 여부
+	uint16 Len : 15;    // FName의 길이 0 ~ 32767
 };
 
-
+/**
+ * Pool에 저장되는 문자열, 실제로는 Header와 Len + 1 글자만큼만 할당되는 가변 길이 구조체입니다.
+ * 한 번 저장된 Entry는 수정되거나 이동하지 않습니다.
+ */
 struct FNameEntry
 {
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
 	FNameEntryHeader Header;   // Name의 정보
 
 	union
@@ -78,6 +93,17 @@ struct FNameEntry
 		WIDECHAR WideName[NAME_SIZE];
 	};
 
+	uint32 CharAt(uint32 Index) const
+	{
+		return Header.bIsWide ? static_cast<uint32>(WideName[Index]) : static_cast<uint32>(static_cast<uint8>(AnsiName[Index]));
+	}
+
+	/** Len 글자를 저장하는데 필요한 Entry의 크기 (null 문자 포함) */
+	static uint32 GetSize(uint32 Len, bool bIsWide)
+	{
+		return static_cast<uint32>(offsetof(FNameEntry, AnsiName)) + (Len + 1) * (bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR));
+	}
+
 	void StoreName(const ANSICHAR* InName, uint32 Len)
 	{
 		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
@@ -93,55 +119,109 @@ struct FNameEntry
 
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+uint32 ToLowerChar(uint32 Char)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
+	if (Char < 128)
 	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
+		return (Char >= 'A' && Char <= 'Z') ? Char + ('a' - 'A') : Char;
 	}
-	return Hash;
+	return static_cast<uint32>(towlower(static_cast<wint_t>(Char)));
 }
 
-template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+template <ENameCase Sensitivity>
+uint32 HashName(FNameStringView InName)
 {
-	CharType LowerStr[NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	// FNV-1a, ANSICHAR와 WIDECHAR로 만든 같은 문자열은 같은 Hash가 나오도록 글자 단위로 계산합니다.
+	uint32 Hash = 2166136261u;
+	for (uint32 Index = 0; Index < InName.Len; ++Index)
 	{
-		for (uint32 i = 0; i < InLen; i++)
+		uint32 Char = InName.CharAt(Index);
+		if constexpr (Sensitivity == IgnoreCase)
 		{
-			LowerStr[i] = towlower(Str[i]);
+			Char = ToLowerChar(Char);
 		}
-		LowerStr[InLen] = '\0';
+		Hash = (Hash ^ Char) * 16777619u;
 	}
-	else
+
+	// 0은 비어있는 Slot을 의미하므로 사용하지 않습니다.
+	return Hash ? Hash : 1;
+}
+
+template <ENameCase Sensitivity>
+bool EqualsName(const FNameEntry& Entry, FNameStringView InName)
+{
+	if (Entry.Header.Len != InName.Len)
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		return false;
+	}
+
+	for (uint32 Index = 0; Index < InName.Len; ++Index)
+	{
+		const uint32 A = Entry.CharAt(Index);
+		const uint32 B = InName.CharAt(Index);
+		if constexpr (Sensitivity == IgnoreCase)
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			if (A != B && ToLowerChar(A) != ToLowerChar(B))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if (A != B)
+			{
+				return false;
+			}
 		}
-		LowerStr[InLen] = '\0';
 	}
-	return HashString(LowerStr);
+	return true;
 }
 
-template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
-
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
+/**
+ * 문자열 끝의 "_숫자"를 분리합니다.
+ * Unreal과 동일하게 0으로 시작하는 숫자("_01")나 int32 범위를 넘는 숫자는 분리하지 않습니다.
+ *
+ * @return 숫자 Suffix + 1, Suffix가 없다면 0
+ */
+uint32 ParseNumberSuffix(FNameStringView InName, uint32& OutLen)
 {
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
-}
+	OutLen = InName.Len;
 
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
-{
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
+	uint32 NumDigits = 0;
+	while (NumDigits < InName.Len)
+	{
+		const uint32 Char = InName.CharAt(InName.Len - 1 - NumDigits);
+		if (Char < '0' || Char > '9')
+		{
+			break;
+		}
+		++NumDigits;
+	}
+
+	const uint32 UnderscoreIndex = InName.Len - NumDigits - 1;
+	if (NumDigits == 0 || NumDigits > 10 || NumDigits >= InName.Len - 1 || InName.CharAt(UnderscoreIndex) != '_')
+	{
+		return 0;
+	}
+
+	const uint32 FirstDigitIndex = UnderscoreIndex + 1;
+	if (NumDigits > 1 && InName.CharAt(FirstDigitIndex) == '0')
+	{
+		return 0;
+	}
+
+	uint64 Number = 0;
+	for (uint32 Index = FirstDigitIndex; Index < InName.Len; ++Index)
+	{
+		Number = Number * 10 + (InName.CharAt(Index) - '0');
+	}
+	if (Number >= 0x7FFFFFFF)
+	{
+		return 0;
+	}
+
+	OutLen = UnderscoreIndex;
+	return static_cast<uint32>(Number) + 1;
 }
 }
 
@@ -155,143 +235,272 @@ struct FNameValue
 
 	FNameStringView Name;
 	uint32 Hash;
-	FNameEntryId ComparisonId = {};
 };
 
 using FNameComparisonValue = FNameValue<IgnoreCase>;
 using FNameDisplayValue = FNameValue<CaseSensitive>;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
+
+/**
+ * FNameEntry를 저장하는 Block 단위의 문자열 Arena입니다.
+ * Block은 해제되거나 이동하지 않으므로, Handle로 Entry를 찾는 Resolve는 Lock 없이 수행됩니다.
+ */
+class FNameEntryAllocator
 {
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
+public:
+	static constexpr uint32 Stride = alignof(FNameEntry);
+	static constexpr uint32 BlockSizeBytes = Stride << 16;
+	static constexpr uint32 MaxBlocks = 1 << 13;
 
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
+	FNameEntryAllocator()
 	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+		AllocateBlock();
+	}
 
-	// 슬롯 구조체
-	struct FSlot
+	~FNameEntryAllocator()
 	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
-
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
+		for (uint32 Index = 0; Index < NumBlocks; ++Index)
 		{
+			FPlatformMemory::Free<EAT_Container>(Blocks[Index], BlockSizeBytes);
 		}
+	}
+
+	FNameEntryAllocator(const FNameEntryAllocator&) = delete;
+	FNameEntryAllocator& operator=(const FNameEntryAllocator&) = delete;
+
+	/** 새로운 Entry를 만들고 문자열을 저장합니다. */
+	FNameEntryId Create(FNameStringView InName)
+	{
+		const uint32 Size = FNameEntry::GetSize(InName.Len, InName.bIsWide);
+		const uint32 AlignedSize = (Size + Stride - 1) & ~(Stride - 1);
 
-		bool Used() const
+		FNameEntryId Id;
 		{
-			return State == ESlotState::Occupied;
+			std::lock_guard Lock(Mutex);
+			if (CurrentByteCursor + AlignedSize > BlockSizeBytes)
+			{
+				AllocateBlock();
+			}
+
+			Id.Value = (CurrentBlock << 16) | (CurrentByteCursor / Stride);
+			CurrentByteCursor += AlignedSize;
+			NumEntries.fetch_add(1, std::memory_order_relaxed);
+			NumBytesUsed.fetch_add(AlignedSize, std::memory_order_relaxed);
 		}
 
-		void SetValue(const FNameEntry& InValue)
+		// 이 Entry는 아직 다른 스레드에 공개되지 않았으므로 Lock 없이 씁니다.
+		FNameEntry& Entry = Resolve(Id);
+		Entry.Header.bIsWide = InName.bIsWide;
+		Entry.Header.Len = static_cast<uint16>(InName.Len);
+		if (InName.bIsWide)
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			Entry.StoreName(InName.Wide, InName.Len);
 		}
-	};
+		else
+		{
+			Entry.StoreName(InName.Ansi, InName.Len);
+		}
+		return Id;
+	}
 
-private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
+	FNameEntry& Resolve(FNameEntryId Id) const
+	{
+		return *reinterpret_cast<FNameEntry*>(Blocks[Id.GetBlock()] + Stride * Id.GetOffset());
+	}
 
-	mutable std::mutex Mutex;
+	uint32 GetNumEntries() const { return NumEntries.load(std::memory_order_relaxed); }
+	uint32 GetNumBytesUsed() const { return NumBytesUsed.load(std::memory_order_relaxed); }
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+private:
+	void AllocateBlock()
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
+		SCOPED_MEMORY_TAG(Names);
 
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
-		{
-			if (Slot.State == ESlotState::Occupied)
-			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
-			}
-		}
+		assert(NumBlocks < MaxBlocks && "FNameEntryAllocator: Name Block이 가득 찼습니다.");
+		CurrentBlock = NumBlocks++;
+		CurrentByteCursor = 0;
+		Blocks[CurrentBlock] = static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSizeBytes));
 	}
 
+private:
+	// .natvis에서 Handle로 문자열을 찾을 때 사용합니다.
+	uint8* Blocks[MaxBlocks] = {};
+
+	uint32 NumBlocks = 0;
+	uint32 CurrentBlock = 0;
+	uint32 CurrentByteCursor = 0;
+
+	std::atomic<uint32> NumEntries = 0;
+	std::atomic<uint32> NumBytesUsed = 0;
+
+	std::mutex Mutex;
+};
+
+
+/**
+ * 같은 문자열을 가진 Entry를 찾기 위한 Open Addressing Hash Table의 일부입니다.
+ * Slot에는 (Hash, Entry Handle)을 함께 저장하고, Hash가 같으면 실제 문자열을 비교하므로 Hash 충돌이 있어도 안전합니다.
+ *
+ * - 검색은 Lock 없이 수행하고, 찾지 못한 경우에만 Lock을 잡고 다시 검색한 뒤 삽입합니다.
+ * - Table이 커질 때 이전 Table은 해제하지 않고 보관하므로, 동시에 검색중인 스레드도 안전합니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	struct FSlotTable
+	{
+		uint32 Capacity;
+		std::atomic<uint64>* Slots;
+	};
+
+	static constexpr uint32 InitialCapacity = 256;
+
+	static uint64 MakeSlot(uint32 Hash, FNameEntryId Id) { return static_cast<uint64>(Hash) << 32 | Id.Value; }
+	static uint32 GetSlotHash(uint64 Slot) { return static_cast<uint32>(Slot >> 32); }
+	static FNameEntryId GetSlotId(uint64 Slot) { return {static_cast<uint32>(Slot)}; }
+
 public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	FNamePoolShard()
 	{
+		Table.store(CreateTable(InitialCapacity), std::memory_order_release);
 	}
 
-	FSlot& Probe(uint32 InHash) const
+	~FNamePoolShard()
 	{
-		return Slots[InHash & Slots.size()-1];
+		DestroyTable(Table.load(std::memory_order_relaxed));
+		for (FSlotTable* RetiredTable : RetiredTables)
+		{
+			DestroyTable(RetiredTable);
+		}
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	FNamePoolShard(const FNamePoolShard&) = delete;
+	FNamePoolShard& operator=(const FNamePoolShard&) = delete;
+
+	/** Lock 없이 같은 문자열을 가진 Entry를 찾습니다. */
+	FNameEntryId Find(const FNameValue<Sensitivity>& Value, const FNameEntryAllocator& Entries) const
 	{
-		FNameEntryId Result;
+		return Probe(Table.load(std::memory_order_acquire), Value, Entries, nullptr);
+	}
+
+	/** 같은 문자열을 가진 Entry를 찾고, 없다면 새로 저장합니다. */
+	FNameEntryId FindOrStore(const FNameValue<Sensitivity>& Value, FNameEntryAllocator& Entries)
+	{
+		if (const FNameEntryId Existing = Find(Value, Entries))
 		{
-			std::lock_guard _(Mutex);
+			return Existing;
+		}
+
+		std::lock_guard Lock(Mutex);
 
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
+		// Lock을 잡기 전에 다른 스레드가 삽입했을 수 있으므로 다시 확인합니다.
+		FSlotTable* CurrentTable = Table.load(std::memory_order_relaxed);
+		uint32 EmptyIndex = 0;
+		if (const FNameEntryId Existing = Probe(CurrentTable, Value, Entries, &EmptyIndex))
+		{
+			return Existing;
 		}
-		return Result;
-	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
-	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		if ((NumUsed + 1) * 4 > CurrentTable->Capacity * 3)
 		{
-			Rehash(Slots.size() * 2);
+			CurrentTable = Grow(CurrentTable);
+			Probe(CurrentTable, Value, Entries, &EmptyIndex);
 		}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+		const FNameEntryId NewId = Entries.Create(Value.Name);
+		CurrentTable->Slots[EmptyIndex].store(MakeSlot(Value.Hash, NewId), std::memory_order_release);
+		++NumUsed;
+		return NewId;
+	}
 
-		if (Slot.Used())
+private:
+	static FSlotTable* CreateTable(uint32 Capacity)
+	{
+		SCOPED_MEMORY_TAG(Names);
+
+		FSlotTable* NewTable = static_cast<FSlotTable*>(FPlatformMemory::Malloc<EAT_Container>(sizeof(FSlotTable)));
+		NewTable->Capacity = Capacity;
+		NewTable->Slots = static_cast<std::atomic<uint64>*>(FPlatformMemory::Malloc<EAT_Container>(sizeof(std::atomic<uint64>) * Capacity));
+		for (uint32 Index = 0; Index < Capacity; ++Index)
 		{
-			return Slot.Value.ComparisonId;
+			new (&NewTable->Slots[Index]) std::atomic<uint64>(0);
 		}
+		return NewTable;
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
+	static void DestroyTable(FSlotTable* InTable)
+	{
+		FPlatformMemory::Free<EAT_Container>(InTable->Slots, sizeof(std::atomic<uint64>) * InTable->Capacity);
+		FPlatformMemory::Free<EAT_Container>(InTable, sizeof(FSlotTable));
+	}
+
+	/**
+	 * @param OutEmptyIndex nullptr가 아니라면, 찾지 못했을 때 삽입할 Slot의 Index를 반환합니다.
+	 */
+	static FNameEntryId Probe(const FSlotTable* InTable, const FNameValue<Sensitivity>& Value, const FNameEntryAllocator& Entries, uint32* OutEmptyIndex)
+	{
+		const uint32 Mask = InTable->Capacity - 1;
+		for (uint32 Index = Value.Hash & Mask; ; Index = (Index + 1) & Mask)
 		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
+			const uint64 Slot = InTable->Slots[Index].load(std::memory_order_acquire);
+			if (Slot == 0)
+			{
+				if (OutEmptyIndex)
+				{
+					*OutEmptyIndex = Index;
+				}
+				return {};
+			}
+
+			if (GetSlotHash(Slot) == Value.Hash && EqualsName<Sensitivity>(Entries.Resolve(GetSlotId(Slot)), Value.Name))
+			{
+				return GetSlotId(Slot);
+			}
 		}
-		else
+	}
+
+	FSlotTable* Grow(FSlotTable* OldTable)
+	{
+		FSlotTable* NewTable = CreateTable(OldTable->Capacity * 2);
+		const uint32 Mask = NewTable->Capacity - 1;
+		for (uint32 OldIndex = 0; OldIndex < OldTable->Capacity; ++OldIndex)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			const uint64 Slot = OldTable->Slots[OldIndex].load(std::memory_order_relaxed);
+			if (Slot == 0)
+			{
+				continue;
+			}
+
+			uint32 Index = GetSlotHash(Slot) & Mask;
+			while (NewTable->Slots[Index].load(std::memory_order_relaxed) != 0)
+			{
+				Index = (Index + 1) & Mask;
+			}
+			NewTable->Slots[Index].store(Slot, std::memory_order_relaxed);
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
+
+		// 이전 Table은 Lock 없이 검색중인 스레드가 있을 수 있으므로 해제하지 않습니다.
+		RetiredTables.Add(OldTable);
+		Table.store(NewTable, std::memory_order_release);
+		return NewTable;
 	}
+
+private:
+	std::atomic<FSlotTable*> Table = nullptr;
+	uint32 NumUsed = 0;
+
+	TArray<FSlotTable*> RetiredTables;
+
+	std::mutex Mutex;
 };
-#endif
-#pragma endregion Deprecated Pool Shard
+
 
 struct FNamePool
 {
+	/** Hash의 상위 비트로 Shard를 선택합니다. */
+	static constexpr uint32 NumShardBits = 4;
+	static constexpr uint32 NumShards = 1 << NumShardBits;
+
 public:
     static FNamePool& Get()
     {
@@ -299,65 +508,60 @@ public:
         return Instance;
     }
 
+	FNamePool()
+	{
+		// Handle 0은 항상 "None"
+		[[maybe_unused]] const FNameEntryId NoneId = Entries.Create({"None", 4});
+		assert(NoneId.IsNone());
+	}
+
 private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
+	FNameEntryAllocator Entries;
 
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	/** 대소문자를 무시한 문자열, FName의 비교에 사용합니다. */
+	FNamePoolShard<IgnoreCase> ComparisonShards[NumShards];
+
+	/** Comparison Entry와 대소문자가 다른 원본 문자열만 따로 저장합니다. */
+	FNamePoolShard<CaseSensitive> DisplayShards[NumShards];
 
-private:
 	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
-	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
+	static uint32 GetShardIndex(const FNameValue<Sensitivity>& Value)
+	{
+		return Value.Hash >> (32 - NumShardBits);
 	}
 
 public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	/** Handle로 저장된 문자열을 가져옵니다. Lock 없이 수행됩니다. */
+	const FNameEntry& Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
 	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
-	 *
-	 * @return DisplayName의 Hash
+	 * 문자열을 찾거나, 없으면 저장합니다.
+	 * 숫자 Suffix는 미리 분리되어 있어야 합니다.
 	 */
-	FNameEntryId FindOrStoreString(const FNameStringView& Name)
+	void FindOrStoreString(const FNameStringView& Name, FNameEntryId& OutComparisonId, FNameEntryId& OutDisplayId)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const FNameComparisonValue ComparisonValue{Name};
+		if (EqualsName<IgnoreCase>(Resolve({}), Name))
 		{
-			return {DisplayValue.Hash};
+			OutComparisonId = {};
+		}
+		else
+		{
+			OutComparisonId = ComparisonShards[GetShardIndex(ComparisonValue)].FindOrStore(ComparisonValue, Entries);
 		}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+		// 대부분의 이름은 처음 저장된 대소문자 그대로 사용되므로, Comparison Entry를 그대로 Display로 사용합니다.
+		if (EqualsName<CaseSensitive>(Resolve(OutComparisonId), Name))
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
+			OutDisplayId = OutComparisonId;
+			return;
 		}
 
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+		const FNameDisplayValue DisplayValue{Name};
+		OutDisplayId = DisplayShards[GetShardIndex(DisplayValue)].FindOrStore(DisplayValue, Entries);
 	}
 };
 
@@ -387,26 +591,43 @@ struct FNameHelper
 		// 문자열의 길이가 NAME_SIZE를 초과하면 None 반환
 		if (Len >= NAME_SIZE)
 		{
-		    assert(Len >= NAME_SIZE);
+		    assert(Len < NAME_SIZE);
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		FNameStringView Name{Char, Len};
+
+		// ASCII로만 이루어진 WIDECHAR 문자열은 ANSICHAR로 저장해서 메모리를 절약합니다.
+		ANSICHAR AnsiBuffer[NAME_SIZE];
+		if constexpr (std::is_same_v<CharType, wchar_t>)
+		{
+			bool bIsPureAnsi = true;
+			for (uint32 Index = 0; Index < Len; ++Index)
+			{
+				if (static_cast<uint32>(Char[Index]) >= 128)
+				{
+					bIsPureAnsi = false;
+					break;
+				}
+				AnsiBuffer[Index] = static_cast<ANSICHAR>(Char[Index]);
+			}
+			if (bIsPureAnsi)
+			{
+				Name = FNameStringView{AnsiBuffer, Len};
+			}
+		}
 
 		FName Result;
+		Result.Number = ParseNumberSuffix(Name, Name.Len);
+
+		FNameEntryId ComparisonId;
+		FNameEntryId DisplayId;
+		FNamePool::Get().FindOrStoreString(Name, ComparisonId, DisplayId);
+
 		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
+		Result.ComparisonIndex = ComparisonId.Value;
 		return Result;
 	}
-
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
-	{
-		if (DisplayId.IsNone())
-		{
-			return {};
-		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
-	}
 };
 
 #if defined(_DEBUG)
@@ -431,39 +652,37 @@ FName::FName(const FString& Name)
 
 FString FName::ToString() const
 {
-	if (DisplayIndex == 0 && ComparisonIndex == 0)
+	if (DisplayIndex == 0 && ComparisonIndex == 0 && Number == 0)
 	{
 		return {TEXT("None")};
 	}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-    if (Entry.Header.IsWide)
-    {
-        return {Entry.WideName};
-    }
-    else
-    {
-        return {Entry.AnsiName};
-    }
+	const FNameEntry& Entry = FNamePool::Get().Resolve({DisplayIndex});
+	FString Result = Entry.Header.bIsWide ? FString(Entry.WideName) : FString(Entry.AnsiName);
+	if (Number != 0)
+	{
+		Result += TEXT("_");
+		Result += FString::FromInt(Number - 1);
+	}
+	return Result;
 }
 
 bool FName::operator==(const FName& Other) const
 {
-	return ComparisonIndex == Other.ComparisonIndex;
+	return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number;
 }
 
 bool FName::operator==(ENameNone) const
 {
-    return ComparisonIndex == NAME_None;
+    return ComparisonIndex == NAME_None && Number == 0;
 }
 
 bool FName::operator!=(ENameNone) const
 {
-    return ComparisonIndex != NAME_None;
+    return !(*this == NAME_None);
 }
 
 bool FName::operator!=(const FName& Other) const
 {
-    return ComparisonIndex != Other.ComparisonIndex;
+    return !(*this == Other);
 }
@@ -8,16 +8,23 @@ enum ENameNone : uint8 { NAME_None = 0 };
 /** Maximum size of name, including the null terminator. */
 enum : uint16 { NAME_SIZE = 256 };
 
+/**
+ * FNamePool에 한 번만 저장되는 문자열을 가리키는 가벼운 이름입니다.
+ * "Actor_12"처럼 끝에 붙은 숫자는 Number로 분리되므로, 같은 Base 문자열을 가진 이름들은 Pool의 Entry를 공유합니다.
+ *
+ * 생성과 ToString은 어느 스레드에서든 호출할 수 있습니다.
+ */
 class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본(대소문자 유지) 문자열 Entry의 Handle
+    uint32 ComparisonIndex; // 비교시 사용되는 (대소문자 무시) 문자열 Entry의 Handle
+    uint32 Number;          // 숫자 Suffix + 1, 0이면 Suffix 없음
 
 public:
-    FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
-    FName(ENameNone) : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
+    FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None), Number(0) {}
+    FName(ENameNone) : DisplayIndex(NAME_None), ComparisonIndex(NAME_None), Number(0) {}
     FName(const WIDECHAR* Name);
     FName(const ANSICHAR* Name);
     FName(const FString& Name);
@@ -25,6 +32,7 @@ public:
     FString ToString() const;
     uint32 GetDisplayIndex() const { return DisplayIndex; }
     uint32 GetComparisonIndex() const { return ComparisonIndex; }
+    uint32 GetNumber() const { return Number; }
 
     bool operator==(const FName& Other) const;
     bool operator==(ENameNone) const;
@@ -37,7 +45,6 @@ struct std::hash<FName>
 {
     size_t operator()(const FName& Key) const noexcept
     {
-        // TODO: 나중에 FName에 Number 추가하면 살짝 수정
-        return hash<uint32>()(Key.GetComparisonIndex());
+        return hash<uint64>()(static_cast<uint64>(Key.GetComparisonIndex()) << 32 | Key.GetNumber());
     }
 };
@@ -1,9 +1,12 @@
 #include "Object.h"
+#include "CoreMiscDefines.h"
 
 #include "ObjectFactory.h"
 #include "Class.h"
 #include "Engine/Engine.h"
 
+DEFINE_LOG_CATEGORY(LogObject)
+
 
 UClass* UObject::StaticClass()
 {
@@ -14,7 +17,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = UObject::StaticClass()->AllocateObjectMemory();
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -24,8 +27,8 @@ UClass* UObject::StaticClass()
 
 UObject::UObject()
     : UUID(0)
-    // TODO: Object를 생성할 때 직접 설정하기
-    , InternalIndex(-1)
+    , InternalIndex(INDEX_NONE)
+    , InternalSerialNumber(0)
     , NamePrivate("None")
 {
 }
@@ -1,10 +1,14 @@
 #pragma once
 #include "EngineLoop.h"
 #include "NameTypes.h"
+#include "Logging/LogCategory.h"
 #include "Misc/CoreMiscDefines.h"
 
 extern FEngineLoop GEngineLoop;
 
+/** UObject 생성/삭제 로그, Spawn이 많을 때 로그가 넘치지 않도록 기본적으로 출력하지 않습니다. */
+DECLARE_LOG_CATEGORY_EXTERN(LogObject, Display)
+
 class UClass;
 class UWorld;
 class AActor;
@@ -28,9 +32,11 @@ private:
     friend class FObjectFactory;
     friend class FSceneMgr;
     friend class UClass;
+    friend class FUObjectArray;
 
     uint32 UUID;
-    uint32 InternalIndex; // Index of GUObjectArray
+    int32 InternalIndex; // Index of GUObjectArray
+    int32 InternalSerialNumber; // 등록될 때 GUObjectArray Slot의 SerialNumber
 
     FName NamePrivate;
     UClass* ClassPrivate = nullptr;
@@ -55,7 +61,7 @@ public:
 
 
     uint32 GetUUID() const { return UUID; }
-    uint32 GetInternalIndex() const { return InternalIndex; }
+    int32 GetInternalIndex() const { return InternalIndex; }
 
     UClass* GetClass() const { return ClassPrivate; }
 
@@ -73,11 +79,12 @@ public:
 public:
     void* operator new(size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Created : %d", size);
+        UE_LOG_CAT(LogObject, ELogLevel::Verbose, "UObject Created : %d", size);
 
         void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
-            ELogLevel::Display,
+        UE_LOG_CAT(
+            LogObject,
+            ELogLevel::Verbose,
             "TotalAllocationBytes : %d, TotalAllocationCount : %d",
             FPlatformMemory::GetAllocationBytes<EAT_Object>(),
             FPlatformMemory::GetAllocationCount<EAT_Object>()
@@ -87,7 +94,7 @@ public:
 
     void operator delete(void* ptr, size_t size)
     {
-        UE_LOG(ELogLevel::Display, "UObject Deleted : %d", size);
+        UE_LOG_CAT(LogObject, ELogLevel::Verbose, "UObject Deleted : %d", size);
         FPlatformMemory::Free<EAT_Object>(ptr, size);
     }
 
@@ -26,7 +26,7 @@ public:
 
         GUObjectArray.AddObject(Obj);
 
-        UE_LOG(ELogLevel::Display, "Created New Object : %s", *Name);
+        UE_LOG_CAT(LogObject, ELogLevel::Verbose, "Created New Object : %s", *Name);
         return Obj;
     }
 
@@ -4,8 +4,10 @@ class UObject;
 
 /**
  * 주어진 UObject 포인터가 유효한지 확인합니다.
+ * Object의 InternalIndex로 GUObjectArray의 Slot을 찾아 객체와 SerialNumber를 비교하므로, Hash와 Lock 없이 O(1)입니다.
  *
  * @param Test 유효성을 검사할 UObject 포인터입니다.
  * @return 포인터가 유효하면 true를 반환하고, 그렇지 않으면 false를 반환합니다.
+ * @note 이미 삭제된 객체를 가리킬 수 있는 포인터는 TWeakObjectPtr로 보관해야 합니다.
  */
 bool IsValid(const UObject* Test);
@@ -0,0 +1,123 @@
+#include "UObjectAllocator.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "HAL/PlatformMemory.h"
+
+
+namespace
+{
+constexpr uint32 AlignUp(uint32 Value, uint32 Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+}
+
+
+FUObjectPool::FUObjectPool(uint32 InObjectSize, uint32 InObjectAlignment)
+{
+    // Free List의 포인터를 블록 안에 저장하므로, 최소 포인터 크기/정렬이 필요합니다.
+    BlockAlignment = std::max<uint32>(InObjectAlignment, alignof(FFreeBlock));
+    ObjectSize = InObjectSize;
+#if ENABLE_MEMORY_TAGS
+    TagHeaderSize = AlignUp(sizeof(FMemoryTagHeader), BlockAlignment);
+#endif
+    BlockSize = AlignUp(std::max<uint32>(TagHeaderSize + InObjectSize, sizeof(FFreeBlock)), BlockAlignment);
+    SlabHeaderSize = AlignUp(sizeof(FSlabHeader), BlockAlignment);
+}
+
+FUObjectPool::~FUObjectPool()
+{
+    // 종료 시점에 아직 살아있는 객체가 있다면, 다른 정적 객체의 소멸자에서 접근할 수 있으므로 Slab을 해제하지 않습니다.
+    if (NumUsed > 0)
+    {
+        return;
+    }
+
+    while (Slabs)
+    {
+        FSlabHeader* Next = Slabs->Next;
+        FPlatformMemory::PoolFree(Slabs, Slabs->AllocSize);
+        Slabs = Next;
+    }
+}
+
+void* FUObjectPool::Allocate()
+{
+    std::lock_guard Lock(Mutex);
+
+    if (!FreeList)
+    {
+        AllocateSlab();
+    }
+
+    FFreeBlock* Block = FreeList;
+    FreeList = Block->Next;
+    ++NumUsed;
+
+    FPlatformMemory::TrackAlloc<EAT_Object>(ObjectSize);
+#if ENABLE_MEMORY_TAGS
+    const EMemoryTag CurrentTag = FMemoryTracker::GetCurrentTag();
+    const EMemoryTag Tag = CurrentTag == EMemoryTag::Untagged ? EMemoryTag::UObject : CurrentTag;
+    return FMemoryTracker::TagAllocation(Block, TagHeaderSize, ObjectSize, Tag);
+#else
+    return Block;
+#endif
+}
+
+void FUObjectPool::Free(void* Ptr)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    std::lock_guard Lock(Mutex);
+    assert(NumUsed > 0);
+
+    FPlatformMemory::TrackFree<EAT_Object>(ObjectSize);
+#if ENABLE_MEMORY_TAGS
+    Ptr = FMemoryTracker::UntagAllocation(Ptr, ObjectSize);
+#endif
+
+#ifdef _DEBUG
+    // 해제된 객체를 참조하는 버그를 찾기 쉽도록 덮어씁니다.
+    std::memset(Ptr, 0xDD, BlockSize);
+#endif
+
+    FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+    Block->Next = FreeList;
+    FreeList = Block;
+    --NumUsed;
+}
+
+void FUObjectPool::AllocateSlab()
+{
+    const uint32 NumBlocks = NextBlocksPerSlab;
+    const size_t AllocSize = SlabHeaderSize + static_cast<size_t>(BlockSize) * NumBlocks;
+
+    uint8* Memory = static_cast<uint8*>(FPlatformMemory::PoolMalloc(AllocSize, BlockAlignment));
+    assert(Memory && "FUObjectPool: Slab 할당에 실패했습니다.");
+
+    FSlabHeader* Slab = reinterpret_cast<FSlabHeader*>(Memory);
+    Slab->Next = Slabs;
+    Slab->AllocSize = AllocSize;
+    Slabs = Slab;
+
+    // 주소 순서대로 꺼내지도록 역순으로 Free List에 연결합니다.
+    uint8* FirstBlock = Memory + SlabHeaderSize;
+    for (uint32 Index = NumBlocks; Index > 0; --Index)
+    {
+        FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(FirstBlock + static_cast<size_t>(BlockSize) * (Index - 1));
+        Block->Next = FreeList;
+        FreeList = Block;
+    }
+
+    NumReserved += NumBlocks;
+    ReservedBytes += AllocSize;
+
+    // 다음 Slab은 MaxSlabSize를 넘지 않는 선에서 두 배로 늘립니다.
+    const uint32 MaxBlocksPerSlab = std::max<uint32>(1, static_cast<uint32>(MaxSlabSize / BlockSize));
+    NextBlocksPerSlab = std::min(NextBlocksPerSlab * 2, std::max(MaxBlocksPerSlab, NumBlocks));
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <mutex>
+
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 하나의 UClass 인스턴스들을 위한 고정 크기 블록 Pool입니다.
+ * Slab 단위로 메모리를 확보한 뒤 블록으로 나눠주며, 해제된 블록은 Free List로 재사용하므로 할당/해제가 O(1)입니다.
+ * 같은 클래스의 객체가 같은 Slab에 모이므로, 클래스별 순회 시 캐시 효율도 좋아집니다.
+ *
+ * - Slab은 작은 크기에서 시작해 두 배씩 커지므로, 인스턴스가 하나뿐인 클래스(CDO 등)는 메모리를 거의 낭비하지 않습니다.
+ * - Slab은 Pool이 소멸될 때까지 반환하지 않습니다. (최대 사용량만큼 유지)
+ * - ENABLE_MEMORY_TAGS가 켜져 있으면 블록 앞에 Memory Tag 헤더를 두고, 할당 시점의 Tag(기본값 UObject)로 집계합니다.
+ */
+class FUObjectPool
+{
+public:
+    /** Slab 하나의 최대 크기 */
+    static constexpr size_t MaxSlabSize = 64 * 1024;
+
+    /** 첫 Slab의 블록 개수 */
+    static constexpr uint32 InitialBlocksPerSlab = 4;
+
+    FUObjectPool(uint32 InObjectSize, uint32 InObjectAlignment);
+    ~FUObjectPool();
+
+    FUObjectPool(const FUObjectPool&) = delete;
+    FUObjectPool& operator=(const FUObjectPool&) = delete;
+    FUObjectPool(FUObjectPool&&) = delete;
+    FUObjectPool& operator=(FUObjectPool&&) = delete;
+
+public:
+    /** 객체 하나 크기의 초기화되지 않은 메모리를 반환합니다. */
+    void* Allocate();
+
+    /** Allocate로 얻은 메모리를 Pool에 반환합니다. 소멸자는 미리 호출되어 있어야 합니다. */
+    void Free(void* Ptr);
+
+    /** Pool이 나눠주는 블록 하나의 크기 (정렬, Tag 헤더 포함) */
+    uint32 GetBlockSize() const { return BlockSize; }
+
+    /** 현재 사용중인 블록 개수 */
+    uint32 GetNumUsed() const { return NumUsed; }
+
+    /** Slab으로 확보해둔 전체 블록 개수 */
+    uint32 GetNumReserved() const { return NumReserved; }
+
+    /** Slab으로 확보해둔 전체 바이트 수 */
+    size_t GetNumBytesReserved() const { return ReservedBytes; }
+
+private:
+    struct FFreeBlock
+    {
+        FFreeBlock* Next;
+    };
+
+    struct FSlabHeader
+    {
+        FSlabHeader* Next;
+        size_t AllocSize;
+    };
+
+    /** 새로운 Slab을 확보하고, 블록들을 Free List에 추가합니다. */
+    void AllocateSlab();
+
+private:
+    uint32 BlockSize;
+    uint32 BlockAlignment;
+
+    /** 객체 하나의 크기 */
+    uint32 ObjectSize;
+
+    /** 블록 시작에서 객체까지의 Offset (Memory Tag 헤더) */
+    uint32 TagHeaderSize = 0;
+
+    /** Slab 헤더 뒤, 첫 블록이 시작되는 위치까지의 Offset */
+    uint32 SlabHeaderSize;
+
+    /** 다음에 확보할 Slab의 블록 개수 */
+    uint32 NextBlocksPerSlab = InitialBlocksPerSlab;
+
+    FFreeBlock* FreeList = nullptr;
+    FSlabHeader* Slabs = nullptr;
+
+    uint32 NumUsed = 0;
+    uint32 NumReserved = 0;
+    size_t ReservedBytes = 0;
+
+    std::mutex Mutex;
+};
@@ -1,31 +1,160 @@
 ﻿#include "UObjectArray.h"
+#include <cassert>
+#include <cstring>
+
 #include "Object.h"
 #include "UObjectHash.h"
+#include "Class.h"
+#include "CoreMiscDefines.h"
+#include "HAL/PlatformMemory.h"
+
+
+FChunkedFixedUObjectArray::~FChunkedFixedUObjectArray()
+{
+    for (FUObjectItem*& Chunk : Chunks)
+    {
+        if (Chunk)
+        {
+            FPlatformMemory::Free<EAT_Container>(Chunk, sizeof(FUObjectItem) * NumElementsPerChunk);
+            Chunk = nullptr;
+        }
+    }
+}
+
+int32 FChunkedFixedUObjectArray::AddSingle()
+{
+    const int32 Index = NumElements.load(std::memory_order_relaxed);
+    assert(Index < Capacity() && "FChunkedFixedUObjectArray: 최대 객체 수를 초과했습니다.");
+
+    const int32 ChunkIndex = Index / NumElementsPerChunk;
+    if (!Chunks[ChunkIndex])
+    {
+        SCOPED_MEMORY_TAG(UObject);
+        void* Memory = FPlatformMemory::Malloc<EAT_Container>(sizeof(FUObjectItem) * NumElementsPerChunk);
+        std::memset(Memory, 0, sizeof(FUObjectItem) * NumElementsPerChunk);
+        Chunks[ChunkIndex] = static_cast<FUObjectItem*>(Memory);
+    }
+
+    // Chunk를 먼저 기록한 뒤 개수를 늘려, Lock 없이 읽는 쪽에서 항상 할당된 Chunk를 보도록 합니다.
+    NumElements.store(Index + 1, std::memory_order_release);
+    return Index;
+}
 
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
+    {
+        std::lock_guard Lock(ObjObjectsMutex);
+        assert(Object->InternalIndex == INDEX_NONE && "FUObjectArray: 이미 등록된 객체입니다.");
+
+        int32 Index;
+        if (ObjAvailableList.Num() > 0)
+        {
+            Index = ObjAvailableList.Pop();
+        }
+        else
+        {
+            Index = ObjObjects.AddSingle();
+        }
+
+        FUObjectItem& Item = ObjObjects[Index];
+        assert(Item.Object == nullptr);
+
+        Item.Object = Object;
+        Item.Flags = 0;
+        // 0은 "Serial 없음"으로 사용하므로 건너뜁니다.
+        Item.SerialNumber = Item.SerialNumber + 1 > 0 ? Item.SerialNumber + 1 : 1;
+
+        Object->InternalIndex = Index;
+        Object->InternalSerialNumber = Item.SerialNumber;
+    }
+
     AddToClassMap(Object);
 }
 
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
-    ObjObjects.Remove(Object);
-    RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
-    PendingDestroyObjects.AddUnique(Object);
+    std::lock_guard Lock(ObjObjectsMutex);
+    if (!ObjObjects.IsValidIndex(Object->InternalIndex))
+    {
+        return;
+    }
+
+    FUObjectItem& Item = ObjObjects[Object->InternalIndex];
+    if (Item.Object != Object || Item.IsPendingKill())
+    {
+        return;
+    }
+
+    // UObjectHashTable에서는 실제로 삭제될 때 제외하고, 그 전까지는 Iterator가 PendingKill Flag를 보고 건너뜁니다.
+    Item.SetPendingKill();
+    PendingDestroyObjects.Add(Object);
 }
 
 void FUObjectArray::ProcessPendingDestroyObjects()
 {
-    for (UObject* Object : PendingDestroyObjects)
+    // 소멸자에서 다른 객체를 MarkRemoveObject할 수 있으므로, 목록을 비울 때까지 반복합니다.
+    while (true)
     {
-        if (Object)
+        TArray<UObject*> ObjectsToDestroy;
+        {
+            std::lock_guard Lock(ObjObjectsMutex);
+            if (PendingDestroyObjects.IsEmpty())
+            {
+                break;
+            }
+            ObjectsToDestroy = std::move(PendingDestroyObjects);
+            PendingDestroyObjects.Empty();
+        }
+
+        for (UObject* Object : ObjectsToDestroy)
         {
-            delete Object;
+            if (!Object)
+            {
+                continue;
+            }
+
+            const int32 Index = Object->InternalIndex;
+            RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
+
+            // 해제된 포인터로 IsValid를 호출해도 이 Slot을 찾지 못하도록 합니다.
+            Object->InternalIndex = INDEX_NONE;
+
+            // ClassCTOR로 생성된 객체는 클래스별 Pool에 메모리를 반환합니다.
+            if (UClass* Class = Object->GetClass())
+            {
+                Class->DestroyObject(Object);
+            }
+            else
+            {
+                delete Object;
+            }
+
+            std::lock_guard Lock(ObjObjectsMutex);
+            FUObjectItem& Item = ObjObjects[Index];
+            Item.Object = nullptr;
+            Item.Flags = 0;
+            ObjAvailableList.Add(Index);
         }
     }
-    PendingDestroyObjects.Empty();
+}
+
+bool FUObjectArray::IsValid(const UObject* Object) const
+{
+    const FUObjectItem* Item = ObjectToObjectItem(Object);
+    return Item && !Item->IsPendingKill();
+}
+
+const FUObjectItem* FUObjectArray::ObjectToObjectItem(const UObject* Object) const
+{
+    if (!Object)
+    {
+        return nullptr;
+    }
+
+    // Slot이 재사용되었다면 Object가 아닌 다른 객체를 가리키거나, SerialNumber가 다릅니다.
+    const FUObjectItem* Item = IndexToObject(Object->InternalIndex);
+    return Item && Item->Object == Object && Item->SerialNumber == Object->InternalSerialNumber ? Item : nullptr;
 }
 
 FUObjectArray GUObjectArray;
@@ -1,32 +1,164 @@
 ﻿#pragma once
+#include <atomic>
+#include <mutex>
+
 #include "Container/Array.h"
-#include "Container/Set.h"
+#include "HAL/PlatformType.h"
 
 class UClass;
 class UObject;
 
 
+/** FUObjectItem의 상태 Flag */
+enum class EInternalObjectFlags : int32
+{
+    None = 0,
+
+    /** MarkRemoveObject가 호출되어 ProcessPendingDestroyObjects에서 삭제될 객체 */
+    PendingKill = 1 << 0,
+};
+
+
+/**
+ * GUObjectArray의 Slot 하나
+ *
+ * SerialNumber는 Slot에 새 객체가 들어올 때마다 증가하므로, {Index, SerialNumber} 쌍으로 객체를 구분할 수 있습니다.
+ * 객체가 삭제되고 같은 Slot이 재사용되어도 이전 SerialNumber를 가진 Weak Pointer는 무효가 됩니다.
+ */
+struct FUObjectItem
+{
+    UObject* Object = nullptr;
+    int32 Flags = 0;
+    int32 SerialNumber = 0;
+
+    FORCEINLINE bool IsPendingKill() const
+    {
+        return (Flags & static_cast<int32>(EInternalObjectFlags::PendingKill)) != 0;
+    }
+
+    FORCEINLINE void SetPendingKill()
+    {
+        Flags |= static_cast<int32>(EInternalObjectFlags::PendingKill);
+    }
+};
+
+
+/**
+ * 고정 크기 Chunk로 나뉜 FUObjectItem 배열
+ *
+ * Chunk는 한 번 할당되면 이동하지 않으므로, 다른 스레드에서 새 Chunk를 추가하는 중에도 기존 Item의 주소는 유효합니다.
+ */
+class FChunkedFixedUObjectArray
+{
+public:
+    /** Chunk 하나에 들어가는 Item 개수 */
+    static constexpr int32 NumElementsPerChunk = 64 * 1024;
+
+    /** 최대 Chunk 개수, 최대 객체 수는 NumElementsPerChunk * MaxChunks 입니다. */
+    static constexpr int32 MaxChunks = 64;
+
+    FChunkedFixedUObjectArray() = default;
+    ~FChunkedFixedUObjectArray();
+
+    FChunkedFixedUObjectArray(const FChunkedFixedUObjectArray&) = delete;
+    FChunkedFixedUObjectArray& operator=(const FChunkedFixedUObjectArray&) = delete;
+
+    /** 사용된 적이 있는 Slot의 개수 (비어있는 Slot 포함) */
+    FORCEINLINE int32 Num() const { return NumElements.load(std::memory_order_acquire); }
+
+    FORCEINLINE static constexpr int32 Capacity() { return NumElementsPerChunk * MaxChunks; }
+
+    FORCEINLINE bool IsValidIndex(int32 Index) const
+    {
+        return Index >= 0 && Index < Num();
+    }
+
+    FORCEINLINE FUObjectItem& operator[](int32 Index)
+    {
+        return Chunks[Index / NumElementsPerChunk][Index % NumElementsPerChunk];
+    }
+
+    FORCEINLINE const FUObjectItem& operator[](int32 Index) const
+    {
+        return Chunks[Index / NumElementsPerChunk][Index % NumElementsPerChunk];
+    }
+
+    /** 새 Slot을 배열 끝에 추가하고 Index를 반환합니다. 필요하면 Chunk를 할당합니다. */
+    int32 AddSingle();
+
+private:
+    FUObjectItem* Chunks[MaxChunks] = {};
+    std::atomic<int32> NumElements = 0;
+};
+
+
+/**
+ * 모든 UObject를 Index로 관리하는 배열
+ *
+ * - UObject는 자신의 Slot Index와 SerialNumber를 가지고 있으므로 IsValid와 Weak Pointer 검사는 Hash와 Lock 없이 O(1)입니다.
+ * - 삭제된 Slot은 Free List로 재사용되고, 재사용할 때 SerialNumber가 증가합니다.
+ * - 객체 등록/삭제는 Mutex로 보호되며, Slot 조회는 Lock 없이 가능합니다.
+ */
 class FUObjectArray
 {
 public:
+    /** Object에 Slot을 할당하고 UObjectHashTable에 등록합니다. */
     void AddObject(UObject* Object);
+
+    /**
+     * Object를 PendingKill로 표시합니다. 실제 삭제는 ProcessPendingDestroyObjects에서 이루어집니다.
+     * 표시된 Object는 IsValid, TWeakObjectPtr, TObjectIterator에서 즉시 제외됩니다.
+     */
     void MarkRemoveObject(UObject* Object);
 
+    /** PendingKill로 표시된 객체들을 삭제하고, Slot을 반환합니다. */
     void ProcessPendingDestroyObjects();
 
-    TSet<UObject*>& GetObjectItemArrayUnsafe()
+    /**
+     * Object가 등록되어 있고, 삭제 대기 중이 아닌지 확인합니다.
+     * Object의 InternalIndex로 찾은 Slot이 Object를 가리키고, SerialNumber가 Object에 기록된 값과 같아야 합니다.
+     *
+     * 해제된 포인터도 넘길 수 있습니다. 객체의 메모리는 클래스별 Pool에 남아있고(FUObjectPool은 Slab을 반환하지 않습니다),
+     * 해제하기 전에 InternalIndex를 INDEX_NONE으로 바꾸므로 해제된 객체는 항상 무효입니다.
+     * 같은 주소에 새 객체가 생성되었다면 그 객체로 검사하므로 true를 반환합니다. 객체가 바뀌었는지까지 구분해야 한다면 TWeakObjectPtr을 사용합니다.
+     */
+    bool IsValid(const UObject* Object) const;
+
+    /** Index에 해당하는 Slot을 반환합니다. 범위를 벗어나면 nullptr를 반환합니다. */
+    FORCEINLINE const FUObjectItem* IndexToObject(int32 Index) const
+    {
+        return ObjObjects.IsValidIndex(Index) ? &ObjObjects[Index] : nullptr;
+    }
+
+    /** Object의 Slot을 반환합니다. 등록되지 않은 Object라면 nullptr를 반환합니다. IsValid와 같은 방법으로 검사합니다. */
+    const FUObjectItem* ObjectToObjectItem(const UObject* Object) const;
+
+    /** 사용된 적이 있는 Slot의 개수, 순회할 때는 비어있는 Slot(Object == nullptr)을 건너뛰어야 합니다. */
+    int32 GetObjectArrayNum() const { return ObjObjects.Num(); }
+
+    /** 현재 살아있는 객체 수 (삭제 대기 중인 객체 포함) */
+    int32 GetObjectArrayNumMinusAvailable() const { return ObjObjects.Num() - ObjAvailableList.Num(); }
+
+    FChunkedFixedUObjectArray& GetObjectItemArrayUnsafe()
     {
         return ObjObjects;
     }
 
-    const TSet<UObject*>& GetObjectItemArrayUnsafe() const
+    const FChunkedFixedUObjectArray& GetObjectItemArrayUnsafe() const
     {
         return ObjObjects;
     }
 
 private:
-    TSet<UObject*> ObjObjects;
+    FChunkedFixedUObjectArray ObjObjects;
+
+    /** 재사용 가능한 Slot의 Index 목록 */
+    TArray<int32> ObjAvailableList;
+
+    /** MarkRemoveObject로 표시된 객체 목록, PendingKill Flag로 중복을 막으므로 AddUnique가 필요 없습니다. */
     TArray<UObject*> PendingDestroyObjects;
+
+    mutable std::mutex ObjObjectsMutex;
 };
 
 extern FUObjectArray GUObjectArray;
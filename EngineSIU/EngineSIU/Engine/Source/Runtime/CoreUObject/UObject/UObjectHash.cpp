@@ -1,9 +1,12 @@
 #include "UObjectHash.h"
 #include <cassert>
+#include <mutex>
 #include "Object.h"
 #include "Class.h"
+#include "UObjectArray.h"
+#include "CoreMiscDefines.h"
+#include "Async/JobSystem.h"
 #include "Container/Map.h"
-#include "Container/Set.h"
 
 /**
  * 모든 UObject의 정보를 담고 있는 HashTable
@@ -12,7 +15,14 @@ struct FUObjectHashTables
 {
 private:
     FUObjectHashTables() = default;
-    ~FUObjectHashTables() = default;
+
+    ~FUObjectHashTables()
+    {
+        for (const auto& [Class, Bucket] : ClassToBucketMap)
+        {
+            delete Bucket;
+        }
+    }
 
 public:
     FUObjectHashTables(const FUObjectHashTables&) = delete;
@@ -26,122 +36,175 @@ public:
         return Singleton;
     }
 
-    TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
-    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
+    /** Map의 값은 Rehash 시 이동하므로, Bucket은 따로 할당해서 주소를 고정합니다. */
+    TMap<const UClass*, FUObjectClassBucket*> ClassToBucketMap;
+
+    /** GUObjectArray의 Index -> Bucket의 Objects 안에서의 위치 */
+    TArray<int32> ObjectIndexToBucketSlot;
+
+    /** Worker 스레드에서 생성되어, 게임 스레드에서 Bucket에 추가될 객체들 */
+    TArray<UObject*> PendingObjects;
+    std::mutex PendingObjectsMutex;
 };
 
-/** Helper function that returns all the children of the specified class recursively */
-template <typename ClassType, typename ArrayAllocator>
-static void RecursivelyPopulateDerivedClasses(FUObjectHashTables& ThreadHash, const UClass* ParentClass, TArray<ClassType, ArrayAllocator>& OutAllDerivedClass)
+/**
+ * Bucket은 게임 스레드에서만 바뀌므로, 게임 스레드에서 Lock 없이 순회할 수 있습니다.
+ * Job System이 시작되기 전(클래스 등록 등)에는 호출한 스레드를 게임 스레드로 취급합니다.
+ */
+static bool IsInClassMapThread()
 {
-    // Start search with the parent class at virtual index Num-1, then continue searching from index Num as things are added
-    int32 SearchIndex = OutAllDerivedClass.Num() - 1;
-    const UClass* SearchClass = ParentClass;
+    const FJobSystem& JobSystem = FJobSystem::Get();
+    return !JobSystem.IsRunning() || JobSystem.IsInGameThread();
+}
 
-    while (true)
+static FUObjectClassBucket& FindOrAddClassBucket(FUObjectHashTables& HashTable, const UClass* Class)
+{
+    if (FUObjectClassBucket** Found = HashTable.ClassToBucketMap.Find(Class))
     {
-        if (TSet<UClass*>* ChildSet = ThreadHash.ClassToChildListMap.Find(const_cast<UClass*>(SearchClass)))
-        {
-            OutAllDerivedClass.Reserve(OutAllDerivedClass.Num() + ChildSet->Num());
-            for (UClass* ChildClass : *ChildSet)
-            {
-                OutAllDerivedClass.Add(ChildClass);
-            }
-        }
+        return **Found;
+    }
 
-        // Now search at next index, if it has been filled in by code above
-        ++SearchIndex;
+    // 부모 클래스를 먼저 등록하므로, 새 Bucket의 파생 클래스는 아직 등록되어 있지 않습니다.
+    // 따라서 자신과 모든 조상의 DerivedBuckets에 자신을 추가하는 것만으로 목록이 완성됩니다.
+    if (const UClass* SuperClass = Class->GetSuperClass())
+    {
+        FindOrAddClassBucket(HashTable, SuperClass);
+    }
 
-        if (SearchIndex < OutAllDerivedClass.Num())
-        {
-            SearchClass = OutAllDerivedClass[SearchIndex];            
-        }
-        else
+    FUObjectClassBucket* Bucket = new FUObjectClassBucket;
+    Bucket->Class = Class;
+    HashTable.ClassToBucketMap.Add(Class, Bucket);
+
+    for (const UClass* SearchClass = Class; SearchClass; SearchClass = SearchClass->GetSuperClass())
+    {
+        HashTable.ClassToBucketMap[SearchClass]->DerivedBuckets.Add(Bucket);
+    }
+    return *Bucket;
+}
+
+bool IsObjectPendingKill(const UObject* Object)
+{
+    return GUObjectArray.GetObjectItemArrayUnsafe()[Object->GetInternalIndex()].IsPendingKill();
+}
+
+static void AddToClassBucket(FUObjectHashTables& HashTable, UObject* Object)
+{
+    FUObjectClassBucket& Bucket = FindOrAddClassBucket(HashTable, Object->GetClass());
+
+    const int32 ObjectIndex = Object->GetInternalIndex();
+    if (ObjectIndex >= HashTable.ObjectIndexToBucketSlot.Num())
+    {
+        HashTable.ObjectIndexToBucketSlot.SetNum(ObjectIndex + 1);
+    }
+    HashTable.ObjectIndexToBucketSlot[ObjectIndex] = Bucket.Objects.Add(Object);
+}
+
+/** Worker 스레드에서 생성된 객체들을 Bucket에 추가합니다. 게임 스레드에서만 호출합니다. */
+static void FlushPendingObjects(FUObjectHashTables& HashTable)
+{
+    TArray<UObject*> Objects;
+    {
+        std::lock_guard Lock(HashTable.PendingObjectsMutex);
+        if (HashTable.PendingObjects.IsEmpty())
         {
             return;
         }
+        Objects = std::move(HashTable.PendingObjects);
+        HashTable.PendingObjects.Empty();
     }
+
+    for (UObject* Object : Objects)
+    {
+        AddToClassBucket(HashTable, Object);
+    }
+}
+
+FUObjectClassBucket& GetClassBucket(const UClass* Class)
+{
+    assert(IsInClassMapThread() && "GetClassBucket: 객체 순회는 게임 스레드에서만 할 수 있습니다.");
+    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
+
+    FlushPendingObjects(HashTable);
+    return FindOrAddClassBucket(HashTable, Class);
 }
 
 void AddToClassMap(UObject* Object)
 {
     assert(Object->GetClass());
+    assert(Object->GetInternalIndex() != INDEX_NONE && "AddToClassMap: GUObjectArray에 등록되지 않은 객체입니다.");
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
-    UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
+    // 게임 스레드가 Bucket을 순회하는 중일 수 있으므로, Worker 스레드에서는 Bucket을 바꾸지 않고 넘겨줍니다.
+    if (!IsInClassMapThread())
+    {
+        std::lock_guard Lock(HashTable.PendingObjectsMutex);
+        HashTable.PendingObjects.Add(Object);
+        return;
+    }
 
-    // Ensure child class mappings are updated
-    AddClassToChildListMap(Class);
+    FlushPendingObjects(HashTable);
+    AddToClassBucket(HashTable, Object);
 }
 
 void RemoveFromClassMap(UObject* Object)
 {
     assert(Object->GetClass());
+    assert(IsInClassMapThread() && "RemoveFromClassMap: 객체는 게임 스레드에서 삭제됩니다.");
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
-    int32 NumRemoved = ObjectSet.Remove(Object);
+    // 아직 Bucket에 추가되지 않은 객체일 수 있습니다.
+    FlushPendingObjects(HashTable);
 
-    if (NumRemoved == 0)
+    FUObjectClassBucket** Found = HashTable.ClassToBucketMap.Find(Object->GetClass());
+    if (!Found)
     {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
+        return;
     }
-}
 
-void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
-{
-    Results.Add(ClassToLookFor);
+    TArray<UObject*>& Objects = (*Found)->Objects;
+    const int32 Slot = HashTable.ObjectIndexToBucketSlot[Object->GetInternalIndex()];
+    assert(Objects[Slot] == Object);
+
+    // 마지막 객체를 빈 자리로 옮깁니다.
+    UObject* LastObject = Objects.Last();
+    Objects[Slot] = LastObject;
+    HashTable.ObjectIndexToBucketSlot[LastObject->GetInternalIndex()] = Slot;
+    Objects.Pop();
 
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-    RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Results);
+    HashTable.ObjectIndexToBucketSlot[Object->GetInternalIndex()] = INDEX_NONE;
 }
 
-uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor)
+void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
 {
-    if (const TSet<UObject*>* ObjectSet = FUObjectHashTables::Get().ClassToObjectListMap.Find(ClassToLookFor))
+    // DerivedBuckets의 0번은 자기 자신입니다.
+    for (const FUObjectClassBucket* Bucket : GetClassBucket(ClassToLookFor).DerivedBuckets)
     {
-        return ObjectSet->Num();
+        Results.Add(const_cast<UClass*>(Bucket->Class));
     }
-    return 0;
 }
 
-void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
+uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor)
 {
-    // Most classes searched for have around 10 subclasses, some have hundreds
-    TArray<const UClass*> ClassesToSearch;
-    ClassesToSearch.Add(ClassToLookFor);
-
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-
-    if (bIncludeDerivedClasses)
-    {
-        RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
-    }
-
-
-    for (const UClass* SearchClass : ClassesToSearch)
+    uint32 Count = 0;
+    for (const UObject* Object : GetClassBucket(ClassToLookFor).Objects)
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
+        if (!IsObjectPendingKill(Object))
         {
-            for (const auto& Object : *List)
-            {
-                Results.Add(Object);
-            }
+            ++Count;
         }
     }
+    return Count;
 }
 
-void AddClassToChildListMap(UClass* InClass)
+void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
 {
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-    UClass* CurrentClass = InClass;
-
-    for (UClass* SuperClass = CurrentClass->GetSuperClass(); SuperClass;)
+    ForEachObjectOfClass(ClassToLookFor, [&Results](UObject* Object)
     {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(CurrentClass);
+        Results.Add(Object);
+    }, bIncludeDerivedClasses);
+}
 
-        CurrentClass = SuperClass;
-        SuperClass = SuperClass->GetSuperClass();
-    }
+void AddClassToChildListMap(UClass* InClass)
+{
+    GetClassBucket(InClass);
 }
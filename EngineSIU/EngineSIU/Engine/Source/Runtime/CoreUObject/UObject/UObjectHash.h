@@ -4,6 +4,39 @@
 class UObject;
 class UClass;
 
+/**
+ * 한 UClass의 객체 목록
+ *
+ * Objects는 Class와 정확히 일치하는 객체만 담는 Dense 배열이며, 삭제 시 마지막 원소와 자리를 바꿔 O(1)로 제거합니다.
+ * DerivedBuckets는 자기 자신(0번)과 모든 파생 클래스의 Bucket 목록으로, 새 클래스가 등록될 때만 갱신됩니다.
+ *
+ * Bucket은 한 번 만들어지면 이동하거나 삭제되지 않으므로, 포인터를 보관해도 안전합니다.
+ *
+ * Bucket은 게임 스레드에서만 바뀌고 순회됩니다. Worker 스레드에서 생성된 객체(FBX Job 등)는 대기 목록에 넣어 두었다가,
+ * 게임 스레드가 다음에 GetClassBucket, AddToClassMap, RemoveFromClassMap을 호출할 때 추가합니다.
+ * 순회 중에 객체가 추가되면 Objects가 재할당될 수 있으므로, 순회하는 쪽은 참조를 보관하지 말고 매번 Index로 접근해야 합니다.
+ */
+struct FUObjectClassBucket
+{
+    const UClass* Class = nullptr;
+
+    /** Class의 객체들, 순서는 보장되지 않습니다. */
+    TArray<UObject*> Objects;
+
+    /** Class 자신을 포함한 모든 파생 클래스의 Bucket */
+    TArray<FUObjectClassBucket*> DerivedBuckets;
+};
+
+/**
+ * Class의 Bucket을 반환합니다. 등록되지 않은 Class라면 상속 구조와 함께 등록합니다.
+ * TObjectIterator처럼 매 프레임 순회하는 곳에서는 이 Bucket을 직접 순회하면 객체 목록을 복사하지 않아도 됩니다.
+ * 게임 스레드에서만 호출할 수 있습니다.
+ */
+FUObjectClassBucket& GetClassBucket(const UClass* Class);
+
+/** MarkRemoveObject로 삭제 대기 중인 객체인지 확인합니다. Bucket을 순회할 때 사용합니다. */
+bool IsObjectPendingKill(const UObject* Object);
+
 /**
  * ClassToLookFor와 일치하는 UObject를 반환합니다.
  * @param ClassToLookFor 반환할 Object의 Class정보
@@ -13,7 +46,36 @@ class UClass;
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses);
 
 /**
- * ClassToChildListMap에 상속 구조를 저장합니다.
+ * ClassToLookFor와 일치하는 UObject마다 Operation을 호출합니다.
+ * 결과 배열을 만들지 않으므로, 결과를 보관할 필요가 없을 때는 GetObjectsOfClass 대신 사용합니다.
+ * Operation 안에서 생성된 객체는 순회에 포함될 수 있고, MarkRemoveObject된 객체는 건너뜁니다.
+ * @param ClassToLookFor 찾을 Object의 Class정보
+ * @param Operation 각 Object에 대해 호출할 함수, void(UObject*)
+ * @param bIncludeDerivedClasses ClassToLookFor의 파생 클래스까지 찾을지 여부
+ */
+template <typename FuncType>
+void ForEachObjectOfClass(const UClass* ClassToLookFor, FuncType&& Operation, bool bIncludeDerivedClasses = true)
+{
+    const FUObjectClassBucket& RootBucket = GetClassBucket(ClassToLookFor);
+    const int32 NumBuckets = bIncludeDerivedClasses ? RootBucket.DerivedBuckets.Num() : 1;
+
+    for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        // Operation에서 객체를 생성하면 Objects가 재할당될 수 있으므로, 매번 Index로 접근합니다.
+        const TArray<UObject*>& Objects = RootBucket.DerivedBuckets[BucketIndex]->Objects;
+        for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+        {
+            UObject* Object = Objects[ObjectIndex];
+            if (!IsObjectPendingKill(Object))
+            {
+                Operation(Object);
+            }
+        }
+    }
+}
+
+/**
+ * 클래스의 상속 구조를 등록하고, 부모 클래스들의 DerivedBuckets에 추가합니다.
  * @note UClass에서 자동으로 처리할 때 사용되며, 직접 사용해서는 안됩니다.
  */
 void AddClassToChildListMap(UClass* InClass);
@@ -21,7 +83,10 @@ void AddClassToChildListMap(UClass* InClass);
 /** FUObjectHashTables에 Object의 정보를 저장합니다. */
 void AddToClassMap(UObject* Object);
 
-/** FUObjectHashTables에 저장된 Object정보를 제거합니다. */
+/**
+ * FUObjectHashTables에 저장된 Object정보를 제거합니다.
+ * @note 순회 중인 Iterator를 보호하기 위해, MarkRemoveObject가 아니라 객체가 실제로 삭제될 때 호출됩니다.
+ */
 void RemoveFromClassMap(UObject* Object);
 
 /**
@@ -31,5 +96,5 @@ void RemoveFromClassMap(UObject* Object);
  */
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results);
 
-/** ClassToLookFor와 일치하는 오브젝트의 개수를 반환합니다. */
+/** ClassToLookFor와 일치하는 오브젝트의 개수를 반환합니다. (삭제 대기 중인 객체 제외) */
 uint32 GetNumOfObjectsByClass(UClass* ClassToLookFor);
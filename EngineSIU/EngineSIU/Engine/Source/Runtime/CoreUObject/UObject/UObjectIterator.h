@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "UObjectArray.h"
 #include "UObjectHash.h"
 #include "Container/Array.h"
 
@@ -8,6 +9,11 @@
 
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
+ *
+ * FUObjectHashTables의 클래스별 Bucket과, 미리 계산된 파생 클래스 Bucket 목록을 직접 순회하므로 객체 목록을 복사하지 않습니다.
+ * - 순회 중 생성된 객체는 Bucket 끝에 추가되므로 순회에 포함될 수 있습니다.
+ * - 순회 중 MarkRemoveObject된 객체는 건너뛰며, Bucket에서는 ProcessPendingDestroyObjects에서 제거됩니다.
+ * - Bucket은 게임 스레드에서만 바뀌므로, 게임 스레드에서만 사용할 수 있습니다. (FUObjectClassBucket 참고)
  * 
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
  */
@@ -23,15 +29,16 @@ public:
 
     /** Begin 생성자 */
     explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
+        : RootBucket(&GetClassBucket(T::StaticClass()))
+        , bIncludeDerivedClasses(bIncludeDerivedClasses)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : RootBucket(Begin.RootBucket)
+        , bIncludeDerivedClasses(Begin.bIncludeDerivedClasses)
     {
     }
 
@@ -50,31 +57,52 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    FORCEINLINE explicit operator bool() const { return CurrentObject != nullptr; }
+
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return CurrentObject == Rhs.CurrentObject; }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return CurrentObject != Rhs.CurrentObject; }
 
 protected:
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return CurrentObject;
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        // 순회 중 클래스가 등록되거나 객체가 추가되면 배열이 재할당될 수 있으므로, 매번 Index로 접근합니다.
+        const TArray<FUObjectClassBucket*>& Buckets = RootBucket->DerivedBuckets;
+        const int32 NumBuckets = bIncludeDerivedClasses ? Buckets.Num() : 1;
+
+        while (BucketIndex < NumBuckets)
         {
-            if (GetObject())
+            const TArray<UObject*>& Objects = Buckets[BucketIndex]->Objects;
+            while (++ObjectIndex < Objects.Num())
             {
-                return true;
+                UObject* Object = Objects[ObjectIndex];
+                if (!GUObjectArray.GetObjectItemArrayUnsafe()[Object->GetInternalIndex()].IsPendingKill())
+                {
+                    CurrentObject = Object;
+                    return true;
+                }
             }
+
+            ++BucketIndex;
+            ObjectIndex = -1;
         }
+
+        CurrentObject = nullptr;
         return false;
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
-    int32 Index;
+    /** T::StaticClass()의 Bucket, DerivedBuckets[0]은 자기 자신입니다. */
+    const FUObjectClassBucket* RootBucket;
+    bool bIncludeDerivedClasses;
+
+    int32 BucketIndex = 0;
+    int32 ObjectIndex = -1;
+    UObject* CurrentObject = nullptr;
 };
 
 
@@ -0,0 +1,17 @@
+#include "WeakObjectPtr.h"
+#include "Object.h"
+
+
+FWeakObjectPtr& FWeakObjectPtr::operator=(const UObject* Object)
+{
+    if (const FUObjectItem* Item = GUObjectArray.ObjectToObjectItem(Object))
+    {
+        ObjectIndex = Object->GetInternalIndex();
+        ObjectSerialNumber = Item->SerialNumber;
+    }
+    else
+    {
+        Reset();
+    }
+    return *this;
+}
@@ -1,7 +1,66 @@
 ﻿#pragma once
+#include "CoreMiscDefines.h"
 #include "ObjectUtils.h"
+#include "UObjectArray.h"
 #include "HAL/PlatformType.h"
 
+
+/**
+ * UObject를 {GUObjectArray의 Index, SerialNumber} 쌍으로 가리키는 Weak Pointer
+ *
+ * Slot의 SerialNumber는 객체가 바뀔 때마다 증가하므로, 두 값을 비교하는 것만으로 객체가 아직 살아있는지 알 수 있습니다.
+ * 포인터를 Hash하거나 삭제된 객체의 메모리에 접근하지 않습니다.
+ */
+struct FWeakObjectPtr
+{
+public:
+    FWeakObjectPtr() = default;
+
+    FWeakObjectPtr(const UObject* Object)
+    {
+        *this = Object;
+    }
+
+    /** Object가 GUObjectArray에 등록되어 있지 않다면 null이 됩니다. */
+    FWeakObjectPtr& operator=(const UObject* Object);
+
+    FORCEINLINE void Reset()
+    {
+        ObjectIndex = INDEX_NONE;
+        ObjectSerialNumber = 0;
+    }
+
+    /** 객체가 살아있고 삭제 대기 중이 아니라면 반환하고, 아니라면 nullptr를 반환합니다. */
+    FORCEINLINE UObject* Get() const
+    {
+        const FUObjectItem* Item = GUObjectArray.IndexToObject(ObjectIndex);
+        if (Item && Item->SerialNumber == ObjectSerialNumber && !Item->IsPendingKill())
+        {
+            return Item->Object;
+        }
+        return nullptr;
+    }
+
+    FORCEINLINE bool IsValid() const { return Get() != nullptr; }
+
+    /** 객체의 유효성과 관계없이 같은 객체를 가리키도록 만들어졌는지 비교합니다. */
+    FORCEINLINE bool HasSameIndexAndSerialNumber(const FWeakObjectPtr& Other) const
+    {
+        return ObjectIndex == Other.ObjectIndex && ObjectSerialNumber == Other.ObjectSerialNumber;
+    }
+
+    /** 둘 다 무효라면 같은 것으로 취급합니다. */
+    FORCEINLINE bool operator==(const FWeakObjectPtr& Other) const
+    {
+        return HasSameIndexAndSerialNumber(Other) || (!IsValid() && !Other.IsValid());
+    }
+
+private:
+    int32 ObjectIndex = INDEX_NONE;
+    int32 ObjectSerialNumber = 0;
+};
+
+
 /**
  * Object가 유효할때만 값을 반환하는 포인터, Object가 유효하지 않다면 nullptr
  * @tparam T UObject를 상속받은 Class
@@ -23,40 +82,33 @@ public:
     TWeakObjectPtr& operator=(TWeakObjectPtr&&) = default;
 
     TWeakObjectPtr(nullptr_t)
-        : ObjectPtr(nullptr)
     {
     }
 
     TWeakObjectPtr(ElementType* InPtr)
-        : ObjectPtr(InPtr)
+        // ReSharper disable once CppCStyleCast
+        : WeakPtr((const UObject*)InPtr)
     {
     }
 
     TWeakObjectPtr& operator=(nullptr_t)
     {
-        ObjectPtr = nullptr;
+        WeakPtr.Reset();
         return *this;
     }
 
     TWeakObjectPtr& operator=(ElementType* InPtr)
     {
-        ObjectPtr = InPtr;
+        // ReSharper disable once CppCStyleCast
+        WeakPtr = (const UObject*)InPtr;
         return *this;
     }
 
 public:
     FORCEINLINE ElementType* Get() const
     {
-        if (ObjectPtr)
-        {
-            // ReSharper disable once CppCStyleCast
-            if (::IsValid((UObject*)ObjectPtr))
-            {
-                return ObjectPtr;
-            }
-            ObjectPtr = nullptr;
-        }
-        return nullptr;
+        // ReSharper disable once CppCStyleCast
+        return (ElementType*)WeakPtr.Get();
     }
 
     FORCEINLINE ElementType* operator->() const { return Get(); }
@@ -64,9 +116,18 @@ public:
     FORCEINLINE operator ElementType*() const { return Get(); }
     FORCEINLINE explicit operator bool() const { return Get() != nullptr; }
 
+    FORCEINLINE bool operator==(const TWeakObjectPtr& Other) const { return WeakPtr == Other.WeakPtr; }
+
 public:
     bool IsValid() const { return Get() != nullptr; }
 
+    void Reset() { WeakPtr.Reset(); }
+
+    bool HasSameIndexAndSerialNumber(const TWeakObjectPtr& Other) const
+    {
+        return WeakPtr.HasSameIndexAndSerialNumber(Other.WeakPtr);
+    }
+
 private:
-    mutable ElementType* ObjectPtr = nullptr;
+    FWeakObjectPtr WeakPtr;
 };
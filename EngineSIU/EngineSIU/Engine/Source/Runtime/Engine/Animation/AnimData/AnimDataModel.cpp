@@ -1,6 +1,8 @@
 #include "AnimDataModel.h"
 
+#include "Container/ContainerAllocator.h"
 #include "Engine/Asset/SkeletalMeshAsset.h"
+#include "Math/MathKernels.h"
 #include "Math/Transform.h"
 
 UAnimDataModel::UAnimDataModel()
@@ -84,28 +86,47 @@ void UAnimDataModel::GetPoseAtTime(float Time, TArray<FTransform>& OutPose, cons
         Frame2Idx = FMath::Clamp(Frame2Idx, 0, NumberOfFrames - 1);
     }
 
-    // 각 본에 대해 트랜스폼 계산
-    for (int32 BoneTreeIdx = 0; BoneTreeIdx < NumBones; ++BoneTreeIdx)
+    // Bone마다 Track을 한 번만 찾아 둡니다. (같은 Bone의 Track이 여럿이면 처음 것)
+    FMemMark Mark(FMemStack::Get());
+    TArray<const FRawAnimSequenceTrack*, TFrameAllocator<const FRawAnimSequenceTrack*>> BoneTracks;
+    BoneTracks.Init(nullptr, NumBones);
+    for (const FBoneAnimationTrack& Track : BoneAnimationTracks)
     {
-        // 해당 Bone에 대한 애니메이션 트랙 찾기
-        const FBoneAnimationTrack* FoundTrack = nullptr;
-        for (const FBoneAnimationTrack& Track : BoneAnimationTracks)
+        if (BoneTracks.IsValidIndex(Track.BoneTreeIndex) && !BoneTracks[Track.BoneTreeIndex])
         {
-            if (Track.BoneTreeIndex == BoneTreeIdx)
-            {
-                FoundTrack = &Track;
-                break;
-            }
+            BoneTracks[Track.BoneTreeIndex] = &Track.InternalTrackData;
         }
+    }
+
+    // 위치와 스케일은 바로 보간하고, 회전은 모아 두었다가 한 번에 Slerp합니다.
+    TArray<int32, TFrameAllocator<int32>> AnimatedBones;
+    TArray<FQuat, TFrameAllocator<FQuat>> StartRotations;
+    TArray<FQuat, TFrameAllocator<FQuat>> EndRotations;
+    AnimatedBones.Reserve(NumBones);
+    StartRotations.Reserve(NumBones);
+    EndRotations.Reserve(NumBones);
 
-        if (FoundTrack && !FoundTrack->InternalTrackData.PosKeys.IsEmpty()) // 트랙이 있고, 키 데이터가 있는 경우)
+    for (int32 BoneTreeIdx = 0; BoneTreeIdx < NumBones; ++BoneTreeIdx)
+    {
+        const FRawAnimSequenceTrack* TrackData = BoneTracks[BoneTreeIdx];
+        if (TrackData && !TrackData->PosKeys.IsEmpty()) // 트랙이 있고, 키 데이터가 있는 경우
         {
             // 두 프레임에서 트랜스폼 가져오기
-            FTransform Transform1 = GetTransformAtFrame(FoundTrack->InternalTrackData, Frame1Idx);
-            FTransform Transform2 = GetTransformAtFrame(FoundTrack->InternalTrackData, Frame2Idx);
+            const FTransform Transform1 = GetTransformAtFrame(*TrackData, Frame1Idx);
+            const FTransform Transform2 = GetTransformAtFrame(*TrackData, Frame2Idx);
+            if (Alpha <= 0.0f)
+            {
+                OutPose[BoneTreeIdx] = Transform1;
+                continue;
+            }
 
-            // 보간하여 최종 트랜스폼 계산
-            OutPose[BoneTreeIdx] = InterpolateTransform(Transform1, Transform2, Alpha);
+            FTransform& BonePose = OutPose[BoneTreeIdx];
+            BonePose.SetTranslation(FMath::Lerp(Transform1.GetTranslation(), Transform2.GetTranslation(), Alpha));
+            BonePose.SetScale3D(FMath::Lerp(Transform1.GetScale3D(), Transform2.GetScale3D(), Alpha));
+
+            AnimatedBones.Add(BoneTreeIdx);
+            StartRotations.Add(Transform1.GetRotation());
+            EndRotations.Add(Transform2.GetRotation());
         }
         else // 해당 본에 대한 애니메이션 트랙이 없거나 키 데이터가 없으면 참조 포즈 사용
         {
@@ -119,6 +140,16 @@ void UAnimDataModel::GetPoseAtTime(float Time, TArray<FTransform>& OutPose, cons
             }
         }
     }
+
+    if (!AnimatedBones.IsEmpty())
+    {
+        // Slerp 결과는 정규화되어 있습니다.
+        FMathKernels::Get().SlerpQuats(StartRotations.GetData(), StartRotations.GetData(), EndRotations.GetData(), Alpha, StartRotations.Num());
+        for (int32 Index = 0; Index < AnimatedBones.Num(); ++Index)
+        {
+            OutPose[AnimatedBones[Index]].SetRotation(StartRotations[Index]);
+        }
+    }
 }
 
 FTransform UAnimDataModel::GetTransformAtFrame(const FRawAnimSequenceTrack& TrackData, int32 FrameIndex) const
@@ -149,20 +180,3 @@ FTransform UAnimDataModel::GetTransformAtFrame(const FRawAnimSequenceTrack& Trac
     return FTransform(Pos, Rot, Scale);
 
 }
-
-FTransform UAnimDataModel::InterpolateTransform(const FTransform& Start, const FTransform& End, float Alpha) const
-{
-    if (Alpha <= 0.0f) return Start;
-    if (Alpha >= 1.0f) return End;
-
-    FTransform Result;
-    // 위치는 선형 보간 (Lerp)
-    Result.SetTranslation(FMath::Lerp(Start.GetTranslation(), End.GetTranslation(), Alpha));
-    // 회전은 구면 선형 보간 (Slerp)
-    Result.SetRotation(FQuat::Slerp(Start.GetRotation(), End.GetRotation(), Alpha));
-    // 스케일도 선형 보간 (Lerp)
-    Result.SetScale3D(FMath::Lerp(Start.GetScale3D(), End.GetScale3D(), Alpha));
-
-    Result.NormalizeRotation(); // Slerp 후 정규화 권장
-    return Result;
-}
@@ -33,6 +33,4 @@ public:
 private:
     /* 특정 트랙에서 특정 프레임의 트랜스폼을 가져옴 */
     FTransform GetTransformAtFrame(const FRawAnimSequenceTrack& TrackData, int32 FrameIndex) const;
-    /* 두 프레임 사이의 트랜스폼을 보간 */
-    FTransform InterpolateTransform(const FTransform& Start, const FTransform& End, float Alpha) const;
 };
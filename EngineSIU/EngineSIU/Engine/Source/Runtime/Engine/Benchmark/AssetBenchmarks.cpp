@@ -0,0 +1,106 @@
+#include "Benchmark.h"
+#include <filesystem>
+#include <fstream>
+
+#include "Components/Material/Material.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Asset/StaticMeshAsset.h"
+#include "Engine/FbxObject.h"
+#include "Engine/FFbxLoader.h"
+#include "Engine/FObjLoader.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+/**
+ * 등록된 AssetType Asset 중 캐시(.bin) 파일이 가장 큰 것의 캐시 경로를 찾습니다.
+ * Contents가 바뀌지 않는 한 같은 Asset이 선택되므로 Baseline과 비교할 수 있습니다.
+ */
+bool FindLargestCache(EAssetType AssetType, FWString& OutBinaryPath, uint64& OutBytes)
+{
+    UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+    if (!AssetManager)
+    {
+        return false;
+    }
+
+    OutBytes = 0;
+    for (const auto& [AssetName, AssetInfo] : AssetManager->GetAssetRegistry())
+    {
+        if (AssetInfo.AssetType != AssetType)
+        {
+            continue;
+        }
+
+        const FWString BinaryPath = (AssetInfo.GetFullPath() + ".bin").ToWideString();
+        std::error_code ErrorCode;
+        const uint64 Bytes = std::filesystem::file_size(BinaryPath, ErrorCode);
+        if (!ErrorCode && Bytes > OutBytes)
+        {
+            OutBinaryPath = BinaryPath;
+            OutBytes = Bytes;
+        }
+    }
+    return OutBytes > 0;
+}
+}
+
+
+/** .obj.bin 캐시에서 StaticMesh RenderData를 읽습니다. Texture는 처음 한 번만 로드됩니다. */
+static void BM_Asset_LoadObjCache(FBenchmarkState& State)
+{
+    FWString BinaryPath;
+    uint64 Bytes = 0;
+    if (!FindLargestCache(EAssetType::StaticMesh, BinaryPath, Bytes))
+    {
+        State.SkipWithError(TEXT("no .obj.bin cache in Contents"));
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        FStaticMeshRenderData RenderData;
+        FObjManager::LoadStaticMeshFromBinary(BinaryPath, RenderData);
+        DoNotOptimize(RenderData);
+    }
+    State.SetBytesProcessed(State.GetIterations() * static_cast<int64>(Bytes));
+}
+BENCHMARK(BM_Asset_LoadObjCache);
+
+/** .fbx.bin 캐시에서 SkeletalMesh 데이터를 읽습니다. Texture는 처음 한 번만 로드됩니다. */
+static void BM_Asset_LoadFbxCache(FBenchmarkState& State)
+{
+    FWString BinaryPath;
+    uint64 Bytes = 0;
+    if (!FindLargestCache(EAssetType::SkeletalMesh, BinaryPath, Bytes))
+    {
+        State.SkipWithError(TEXT("no .fbx.bin cache in Contents"));
+        return;
+    }
+
+    // 원본의 수정 시각 검사를 통과하도록, 캐시 맨 앞에 기록된 시각을 그대로 넘깁니다.
+    int64_t LastModifiedTime = 0;
+    std::ifstream(BinaryPath, std::ios::binary).read(reinterpret_cast<char*>(&LastModifiedTime), sizeof(LastModifiedTime));
+
+    // LoadFBXFromBinary가 호출마다 남기는 로그를 측정하는 동안 막습니다.
+    const ELogLevel PrevVerbosity = LogTemp.GetVerbosity();
+    LogTemp.SetVerbosity(ELogLevel::Warning);
+
+    for (auto _ : State)
+    {
+        FFbxSkeletalMesh SkeletalMesh;
+        FFbxManager::LoadFBXFromBinary(BinaryPath, LastModifiedTime, SkeletalMesh);
+        DoNotOptimize(SkeletalMesh);
+
+        // 캐시에서 만든 Material은 UObjectArray에 등록되지 않으므로 직접 지웁니다.
+        for (UMaterial* Material : SkeletalMesh.material)
+        {
+            delete Material;
+        }
+    }
+
+    LogTemp.SetVerbosity(PrevVerbosity);
+    State.SetBytesProcessed(State.GetIterations() * static_cast<int64>(Bytes));
+}
+BENCHMARK(BM_Asset_LoadFbxCache);
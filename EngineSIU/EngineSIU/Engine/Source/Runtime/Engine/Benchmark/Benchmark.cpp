@@ -0,0 +1,458 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#include "JSON/json.hpp"
+#include "WindowsPlatformTime.h"
+#include "Container/Map.h"
+#include "Math/MathKernels.h"
+#include "UserInterface/Console.h"
+
+using json = nlohmann::json;
+
+
+const void* volatile GBenchmarkSink = nullptr;
+
+
+namespace
+{
+/** 측정 한 번의 최대 반복 횟수 */
+constexpr int64 MaxIterations = 1'000'000'000;
+
+double ToNanoseconds(double Value, const std::string& TimeUnit)
+{
+    if (TimeUnit == "us")
+    {
+        return Value * 1.0e3;
+    }
+    if (TimeUnit == "ms")
+    {
+        return Value * 1.0e6;
+    }
+    if (TimeUnit == "s")
+    {
+        return Value * 1.0e9;
+    }
+    return Value;
+}
+}
+
+
+FBenchmarkState::FBenchmarkState(int64 InArg, int64 InMaxIterations)
+    : Arg(InArg)
+    , MaxIterations(InMaxIterations)
+{
+}
+
+FBenchmarkState::FIterator FBenchmarkState::begin()
+{
+    StartTiming();
+    return FIterator{ this, Error.IsEmpty() ? MaxIterations : 0 };
+}
+
+bool FBenchmarkState::KeepRunning()
+{
+    if (KeepRunningRemaining < 0)
+    {
+        KeepRunningRemaining = Error.IsEmpty() ? MaxIterations : 0;
+        StartTiming();
+    }
+
+    if (KeepRunningRemaining > 0)
+    {
+        --KeepRunningRemaining;
+        return true;
+    }
+
+    StopTiming();
+    return false;
+}
+
+void FBenchmarkState::PauseTiming()
+{
+    StopTiming();
+}
+
+void FBenchmarkState::ResumeTiming()
+{
+    StartTiming();
+}
+
+void FBenchmarkState::SkipWithError(const FString& Message)
+{
+    Error = Message;
+}
+
+void FBenchmarkState::StartTiming()
+{
+    if (!bTiming)
+    {
+        bTiming = true;
+        StartCycles = FPlatformTime::Cycles64();
+    }
+}
+
+void FBenchmarkState::StopTiming()
+{
+    if (bTiming)
+    {
+        ElapsedCycles += FPlatformTime::Cycles64() - StartCycles;
+        bTiming = false;
+    }
+    bFinished = true;
+}
+
+double FBenchmarkState::GetElapsedNs() const
+{
+    return FPlatformTime::ToMilliseconds(ElapsedCycles) * 1.0e6;
+}
+
+
+FBenchmark::FBenchmark(const ANSICHAR* InName, FBenchmarkFunction InFunction)
+    : Name(InName)
+    , Function(InFunction)
+{
+}
+
+FBenchmark* FBenchmark::Arg(int64 InArg)
+{
+    Args.Add(InArg);
+    return this;
+}
+
+FBenchmark* FBenchmark::Range(int64 Low, int64 High, int64 Multiplier)
+{
+    for (int64 Value = Low; Value < High; Value *= std::max<int64>(Multiplier, 2))
+    {
+        Args.Add(Value);
+    }
+    Args.Add(High);
+    return this;
+}
+
+FString FBenchmark::GetCaseName(int32 ArgIndex) const
+{
+    if (Args.IsEmpty())
+    {
+        return Name;
+    }
+    return FString::Printf(TEXT("%s/%lld"), *Name, Args[ArgIndex]);
+}
+
+
+FBenchmark* FBenchmarkRegistry::Register(const ANSICHAR* Name, FBenchmarkFunction Function)
+{
+    FBenchmark* Benchmark = new FBenchmark(Name, Function);
+    GetBenchmarksMutable().Add(Benchmark);
+    return Benchmark;
+}
+
+TArray<FBenchmark*>& FBenchmarkRegistry::GetBenchmarksMutable()
+{
+    // 다른 번역 단위의 정적 초기화에서 등록되므로, 처음 사용할 때 생성합니다.
+    static TArray<FBenchmark*> Benchmarks;
+    return Benchmarks;
+}
+
+
+bool FBenchmarkRunner::RunBenchmarks(const FBenchmarkSettings& Settings, TArray<FBenchmarkResult>& OutResults)
+{
+    OutResults.Empty();
+
+    TArray<const FBenchmark*> Benchmarks;
+    for (const FBenchmark* Benchmark : FBenchmarkRegistry::GetBenchmarks())
+    {
+        if (Settings.Filter.IsEmpty() || Benchmark->GetName().Contains(Settings.Filter))
+        {
+            Benchmarks.Add(Benchmark);
+        }
+    }
+    std::ranges::sort(Benchmarks, [](const FBenchmark* A, const FBenchmark* B)
+    {
+        return A->GetName() < B->GetName();
+    });
+
+    if (Benchmarks.IsEmpty())
+    {
+        UE_LOG(ELogLevel::Warning, "Benchmark: no benchmark matches '%s'", *Settings.Filter);
+        return false;
+    }
+
+    UE_LOG(ELogLevel::Display, "Benchmark: running %d benchmarks (min time %.0f ms, %d repetitions)",
+        Benchmarks.Num(), Settings.MinTimeMs, Settings.Repetitions);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    for (const FBenchmark* Benchmark : Benchmarks)
+    {
+        for (int32 ArgIndex = 0; ArgIndex < Benchmark->GetNumCases(); ++ArgIndex)
+        {
+            OutResults.Add(RunCase(*Benchmark, ArgIndex, Settings));
+        }
+    }
+
+    int32 NumFailed = 0;
+    for (const FBenchmarkResult& Result : OutResults)
+    {
+        NumFailed += Result.Error.IsEmpty() ? 0 : 1;
+    }
+
+    int32 NumRegressed = 0;
+    if (!Settings.BaselinePath.IsEmpty() && std::ifstream(*Settings.BaselinePath).good())
+    {
+        NumRegressed = std::max(CompareWithBaseline(Settings.BaselinePath, Settings.RegressionThresholdPercent, OutResults), 0);
+    }
+
+    for (const FBenchmarkResult& Result : OutResults)
+    {
+        if (!Result.Error.IsEmpty())
+        {
+            UE_LOG(ELogLevel::Warning, "  %-40s skipped: %s", *Result.Name, *Result.Error);
+            continue;
+        }
+
+        FString Throughput;
+        if (Result.BytesPerSecond > 0.0)
+        {
+            Throughput = FString::Printf(TEXT(", %.1f MB/s"), Result.BytesPerSecond / (1024.0 * 1024.0));
+        }
+        else if (Result.ItemsPerSecond > 0.0)
+        {
+            Throughput = FString::Printf(TEXT(", %.2f M items/s"), Result.ItemsPerSecond * 1.0e-6);
+        }
+        if (!Result.Label.IsEmpty())
+        {
+            Throughput += FString::Printf(TEXT(", %s"), *Result.Label);
+        }
+
+        if (Result.BaselineNsPerOp > 0.0)
+        {
+            UE_LOG(Result.bRegressed ? ELogLevel::Error : ELogLevel::Display,
+                "  %-40s %12.1f ns (min %.1f, %lld iterations%s), baseline %.1f ns, %+.1f%%%s",
+                *Result.Name, Result.NsPerOp, Result.MinNsPerOp, Result.Iterations, *Throughput,
+                Result.BaselineNsPerOp, Result.ChangePercent, Result.bRegressed ? " REGRESSION" : "");
+        }
+        else
+        {
+            UE_LOG(ELogLevel::Display, "  %-40s %12.1f ns (min %.1f, %lld iterations%s)",
+                *Result.Name, Result.NsPerOp, Result.MinNsPerOp, Result.Iterations, *Throughput);
+        }
+    }
+
+    UE_LOG(NumRegressed + NumFailed > 0 ? ELogLevel::Warning : ELogLevel::Display,
+        "Benchmark: %d results in %.1f s, %d skipped, %d regressions (threshold %.0f%%)",
+        OutResults.Num(), FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / 1000.0,
+        NumFailed, NumRegressed, Settings.RegressionThresholdPercent);
+
+    if (!Settings.OutputPath.IsEmpty())
+    {
+        if (SaveResults(Settings.OutputPath, Settings, OutResults))
+        {
+            UE_LOG(ELogLevel::Display, "Benchmark: saved results to %s", *Settings.OutputPath);
+        }
+        else
+        {
+            UE_LOG(ELogLevel::Error, "Benchmark: failed to save results to %s", *Settings.OutputPath);
+        }
+    }
+
+    return NumRegressed == 0;
+}
+
+bool FBenchmarkRunner::SaveResults(const FString& Path, const FBenchmarkSettings& Settings, const TArray<FBenchmarkResult>& Results)
+{
+    const std::time_t Now = std::time(nullptr);
+    std::tm LocalTime = {};
+    localtime_s(&LocalTime, &Now);
+    char Date[32];
+    std::strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%S", &LocalTime);
+
+    try
+    {
+        json Json;
+        Json["context"] = {
+            { "date", Date },
+            { "executable", "EngineSIU" },
+            { "num_cpus", std::thread::hardware_concurrency() },
+#ifdef _DEBUG
+            { "library_build_type", "debug" },
+#else
+            { "library_build_type", "release" },
+#endif
+            { "math_isa", FMathKernels::GetISAName(FMathKernels::Get().ISA) },
+            { "min_time_ms", Settings.MinTimeMs },
+            { "repetitions", Settings.Repetitions },
+        };
+
+        json& Benchmarks = Json["benchmarks"];
+        Benchmarks = json::array();
+        for (const FBenchmarkResult& Result : Results)
+        {
+            json Entry = {
+                { "name", *Result.Name },
+                { "iterations", Result.Iterations },
+                { "real_time", Result.NsPerOp },
+                { "min_time", Result.MinNsPerOp },
+                { "max_time", Result.MaxNsPerOp },
+                { "time_unit", "ns" },
+            };
+            if (Result.ItemsPerSecond > 0.0)
+            {
+                Entry["items_per_second"] = Result.ItemsPerSecond;
+            }
+            if (Result.BytesPerSecond > 0.0)
+            {
+                Entry["bytes_per_second"] = Result.BytesPerSecond;
+            }
+            if (!Result.Label.IsEmpty())
+            {
+                Entry["label"] = *Result.Label;
+            }
+            if (!Result.Error.IsEmpty())
+            {
+                Entry["error_occurred"] = true;
+                Entry["error_message"] = *Result.Error;
+            }
+            if (Result.BaselineNsPerOp > 0.0)
+            {
+                Entry["baseline_time"] = Result.BaselineNsPerOp;
+                Entry["change_percent"] = Result.ChangePercent;
+                Entry["regressed"] = Result.bRegressed;
+            }
+            Benchmarks.push_back(std::move(Entry));
+        }
+
+        std::ofstream File(*Path);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        File << Json.dump(4);
+        return File.good();
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG(ELogLevel::Error, "Error writing benchmark JSON: %s", e.what());
+        return false;
+    }
+}
+
+int32 FBenchmarkRunner::CompareWithBaseline(const FString& Path, double ThresholdPercent, TArray<FBenchmarkResult>& InOutResults)
+{
+    TMap<FString, double> BaselineNsPerOp;
+    try
+    {
+        std::ifstream File(*Path);
+        if (!File.is_open())
+        {
+            UE_LOG(ELogLevel::Error, "Benchmark: failed to open baseline %s", *Path);
+            return -1;
+        }
+
+        const json Json = json::parse(File);
+        for (const json& Entry : Json.at("benchmarks"))
+        {
+            // 실패한 결과나 Google Benchmark의 mean/median 같은 집계 항목은 건너뜁니다.
+            if (Entry.value("error_occurred", false) || Entry.value("run_type", "iteration") != "iteration")
+            {
+                continue;
+            }
+
+            const std::string Name = Entry.at("name").get<std::string>();
+            const double RealTime = ToNanoseconds(Entry.at("real_time").get<double>(), Entry.value("time_unit", "ns"));
+            BaselineNsPerOp.Add(FString(Name.c_str()), RealTime);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG(ELogLevel::Error, "Error parsing benchmark baseline %s: %s", *Path, e.what());
+        return -1;
+    }
+
+    int32 NumRegressed = 0;
+    for (FBenchmarkResult& Result : InOutResults)
+    {
+        const double* Baseline = BaselineNsPerOp.Find(Result.Name);
+        if (!Baseline || *Baseline <= 0.0 || !Result.Error.IsEmpty())
+        {
+            continue;
+        }
+
+        Result.BaselineNsPerOp = *Baseline;
+        Result.ChangePercent = (Result.NsPerOp - *Baseline) / *Baseline * 100.0;
+        Result.bRegressed = Result.ChangePercent > ThresholdPercent;
+        NumRegressed += Result.bRegressed ? 1 : 0;
+    }
+    return NumRegressed;
+}
+
+FBenchmarkResult FBenchmarkRunner::RunCase(const FBenchmark& Benchmark, int32 ArgIndex, const FBenchmarkSettings& Settings)
+{
+    const int64 Arg = Benchmark.GetArgs().IsEmpty() ? 0 : Benchmark.GetArgs()[ArgIndex];
+    const double MinTimeNs = std::max(Settings.MinTimeMs, 0.0) * 1.0e6;
+
+    FBenchmarkResult Result;
+    Result.Name = Benchmark.GetCaseName(ArgIndex);
+
+    // 측정 시간이 MinTime을 넘을 때까지 반복 횟수를 늘립니다.
+    int64 Iterations = 1;
+    while (true)
+    {
+        const FBenchmarkState State = RunIterations(Benchmark, Arg, Iterations);
+        if (!State.Error.IsEmpty())
+        {
+            Result.Error = State.Error;
+            return Result;
+        }
+
+        const double ElapsedNs = State.GetElapsedNs();
+        if (ElapsedNs >= MinTimeNs || Iterations >= MaxIterations)
+        {
+            break;
+        }
+
+        // 남은 시간을 예측해 한 번에 늘리되, 측정 오차에 휘둘리지 않도록 배율을 제한합니다.
+        const double Multiplier = ElapsedNs > 0.0 ? std::clamp(MinTimeNs * 1.4 / ElapsedNs, 2.0, 10.0) : 10.0;
+        Iterations = std::min(static_cast<int64>(static_cast<double>(Iterations) * Multiplier), MaxIterations);
+    }
+
+    TArray<double> Samples;
+    int64 ItemsProcessed = 0;
+    int64 BytesProcessed = 0;
+    for (int32 Repetition = 0; Repetition < std::max(Settings.Repetitions, 1); ++Repetition)
+    {
+        const FBenchmarkState State = RunIterations(Benchmark, Arg, Iterations);
+        Samples.Add(State.GetElapsedNs() / static_cast<double>(Iterations));
+        ItemsProcessed = State.ItemsProcessed;
+        BytesProcessed = State.BytesProcessed;
+        Result.Label = State.Label;
+    }
+    Samples.Sort();
+
+    Result.Iterations = Iterations;
+    Result.NsPerOp = Samples[Samples.Num() / 2];
+    Result.MinNsPerOp = Samples[0];
+    Result.MaxNsPerOp = Samples[Samples.Num() - 1];
+
+    // 처리량은 중앙값 시간 기준입니다.
+    const double Seconds = Result.NsPerOp * static_cast<double>(Iterations) * 1.0e-9;
+    if (Seconds > 0.0)
+    {
+        Result.ItemsPerSecond = static_cast<double>(ItemsProcessed) / Seconds;
+        Result.BytesPerSecond = static_cast<double>(BytesProcessed) / Seconds;
+    }
+    return Result;
+}
+
+FBenchmarkState FBenchmarkRunner::RunIterations(const FBenchmark& Benchmark, int64 Arg, int64 Iterations)
+{
+    FBenchmarkState State(Arg, Iterations);
+    Benchmark.GetFunction()(State);
+
+    if (State.Error.IsEmpty() && !State.bFinished)
+    {
+        State.Error = TEXT("benchmark did not iterate over its state");
+    }
+    return State;
+}
@@ -0,0 +1,256 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+
+class FBenchmarkState;
+
+using FBenchmarkFunction = void(*)(FBenchmarkState& State);
+
+
+/**
+ * Benchmark 함수가 측정할 반복을 받는 객체
+ *
+ * 아래처럼 측정할 코드만 반복문 안에 둡니다. 반복 횟수는 Runner가 측정 시간이 MinTimeMs를 넘도록 정합니다.
+ *
+ *     void BM_Example(FBenchmarkState& State)
+ *     {
+ *         // 준비 코드는 측정되지 않습니다.
+ *         for (auto _ : State)
+ *         {
+ *             DoNotOptimize(Work());
+ *         }
+ *     }
+ *     BENCHMARK(BM_Example)->Arg(64)->Arg(4096);
+ */
+class FBenchmarkState
+{
+public:
+    struct FIterator
+    {
+        FBenchmarkState* State;
+        int64 Remaining;
+
+        int32 operator*() const { return 0; }
+        void operator++() { --Remaining; }
+
+        bool operator!=(const FIterator&)
+        {
+            if (Remaining > 0)
+            {
+                return true;
+            }
+            State->StopTiming();
+            return false;
+        }
+    };
+
+    FBenchmarkState(int64 InArg, int64 InMaxIterations);
+
+    /** 측정을 시작합니다. range-for로 순회합니다. */
+    FIterator begin();
+    FIterator end() { return FIterator{ this, 0 }; }
+
+    /** begin/end 대신 while (State.KeepRunning())로 반복할 수도 있습니다. */
+    bool KeepRunning();
+
+    /** Arg나 Range로 등록한 인자, 등록하지 않았으면 0 */
+    int64 GetArg() const { return Arg; }
+
+    /** 이번 측정의 반복 횟수 */
+    int64 GetIterations() const { return MaxIterations; }
+
+    /** 반복 안에서 측정하지 않을 구간을 감쌉니다. 호출 자체의 비용이 있으므로 짧은 구간에는 쓰지 않습니다. */
+    void PauseTiming();
+    void ResumeTiming();
+
+    /** 처리한 요소 수나 바이트 수, 결과에 초당 처리량으로 함께 기록됩니다. */
+    void SetItemsProcessed(int64 InItems) { ItemsProcessed = InItems; }
+    void SetBytesProcessed(int64 InBytes) { BytesProcessed = InBytes; }
+
+    /** 결과에 함께 출력할 짧은 설명, 정확도처럼 시간 외에 비교할 값을 남깁니다. */
+    void SetLabel(const FString& InLabel) { Label = InLabel; }
+
+    /** 측정할 수 없는 상황(Asset 없음 등)에서 반복문에 들어가기 전에 호출합니다. 결과에 Error로 기록됩니다. */
+    void SkipWithError(const FString& Message);
+
+private:
+    friend class FBenchmarkRunner;
+
+    void StartTiming();
+    void StopTiming();
+
+    double GetElapsedNs() const;
+
+    int64 Arg;
+    int64 MaxIterations;
+    int64 KeepRunningRemaining = -1;
+
+    uint64 StartCycles = 0;
+    uint64 ElapsedCycles = 0;
+    bool bTiming = false;
+    bool bFinished = false;
+
+    int64 ItemsProcessed = 0;
+    int64 BytesProcessed = 0;
+
+    FString Label;
+    FString Error;
+};
+
+
+/** BENCHMARK로 등록된 함수 하나 */
+class FBenchmark
+{
+public:
+    FBenchmark(const ANSICHAR* InName, FBenchmarkFunction InFunction);
+
+    /** State.GetArg()로 받을 인자를 추가합니다. 인자마다 "Name/Arg"라는 이름으로 따로 측정합니다. */
+    FBenchmark* Arg(int64 InArg);
+
+    /** Low부터 High까지 Multiplier배씩 늘린 인자와 High를 추가합니다. */
+    FBenchmark* Range(int64 Low, int64 High, int64 Multiplier = 8);
+
+    const FString& GetName() const { return Name; }
+    FBenchmarkFunction GetFunction() const { return Function; }
+    const TArray<int64>& GetArgs() const { return Args; }
+
+    /** 인자를 붙인 측정 이름 */
+    FString GetCaseName(int32 ArgIndex) const;
+
+    /** 측정할 경우의 수, 인자가 없으면 1 */
+    int32 GetNumCases() const { return Args.IsEmpty() ? 1 : Args.Num(); }
+
+private:
+    FString Name;
+    FBenchmarkFunction Function;
+    TArray<int64> Args;
+};
+
+
+/** 등록된 Benchmark 목록, 정적 초기화 중에 BENCHMARK가 등록합니다. */
+class FBenchmarkRegistry
+{
+public:
+    static FBenchmark* Register(const ANSICHAR* Name, FBenchmarkFunction Function);
+
+    static const TArray<FBenchmark*>& GetBenchmarks() { return GetBenchmarksMutable(); }
+
+private:
+    static TArray<FBenchmark*>& GetBenchmarksMutable();
+};
+
+
+#define BENCHMARK_PRIVATE_CONCAT_INNER(A, B) A##B
+#define BENCHMARK_PRIVATE_CONCAT(A, B) BENCHMARK_PRIVATE_CONCAT_INNER(A, B)
+
+/** FBenchmarkState&를 받는 함수를 Benchmark로 등록합니다. 뒤에 ->Arg(N), ->Range(Low, High)를 이어 붙일 수 있습니다. */
+#define BENCHMARK(Function) \
+    static FBenchmark* BENCHMARK_PRIVATE_CONCAT(GBenchmark_, __LINE__) = FBenchmarkRegistry::Register(#Function, Function)
+
+
+/**
+ * 컴파일러가 Value를 계산하는 코드를 지우지 못하도록 Value를 메모리에 남깁니다.
+ * 주소만 넘기면 지역 변수의 값은 쓰이지 않는 것으로 보고 지울 수 있으므로, 메모리 Barrier로 값을 읽는 것처럼 보이게 합니다.
+ */
+extern const void* volatile GBenchmarkSink;
+
+template <typename T>
+FORCEINLINE void DoNotOptimize(const T& Value)
+{
+    GBenchmarkSink = &Value;
+#if defined(_MSC_VER) && !defined(__clang__)
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : : "memory");
+#endif
+}
+
+
+/** Benchmark 한 경우의 결과, 시간은 모두 반복 한 번당 ns입니다. */
+struct FBenchmarkResult
+{
+    FString Name;
+    int64 Iterations = 0;
+
+    /** Repetitions번 측정한 값의 중앙값, 최소값, 최대값 */
+    double NsPerOp = 0.0;
+    double MinNsPerOp = 0.0;
+    double MaxNsPerOp = 0.0;
+
+    double ItemsPerSecond = 0.0;
+    double BytesPerSecond = 0.0;
+
+    /** FBenchmarkState::SetLabel로 남긴 설명 */
+    FString Label;
+
+    /** 비어있지 않으면 측정하지 못한 이유 */
+    FString Error;
+
+    /** Baseline에 같은 이름이 있으면 그 NsPerOp, 없으면 0 */
+    double BaselineNsPerOp = 0.0;
+
+    /** Baseline보다 느려진 비율(%), 음수면 빨라진 것입니다. */
+    double ChangePercent = 0.0;
+    bool bRegressed = false;
+};
+
+
+struct FBenchmarkSettings
+{
+    /** 경로를 지정하지 않았을 때 결과와 Baseline을 저장하는 경로 */
+    static constexpr const ANSICHAR* DefaultOutputPath = "Saved/Benchmark.json";
+    static constexpr const ANSICHAR* DefaultBaselinePath = "Saved/BenchmarkBaseline.json";
+
+    /** 이름에 이 문자열이 들어간 Benchmark만 실행합니다. 대소문자를 구분하지 않으며, 비어있으면 모두 실행합니다. */
+    FString Filter;
+
+    /** 한 번 측정할 때 최소한 돌아야 하는 시간, 반복 횟수는 이 시간을 넘도록 늘어납니다. */
+    double MinTimeMs = 50.0;
+
+    /** 같은 반복 횟수로 측정하는 횟수, 중앙값을 결과로 씁니다. */
+    int32 Repetitions = 3;
+
+    /** 결과를 저장할 JSON 경로, 비어있으면 저장하지 않습니다. */
+    FString OutputPath;
+
+    /** 비교할 이전 결과 JSON 경로, 비어있거나 파일이 없으면 비교하지 않습니다. */
+    FString BaselinePath;
+
+    /** Baseline보다 이 비율(%) 이상 느려지면 Regression으로 표시합니다. */
+    double RegressionThresholdPercent = 10.0;
+};
+
+
+/**
+ * 등록된 Benchmark를 측정합니다.
+ *
+ * - 반복 횟수를 1부터 늘려가며 MinTimeMs를 넘는 횟수를 찾은 뒤, 그 횟수로 Repetitions번 측정합니다.
+ * - 결과는 Google Benchmark와 같은 형식의 JSON으로 저장하므로, 같은 형식의 Baseline과 비교할 수 있습니다.
+ * - Benchmark는 게임 스레드에서 차례로 실행되며, 실행 중에는 프레임이 멈춥니다.
+ */
+class FBenchmarkRunner
+{
+public:
+    /**
+     * Settings에 맞는 Benchmark를 모두 실행하고 결과를 Console에 출력합니다.
+     * @return Regression으로 표시된 Benchmark가 없으면 true, 건너뛴 Benchmark는 결과에 영향을 주지 않습니다.
+     */
+    static bool RunBenchmarks(const FBenchmarkSettings& Settings, TArray<FBenchmarkResult>& OutResults);
+
+    static bool SaveResults(const FString& Path, const FBenchmarkSettings& Settings, const TArray<FBenchmarkResult>& Results);
+
+    /** Baseline JSON을 읽어 Results의 Baseline 항목을 채웁니다. Regression 수를 반환하고, 읽지 못하면 -1을 반환합니다. */
+    static int32 CompareWithBaseline(const FString& Path, double ThresholdPercent, TArray<FBenchmarkResult>& InOutResults);
+
+private:
+    static FBenchmarkResult RunCase(const FBenchmark& Benchmark, int32 ArgIndex, const FBenchmarkSettings& Settings);
+
+    /** Benchmark 함수를 Iterations번 반복하도록 한 번 호출합니다. */
+    static FBenchmarkState RunIterations(const FBenchmark& Benchmark, int64 Arg, int64 Iterations);
+};
@@ -0,0 +1,93 @@
+#include "ClassCastBenchmark.h"
+#include <algorithm>
+
+#include "WindowsPlatformTime.h"
+#include "UObject/Class.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+template <typename FuncType>
+double MeasureMilliseconds(int32 NumIterations, FuncType&& Func)
+{
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        Func();
+    }
+    return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+}
+
+
+void RunClassCastBenchmark(int32 NumIterations)
+{
+    TArray<const UClass*> Classes;
+    Classes.Add(UObject::StaticClass());
+    for (const auto& [ClassName, Class] : UClass::GetClassMap())
+    {
+        Classes.AddUnique(Class);
+    }
+
+    uint32 MaxDepth = 0;
+    for (const UClass* Class : Classes)
+    {
+        MaxDepth = std::max(MaxDepth, Class->GetClassDepth());
+    }
+
+    // 두 방식의 결과가 같은지 먼저 확인합니다.
+    int32 NumMismatches = 0;
+    int32 NumChildPairs = 0;
+    for (const UClass* Class : Classes)
+    {
+        for (const UClass* Base : Classes)
+        {
+            const bool bFast = Class->IsChildOf(Base);
+            NumChildPairs += bFast ? 1 : 0;
+            NumMismatches += bFast != Class->IsChildOfBySuperChain(Base) ? 1 : 0;
+        }
+    }
+
+    // 컴파일러가 검사를 제거하지 못하도록 결과를 누적합니다.
+    volatile int32 Sink = 0;
+
+    const double SuperChainMs = MeasureMilliseconds(NumIterations, [&]()
+    {
+        int32 Count = 0;
+        for (const UClass* Class : Classes)
+        {
+            for (const UClass* Base : Classes)
+            {
+                Count += Class->IsChildOfBySuperChain(Base) ? 1 : 0;
+            }
+        }
+        Sink = Sink + Count;
+    });
+
+    const double BaseChainMs = MeasureMilliseconds(NumIterations, [&]()
+    {
+        int32 Count = 0;
+        for (const UClass* Class : Classes)
+        {
+            for (const UClass* Base : Classes)
+            {
+                Count += Class->IsChildOf(Base) ? 1 : 0;
+            }
+        }
+        Sink = Sink + Count;
+    });
+
+    const double NumChecks = static_cast<double>(Classes.Num()) * Classes.Num() * NumIterations;
+
+    UE_LOG(ELogLevel::Display, "IsChildOf Benchmark: %d classes (max depth %u), %d child pairs, %d iterations",
+        Classes.Num(), MaxDepth, NumChildPairs, NumIterations);
+    UE_LOG(ELogLevel::Display, "  SuperChain: %.3f ms (%.2f ns/check)", SuperChainMs, SuperChainMs * 1.0e6 / NumChecks);
+    UE_LOG(ELogLevel::Display, "  BaseChain : %.3f ms (%.2f ns/check), x%.2f",
+        BaseChainMs, BaseChainMs * 1.0e6 / NumChecks, BaseChainMs > 0.0 ? SuperChainMs / BaseChainMs : 0.0);
+
+    if (NumMismatches > 0)
+    {
+        UE_LOG(ELogLevel::Error, "IsChildOf Benchmark: %d mismatches between BaseChain and SuperChain", NumMismatches);
+    }
+}
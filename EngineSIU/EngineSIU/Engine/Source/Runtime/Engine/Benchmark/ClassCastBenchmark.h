@@ -0,0 +1,11 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 엔진에 등록된 모든 클래스 쌍에 대해 UClass::IsChildOf(조상 테이블)와 IsChildOfBySuperChain(SuperClass 순회)을 비교합니다.
+ * 두 결과가 모두 같은지 검증한 뒤, 각각의 수행 시간을 Console에 출력합니다.
+ *
+ * @param NumIterations 모든 클래스 쌍을 검사하는 횟수
+ */
+void RunClassCastBenchmark(int32 NumIterations = 200);
@@ -0,0 +1,190 @@
+#include "Benchmark.h"
+#include <random>
+
+#include "Math/JungleCollision.h"
+#include "Math/Quat.h"
+#include "Math/Rotator.h"
+
+
+namespace
+{
+/** 입력 배열의 크기, 충돌하는 쌍과 충돌하지 않는 쌍이 섞이도록 좁은 공간에 배치합니다. */
+constexpr int32 NumInputs = 1024;
+constexpr int32 InputMask = NumInputs - 1;
+
+struct FCollisionInputs
+{
+    TArray<FRay> Rays;
+    TArray<FBox> Boxes;
+    TArray<FSphere> Spheres;
+    TArray<FCapsule> Capsules;
+    TArray<FOrientedBox> OrientedBoxes;
+
+    FCollisionInputs()
+    {
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> Position(-10.f, 10.f);
+        std::uniform_real_distribution<float> Size(0.5f, 3.f);
+        std::uniform_real_distribution<float> Angle(-180.f, 180.f);
+
+        for (int32 Index = 0; Index < NumInputs; ++Index)
+        {
+            const FVector Center(Position(Random), Position(Random), Position(Random));
+            const FVector Extent(Size(Random), Size(Random), Size(Random));
+
+            // 원점 근처에서 출발해 임의의 방향으로 향하는 Ray
+            const FVector Direction = FVector(Position(Random), Position(Random), Position(Random)).GetSafeNormal();
+            Rays.Add(FRay{ Center * -2.f, Direction });
+
+            Boxes.Add(FBox{ Center - Extent, Center + Extent });
+            Spheres.Add(FSphere{ Center, Extent.X });
+            Capsules.Add(FCapsule{ Center - Extent, Center + Extent, Extent.Z * 0.5f });
+
+            const FQuat Rotation = FQuat(FRotator(Angle(Random), Angle(Random), Angle(Random))).GetNormalized();
+            OrientedBoxes.Add(FOrientedBox{
+                Rotation.RotateVector(FVector::ForwardVector),
+                Rotation.RotateVector(FVector::RightVector),
+                Rotation.RotateVector(FVector::UpVector),
+                Center, Extent.X, Extent.Y, Extent.Z
+            });
+        }
+    }
+};
+
+const FCollisionInputs& GetCollisionInputs()
+{
+    static const FCollisionInputs Inputs;
+    return Inputs;
+}
+}
+
+
+static void BM_Collision_RayAABB(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        float T;
+        NumHits += JungleCollision::RayIntersectsAABB(Inputs.Rays[Index], Inputs.Boxes[(Index + 1) & InputMask], &T) ? 1 : 0;
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_RayAABB);
+
+static void BM_Collision_RaySphere(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        float T;
+        NumHits += JungleCollision::RayIntersectsSphere(Inputs.Rays[Index], Inputs.Spheres[(Index + 1) & InputMask], &T) ? 1 : 0;
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_RaySphere);
+
+static void BM_Collision_RayCapsule(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        float T;
+        NumHits += JungleCollision::RayIntersectsCapsule(Inputs.Rays[Index], Inputs.Capsules[(Index + 1) & InputMask], &T) ? 1 : 0;
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_RayCapsule);
+
+static void BM_Collision_RayOrientedBox(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        float T;
+        NumHits += JungleCollision::RayIntersectsOrientedBox(Inputs.Rays[Index], Inputs.OrientedBoxes[(Index + 1) & InputMask], &T) ? 1 : 0;
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_RayOrientedBox);
+
+static void BM_Collision_SphereAABB(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        NumHits += JungleCollision::Intersects(Inputs.Spheres[Index], Inputs.Boxes[(Index + 1) & InputMask]) ? 1 : 0;
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_SphereAABB);
+
+static void BM_Collision_CapsuleCapsule(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        JungleCollision::FCapsuleContactResult Contact;
+        NumHits += JungleCollision::Intersects(Inputs.Capsules[Index], Inputs.Capsules[(Index + 1) & InputMask], &Contact) ? 1 : 0;
+        DoNotOptimize(Contact);
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_CapsuleCapsule);
+
+static void BM_Collision_OrientedBoxOrientedBox(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        JungleCollision::FBoxContactResult Contact;
+        NumHits += JungleCollision::Intersects(Inputs.OrientedBoxes[Index], Inputs.OrientedBoxes[(Index + 1) & InputMask], &Contact) ? 1 : 0;
+        DoNotOptimize(Contact);
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_OrientedBoxOrientedBox);
+
+static void BM_Collision_CapsuleOrientedBox(FBenchmarkState& State)
+{
+    const FCollisionInputs& Inputs = GetCollisionInputs();
+    int32 Index = 0;
+    int32 NumHits = 0;
+    for (auto _ : State)
+    {
+        JungleCollision::FCapsuleBoxContactResult Contact;
+        NumHits += JungleCollision::Intersects(Inputs.Capsules[Index], Inputs.OrientedBoxes[(Index + 1) & InputMask], &Contact) ? 1 : 0;
+        DoNotOptimize(Contact);
+        Index = (Index + 1) & InputMask;
+    }
+    DoNotOptimize(NumHits);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Collision_CapsuleOrientedBox);
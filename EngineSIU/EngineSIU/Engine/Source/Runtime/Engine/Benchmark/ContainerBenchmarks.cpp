@@ -0,0 +1,311 @@
+#include "Benchmark.h"
+#include <random>
+
+#include "Container/Map.h"
+#include "UObject/NameTypes.h"
+
+
+namespace
+{
+/** 0부터 Num-1까지를 섞은 배열, 검색 순서가 삽입 순서와 같지 않도록 합니다. */
+TArray<int32> MakeShuffledKeys(int32 Num)
+{
+    TArray<int32> Keys;
+    Keys.Reserve(Num);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Keys.Add(Index * 7919);
+    }
+
+    std::mt19937 Random(1234);
+    for (int32 Index = Num - 1; Index > 0; --Index)
+    {
+        std::swap(Keys[Index], Keys[std::uniform_int_distribution<int32>(0, Index)(Random)]);
+    }
+    return Keys;
+}
+
+/** Actor나 Component 이름과 비슷한 길이의 서로 다른 문자열 */
+TArray<FString> MakeNames(int32 Num)
+{
+    TArray<FString> Names;
+    Names.Reserve(Num);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Names.Add(FString::Printf(TEXT("BenchmarkComponent%dMesh"), Index));
+    }
+    return Names;
+}
+}
+
+
+static void BM_Array_Add(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    for (auto _ : State)
+    {
+        TArray<int32> Array;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Array.Add(Index);
+        }
+        DoNotOptimize(Array.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * Num);
+}
+BENCHMARK(BM_Array_Add)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_Array_Find(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    TArray<int32> Array = MakeShuffledKeys(Num);
+    const TArray<int32> Keys = MakeShuffledKeys(Num);
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        DoNotOptimize(Array.Find(Keys[Index]));
+        Index = Index + 1 < Num ? Index + 1 : 0;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Array_Find)->Arg(16)->Arg(256)->Arg(4096);
+
+static void BM_Array_Sort(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const TArray<int32> Keys = MakeShuffledKeys(Num);
+    for (auto _ : State)
+    {
+        // 복사 비용도 함께 측정되지만, 정렬에 비하면 작습니다.
+        TArray<int32> Array = Keys;
+        Array.Sort();
+        DoNotOptimize(Array.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * Num);
+}
+BENCHMARK(BM_Array_Sort)->Arg(1024)->Arg(65536);
+
+static void BM_Map_Add(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const TArray<int32> Keys = MakeShuffledKeys(Num);
+    for (auto _ : State)
+    {
+        TMap<int32, int32> Map;
+        for (int32 Key : Keys)
+        {
+            Map.Add(Key, Key);
+        }
+        DoNotOptimize(Map.Num());
+    }
+    State.SetItemsProcessed(State.GetIterations() * Num);
+}
+BENCHMARK(BM_Map_Add)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_Map_Find(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const TArray<int32> Keys = MakeShuffledKeys(Num);
+    TMap<int32, int32> Map;
+    for (int32 Key : Keys)
+    {
+        Map.Add(Key, Key);
+    }
+
+    // 절반은 없는 Key를 찾습니다.
+    int32 Index = 0;
+    int32 NumFound = 0;
+    for (auto _ : State)
+    {
+        NumFound += Map.Find(Keys[Index] + (Index & 1)) ? 1 : 0;
+        Index = Index + 1 < Num ? Index + 1 : 0;
+    }
+    DoNotOptimize(NumFound);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Map_Find)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_Map_FindString(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const TArray<FString> Names = MakeNames(Num);
+    TMap<FString, int32> Map;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Map.Add(Names[Index], Index);
+    }
+
+    int32 Index = 0;
+    int32 NumFound = 0;
+    for (auto _ : State)
+    {
+        NumFound += Map.Find(Names[Index]) ? 1 : 0;
+        Index = Index + 1 < Num ? Index + 1 : 0;
+    }
+    DoNotOptimize(NumFound);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Map_FindString)->Arg(1024);
+
+static void BM_Map_FindName(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const TArray<FString> Names = MakeNames(Num);
+    TArray<FName> Keys;
+    TMap<FName, int32> Map;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Keys.Add(FName(Names[Index]));
+        Map.Add(Keys[Index], Index);
+    }
+
+    int32 Index = 0;
+    int32 NumFound = 0;
+    for (auto _ : State)
+    {
+        NumFound += Map.Find(Keys[Index]) ? 1 : 0;
+        Index = Index + 1 < Num ? Index + 1 : 0;
+    }
+    DoNotOptimize(NumFound);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Map_FindName)->Arg(1024);
+
+static void BM_String_Printf(FBenchmarkState& State)
+{
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FString Result = FString::Printf(TEXT("StaticMeshComponent_%d (%.2f, %.2f)"), Index, 1.5f, -3.25f);
+        DoNotOptimize(Result);
+        ++Index;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_String_Printf);
+
+static void BM_String_Append(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    const FString Piece = TEXT("Contents/Meshes/");
+    for (auto _ : State)
+    {
+        FString Result;
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Result += Piece;
+        }
+        DoNotOptimize(Result);
+    }
+    State.SetBytesProcessed(State.GetIterations() * Num * Piece.Len());
+}
+BENCHMARK(BM_String_Append)->Arg(16)->Arg(1024);
+
+static void BM_String_Find(FBenchmarkState& State)
+{
+    const FString Path = TEXT("Contents/Characters/Mannequin/Meshes/SK_Mannequin_Skeleton.fbx");
+    const FString SubStr = TEXT("skeleton");
+    for (auto _ : State)
+    {
+        DoNotOptimize(Path.Find(SubStr, ESearchCase::IgnoreCase));
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_String_Find);
+
+static void BM_String_EqualsIgnoreCase(FBenchmarkState& State)
+{
+    const FString A = TEXT("Contents/Characters/Mannequin/Meshes/SK_Mannequin.fbx");
+    const FString B = TEXT("contents/characters/mannequin/meshes/sk_mannequin.FBX");
+    for (auto _ : State)
+    {
+        DoNotOptimize(A.Equals(B, ESearchCase::IgnoreCase));
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_String_EqualsIgnoreCase);
+
+static void BM_String_ToLower(FBenchmarkState& State)
+{
+    const FString Path = TEXT("Contents/Characters/Mannequin/Meshes/SK_Mannequin.fbx");
+    for (auto _ : State)
+    {
+        const FString Result = Path.ToLower();
+        DoNotOptimize(Result);
+    }
+    State.SetBytesProcessed(State.GetIterations() * Path.Len());
+}
+BENCHMARK(BM_String_ToLower);
+
+/** 이미 Pool에 있는 문자열로 FName을 만듭니다. Asset 경로나 Property 이름을 찾는 경우입니다. */
+static void BM_FName_Find(FBenchmarkState& State)
+{
+    constexpr int32 Num = 1024;
+    const TArray<FString> Names = MakeNames(Num);
+    for (const FString& Name : Names)
+    {
+        FName Registered(Name);
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FName Name(*Names[Index]);
+        DoNotOptimize(Name);
+        Index = (Index + 1) & (Num - 1);
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_FName_Find);
+
+/**
+ * "Actor_12"처럼 숫자가 붙은 새 이름을 만듭니다. ConstructObject가 이름을 붙이는 경우입니다.
+ * 숫자는 Number로 분리되므로 Pool이 커지지 않습니다. 숫자 없는 새 문자열은 Pool에서 지워지지 않아 반복 측정하지 않습니다.
+ */
+static void BM_FName_CreateNumbered(FBenchmarkState& State)
+{
+    static int32 NextNumber = 1;
+    for (auto _ : State)
+    {
+        const FString Name = FString::Printf(TEXT("StaticMeshComponent_%d"), NextNumber++);
+        const FName Result(Name);
+        DoNotOptimize(Result);
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_FName_CreateNumbered);
+
+static void BM_FName_Compare(FBenchmarkState& State)
+{
+    constexpr int32 Num = 1024;
+    const TArray<FString> Strings = MakeNames(Num);
+    TArray<FName> Names;
+    for (const FString& String : Strings)
+    {
+        Names.Add(FName(String));
+    }
+
+    int32 Index = 0;
+    int32 NumEqual = 0;
+    for (auto _ : State)
+    {
+        NumEqual += Names[Index] == Names[(Index * 7) & (Num - 1)] ? 1 : 0;
+        Index = (Index + 1) & (Num - 1);
+    }
+    DoNotOptimize(NumEqual);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_FName_Compare);
+
+static void BM_FName_ToString(FBenchmarkState& State)
+{
+    const FName Name(TEXT("StaticMeshComponent_42"));
+    for (auto _ : State)
+    {
+        const FString Result = Name.ToString();
+        DoNotOptimize(Result);
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_FName_ToString);
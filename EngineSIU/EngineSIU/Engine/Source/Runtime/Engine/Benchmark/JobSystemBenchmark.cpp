@@ -0,0 +1,230 @@
+#include "JobSystemBenchmark.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+double MillisecondsSince(uint64 StartCycles)
+{
+    return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+void LogResult(const char* Name, double Milliseconds, bool bValid, const char* Extra = "")
+{
+    UE_LOG(
+        bValid ? ELogLevel::Display : ELogLevel::Error,
+        "  %-28s %9.3f ms%s%s", Name, Milliseconds, Extra, bValid ? "" : "  [INVALID]"
+    );
+}
+
+/** 빈 Job을 NumJobs개 만들고 모두 끝날 때까지 기다립니다. */
+void BenchmarkThroughput(int32 NumJobs)
+{
+    FJobSystem& JobSystem = FJobSystem::Get();
+
+    std::atomic<int32> NumExecuted = 0;
+    TArray<FJobHandle> Handles;
+    Handles.Reserve(NumJobs);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Index = 0; Index < NumJobs; ++Index)
+    {
+        Handles.Add(JobSystem.Launch([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    JobSystem.WaitAll(Handles);
+    const double Milliseconds = MillisecondsSince(StartCycles);
+
+    char Extra[64];
+    snprintf(Extra, sizeof(Extra), "  %7.3f us/job", Milliseconds * 1000.0 / NumJobs);
+    LogResult("Launch + WaitAll", Milliseconds, NumExecuted.load() == NumJobs, Extra);
+
+    // 비교 기준: 이전의 Job마다 std::thread를 만드는 방식, 너무 느리므로 개수를 줄여서 측정합니다.
+    const int32 NumThreads = std::min(NumJobs, 256);
+    NumExecuted = 0;
+
+    const uint64 ThreadStartCycles = FPlatformTime::Cycles64();
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads);
+    for (int32 Index = 0; Index < NumThreads; ++Index)
+    {
+        Threads.emplace_back([&NumExecuted]() { NumExecuted.fetch_add(1, std::memory_order_relaxed); });
+    }
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+    const double ThreadMilliseconds = MillisecondsSince(ThreadStartCycles);
+
+    snprintf(Extra, sizeof(Extra), "  %7.3f us/job (%d jobs)", ThreadMilliseconds * 1000.0 / NumThreads, NumThreads);
+    LogResult("std::thread per job", ThreadMilliseconds, NumExecuted.load() == NumThreads, Extra);
+}
+
+/** 선행 Job이 모두 끝난 뒤에만 실행되는지 Chain과 Fan-out/Fan-in 그래프로 확인합니다. */
+void BenchmarkDependencies(int32 NumJobs)
+{
+    FJobSystem& JobSystem = FJobSystem::Get();
+
+    // Chain: 각 Job은 이전 Job이 끝난 뒤에 실행되어야 합니다.
+    {
+        const int32 ChainLength = std::max(1, NumJobs / 10);
+        std::atomic<int32> Order = 0;
+        std::atomic<bool> bInOrder = true;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FJobHandle Previous;
+        for (int32 Index = 0; Index < ChainLength; ++Index)
+        {
+            Previous = JobSystem.Launch([&Order, &bInOrder, Index]()
+            {
+                if (Order.fetch_add(1, std::memory_order_relaxed) != Index)
+                {
+                    bInOrder = false;
+                }
+            }, { Previous });
+        }
+        Previous.Wait();
+
+        LogResult("Dependency chain", MillisecondsSince(StartCycles), bInOrder && Order.load() == ChainLength);
+    }
+
+    // Fan-out/Fan-in: Root -> N개의 Job -> Join
+    {
+        const int32 Width = std::max(1, NumJobs / 10);
+        std::atomic<bool> bRootDone = false;
+        std::atomic<int32> NumBranches = 0;
+        int32 NumBranchesAtJoin = 0;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FJobHandle Root = JobSystem.Launch([&bRootDone]() { bRootDone = true; });
+
+        TArray<FJobHandle> Branches;
+        Branches.Reserve(Width);
+        for (int32 Index = 0; Index < Width; ++Index)
+        {
+            Branches.Add(Root.Then([&bRootDone, &NumBranches]()
+            {
+                if (bRootDone)
+                {
+                    NumBranches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }));
+        }
+        JobSystem.Launch([&NumBranches, &NumBranchesAtJoin]() { NumBranchesAtJoin = NumBranches.load(); }, Branches).Wait();
+
+        LogResult("Fan-out / fan-in", MillisecondsSince(StartCycles), NumBranchesAtJoin == Width);
+    }
+
+    // GameThread Continuation은 게임 스레드에서만 실행되어야 합니다.
+    if (JobSystem.IsInGameThread())
+    {
+        bool bOnGameThread = false;
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        FJobHandle Continuation = JobSystem.Launch([]() {}).Then([&bOnGameThread]()
+        {
+            bOnGameThread = FJobSystem::Get().IsInGameThread();
+        }, EJobThread::GameThread);
+
+        // 게임 스레드에서 기다리면 GameThread Job도 함께 처리됩니다.
+        Continuation.Wait();
+
+        LogResult("Game thread continuation", MillisecondsSince(StartCycles), bOnGameThread);
+    }
+}
+
+/** 같은 연산을 단일 스레드와 GrainSize별 ParallelFor로 실행해 비교합니다. */
+void BenchmarkParallelFor(int32 NumElements)
+{
+    std::vector<float> Input(NumElements);
+    for (int32 Index = 0; Index < NumElements; ++Index)
+    {
+        Input[Index] = static_cast<float>(Index % 1024) * 0.01f;
+    }
+    std::vector<float> Output(NumElements);
+
+    auto Kernel = [&Input, &Output](int32 Index)
+    {
+        const float Value = Input[Index];
+        Output[Index] = std::sqrt(Value * Value + 1.0f) * std::sin(Value);
+    };
+
+    auto Checksum = [&Output]()
+    {
+        double Sum = 0.0;
+        for (float Value : Output)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    const uint64 SerialStartCycles = FPlatformTime::Cycles64();
+    for (int32 Index = 0; Index < NumElements; ++Index)
+    {
+        Kernel(Index);
+    }
+    const double SerialMilliseconds = MillisecondsSince(SerialStartCycles);
+    const double Expected = Checksum();
+    LogResult("Serial", SerialMilliseconds, true);
+
+    const int32 GrainSizes[] = { 0, 64, 1024, 16384 };
+    for (int32 GrainSize : GrainSizes)
+    {
+        std::fill(Output.begin(), Output.end(), 0.0f);
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        ParallelFor(NumElements, Kernel, GrainSize);
+        const double Milliseconds = MillisecondsSince(StartCycles);
+
+        char Name[64];
+        if (GrainSize > 0)
+        {
+            snprintf(Name, sizeof(Name), "ParallelFor (grain %d)", GrainSize);
+        }
+        else
+        {
+            snprintf(Name, sizeof(Name), "ParallelFor (grain auto)");
+        }
+
+        char Extra[32];
+        snprintf(Extra, sizeof(Extra), "  x%.2f", Milliseconds > 0.0 ? SerialMilliseconds / Milliseconds : 0.0);
+        LogResult(Name, Milliseconds, Checksum() == Expected, Extra);
+    }
+}
+}
+
+
+void RunJobSystemBenchmark(int32 NumJobs, int32 NumElements)
+{
+    FJobSystem& JobSystem = FJobSystem::Get();
+    if (!JobSystem.IsRunning())
+    {
+        UE_LOG(ELogLevel::Warning, "Job System Benchmark: FJobSystem is not running, jobs execute inline");
+    }
+
+    UE_LOG(ELogLevel::Display, "Job System Benchmark: %d workers + game thread", JobSystem.GetNumWorkers());
+
+    uint64 StartExecuted, StartStolen;
+    JobSystem.GetStats(StartExecuted, StartStolen);
+
+    UE_LOG(ELogLevel::Display, " Throughput (%d empty jobs)", NumJobs);
+    BenchmarkThroughput(NumJobs);
+
+    UE_LOG(ELogLevel::Display, " Dependencies");
+    BenchmarkDependencies(NumJobs);
+
+    UE_LOG(ELogLevel::Display, " ParallelFor (%d elements)", NumElements);
+    BenchmarkParallelFor(NumElements);
+
+    uint64 EndExecuted, EndStolen;
+    JobSystem.GetStats(EndExecuted, EndStolen);
+    UE_LOG(ELogLevel::Display, " Executed %llu jobs, %llu stolen", EndExecuted - StartExecuted, EndStolen - StartStolen);
+}
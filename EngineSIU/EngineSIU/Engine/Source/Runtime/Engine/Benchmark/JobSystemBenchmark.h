@@ -0,0 +1,12 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * FJobSystem의 Job 생성/실행 비용, 의존성 처리, ParallelFor의 GrainSize별 속도를 측정하고 결과를 검증합니다.
+ * 렌더링과 World에 의존하지 않으므로 Editor 없이도 실행할 수 있습니다.
+ *
+ * @param NumJobs 처리량 측정에 사용할 빈 Job 수
+ * @param NumElements ParallelFor로 처리할 요소 수
+ */
+void RunJobSystemBenchmark(int32 NumJobs = 100000, int32 NumElements = 1 << 22);
@@ -0,0 +1,1158 @@
+#include "Benchmark.h"
+#include <random>
+
+#include "Define.h"
+#include "Math/MathKernels.h"
+#include "Math/Matrix.h"
+#include "Math/Quat.h"
+#include "Math/Rotator.h"
+#include "Math/Transform.h"
+
+
+namespace
+{
+/** 입력 배열의 크기, 같은 값이 반복되어 상수로 접히지 않도록 입력을 순환합니다. */
+constexpr int32 NumInputs = 1024;
+constexpr int32 InputMask = NumInputs - 1;
+
+struct FMathInputs
+{
+    TArray<FVector> Vectors;
+    TArray<FVector4> Vector4s;
+    TArray<FQuat> Quats;
+    TArray<FTransform> Transforms;
+    TArray<FMatrix> Matrices;
+    TArray<FBoundingBox> Boxes;
+
+    /** Vectors를 성분별로 나눈 SoA 배열 */
+    TArray<float> VectorsX, VectorsY, VectorsZ;
+
+    FMathInputs()
+    {
+        std::mt19937 Random(1234);
+        std::uniform_real_distribution<float> Position(-1000.f, 1000.f);
+        std::uniform_real_distribution<float> Angle(-180.f, 180.f);
+        std::uniform_real_distribution<float> Scale(0.5f, 2.f);
+
+        for (int32 Index = 0; Index < NumInputs; ++Index)
+        {
+            const FVector Translation(Position(Random), Position(Random), Position(Random));
+            const FQuat Rotation = FQuat(FRotator(Angle(Random), Angle(Random), Angle(Random))).GetNormalized();
+            const FVector Scale3D(Scale(Random), Scale(Random), Scale(Random));
+
+            Vectors.Add(Translation);
+            Vector4s.Add(FVector4(Translation, static_cast<float>(Index & 1)));
+            Quats.Add(Rotation);
+            Transforms.Add(FTransform(Translation, Rotation, Scale3D));
+            Matrices.Add(Transforms[Index].GetMatrix());
+
+            const FVector Extent(Scale(Random), Scale(Random), Scale(Random));
+            Boxes.Add(FBoundingBox(Translation - Extent * 100.f, Translation + Extent * 100.f));
+
+            VectorsX.Add(Translation.X);
+            VectorsY.Add(Translation.Y);
+            VectorsZ.Add(Translation.Z);
+        }
+    }
+};
+
+const FMathInputs& GetMathInputs()
+{
+    static const FMathInputs Inputs;
+    return Inputs;
+}
+
+/** Arg로 받은 EMathISA의 구현, CPU가 지원하지 않으면 벤치마크를 건너뜁니다. */
+const FMathKernels* GetKernels(FBenchmarkState& State)
+{
+    const EMathISA ISA = static_cast<EMathISA>(State.GetArg());
+    const FMathKernels* Kernels = FMathKernels::Get(ISA);
+    if (!Kernels)
+    {
+        State.SkipWithError(FString::Printf(TEXT("%s is not supported by this CPU"), FMathKernels::GetISAName(ISA)));
+    }
+    return Kernels;
+}
+
+/**
+ * Kernels의 결과 Actual을 Scalar 결과 Expected와 비교합니다.
+ * 오차는 Expected의 가장 큰 절대값(1 이상)에 대한 비율이고, Tolerance를 넘으면 측정하지 않고 오차를 남깁니다.
+ */
+bool VerifyAgainstScalar(FBenchmarkState& State, const float* Actual, const float* Expected, int32 NumFloats, float Tolerance)
+{
+    float MaxAbs = 1.f;
+    float MaxDiff = 0.f;
+    for (int32 Index = 0; Index < NumFloats; ++Index)
+    {
+        MaxAbs = FMath::Max(MaxAbs, FMath::Abs(Expected[Index]));
+        MaxDiff = FMath::Max(MaxDiff, FMath::Abs(Actual[Index] - Expected[Index]));
+    }
+
+    const float Error = MaxDiff / MaxAbs;
+    if (!(Error <= Tolerance))
+    {
+        State.SkipWithError(FString::Printf(TEXT("differs from Scalar by %g (tolerance %g)"), Error, Tolerance));
+        return false;
+    }
+    return true;
+}
+
+const FMathKernels& GetScalarKernels()
+{
+    return *FMathKernels::Get(EMathISA::Scalar);
+}
+}
+
+
+static void BM_Matrix_Multiply(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FMatrix Result = Inputs.Matrices[Index] * Inputs.Matrices[(Index + 1) & InputMask];
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Matrix_Multiply);
+
+static void BM_Matrix_Inverse(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FMatrix Result = FMatrix::Inverse(Inputs.Matrices[Index]);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Matrix_Inverse);
+
+static void BM_Matrix_TransformPosition(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FVector Result = Inputs.Matrices[Index].TransformPosition(Inputs.Vectors[Index]);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Matrix_TransformPosition);
+
+static void BM_Quat_Multiply(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FQuat Result = Inputs.Quats[Index] * Inputs.Quats[(Index + 1) & InputMask];
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Quat_Multiply);
+
+static void BM_Quat_RotateVector(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FVector Result = Inputs.Quats[Index].RotateVector(Inputs.Vectors[Index]);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Quat_RotateVector);
+
+static void BM_Quat_Slerp(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FQuat Result = FQuat::Slerp(Inputs.Quats[Index], Inputs.Quats[(Index + 1) & InputMask], 0.3f);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Quat_Slerp);
+
+static void BM_Quat_ToMatrix(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FMatrix Result = Inputs.Quats[Index].ToMatrix();
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Quat_ToMatrix);
+
+static void BM_Transform_GetMatrix(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FMatrix Result = Inputs.Transforms[Index].GetMatrix();
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Transform_GetMatrix);
+
+static void BM_Transform_Multiply(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FTransform Result = Inputs.Transforms[Index] * Inputs.Transforms[(Index + 1) & InputMask];
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Transform_Multiply);
+
+static void BM_Transform_TransformPosition(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FVector Result = Inputs.Transforms[Index].TransformPosition(Inputs.Vectors[Index]);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Transform_TransformPosition);
+
+static void BM_Transform_Inverse(FBenchmarkState& State)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const FTransform Result = Inputs.Transforms[Index].Inverse();
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Transform_Inverse);
+
+
+// 아래는 FMathKernels의 ISA별 구현을 비교합니다. Arg는 EMathISA(0: Scalar, 1: SSE4.1, 2: AVX2)입니다.
+// FMatrix의 멤버 함수는 SSE4.1 구현과 같은 코드를 사용하므로, SSE4.1의 검증이 곧 FMatrix의 검증입니다.
+
+static void BM_MathKernel_MultiplyMatrix(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        const FMatrix& A = Inputs.Matrices[Index];
+        const FMatrix& B = Inputs.Matrices[(Index + 1) & InputMask];
+        FMatrix Actual, Expected;
+        Kernels->MultiplyMatrix(&Actual, &A, &B);
+        GetScalarKernels().MultiplyMatrix(&Expected, &A, &B);
+        if (!VerifyAgainstScalar(State, &Actual.M[0][0], &Expected.M[0][0], 16, 1.e-6f))
+        {
+            return;
+        }
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        FMatrix Result;
+        Kernels->MultiplyMatrix(&Result, &Inputs.Matrices[Index], &Inputs.Matrices[(Index + 1) & InputMask]);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_MathKernel_MultiplyMatrix)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_InverseMatrix(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    // 알고리즘이 달라 Scalar와 마지막 몇 자리가 다릅니다.
+    const FMathInputs& Inputs = GetMathInputs();
+    for (const FMatrix& Matrix : Inputs.Matrices)
+    {
+        FMatrix Actual, Expected;
+        const bool bActual = Kernels->InverseMatrix(&Actual, &Matrix);
+        const bool bExpected = GetScalarKernels().InverseMatrix(&Expected, &Matrix);
+        if (bActual != bExpected)
+        {
+            State.SkipWithError(TEXT("disagrees with Scalar on whether the matrix is invertible"));
+            return;
+        }
+        if (bActual && !VerifyAgainstScalar(State, &Actual.M[0][0], &Expected.M[0][0], 16, 1.e-5f))
+        {
+            return;
+        }
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        FMatrix Result;
+        DoNotOptimize(Kernels->InverseMatrix(&Result, &Inputs.Matrices[Index]));
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_MathKernel_InverseMatrix)->Arg(0)->Arg(1)->Arg(2);
+
+/** 한 번에 NumInputs개를 변환합니다. 처리량은 변환한 Vector 수입니다. */
+static void BM_MathKernel_TransformPositions(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FVector> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->TransformPositions(Actual.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[0]);
+    GetScalarKernels().TransformPositions(Expected.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[0]);
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 3, 1.e-6f))
+    {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        Kernels->TransformPositions(Actual.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[Index]);
+        DoNotOptimize(Actual.GetData());
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_TransformPositions)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_TransformVector4s(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FVector4> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->TransformVector4s(Actual.GetData(), Inputs.Vector4s.GetData(), NumInputs, Inputs.Matrices[0]);
+    GetScalarKernels().TransformVector4s(Expected.GetData(), Inputs.Vector4s.GetData(), NumInputs, Inputs.Matrices[0]);
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 4, 1.e-6f))
+    {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        Kernels->TransformVector4s(Actual.GetData(), Inputs.Vector4s.GetData(), NumInputs, Inputs.Matrices[Index]);
+        DoNotOptimize(Actual.GetData());
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_TransformVector4s)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_TransformVectors(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FVector> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->TransformVectors(Actual.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[0]);
+    GetScalarKernels().TransformVectors(Expected.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[0]);
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 3, 1.e-6f))
+    {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        Kernels->TransformVectors(Actual.GetData(), Inputs.Vectors.GetData(), NumInputs, Inputs.Matrices[Index]);
+        DoNotOptimize(Actual.GetData());
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_TransformVectors)->Arg(0)->Arg(1)->Arg(2);
+
+/** TransformPositions와 같은 점을 SoA 배열로 변환합니다. */
+static void BM_MathKernel_TransformPositionsSoA(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<float> Actual, Expected;
+    Actual.SetNum(NumInputs * 3);
+    Expected.SetNum(NumInputs * 3);
+    float* const ActualX = Actual.GetData();
+    float* const ExpectedX = Expected.GetData();
+
+    Kernels->TransformPositionsSoA(
+        ActualX, ActualX + NumInputs, ActualX + NumInputs * 2,
+        Inputs.VectorsX.GetData(), Inputs.VectorsY.GetData(), Inputs.VectorsZ.GetData(), NumInputs, Inputs.Matrices[0]
+    );
+    GetScalarKernels().TransformPositionsSoA(
+        ExpectedX, ExpectedX + NumInputs, ExpectedX + NumInputs * 2,
+        Inputs.VectorsX.GetData(), Inputs.VectorsY.GetData(), Inputs.VectorsZ.GetData(), NumInputs, Inputs.Matrices[0]
+    );
+    if (!VerifyAgainstScalar(State, ActualX, ExpectedX, NumInputs * 3, 1.e-6f))
+    {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        Kernels->TransformPositionsSoA(
+            ActualX, ActualX + NumInputs, ActualX + NumInputs * 2,
+            Inputs.VectorsX.GetData(), Inputs.VectorsY.GetData(), Inputs.VectorsZ.GetData(), NumInputs, Inputs.Matrices[Index]
+        );
+        DoNotOptimize(ActualX);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_TransformPositionsSoA)->Arg(0)->Arg(1)->Arg(2);
+
+/** 각 상자를 서로 다른 행렬로 변환합니다. 결과는 Scalar 구현이 아니라 8개 꼭짓점을 직접 변환한 AABB와 비교합니다. */
+static void BM_MathKernel_TransformBoxes(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FBoundingBox> Results;
+    Results.SetNum(NumInputs);
+    Kernels->TransformBoxes(Results.GetData(), Inputs.Boxes.GetData(), Inputs.Matrices.GetData(), NumInputs);
+
+    TArray<float> Actual, Expected;
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        const FBoundingBox& Box = Inputs.Boxes[Index];
+        FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const FVector Local(
+                (Corner & 1) ? Box.MaxLocation.X : Box.MinLocation.X,
+                (Corner & 2) ? Box.MaxLocation.Y : Box.MinLocation.Y,
+                (Corner & 4) ? Box.MaxLocation.Z : Box.MinLocation.Z
+            );
+            const FVector World = Inputs.Matrices[Index].TransformPosition(Local);
+            Min = FVector(FMath::Min(Min.X, World.X), FMath::Min(Min.Y, World.Y), FMath::Min(Min.Z, World.Z));
+            Max = FVector(FMath::Max(Max.X, World.X), FMath::Max(Max.Y, World.Y), FMath::Max(Max.Z, World.Z));
+        }
+
+        const FBoundingBox& Result = Results[Index];
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Actual.Add(Result.MinLocation[Axis]);
+            Actual.Add(Result.MaxLocation[Axis]);
+            Expected.Add(Min[Axis]);
+            Expected.Add(Max[Axis]);
+        }
+    }
+    if (!VerifyAgainstScalar(State, Actual.GetData(), Expected.GetData(), Actual.Num(), 1.e-5f))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->TransformBoxes(Results.GetData(), Inputs.Boxes.GetData(), Inputs.Matrices.GetData(), NumInputs);
+        DoNotOptimize(Results.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_TransformBoxes)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_QuatsToMatrices(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FMatrix> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->QuatsToMatrices(Actual.GetData(), Inputs.Quats.GetData(), NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        const FMatrix Expected = Inputs.Quats[Index].ToMatrix();
+        if (!VerifyAgainstScalar(State, &Actual[Index].M[0][0], &Expected.M[0][0], 16, 1.e-6f))
+        {
+            return;
+        }
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->QuatsToMatrices(Actual.GetData(), Inputs.Quats.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_QuatsToMatrices)->Arg(0)->Arg(1)->Arg(2);
+
+namespace
+{
+/** Quats를 하나씩 밀어 둔 배열, Quats[i]와 짝지어 두 Quat을 받는 연산의 입력으로 씁니다. */
+TArray<FQuat> GetShiftedQuats()
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FQuat> Result;
+    Result.SetNum(NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        Result[Index] = Inputs.Quats[(Index + 1) & InputMask];
+    }
+    return Result;
+}
+
+float GetMaxDifference(const TArray<FQuat>& A, const TArray<FQuat>& B)
+{
+    float MaxDiff = 0.f;
+    for (int32 Index = 0; Index < A.Num(); ++Index)
+    {
+        MaxDiff = FMath::Max(MaxDiff, FMath::Abs(A[Index].X - B[Index].X));
+        MaxDiff = FMath::Max(MaxDiff, FMath::Abs(A[Index].Y - B[Index].Y));
+        MaxDiff = FMath::Max(MaxDiff, FMath::Abs(A[Index].Z - B[Index].Z));
+        MaxDiff = FMath::Max(MaxDiff, FMath::Abs(A[Index].W - B[Index].W));
+    }
+    return MaxDiff;
+}
+
+/** 보간 Kernel의 정확도를 재는 Alpha, 양 끝과 그 근처를 포함합니다. */
+constexpr float InterpolationAlphas[] = { 0.f, 0.001f, 0.1f, 0.25f, 0.3f, 0.5f, 0.75f, 0.999f, 1.f };
+
+/**
+ * Interpolate의 결과를 Alpha마다 Scalar와 비교하고, 현재 FQuat::Slerp와의 가장 큰 성분 오차를 Label로 남깁니다.
+ * @return Scalar와의 오차가 Tolerance를 넘으면 false
+ */
+template <typename FunctionType>
+bool VerifyInterpolation(FBenchmarkState& State, FunctionType Interpolate, FunctionType ScalarInterpolate, float Tolerance)
+{
+    const FMathInputs& Inputs = GetMathInputs();
+    const TArray<FQuat> Targets = GetShiftedQuats();
+
+    TArray<FQuat> Actual, Expected, Slerped;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Slerped.SetNum(NumInputs);
+
+    float MaxSlerpError = 0.f;
+    for (const float Alpha : InterpolationAlphas)
+    {
+        Interpolate(Actual.GetData(), Inputs.Quats.GetData(), Targets.GetData(), Alpha, NumInputs);
+        ScalarInterpolate(Expected.GetData(), Inputs.Quats.GetData(), Targets.GetData(), Alpha, NumInputs);
+        if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 4, Tolerance))
+        {
+            return false;
+        }
+
+        GetScalarKernels().SlerpQuats(Slerped.GetData(), Inputs.Quats.GetData(), Targets.GetData(), Alpha, NumInputs);
+        MaxSlerpError = FMath::Max(MaxSlerpError, GetMaxDifference(Actual, Slerped));
+    }
+    State.SetLabel(FString::Printf(TEXT("max error vs Slerp %.2e"), MaxSlerpError));
+    return true;
+}
+}
+
+static void BM_MathKernel_MultiplyQuats(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    const TArray<FQuat> Targets = GetShiftedQuats();
+    TArray<FQuat> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->MultiplyQuats(Actual.GetData(), Inputs.Quats.GetData(), Targets.GetData(), NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        Expected[Index] = Inputs.Quats[Index] * Targets[Index];
+    }
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 4, 1.e-6f))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->MultiplyQuats(Actual.GetData(), Inputs.Quats.GetData(), Targets.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_MultiplyQuats)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_NormalizeQuats(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    // 크기가 1이 아닌 Quat과, Identity가 되어야 하는 0에 가까운 Quat을 섞습니다.
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FQuat> Unnormalized;
+    Unnormalized.SetNum(NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        const FQuat& Quat = Inputs.Quats[Index];
+        const float Scale = Index % 64 == 0 ? 1.e-5f : 0.5f + static_cast<float>(Index % 7) * 0.25f;
+        Unnormalized[Index] = FQuat(Quat.X * Scale, Quat.Y * Scale, Quat.Z * Scale, Quat.W * Scale);
+    }
+
+    TArray<FQuat> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->NormalizeQuats(Actual.GetData(), Unnormalized.GetData(), NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        Expected[Index] = Unnormalized[Index].GetNormalized();
+    }
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 4, 1.e-6f))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->NormalizeQuats(Actual.GetData(), Unnormalized.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_NormalizeQuats)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_NlerpQuats(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels || !VerifyInterpolation(State, Kernels->NlerpQuats, GetScalarKernels().NlerpQuats, 1.e-6f))
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    const TArray<FQuat> Targets = GetShiftedQuats();
+    TArray<FQuat> Actual;
+    Actual.SetNum(NumInputs);
+    for (auto _ : State)
+    {
+        Kernels->NlerpQuats(Actual.GetData(), Inputs.Quats.GetData(), Targets.GetData(), 0.3f, NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_NlerpQuats)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_SlerpQuats(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels || !VerifyInterpolation(State, Kernels->SlerpQuats, GetScalarKernels().SlerpQuats, 1.e-6f))
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    const TArray<FQuat> Targets = GetShiftedQuats();
+    TArray<FQuat> Actual;
+    Actual.SetNum(NumInputs);
+    for (auto _ : State)
+    {
+        Kernels->SlerpQuats(Actual.GetData(), Inputs.Quats.GetData(), Targets.GetData(), 0.3f, NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_SlerpQuats)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_RotateVectors(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FMathInputs& Inputs = GetMathInputs();
+    TArray<FVector> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->RotateVectors(Actual.GetData(), Inputs.Quats.GetData(), Inputs.Vectors.GetData(), NumInputs);
+    GetScalarKernels().RotateVectors(Expected.GetData(), Inputs.Quats.GetData(), Inputs.Vectors.GetData(), NumInputs);
+    if (!VerifyAgainstScalar(State, &Actual[0].X, &Expected[0].X, NumInputs * 3, 1.e-6f))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->RotateVectors(Actual.GetData(), Inputs.Quats.GetData(), Inputs.Vectors.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_RotateVectors)->Arg(0)->Arg(1)->Arg(2);
+
+
+namespace
+{
+/** FMath::Fast*와 FMathKernels의 float 배열 함수가 사용하는 입력, MathUtility.h의 오차 표에 적힌 범위에서 고릅니다. */
+struct FFunctionInputs
+{
+    TArray<float> Angles;
+    TArray<float> Exponents;
+
+    /** 1e-30 ~ 1e30에서 지수가 고르게 분포하는 양수 */
+    TArray<float> Positives;
+    TArray<float> NoiseOffsets;
+
+    /** Atan2의 입력, 축 위의 점과 원점을 포함합니다. */
+    TArray<float> Y, X;
+
+    FFunctionInputs()
+    {
+        std::mt19937 Random(5678);
+        std::uniform_real_distribution<float> Angle(-1.e4f, 1.e4f);
+        std::uniform_real_distribution<float> SmallAngle(-2.f * PI, 2.f * PI);
+        std::uniform_real_distribution<float> Exponent(FastMath::ExpMinInput, FastMath::ExpMaxInput);
+        std::uniform_real_distribution<float> Log10(-30.f, 30.f);
+        std::uniform_real_distribution<float> NoiseOffset(0.f, 1000.f);
+        std::uniform_real_distribution<float> Coordinate(-1000.f, 1000.f);
+
+        for (int32 Index = 0; Index < NumInputs; ++Index)
+        {
+            Angles.Add(Index & 1 ? Angle(Random) : SmallAngle(Random));
+            Exponents.Add(Exponent(Random));
+            Positives.Add(std::pow(10.f, Log10(Random)));
+            NoiseOffsets.Add(NoiseOffset(Random));
+
+            const float CoordinateY = Coordinate(Random);
+            const float CoordinateX = Coordinate(Random);
+            Y.Add(Index % 16 == 0 ? 0.f : CoordinateY);
+            X.Add(Index % 16 == 0 || Index % 16 == 1 ? 0.f : CoordinateX);
+        }
+    }
+};
+
+const FFunctionInputs& GetFunctionInputs()
+{
+    static const FFunctionInputs Inputs;
+    return Inputs;
+}
+
+/** Actual을 double로 계산한 Expected와 비교합니다. bRelative면 |Expected|에 대한 비율입니다. */
+double GetMaxError(const float* Actual, const TArray<double>& Expected, bool bRelative)
+{
+    double MaxError = 0.0;
+    for (int32 Index = 0; Index < Expected.Num(); ++Index)
+    {
+        const double Error = std::abs(static_cast<double>(Actual[Index]) - Expected[Index]);
+        MaxError = FMath::Max(MaxError, bRelative ? Error / std::abs(Expected[Index]) : Error);
+    }
+    return MaxError;
+}
+
+/**
+ * MathUtility.h의 오차 표를 검증합니다. Tolerance를 넘으면 측정하지 않고 오차를 남기고, 넘지 않으면 오차를 Label로 남깁니다.
+ * std 함수도 float로 반올림하므로 같은 방법으로 재면 반올림 오차가 나옵니다.
+ */
+bool VerifyFunction(FBenchmarkState& State, const float* Actual, const TArray<double>& Expected, bool bRelative, double Tolerance)
+{
+    const double Error = GetMaxError(Actual, Expected, bRelative);
+    const TCHAR* Kind = bRelative ? TEXT("relative") : TEXT("absolute");
+    if (!(Error <= Tolerance))
+    {
+        State.SkipWithError(FString::Printf(TEXT("max %s error %.2e (tolerance %.2e)"), Kind, Error, Tolerance));
+        return false;
+    }
+    State.SetLabel(FString::Printf(TEXT("max %s error %.2e"), Kind, Error));
+    return true;
+}
+
+template <typename FunctionType>
+TArray<double> Evaluate(const TArray<float>& In, FunctionType Function)
+{
+    TArray<double> Result;
+    Result.SetNum(In.Num());
+    for (int32 Index = 0; Index < In.Num(); ++Index)
+    {
+        Result[Index] = Function(static_cast<double>(In[Index]));
+    }
+    return Result;
+}
+
+TArray<double> GetExpectedSin() { return Evaluate(GetFunctionInputs().Angles, [](double Value) { return std::sin(Value); }); }
+TArray<double> GetExpectedCos() { return Evaluate(GetFunctionInputs().Angles, [](double Value) { return std::cos(Value); }); }
+TArray<double> GetExpectedExp() { return Evaluate(GetFunctionInputs().Exponents, [](double Value) { return std::exp(Value); }); }
+TArray<double> GetExpectedInvSqrt() { return Evaluate(GetFunctionInputs().Positives, [](double Value) { return 1.0 / std::sqrt(Value); }); }
+
+TArray<double> GetExpectedAtan2()
+{
+    const FFunctionInputs& Inputs = GetFunctionInputs();
+    TArray<double> Result;
+    Result.SetNum(NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        Result[Index] = std::atan2(static_cast<double>(Inputs.Y[Index]), static_cast<double>(Inputs.X[Index]));
+    }
+    return Result;
+}
+
+/** MathUtility.h의 오차 표 */
+constexpr double SinCosTolerance = 1.e-7;
+constexpr double Atan2Tolerance = 3.e-7;
+constexpr double ExpTolerance = 1.2e-7;
+constexpr double InvSqrtTolerance = 5.e-7;
+
+/**
+ * FMath 함수 하나를 입력 배열 전체에 적용해 정확도를 검증한 뒤, 한 번씩 호출하는 시간을 잽니다.
+ * Function은 입력의 Index를 받습니다. Label에 std 함수는 float 반올림 오차가, Fast* 함수는 근사 오차가 남습니다.
+ */
+template <typename FunctionType>
+void RunFunction(FBenchmarkState& State, const TArray<double>& Expected, bool bRelative, double Tolerance, FunctionType Function)
+{
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    for (int32 Index = 0; Index < NumInputs; ++Index)
+    {
+        Actual[Index] = Function(Index);
+    }
+    if (!VerifyFunction(State, Actual.GetData(), Expected, bRelative, Tolerance))
+    {
+        return;
+    }
+
+    int32 Index = 0;
+    for (auto _ : State)
+    {
+        const float Result = Function(Index);
+        DoNotOptimize(Result);
+        Index = (Index + 1) & InputMask;
+    }
+    State.SetItemsProcessed(State.GetIterations());
+}
+}
+
+static void BM_FMath_Sin(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    RunFunction(State, GetExpectedSin(), false, SinCosTolerance, [&In](int32 Index) { return FMath::Sin(In[Index]); });
+}
+BENCHMARK(BM_FMath_Sin);
+
+static void BM_FMath_FastSin(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    RunFunction(State, GetExpectedSin(), false, SinCosTolerance, [&In](int32 Index) { return FMath::FastSin(In[Index]); });
+}
+BENCHMARK(BM_FMath_FastSin);
+
+static void BM_FMath_Cos(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    RunFunction(State, GetExpectedCos(), false, SinCosTolerance, [&In](int32 Index) { return FMath::Cos(In[Index]); });
+}
+BENCHMARK(BM_FMath_Cos);
+
+static void BM_FMath_FastCos(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    RunFunction(State, GetExpectedCos(), false, SinCosTolerance, [&In](int32 Index) { return FMath::FastCos(In[Index]); });
+}
+BENCHMARK(BM_FMath_FastCos);
+
+static void BM_FMath_Exp(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Exponents;
+    RunFunction(State, GetExpectedExp(), true, ExpTolerance, [&In](int32 Index) { return FMath::Exp(In[Index]); });
+}
+BENCHMARK(BM_FMath_Exp);
+
+static void BM_FMath_FastExp(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Exponents;
+    RunFunction(State, GetExpectedExp(), true, ExpTolerance, [&In](int32 Index) { return FMath::FastExp(In[Index]); });
+}
+BENCHMARK(BM_FMath_FastExp);
+
+static void BM_FMath_InvSqrt(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Positives;
+    RunFunction(State, GetExpectedInvSqrt(), true, InvSqrtTolerance, [&In](int32 Index) { return FMath::InvSqrt(In[Index]); });
+}
+BENCHMARK(BM_FMath_InvSqrt);
+
+static void BM_FMath_FastInvSqrt(FBenchmarkState& State)
+{
+    const TArray<float>& In = GetFunctionInputs().Positives;
+    RunFunction(State, GetExpectedInvSqrt(), true, InvSqrtTolerance, [&In](int32 Index) { return FMath::FastInvSqrt(In[Index]); });
+}
+BENCHMARK(BM_FMath_FastInvSqrt);
+
+static void BM_FMath_Atan2(FBenchmarkState& State)
+{
+    const FFunctionInputs& Inputs = GetFunctionInputs();
+    RunFunction(State, GetExpectedAtan2(), false, Atan2Tolerance, [&Inputs](int32 Index) { return FMath::Atan2(Inputs.Y[Index], Inputs.X[Index]); });
+}
+BENCHMARK(BM_FMath_Atan2);
+
+static void BM_FMath_FastAtan2(FBenchmarkState& State)
+{
+    const FFunctionInputs& Inputs = GetFunctionInputs();
+    RunFunction(State, GetExpectedAtan2(), false, Atan2Tolerance, [&Inputs](int32 Index) { return FMath::FastAtan2(Inputs.Y[Index], Inputs.X[Index]); });
+}
+BENCHMARK(BM_FMath_FastAtan2);
+
+static void BM_MathKernel_Sin(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->Sin(Actual.GetData(), In.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), GetExpectedSin(), false, SinCosTolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->Sin(Actual.GetData(), In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_Sin)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_Cos(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->Cos(Actual.GetData(), In.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), GetExpectedCos(), false, SinCosTolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->Cos(Actual.GetData(), In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_Cos)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_SinCos(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    // Sin 뒤에 Cos을 이어 붙여 한 번에 검증합니다.
+    const TArray<float>& In = GetFunctionInputs().Angles;
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs * 2);
+    TArray<double> Expected = GetExpectedSin();
+    Expected += GetExpectedCos();
+    Kernels->SinCos(Actual.GetData(), Actual.GetData() + NumInputs, In.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), Expected, false, SinCosTolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->SinCos(Actual.GetData(), Actual.GetData() + NumInputs, In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_SinCos)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_Atan2(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const FFunctionInputs& Inputs = GetFunctionInputs();
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->Atan2(Actual.GetData(), Inputs.Y.GetData(), Inputs.X.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), GetExpectedAtan2(), false, Atan2Tolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->Atan2(Actual.GetData(), Inputs.Y.GetData(), Inputs.X.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_Atan2)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_Exp(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const TArray<float>& In = GetFunctionInputs().Exponents;
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->Exp(Actual.GetData(), In.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), GetExpectedExp(), true, ExpTolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->Exp(Actual.GetData(), In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_Exp)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_InvSqrt(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const TArray<float>& In = GetFunctionInputs().Positives;
+    TArray<float> Actual;
+    Actual.SetNum(NumInputs);
+    Kernels->InvSqrt(Actual.GetData(), In.GetData(), NumInputs);
+    if (!VerifyFunction(State, Actual.GetData(), GetExpectedInvSqrt(), true, InvSqrtTolerance))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->InvSqrt(Actual.GetData(), In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_InvSqrt)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_MathKernel_PerlinNoise1D(FBenchmarkState& State)
+{
+    const FMathKernels* Kernels = GetKernels(State);
+    if (!Kernels)
+    {
+        return;
+    }
+
+    const TArray<float>& In = GetFunctionInputs().NoiseOffsets;
+    TArray<float> Actual, Expected;
+    Actual.SetNum(NumInputs);
+    Expected.SetNum(NumInputs);
+    Kernels->PerlinNoise1D(Actual.GetData(), In.GetData(), NumInputs);
+    GetScalarKernels().PerlinNoise1D(Expected.GetData(), In.GetData(), NumInputs);
+    if (!VerifyAgainstScalar(State, Actual.GetData(), Expected.GetData(), NumInputs, 1.e-6f))
+    {
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        Kernels->PerlinNoise1D(Actual.GetData(), In.GetData(), NumInputs);
+        DoNotOptimize(Actual.GetData());
+    }
+    State.SetItemsProcessed(State.GetIterations() * NumInputs);
+}
+BENCHMARK(BM_MathKernel_PerlinNoise1D)->Arg(0)->Arg(1)->Arg(2);
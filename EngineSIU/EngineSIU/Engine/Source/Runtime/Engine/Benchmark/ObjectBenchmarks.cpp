@@ -0,0 +1,113 @@
+#include "Benchmark.h"
+#include <iterator>
+
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectIterator.h"
+
+
+/** Arg개의 객체를 만들고 모두 지웁니다. 이름 생성, UObjectArray와 Hash 등록, 클래스별 Pool 할당이 포함됩니다. */
+template <typename T>
+static void ConstructDestroyObjects(FBenchmarkState& State)
+{
+    const int32 Num = static_cast<int32>(State.GetArg());
+    TArray<UObject*> Objects;
+    Objects.Reserve(Num);
+
+    for (auto _ : State)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Objects.Add(FObjectFactory::ConstructObject<T>(nullptr));
+        }
+        for (UObject* Object : Objects)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+        GUObjectArray.ProcessPendingDestroyObjects();
+        Objects.Empty(Num);
+    }
+    State.SetItemsProcessed(State.GetIterations() * Num);
+}
+
+static void BM_Object_ConstructDestroy(FBenchmarkState& State)
+{
+    ConstructDestroyObjects<UObject>(State);
+}
+BENCHMARK(BM_Object_ConstructDestroy)->Arg(1)->Arg(256);
+
+static void BM_Object_ConstructDestroySceneComponent(FBenchmarkState& State)
+{
+    ConstructDestroyObjects<USceneComponent>(State);
+}
+BENCHMARK(BM_Object_ConstructDestroySceneComponent)->Arg(1)->Arg(256);
+
+/** 현재 World에 있는 모든 객체에 대해 자주 쓰이는 클래스들로 IsA를 검사합니다. */
+static void BM_Object_IsA(FBenchmarkState& State)
+{
+    TArray<const UObject*> Objects;
+    for (const UObject* Object : TObjectRange<UObject>())
+    {
+        Objects.Add(Object);
+    }
+    if (Objects.IsEmpty())
+    {
+        State.SkipWithError(TEXT("no live objects"));
+        return;
+    }
+
+    const UClass* Classes[] = {
+        UObject::StaticClass(), AActor::StaticClass(), USceneComponent::StaticClass(), UPrimitiveComponent::StaticClass()
+    };
+    constexpr int32 NumClasses = static_cast<int32>(std::size(Classes));
+
+    int32 Index = 0;
+    int32 NumMatches = 0;
+    for (auto _ : State)
+    {
+        const UObject* Object = Objects[Index % Objects.Num()];
+        NumMatches += Object->IsA(Classes[Index % NumClasses]) ? 1 : 0;
+        ++Index;
+    }
+    DoNotOptimize(NumMatches);
+    State.SetItemsProcessed(State.GetIterations());
+}
+BENCHMARK(BM_Object_IsA);
+
+/** 현재 World의 객체를 클래스별 Hash Bucket으로 순회합니다. 한 번 순회한 객체 수가 처리량이 됩니다. */
+template <typename T>
+static void IterateObjects(FBenchmarkState& State)
+{
+    int64 NumObjects = 0;
+    for (auto _ : State)
+    {
+        int32 Count = 0;
+        for (const T* Object : TObjectRange<T>())
+        {
+            DoNotOptimize(Object);
+            ++Count;
+        }
+        NumObjects += Count;
+    }
+    State.SetItemsProcessed(NumObjects);
+}
+
+static void BM_ObjectRange_Object(FBenchmarkState& State)
+{
+    IterateObjects<UObject>(State);
+}
+BENCHMARK(BM_ObjectRange_Object);
+
+static void BM_ObjectRange_SceneComponent(FBenchmarkState& State)
+{
+    IterateObjects<USceneComponent>(State);
+}
+BENCHMARK(BM_ObjectRange_SceneComponent);
+
+static void BM_ObjectRange_Actor(FBenchmarkState& State)
+{
+    IterateObjects<AActor>(State);
+}
+BENCHMARK(BM_ObjectRange_Actor);
@@ -0,0 +1,151 @@
+#include "QueueBenchmark.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WindowsPlatformTime.h"
+#include "Container/LockFreeQueue.h"
+#include "Container/Queue.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+/** 비교 기준이 되는 Lock 기반 Queue */
+template <typename T>
+class TMutexQueue
+{
+public:
+    bool Enqueue(const T& Item)
+    {
+        std::lock_guard Lock(Mutex);
+        return Queue.Enqueue(Item);
+    }
+
+    bool Dequeue(T& OutItem)
+    {
+        std::lock_guard Lock(Mutex);
+        return Queue.Dequeue(OutItem);
+    }
+
+private:
+    std::mutex Mutex;
+    TQueue<T> Queue;
+};
+
+struct FQueueBenchmarkResult
+{
+    double Milliseconds = 0.0;
+    bool bValid = false;
+};
+
+/** NumProducers개의 스레드가 넣은 값을 NumConsumers개의 스레드가 모두 꺼낼 때까지의 시간을 측정합니다. */
+template <typename QueueType>
+FQueueBenchmarkResult RunContention(QueueType& Queue, int32 NumProducers, int32 NumConsumers, int32 NumItemsPerProducer)
+{
+    const int64 TotalItems = static_cast<int64>(NumProducers) * NumItemsPerProducer;
+    std::atomic<int64> NumConsumed = 0;
+    std::atomic<int64> Sum = 0;
+    std::atomic<bool> bStart = false;
+
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumProducers + NumConsumers);
+
+    for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+    {
+        Threads.emplace_back([&]()
+        {
+            while (!bStart.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (int32 Index = 0; Index < NumItemsPerProducer; ++Index)
+            {
+                while (!Queue.Enqueue(Index))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (int32 Consumer = 0; Consumer < NumConsumers; ++Consumer)
+    {
+        Threads.emplace_back([&]()
+        {
+            int64 LocalSum = 0;
+            int32 Item;
+            while (NumConsumed.load(std::memory_order_relaxed) < TotalItems)
+            {
+                if (Queue.Dequeue(Item))
+                {
+                    LocalSum += Item;
+                    NumConsumed.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            Sum.fetch_add(LocalSum, std::memory_order_relaxed);
+        });
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    bStart.store(true, std::memory_order_release);
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    FQueueBenchmarkResult Result;
+    Result.Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    const int64 ExpectedSum = static_cast<int64>(NumProducers) * NumItemsPerProducer * (NumItemsPerProducer - 1) / 2;
+    Result.bValid = Sum.load() == ExpectedSum;
+    return Result;
+}
+
+void LogResult(const char* Name, const FQueueBenchmarkResult& Result, int64 TotalItems)
+{
+    const double MopsPerSecond = Result.Milliseconds > 0.0 ? TotalItems / (Result.Milliseconds * 1000.0) : 0.0;
+    UE_LOG(
+        Result.bValid ? ELogLevel::Display : ELogLevel::Error,
+        "  %-24s %9.3f ms  %7.2f Mops/s%s", Name, Result.Milliseconds, MopsPerSecond, Result.bValid ? "" : "  [INVALID]"
+    );
+}
+}
+
+
+void RunQueueContentionBenchmark(int32 NumProducers, int32 NumItemsPerProducer)
+{
+    const int64 TotalItems = static_cast<int64>(NumProducers) * NumItemsPerProducer;
+    constexpr uint32 BoundedCapacity = 4096;
+
+    UE_LOG(ELogLevel::Display, "Queue Benchmark: %d producers x %d items", NumProducers, NumItemsPerProducer);
+
+    UE_LOG(ELogLevel::Display, " Mpsc (1 consumer)");
+    {
+        TMutexQueue<int32> Queue;
+        LogResult("std::mutex + TQueue", RunContention(Queue, NumProducers, 1, NumItemsPerProducer), TotalItems);
+    }
+    {
+        TBoundedQueue<int32, EQueueMode::Mpsc> Queue(BoundedCapacity);
+        LogResult("TBoundedQueue<Mpsc>", RunContention(Queue, NumProducers, 1, NumItemsPerProducer), TotalItems);
+    }
+    {
+        TLockFreeQueue<int32, EQueueMode::Mpsc> Queue;
+        LogResult("TLockFreeQueue<Mpsc>", RunContention(Queue, NumProducers, 1, NumItemsPerProducer), TotalItems);
+    }
+
+    UE_LOG(ELogLevel::Display, " Mpmc (%d consumers)", NumProducers);
+    {
+        TMutexQueue<int32> Queue;
+        LogResult("std::mutex + TQueue", RunContention(Queue, NumProducers, NumProducers, NumItemsPerProducer), TotalItems);
+    }
+    {
+        TBoundedQueue<int32, EQueueMode::Mpmc> Queue(BoundedCapacity);
+        LogResult("TBoundedQueue<Mpmc>", RunContention(Queue, NumProducers, NumProducers, NumItemsPerProducer), TotalItems);
+    }
+}
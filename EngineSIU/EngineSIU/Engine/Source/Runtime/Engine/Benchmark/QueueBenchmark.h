@@ -0,0 +1,12 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 여러 Producer 스레드가 동시에 요소를 넣는 상황에서 std::mutex + TQueue, TBoundedQueue, TLockFreeQueue의 처리량을 비교합니다.
+ * Mpsc(Consumer 하나)와 Mpmc(Producer 수만큼의 Consumer) 구성을 각각 측정하고, 결과를 Console에 출력합니다.
+ *
+ * @param NumProducers Producer 스레드 수
+ * @param NumItemsPerProducer Producer 하나가 넣는 요소 수
+ */
+void RunQueueContentionBenchmark(int32 NumProducers = 4, int32 NumItemsPerProducer = 200000);
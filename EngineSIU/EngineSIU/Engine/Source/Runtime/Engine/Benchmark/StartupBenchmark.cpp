@@ -0,0 +1,131 @@
+#include "StartupBenchmark.h"
+
+#include "WindowsPlatformTime.h"
+#include "Engine/AssetManager.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+/** RecordTimeToFirstFrame이 호출된 시점의 상태 */
+struct FFirstFrameRecord
+{
+    double Milliseconds = -1.0;
+    FAssetScanStats ScanStats;
+    int32 NumLoadedAssets = 0;
+    int32 NumPendingLoads = 0;
+};
+
+FFirstFrameRecord FirstFrameRecord;
+
+constexpr double BytesToMegabytes(uint64 Bytes)
+{
+    return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+}
+
+const char* GetAssetTypeName(EAssetType AssetType)
+{
+    switch (AssetType)
+    {
+    case EAssetType::StaticMesh:
+        return "StaticMesh";
+    case EAssetType::SkeletalMesh:
+        return "SkeletalMesh";
+    case EAssetType::Texture2D:
+        return "Texture2D";
+    case EAssetType::Material:
+        return "Material";
+    default:
+        return "Unknown";
+    }
+}
+
+void LogFirstFrameRecord()
+{
+    const FAssetScanStats& ScanStats = FirstFrameRecord.ScanStats;
+    const double ContentsMegabytes = BytesToMegabytes(ScanStats.TotalBytes);
+
+    UE_LOG(ELogLevel::Display, "Time to first frame: %.1f ms", FirstFrameRecord.Milliseconds);
+    UE_LOG(ELogLevel::Display, "  Contents: %d assets, %.2f MB (%.2f ms/MB)",
+        ScanStats.NumAssets, ContentsMegabytes, ContentsMegabytes > 0.0 ? FirstFrameRecord.Milliseconds / ContentsMegabytes : 0.0);
+    UE_LOG(ELogLevel::Display, "  Scan: %.3f ms, %d from registry file (%d with mesh info), %d changed",
+        ScanStats.ScanMilliseconds, ScanStats.NumCached, ScanStats.NumWithMeshInfo, ScanStats.NumChanged);
+    UE_LOG(ELogLevel::Display, "  Loaded at first frame: %d, still streaming: %d",
+        FirstFrameRecord.NumLoadedAssets, FirstFrameRecord.NumPendingLoads);
+}
+
+double MeasureScanMilliseconds(UAssetManager& AssetManager, bool bUseRegistryFile, int32 NumIterations)
+{
+    double TotalMilliseconds = 0.0;
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        TotalMilliseconds += AssetManager.ScanContents(bUseRegistryFile).ScanMilliseconds;
+    }
+    return TotalMilliseconds / NumIterations;
+}
+}
+
+
+void RecordTimeToFirstFrame(double Milliseconds)
+{
+    FirstFrameRecord.Milliseconds = Milliseconds;
+
+    if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+    {
+        FirstFrameRecord.ScanStats = AssetManager->GetLastScanStats();
+        FirstFrameRecord.NumPendingLoads = AssetManager->GetStreamableManager().GetNumPendingLoads();
+        for (const auto& [AssetName, AssetInfo] : AssetManager->GetAssetRegistry())
+        {
+            FirstFrameRecord.NumLoadedAssets += AssetInfo.IsLoaded ? 1 : 0;
+        }
+    }
+
+    LogFirstFrameRecord();
+}
+
+void RunStartupBenchmark(int32 NumIterations)
+{
+    UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+    if (!AssetManager)
+    {
+        UE_LOG(ELogLevel::Error, "Startup Benchmark: AssetManager is not initialized");
+        return;
+    }
+
+    if (FirstFrameRecord.Milliseconds >= 0.0)
+    {
+        LogFirstFrameRecord();
+    }
+
+    // Asset 타입별 수와 용량
+    struct FTypeSize
+    {
+        int32 NumAssets = 0;
+        int32 NumLoaded = 0;
+        uint64 Bytes = 0;
+    };
+    TMap<EAssetType, FTypeSize> TypeSizes;
+    for (const auto& [AssetName, AssetInfo] : AssetManager->GetAssetRegistry())
+    {
+        FTypeSize& TypeSize = TypeSizes.FindOrAdd(AssetInfo.AssetType);
+        ++TypeSize.NumAssets;
+        TypeSize.NumLoaded += AssetInfo.IsLoaded ? 1 : 0;
+        TypeSize.Bytes += AssetInfo.Size;
+    }
+    for (const auto& [AssetType, TypeSize] : TypeSizes)
+    {
+        UE_LOG(ELogLevel::Display, "  %-12s %4d assets (%4d loaded), %8.2f MB",
+            GetAssetTypeName(AssetType), TypeSize.NumAssets, TypeSize.NumLoaded, BytesToMegabytes(TypeSize.Bytes));
+    }
+
+    // Registry 파일이 없을 때와 있을 때의 스캔 비용
+    const double ColdScanMs = MeasureScanMilliseconds(*AssetManager, false, NumIterations);
+    const double WarmScanMs = MeasureScanMilliseconds(*AssetManager, true, NumIterations);
+    const FAssetScanStats& ScanStats = AssetManager->GetLastScanStats();
+
+    UE_LOG(ELogLevel::Display, "Contents Scan: %d assets, %.2f MB, %d iterations",
+        ScanStats.NumAssets, BytesToMegabytes(ScanStats.TotalBytes), NumIterations);
+    UE_LOG(ELogLevel::Display, "  Without registry file: %.3f ms", ColdScanMs);
+    UE_LOG(ELogLevel::Display, "  With registry file   : %.3f ms (%d cached), x%.2f",
+        WarmScanMs, ScanStats.NumCached, WarmScanMs > 0.0 ? ColdScanMs / WarmScanMs : 0.0);
+}
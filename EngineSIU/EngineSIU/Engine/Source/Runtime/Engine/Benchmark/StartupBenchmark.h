@@ -0,0 +1,17 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * FEngineLoop::Init 시작부터 첫 프레임을 그릴 때까지 걸린 시간을 기록하고,
+ * 그 시점의 Contents 크기, 로드된 Asset 수와 함께 Console에 출력합니다.
+ */
+void RecordTimeToFirstFrame(double Milliseconds);
+
+/**
+ * 기록된 첫 프레임까지의 시간을 Contents 크기(Asset 타입별 수와 용량)와 함께 다시 출력하고,
+ * Contents 스캔을 Registry 파일 없이/Registry 파일로 각각 실행해 비교합니다.
+ *
+ * @param NumIterations 스캔을 반복하는 횟수
+ */
+void RunStartupBenchmark(int32 NumIterations = 5);
@@ -0,0 +1,699 @@
+#include "StressScene.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "JSON/json.hpp"
+#include "WindowsPlatformTime.h"
+#include "Actors/CapsuleActor.h"
+#include "Actors/CubeActor.h"
+#include "Actors/PointLightActor.h"
+#include "Actors/SphereActor.h"
+#include "Actors/SpotLightActor.h"
+#include "Animation/AnimSequence.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/Light/PointLightComponent.h"
+#include "Components/Light/SpotLightComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/EditorEngine.h"
+#include "Engine/FFbxLoader.h"
+#include "Engine/FObjLoader.h"
+#include "Engine/StaticMeshActor.h"
+#include "LuaScripts/LuaScriptComponent.h"
+#include "Math/MathKernels.h"
+#include "UObject/ObjectUtils.h"
+#include "UserInterface/Console.h"
+#include "World/World.h"
+
+using json = nlohmann::json;
+
+
+namespace
+{
+/** 모든 Script Actor가 함께 쓰는 Lua 파일 */
+const TCHAR* StressActorScriptPath = TEXT("LuaScripts/StressActor.lua");
+
+/** Actor 종류마다 Seed와 섞어 별도의 난수열을 만드는 값 */
+enum class EStressActorKind : uint32
+{
+    StaticMesh,
+    SkeletalMesh,
+    PointLight,
+    SpotLight,
+    Shape,
+    Script,
+};
+
+/**
+ * std::mt19937의 출력만 사용하는 난수, 분포 클래스는 표준 라이브러리 구현마다 결과가 달라서 쓰지 않습니다.
+ */
+struct FStressRandom
+{
+    std::mt19937 Engine;
+
+    FStressRandom(uint32 Seed, EStressActorKind Kind)
+    {
+        std::seed_seq Sequence{ Seed, static_cast<uint32>(Kind) };
+        Engine.seed(Sequence);
+    }
+
+    /** [0, 1) */
+    float GetFraction()
+    {
+        return static_cast<float>(Engine() >> 8) * (1.f / 16777216.f);
+    }
+
+    float GetInRange(float Min, float Max)
+    {
+        return Min + (Max - Min) * GetFraction();
+    }
+
+    /** [0, Num) */
+    int32 GetIndex(int32 Num)
+    {
+        return static_cast<int32>(Engine() % static_cast<uint32>(Num));
+    }
+
+    FVector GetPointInCube(float HalfExtent)
+    {
+        const float X = GetInRange(-HalfExtent, HalfExtent);
+        const float Y = GetInRange(-HalfExtent, HalfExtent);
+        const float Z = GetInRange(-HalfExtent, HalfExtent);
+        return FVector(X, Y, Z);
+    }
+
+    FLinearColor GetColor()
+    {
+        const float R = GetInRange(0.2f, 1.f);
+        const float G = GetInRange(0.2f, 1.f);
+        const float B = GetInRange(0.2f, 1.f);
+        return FLinearColor(R, G, B, 1.f);
+    }
+};
+
+/** 등록된 AssetType Asset의 전체 경로, 등록 순서와 상관없도록 정렬합니다. */
+TArray<FString> GetSortedAssetPaths(EAssetType AssetType)
+{
+    TArray<FString> Paths;
+    if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+    {
+        for (const auto& [AssetName, AssetInfo] : AssetManager->GetAssetRegistry())
+        {
+            if (AssetInfo.AssetType == AssetType)
+            {
+                Paths.Add(AssetInfo.GetFullPath());
+            }
+        }
+    }
+    Paths.Sort();
+    return Paths;
+}
+
+/** 로드가 끝난 Animation의 이름, 정렬되어 있습니다. */
+TArray<FString> GetSortedAnimationNames()
+{
+    TArray<FString> Names;
+    {
+        std::lock_guard Lock(FFbxLoader::AnimMapMutex);
+        for (const auto& [Name, Entry] : FFbxLoader::AnimMap)
+        {
+            if (Entry.State == FFbxLoader::LoadState::Completed && Entry.Sequence)
+            {
+                Names.Add(Name);
+            }
+        }
+    }
+    Names.Sort();
+    return Names;
+}
+
+bool ParseInt(const std::string& Text, int32& OutValue)
+{
+    char* End = nullptr;
+    const long Value = std::strtol(Text.c_str(), &End, 10);
+    if (Text.empty() || *End != '\0' || Value < 0)
+    {
+        return false;
+    }
+    OutValue = static_cast<int32>(Value);
+    return true;
+}
+}
+
+
+int32 FStressSceneSettings::GetNumActors() const
+{
+    return NumStaticMeshes + NumSkeletalMeshes + NumPointLights + NumSpotLights + NumShapes + NumScriptedActors;
+}
+
+FStressSceneSettings FStressSceneSettings::Scaled(int32 Scale) const
+{
+    FStressSceneSettings Result = *this;
+    Result.NumStaticMeshes *= Scale;
+    Result.NumSkeletalMeshes *= Scale;
+    Result.NumPointLights *= Scale;
+    Result.NumSpotLights *= Scale;
+    Result.NumShapes *= Scale;
+    Result.NumScriptedActors *= Scale;
+    return Result;
+}
+
+bool FStressSceneSettings::ParseSpec(const FString& Spec)
+{
+    const std::string Text = Spec.ToAnsiString();
+
+    size_t Start = 0;
+    while (Start <= Text.size())
+    {
+        size_t End = Text.find(',', Start);
+        if (End == std::string::npos)
+        {
+            End = Text.size();
+        }
+
+        const std::string Token = Text.substr(Start, End - Start);
+        Start = End + 1;
+        if (Token.empty())
+        {
+            continue;
+        }
+
+        const size_t Equal = Token.find('=');
+        const FString Key = Token.substr(0, Equal).c_str();
+        const std::string Value = Equal == std::string::npos ? std::string() : Token.substr(Equal + 1);
+
+        int32 Count = 0;
+        bool bValid = true;
+        if (Key.Equals(TEXT("Spacing"), ESearchCase::IgnoreCase))
+        {
+            char* ValueEnd = nullptr;
+            Spacing = std::strtof(Value.c_str(), &ValueEnd);
+            bValid = !Value.empty() && *ValueEnd == '\0' && Spacing > 0.f;
+        }
+        else if (!ParseInt(Value, Count))
+        {
+            bValid = false;
+        }
+        else if (Key.Equals(TEXT("All"), ESearchCase::IgnoreCase))
+        {
+            NumStaticMeshes = NumSkeletalMeshes = NumPointLights = NumSpotLights = NumShapes = NumScriptedActors = Count;
+        }
+        else if (Key.Equals(TEXT("StaticMesh"), ESearchCase::IgnoreCase))
+        {
+            NumStaticMeshes = Count;
+        }
+        else if (Key.Equals(TEXT("SkeletalMesh"), ESearchCase::IgnoreCase))
+        {
+            NumSkeletalMeshes = Count;
+        }
+        else if (Key.Equals(TEXT("PointLight"), ESearchCase::IgnoreCase))
+        {
+            NumPointLights = Count;
+        }
+        else if (Key.Equals(TEXT("SpotLight"), ESearchCase::IgnoreCase))
+        {
+            NumSpotLights = Count;
+        }
+        else if (Key.Equals(TEXT("Shape"), ESearchCase::IgnoreCase))
+        {
+            NumShapes = Count;
+        }
+        else if (Key.Equals(TEXT("Script"), ESearchCase::IgnoreCase))
+        {
+            NumScriptedActors = Count;
+        }
+        else if (Key.Equals(TEXT("Seed"), ESearchCase::IgnoreCase))
+        {
+            Seed = static_cast<uint32>(Count);
+        }
+        else
+        {
+            bValid = false;
+        }
+
+        if (!bValid)
+        {
+            UE_LOG(ELogLevel::Error, "StressScene: invalid entry '%s' in '%s'", Token.c_str(), Text.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+FString FStressSceneSettings::ToSpec() const
+{
+    return FString::Printf(
+        TEXT("StaticMesh=%d,SkeletalMesh=%d,PointLight=%d,SpotLight=%d,Shape=%d,Script=%d,Seed=%u,Spacing=%g"),
+        NumStaticMeshes, NumSkeletalMeshes, NumPointLights, NumSpotLights, NumShapes, NumScriptedActors, Seed, Spacing
+    );
+}
+
+
+int32 FStressSceneGenerator::Generate(UWorld* World, const FStressSceneSettings& Settings)
+{
+    if (!World)
+    {
+        return 0;
+    }
+
+    const int32 NumActors = Settings.GetNumActors();
+    const int32 NumBefore = SpawnedActors.Num();
+    SpawnedActors.Reserve(NumBefore + NumActors);
+
+    // 모든 Actor가 Spacing 간격으로 들어가는 정육면체
+    const float HalfExtent = 0.5f * Settings.Spacing * std::cbrt(static_cast<float>(std::max(NumActors, 1)));
+
+    // Mesh 로드와 Animation 설정이 Actor마다 남기는 로그를 막습니다.
+    const ELogLevel PrevVerbosity = LogTemp.GetVerbosity();
+    LogTemp.SetVerbosity(ELogLevel::Warning);
+
+    const TArray<FString> StaticMeshPaths = GetSortedAssetPaths(EAssetType::StaticMesh);
+
+    if (Settings.NumStaticMeshes > 0 || Settings.NumScriptedActors > 0)
+    {
+        if (StaticMeshPaths.IsEmpty())
+        {
+            UE_LOG(ELogLevel::Warning, "StressScene: no static mesh in Contents, static mesh actors will be empty");
+        }
+    }
+
+    {
+        FStressRandom Random(Settings.Seed, EStressActorKind::StaticMesh);
+        for (int32 Index = 0; Index < Settings.NumStaticMeshes; ++Index)
+        {
+            AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>();
+            Actor->SetActorLabel(FString::Printf(TEXT("Stress_StaticMesh_%d"), Index));
+            Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+            Actor->SetActorRotation(FRotator(0.f, Random.GetInRange(-180.f, 180.f), 0.f));
+            if (!StaticMeshPaths.IsEmpty())
+            {
+                Actor->GetStaticMeshComponent()->SetStaticMesh(FObjManager::CreateStaticMesh(StaticMeshPaths[Random.GetIndex(StaticMeshPaths.Num())]));
+            }
+            SpawnedActors.Add(Actor);
+        }
+    }
+
+    if (Settings.NumSkeletalMeshes > 0)
+    {
+        // 처음 참조하는 FBX는 여기서 로드되고, 그 Animation도 함께 등록됩니다.
+        TArray<USkeletalMesh*> SkeletalMeshes;
+        for (const FString& Path : GetSortedAssetPaths(EAssetType::SkeletalMesh))
+        {
+            if (USkeletalMesh* SkeletalMesh = FFbxLoader::GetSkeletalMesh(Path))
+            {
+                SkeletalMeshes.Add(SkeletalMesh);
+            }
+        }
+        const TArray<FString> AnimationNames = GetSortedAnimationNames();
+
+        if (SkeletalMeshes.IsEmpty())
+        {
+            UE_LOG(ELogLevel::Warning, "StressScene: no skeletal mesh in Contents, skipping %d skeletal meshes", Settings.NumSkeletalMeshes);
+        }
+        else
+        {
+            FStressRandom Random(Settings.Seed, EStressActorKind::SkeletalMesh);
+            for (int32 Index = 0; Index < Settings.NumSkeletalMeshes; ++Index)
+            {
+                AActor* Actor = World->SpawnActor<AActor>();
+                Actor->SetActorLabel(FString::Printf(TEXT("Stress_SkeletalMesh_%d"), Index));
+
+                USkeletalMeshComponent* SkeletalMeshComponent = Actor->AddComponent<USkeletalMeshComponent>();
+                SkeletalMeshComponent->SetupAttachment(Actor->GetRootComponent());
+                SkeletalMeshComponent->SetSkeletalMesh(SkeletalMeshes[Random.GetIndex(SkeletalMeshes.Num())]);
+                if (!AnimationNames.IsEmpty())
+                {
+                    SkeletalMeshComponent->PlayAnimation(FFbxLoader::GetAnimSequenceByName(AnimationNames[Random.GetIndex(AnimationNames.Num())]), true);
+                }
+
+                Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+                Actor->SetActorRotation(FRotator(0.f, Random.GetInRange(-180.f, 180.f), 0.f));
+                SpawnedActors.Add(Actor);
+            }
+        }
+    }
+
+    {
+        FStressRandom Random(Settings.Seed, EStressActorKind::PointLight);
+        for (int32 Index = 0; Index < Settings.NumPointLights; ++Index)
+        {
+            APointLight* Actor = World->SpawnActor<APointLight>();
+            Actor->SetActorLabel(FString::Printf(TEXT("Stress_PointLight_%d"), Index));
+            Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+
+            UPointLightComponent* LightComponent = Actor->GetComponentByClass<UPointLightComponent>();
+            LightComponent->SetLightColor(Random.GetColor());
+            LightComponent->SetRadius(Settings.Spacing * 2.f);
+            SpawnedActors.Add(Actor);
+        }
+    }
+
+    {
+        FStressRandom Random(Settings.Seed, EStressActorKind::SpotLight);
+        for (int32 Index = 0; Index < Settings.NumSpotLights; ++Index)
+        {
+            ASpotLight* Actor = World->SpawnActor<ASpotLight>();
+            Actor->SetActorLabel(FString::Printf(TEXT("Stress_SpotLight_%d"), Index));
+            Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+            Actor->SetActorRotation(FRotator(Random.GetInRange(-90.f, -30.f), Random.GetInRange(-180.f, 180.f), 0.f));
+
+            USpotLightComponent* LightComponent = Actor->GetComponentByClass<USpotLightComponent>();
+            LightComponent->SetLightColor(Random.GetColor());
+            LightComponent->SetRadius(Settings.Spacing * 2.f);
+            SpawnedActors.Add(Actor);
+        }
+    }
+
+    {
+        // 크기가 Spacing의 절반 이상이므로 평균적으로 이웃 몇 개와 겹칩니다.
+        FStressRandom Random(Settings.Seed, EStressActorKind::Shape);
+        for (int32 Index = 0; Index < Settings.NumShapes; ++Index)
+        {
+            AActor* Actor = nullptr;
+            const float Size = Random.GetInRange(0.5f, 1.f) * Settings.Spacing;
+            switch (Random.GetIndex(3))
+            {
+            case 0:
+            {
+                ACubeActor* CubeActor = World->SpawnActor<ACubeActor>();
+                CubeActor->GetShapeComponent()->SetBoxExtent(FVector(Size, Size, Size) * 0.7f);
+                Actor = CubeActor;
+                break;
+            }
+            case 1:
+            {
+                ASphereActor* SphereActor = World->SpawnActor<ASphereActor>();
+                SphereActor->GetShapeComponent()->SetRadius(Size);
+                Actor = SphereActor;
+                break;
+            }
+            default:
+            {
+                ACapsuleActor* CapsuleActor = World->SpawnActor<ACapsuleActor>();
+                CapsuleActor->GetShapeComponent()->SetRadius(Size * 0.5f);
+                CapsuleActor->GetShapeComponent()->SetHalfHeight(Size);
+                Actor = CapsuleActor;
+                break;
+            }
+            }
+
+            Actor->SetActorLabel(FString::Printf(TEXT("Stress_Shape_%d"), Index));
+            Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+            SpawnedActors.Add(Actor);
+        }
+    }
+
+    {
+        FStressRandom Random(Settings.Seed, EStressActorKind::Script);
+        for (int32 Index = 0; Index < Settings.NumScriptedActors; ++Index)
+        {
+            AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>();
+            Actor->SetActorLabel(FString::Printf(TEXT("Stress_Script_%d"), Index));
+            Actor->SetActorLocation(Random.GetPointInCube(HalfExtent));
+            Actor->SetActorRotation(FRotator(0.f, Random.GetInRange(-180.f, 180.f), 0.f));
+            if (!StaticMeshPaths.IsEmpty())
+            {
+                Actor->GetStaticMeshComponent()->SetStaticMesh(FObjManager::CreateStaticMesh(StaticMeshPaths[Random.GetIndex(StaticMeshPaths.Num())]));
+            }
+
+            ULuaScriptComponent* ScriptComponent = Actor->AddComponent<ULuaScriptComponent>();
+            ScriptComponent->SetScriptPath(StressActorScriptPath);
+            ScriptComponent->SetDisplayName(TEXT("StressActor.lua"));
+            SpawnedActors.Add(Actor);
+        }
+    }
+
+    LogTemp.SetVerbosity(PrevVerbosity);
+
+    return SpawnedActors.Num() - NumBefore;
+}
+
+void FStressSceneGenerator::Clear()
+{
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    for (AActor* Actor : SpawnedActors)
+    {
+        // Editor에서 직접 지운 Actor는 건너뜁니다.
+        if (!IsValid(Actor))
+        {
+            continue;
+        }
+        if (Engine)
+        {
+            Engine->DeselectActor(Actor);
+        }
+        Actor->Destroy();
+    }
+    SpawnedActors.Empty();
+}
+
+
+bool FStressSceneRunner::Start(const FStressSceneRunSettings& InSettings)
+{
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    if (!Engine)
+    {
+        return false;
+    }
+
+    Settings = InSettings;
+    Settings.NumSteps = std::max(Settings.NumSteps, 1);
+    Settings.NumFrames = std::max(Settings.NumFrames, 1);
+    Settings.NumWarmupFrames = std::max(Settings.NumWarmupFrames, 0);
+
+    // BeginPlay, Lua와 Animation이 실행되도록 PIE World에 만듭니다.
+    bStartedPIE = !Engine->PIEWorld;
+    if (bStartedPIE)
+    {
+        Engine->StartPIE();
+    }
+    World = Engine->PIEWorld;
+
+    // 측정한 프레임이 모두 보관되어야 합니다.
+    if (FCpuProfiler::Get().GetHistorySize() < Settings.NumFrames)
+    {
+        FCpuProfiler::Get().SetHistorySize(Settings.NumFrames);
+    }
+
+    Results.Empty();
+    bRunning = true;
+    StartStep(0);
+    return true;
+}
+
+void FStressSceneRunner::StartStep(int32 StepIndex)
+{
+    CurrentStep = StepIndex;
+    NumStepFrames = 0;
+    StepStartCounters = FRHIStats::GetTotalCounters();
+    StepStartTransformCounters = FTransformCacheStats::GetTotalCounters();
+
+    Generator.Clear();
+
+    FStressSceneStepResult& Result = Results[Results.AddDefaulted()];
+    Result.Settings = Settings.Scene.Scaled(1 << StepIndex);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    Result.NumActors = Generator.Generate(World, Result.Settings);
+    Result.GenerateMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    UE_LOG(ELogLevel::Display, "StressScene: step %d/%d, spawned %d actors in %.1f ms (%s)",
+        StepIndex + 1, Settings.NumSteps, Result.NumActors, Result.GenerateMs, *Result.Settings.ToSpec());
+}
+
+void FStressSceneRunner::EndFrame()
+{
+    if (!bRunning)
+    {
+        return;
+    }
+
+    ++NumStepFrames;
+    if (NumStepFrames == Settings.NumWarmupFrames)
+    {
+        StepStartCounters = FRHIStats::GetTotalCounters();
+        StepStartTransformCounters = FTransformCacheStats::GetTotalCounters();
+    }
+}
+
+bool FStressSceneRunner::BeginFrame()
+{
+    // 마지막 측정 프레임은 이번 BeginFrame에서 FCpuProfiler에 들어갑니다.
+    if (!bRunning || NumStepFrames < Settings.NumWarmupFrames + Settings.NumFrames)
+    {
+        return false;
+    }
+
+    FinishStep();
+
+    if (CurrentStep + 1 < Settings.NumSteps)
+    {
+        StartStep(CurrentStep + 1);
+        return false;
+    }
+
+    Generator.Clear();
+    bRunning = false;
+
+    if (bStartedPIE)
+    {
+        if (UEditorEngine* Engine = Cast<UEditorEngine>(GEngine))
+        {
+            Engine->EndPIE();
+        }
+        World = nullptr;
+    }
+
+    const FString OutputPath = Settings.OutputPath.IsEmpty() ? FString(FStressSceneRunSettings::DefaultOutputPath) : Settings.OutputPath;
+    if (SaveResults(OutputPath))
+    {
+        UE_LOG(ELogLevel::Display, "StressScene: saved results to %s", *OutputPath);
+    }
+    else
+    {
+        UE_LOG(ELogLevel::Error, "StressScene: failed to save results to %s", *OutputPath);
+    }
+    return true;
+}
+
+void FStressSceneRunner::FinishStep()
+{
+    FStressSceneStepResult& Result = Results[CurrentStep];
+
+    const FRHICounters EndCounters = FRHIStats::GetTotalCounters();
+    Result.RHI.DrawCalls = EndCounters.DrawCalls - StepStartCounters.DrawCalls;
+    Result.RHI.BytesUploaded = EndCounters.BytesUploaded - StepStartCounters.BytesUploaded;
+    Result.RHI.BuffersCreated = EndCounters.BuffersCreated - StepStartCounters.BuffersCreated;
+    Result.RHI.StateChanges = EndCounters.StateChanges - StepStartCounters.StateChanges;
+
+    const FTransformCacheCounters& EndTransformCounters = FTransformCacheStats::GetTotalCounters();
+    Result.TransformCache.Requests = EndTransformCounters.Requests - StepStartTransformCounters.Requests;
+    Result.TransformCache.Recomputes = EndTransformCounters.Recomputes - StepStartTransformCounters.Recomputes;
+    Result.TransformCache.Invalidations = EndTransformCounters.Invalidations - StepStartTransformCounters.Invalidations;
+
+    const FCpuProfiler& Profiler = FCpuProfiler::Get();
+    Result.FrameTime = Profiler.GetFrameTimeSummary(Settings.NumFrames);
+    Profiler.GetStatSummaries(Result.Stats, Settings.NumFrames);
+
+    UE_LOG(ELogLevel::Display, "StressScene: %d actors, frame avg %.3f ms, p95 %.3f ms, max %.3f ms",
+        Result.NumActors, Result.FrameTime.AvgMs, Result.FrameTime.P95Ms, Result.FrameTime.MaxMs);
+    constexpr int32 MaxLines = 10;
+    for (int32 Index = 0; Index < Result.Stats.Num() && Index < MaxLines; ++Index)
+    {
+        const FProfileStatSummary& Summary = Result.Stats[Index];
+        UE_LOG(ELogLevel::Display, " - %s: avg %.3f ms, p95 %.3f ms, %.1f calls/frame",
+            *Summary.Name.ToString(), Summary.AvgMs, Summary.P95Ms, Summary.AvgCallsPerFrame);
+    }
+}
+
+bool FStressSceneRunner::SaveResults(const FString& Path) const
+{
+    const std::time_t Now = std::time(nullptr);
+    std::tm LocalTime = {};
+    localtime_s(&LocalTime, &Now);
+    char Date[32];
+    std::strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%S", &LocalTime);
+
+    try
+    {
+        json Json;
+        Json["context"] = {
+            { "date", Date },
+            { "executable", "EngineSIU" },
+            { "num_cpus", std::thread::hardware_concurrency() },
+#ifdef _DEBUG
+            { "library_build_type", "debug" },
+#else
+            { "library_build_type", "release" },
+#endif
+            { "math_isa", FMathKernels::GetISAName(FMathKernels::Get().ISA) },
+            { "scene", *Settings.Scene.ToSpec() },
+            { "warmup_frames", Settings.NumWarmupFrames },
+            { "frames", Settings.NumFrames },
+            { "fixed_delta_time", Settings.FixedDeltaTime },
+        };
+
+        json& Steps = Json["steps"];
+        Steps = json::array();
+        for (int32 StepIndex = 0; StepIndex < Results.Num(); ++StepIndex)
+        {
+            const FStressSceneStepResult& Result = Results[StepIndex];
+            const FStressSceneStepResult* Previous = StepIndex > 0 ? &Results[StepIndex - 1] : nullptr;
+
+            json Step = {
+                { "scene", *Result.Settings.ToSpec() },
+                { "num_actors", Result.NumActors },
+                { "generate_ms", Result.GenerateMs },
+                { "frame", {
+                    { "avg_ms", Result.FrameTime.AvgMs },
+                    { "p50_ms", Result.FrameTime.P50Ms },
+                    { "p95_ms", Result.FrameTime.P95Ms },
+                    { "p99_ms", Result.FrameTime.P99Ms },
+                    { "max_ms", Result.FrameTime.MaxMs },
+                } },
+                { "rhi_per_frame", {
+                    { "draw_calls", static_cast<double>(Result.RHI.DrawCalls) / Settings.NumFrames },
+                    { "bytes_uploaded", static_cast<double>(Result.RHI.BytesUploaded) / Settings.NumFrames },
+                    { "buffers_created", static_cast<double>(Result.RHI.BuffersCreated) / Settings.NumFrames },
+                    { "state_changes", static_cast<double>(Result.RHI.StateChanges) / Settings.NumFrames },
+                } },
+                { "transform_cache_per_frame", {
+                    { "requests", static_cast<double>(Result.TransformCache.Requests) / Settings.NumFrames },
+                    { "recomputes", static_cast<double>(Result.TransformCache.Recomputes) / Settings.NumFrames },
+                    { "saved", static_cast<double>(Result.TransformCache.GetSaved()) / Settings.NumFrames },
+                    { "invalidations", static_cast<double>(Result.TransformCache.Invalidations) / Settings.NumFrames },
+                } },
+            };
+
+            json& Stats = Step["stats"];
+            Stats = json::array();
+            for (const FProfileStatSummary& Summary : Result.Stats)
+            {
+                json Entry = {
+                    { "name", *Summary.Name.ToString() },
+                    { "avg_ms", Summary.AvgMs },
+                    { "avg_exclusive_ms", Summary.AvgExclusiveMs },
+                    { "p95_ms", Summary.P95Ms },
+                    { "max_ms", Summary.MaxMs },
+                    { "calls_per_frame", Summary.AvgCallsPerFrame },
+                };
+
+                // Scene이 두 배가 될 때 시간이 늘어난 차수, 1이면 선형이고 2에 가까우면 O(N^2)입니다.
+                if (Previous)
+                {
+                    for (const FProfileStatSummary& PreviousSummary : Previous->Stats)
+                    {
+                        if (PreviousSummary.Name == Summary.Name && PreviousSummary.AvgMs > 0.0 && Summary.AvgMs > 0.0)
+                        {
+                            Entry["scaling_exponent"] = std::log2(Summary.AvgMs / PreviousSummary.AvgMs);
+                            break;
+                        }
+                    }
+                }
+                Stats.push_back(std::move(Entry));
+            }
+            Steps.push_back(std::move(Step));
+        }
+
+        std::ofstream File(*Path);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        File << Json.dump(4);
+        return File.good();
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG(ELogLevel::Error, "Error writing stress scene JSON: %s", e.what());
+        return false;
+    }
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "Components/SceneComponent.h"
+#include "D3D11RHI/RHIStats.h"
+#include "HAL/PlatformType.h"
+#include "Stats/CpuProfiler.h"
+
+class AActor;
+class UWorld;
+
+
+/** Stress Scene에 만들 Actor 종류별 개수와 배치 */
+struct FStressSceneSettings
+{
+    int32 NumStaticMeshes = 0;
+
+    /** Contents의 Animation 중 하나를 반복 재생하는 SkeletalMesh */
+    int32 NumSkeletalMeshes = 0;
+
+    int32 NumPointLights = 0;
+    int32 NumSpotLights = 0;
+
+    /** Box, Sphere, Capsule Collision, 이웃과 겹치도록 Spacing보다 크게 만듭니다. */
+    int32 NumShapes = 0;
+
+    /** StressActor.lua로 매 Tick 움직이는 StaticMesh */
+    int32 NumScriptedActors = 0;
+
+    /** 위치, Asset, Animation, 색을 고르는 난수의 Seed, 같은 Seed와 Contents면 같은 Scene이 만들어집니다. */
+    uint32 Seed = 1;
+
+    /** Actor 사이의 평균 간격, 모든 Actor는 이 간격으로 채워지는 정육면체 안에 놓입니다. */
+    float Spacing = 10.f;
+
+    int32 GetNumActors() const;
+
+    /** Settings의 모든 개수에 Scale을 곱한 Settings */
+    FStressSceneSettings Scaled(int32 Scale) const;
+
+    /**
+     * "StaticMesh=1000,Shape=200,Seed=7"처럼 쉼표로 구분된 Key=Value를 읽습니다.
+     * Key는 StaticMesh, SkeletalMesh, PointLight, SpotLight, Shape, Script, Seed, Spacing이고, All=N은 모든 종류를 N개로 정합니다.
+     * @return 모르는 Key나 숫자가 아닌 Value가 있으면 false
+     */
+    bool ParseSpec(const FString& Spec);
+
+    /** ParseSpec으로 다시 읽을 수 있는 문자열 */
+    FString ToSpec() const;
+};
+
+
+/**
+ * FStressSceneSettings대로 World에 Actor를 만들고 지웁니다.
+ *
+ * - Actor 종류마다 Seed에서 나온 별도의 난수열을 쓰므로, 한 종류의 개수를 바꿔도 다른 종류의 배치는 그대로입니다.
+ * - Mesh와 Animation은 Asset Registry에서 경로 순으로 정렬한 목록에서 고릅니다.
+ */
+class FStressSceneGenerator
+{
+public:
+    /** 만든 Actor 수를 반환합니다. 이전에 만든 Actor는 그대로 둡니다. */
+    int32 Generate(UWorld* World, const FStressSceneSettings& Settings);
+
+    /** Generate로 만든 Actor를 모두 지웁니다. World가 이미 해제되었다면 호출하지 않습니다. */
+    void Clear();
+
+    const TArray<AActor*>& GetActors() const { return SpawnedActors; }
+
+private:
+    TArray<AActor*> SpawnedActors;
+};
+
+
+/** 같은 Scene 크기로 측정한 결과 */
+struct FStressSceneStepResult
+{
+    FStressSceneSettings Settings;
+
+    int32 NumActors = 0;
+    double GenerateMs = 0.0;
+
+    FProfileStatSummary FrameTime;
+    TArray<FProfileStatSummary> Stats;
+
+    /** 측정한 프레임 동안의 RHI 호출 수 */
+    FRHICounters RHI;
+
+    /** 측정한 프레임 동안의 World Transform 캐시 통계 */
+    FTransformCacheCounters TransformCache;
+};
+
+
+struct FStressSceneRunSettings
+{
+    /** 경로를 지정하지 않았을 때 결과를 저장하는 경로 */
+    static constexpr const ANSICHAR* DefaultOutputPath = "Saved/StressScene.json";
+
+    FStressSceneSettings Scene;
+
+    /** Scene 크기를 두 배씩 늘려가며 측정하는 횟수, 2 이상이면 크기에 따라 Stat이 늘어나는 차수를 함께 저장합니다. */
+    int32 NumSteps = 1;
+
+    /** Scene을 만든 뒤 측정하지 않고 버리는 프레임 수, BeginPlay와 Lua 초기화가 여기에 들어갑니다. */
+    int32 NumWarmupFrames = 10;
+
+    int32 NumFrames = 300;
+
+    /** 매 프레임 World에 넘기는 DeltaTime(초), 실제 프레임 시간과 상관없이 같은 시뮬레이션이 되도록 고정합니다. */
+    float FixedDeltaTime = 1.f / 60.f;
+
+    FString OutputPath;
+};
+
+
+/**
+ * PIE World에 Stress Scene을 만들고 고정된 DeltaTime으로 정해진 프레임 수를 돌리면서,
+ * 측정한 프레임의 Stat별 시간, RHI 호출 수와 World Transform 캐시 통계를 JSON으로 저장합니다.
+ *
+ * FEngineLoop가 -StressScene으로 실행되었을 때 사용하며, 렌더링을 포함하려면 창 모드로, World만 재려면 -Headless로 실행합니다.
+ */
+class FStressSceneRunner
+{
+public:
+    /** PIE를 시작하고 첫 Step의 Scene을 만듭니다. */
+    bool Start(const FStressSceneRunSettings& InSettings);
+
+    bool IsRunning() const { return bRunning; }
+
+    float GetFixedDeltaTime() const { return Settings.FixedDeltaTime; }
+
+    /**
+     * FCpuProfiler::BeginFrame 직후 호출합니다. 지난 프레임으로 Step 측정이 끝났다면 결과를 모으고 다음 Step을 시작합니다.
+     * @return 모든 Step이 끝나 결과를 저장했으면 true
+     */
+    bool BeginFrame();
+
+    /** 프레임 마지막에 호출합니다. Warmup이 끝난 프레임부터 RHI 호출 수를 셉니다. */
+    void EndFrame();
+
+    const TArray<FStressSceneStepResult>& GetResults() const { return Results; }
+
+    bool SaveResults(const FString& Path) const;
+
+private:
+    void StartStep(int32 StepIndex);
+    void FinishStep();
+
+private:
+    FStressSceneRunSettings Settings;
+    FStressSceneGenerator Generator;
+    UWorld* World = nullptr;
+
+    TArray<FStressSceneStepResult> Results;
+
+    int32 CurrentStep = 0;
+    int32 NumStepFrames = 0;
+    FRHICounters StepStartCounters;
+    FTransformCacheCounters StepStartTransformCounters;
+
+    bool bRunning = false;
+
+    /** Start에서 PIE를 시작했다면 끝날 때 PIE도 끝냅니다. */
+    bool bStartedPIE = false;
+};
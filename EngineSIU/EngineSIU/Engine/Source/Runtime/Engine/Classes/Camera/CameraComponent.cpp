@@ -4,6 +4,13 @@
 #include "UObject/Casts.h"
 #include "World/World.h"
 
+UCameraComponent::UCameraComponent()
+{
+    // MainPlayer가 이동을 마친 뒤에 따라갑니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
 UObject* UCameraComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
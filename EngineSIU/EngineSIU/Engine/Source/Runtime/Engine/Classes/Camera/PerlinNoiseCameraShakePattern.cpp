@@ -2,18 +2,28 @@
 #pragma once
 
 #include "PerlinNoiseCameraShakePattern.h"
+#include "Math/MathKernels.h"
 
 float FPerlinNoiseShaker::Update(float DeltaTime, float AmplitudeMultiplier, float FrequencyMultiplier, float& InOutCurrentOffset) const
 {
-    const float TotalAmplitude = Amplitude * AmplitudeMultiplier;
+    const float TotalAmplitude = Advance(DeltaTime, AmplitudeMultiplier, FrequencyMultiplier, InOutCurrentOffset);
     if (TotalAmplitude != 0.f)
     {
-        InOutCurrentOffset += DeltaTime * Frequency * FrequencyMultiplier;
         return TotalAmplitude * FMath::PerlinNoise1D(InOutCurrentOffset);
     }
     return 0.f;
 }
 
+float FPerlinNoiseShaker::Advance(float DeltaTime, float AmplitudeMultiplier, float FrequencyMultiplier, float& InOutCurrentOffset) const
+{
+    const float TotalAmplitude = Amplitude * AmplitudeMultiplier;
+    if (TotalAmplitude != 0.f)
+    {
+        InOutCurrentOffset += DeltaTime * Frequency * FrequencyMultiplier;
+    }
+    return TotalAmplitude;
+}
+
 UPerlinNoiseCameraShakePattern::UPerlinNoiseCameraShakePattern()
     : Super()
 {
@@ -64,13 +74,33 @@ void UPerlinNoiseCameraShakePattern::UpdateShakePatternImpl(const FCameraShakePa
 
 void UPerlinNoiseCameraShakePattern::UpdatePerlinNoise(float DeltaTime, FCameraShakePatternUpdateResult& OutResult)
 {
-    OutResult.Location.X = X.Update(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.X);
-    OutResult.Location.Y = Y.Update(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.Y);
-    OutResult.Location.Z = Z.Update(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.Z);
+    // 7개 성분의 Offset을 먼저 진행하고, 노이즈는 한 번에 계산합니다.
+    constexpr int32 NumShakers = 7;
+    const float Amplitudes[NumShakers] = {
+        X.Advance(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.X),
+        Y.Advance(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.Y),
+        Z.Advance(DeltaTime, LocationAmplitudeMultiplier, LocationFrequencyMultiplier, CurrentLocationOffset.Z),
+        Pitch.Advance(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.X),
+        Yaw.Advance(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.Y),
+        Roll.Advance(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.Z),
+        FOV.Advance(DeltaTime, 1.f, 1.f, CurrentFOVOffset),
+    };
+    const float Offsets[NumShakers] = {
+        CurrentLocationOffset.X, CurrentLocationOffset.Y, CurrentLocationOffset.Z,
+        CurrentRotationOffset.X, CurrentRotationOffset.Y, CurrentRotationOffset.Z,
+        CurrentFOVOffset,
+    };
+
+    float Noises[NumShakers];
+    FMathKernels::Get().PerlinNoise1D(Noises, Offsets, NumShakers);
+
+    OutResult.Location.X = Amplitudes[0] * Noises[0];
+    OutResult.Location.Y = Amplitudes[1] * Noises[1];
+    OutResult.Location.Z = Amplitudes[2] * Noises[2];
 
-    OutResult.Rotation.Pitch = Pitch.Update(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.X);
-    OutResult.Rotation.Yaw = Yaw.Update(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.Y);
-    OutResult.Rotation.Roll = Roll.Update(DeltaTime, RotationAmplitudeMultiplier, RotationFrequencyMultiplier, CurrentRotationOffset.Z);
+    OutResult.Rotation.Pitch = Amplitudes[3] * Noises[3];
+    OutResult.Rotation.Yaw = Amplitudes[4] * Noises[4];
+    OutResult.Rotation.Roll = Amplitudes[5] * Noises[5];
 
-    OutResult.FOV = FOV.Update(DeltaTime, 1.f, 1.f, CurrentFOVOffset);
+    OutResult.FOV = Amplitudes[6] * Noises[6];
 }
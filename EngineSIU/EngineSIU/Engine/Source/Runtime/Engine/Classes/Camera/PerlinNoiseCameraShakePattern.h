@@ -18,6 +18,12 @@ struct FPerlinNoiseShaker
 
     /** Advances the shake time and returns the current value */
     float Update(float DeltaTime, float AmplitudeMultiplier, float FrequencyMultiplier, float& InOutCurrentOffset) const;
+
+    /**
+     * Update에서 노이즈 계산만 뺀 것으로, 여러 Shaker의 노이즈를 FMathKernels::PerlinNoise1D로 한 번에 계산할 때 사용합니다.
+     * @return 노이즈에 곱할 진폭, 0이면 Offset을 진행하지 않습니다.
+     */
+    float Advance(float DeltaTime, float AmplitudeMultiplier, float FrequencyMultiplier, float& InOutCurrentOffset) const;
 };
 
 class UPerlinNoiseCameraShakePattern : public USimpleCameraShakePattern
@@ -4,7 +4,7 @@
 float FWaveOscillator::Initialize(float& OutInitialOffset) const
 {
     OutInitialOffset = 0.f;
-    return Amplitude * FMath::Sin(OutInitialOffset);
+    return Amplitude * FMath::FastSin(OutInitialOffset);
 }
 
 float FWaveOscillator::Update(float DeltaTime, float AmplitudeMultiplier, float FrequencyMultiplier, float& InOutCurrentOffset) const
@@ -13,7 +13,7 @@ float FWaveOscillator::Update(float DeltaTime, float AmplitudeMultiplier, float
     if (TotalAmplitude != 0.f)
     {
         InOutCurrentOffset += DeltaTime * Frequency * FrequencyMultiplier * (2.f * PI);
-        return TotalAmplitude * FMath::Sin(InOutCurrentOffset);
+        return TotalAmplitude * FMath::FastSin(InOutCurrentOffset);
     }
     return 0.f;
 }
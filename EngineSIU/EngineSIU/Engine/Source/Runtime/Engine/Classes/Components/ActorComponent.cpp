@@ -1,8 +1,17 @@
 #include "ActorComponent.h"
 
+#include "Engine/TickTaskManager.h"
 #include "GameFramework/Actor.h"
+#include "World/World.h"
 
 
+UActorComponent::UActorComponent()
+{
+    // Tick 로직이 있는 하위 클래스에서만 bCanEverTick을 켭니다.
+    PrimaryComponentTick.Target = this;
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
 UObject* UActorComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
@@ -90,6 +99,26 @@ void UActorComponent::TickComponent(float DeltaTime)
 {
 }
 
+void UActorComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+    if (!bRegister)
+    {
+        PrimaryComponentTick.UnRegisterTickFunction();
+        return;
+    }
+
+    AActor* MyOwner = GetOwner();
+    UWorld* World = MyOwner ? MyOwner->GetWorld() : nullptr;
+    if (!World || bIsBeingDestroyed)
+    {
+        return;
+    }
+
+    // Component는 항상 Owner Actor의 Tick이 끝난 뒤에 Tick됩니다.
+    PrimaryComponentTick.AddPrerequisite(MyOwner, MyOwner->PrimaryActorTick);
+    PrimaryComponentTick.RegisterTickFunction(World->GetTickTaskManager());
+}
+
 void UActorComponent::OnComponentDestroyed()
 {
 }
@@ -110,6 +139,8 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
 
     bIsBeingDestroyed = true;
 
+    RegisterComponentTickFunctions(false);
+
     // Owner에서 Component 제거하기
     if (AActor* MyOwner = GetOwner())
     {
@@ -147,3 +178,33 @@ void UActorComponent::Deactivate()
     // TODO: Tick 멈추기
     bIsActive = false;
 }
+
+
+void FActorComponentTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType)
+{
+    if (!Target || Target->IsBeingDestroyed())
+    {
+        return;
+    }
+
+    if (TickType == LEVELTICK_ViewportsOnly)
+    {
+        const AActor* Owner = Target->GetOwner();
+        if (!Owner || !Owner->IsActorTickInEditor())
+        {
+            return;
+        }
+    }
+
+    Target->TickComponent(DeltaTime);
+}
+
+const AActor* FActorComponentTickFunction::GetSignificanceActor() const
+{
+    return Target ? Target->GetOwner() : nullptr;
+}
+
+FString FActorComponentTickFunction::DiagnosticMessage() const
+{
+    return Target ? Target->GetName() + TEXT("[TickComponent]") : FString(TEXT("<null>[TickComponent]"));
+}
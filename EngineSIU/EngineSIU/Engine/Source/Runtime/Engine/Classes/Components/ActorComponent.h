@@ -1,4 +1,5 @@
 #pragma once
+#include "Engine/EngineBaseTypes.h"
 #include "Engine/EngineTypes.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
@@ -13,7 +14,7 @@ private:
     friend class AActor;
 
 public:
-    UActorComponent() = default;
+    UActorComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
@@ -36,9 +37,15 @@ public:
     /** 모든 초기화가 끝나고, 준비가 되었을 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 틱마다 호출됩니다. */
+    /** 매 틱마다 PrimaryComponentTick에 의해, Owner Actor의 Tick이 끝난 뒤에 호출됩니다. */
     virtual void TickComponent(float DeltaTime);
 
+    /** Component의 Tick Function을 Owner가 속한 World의 Tick Manager에 등록하거나 해제합니다. */
+    void RegisterComponentTickFunctions(bool bRegister);
+
+    void SetComponentTickEnabled(bool bEnabled) { PrimaryComponentTick.SetTickFunctionEnable(bEnabled); }
+    bool IsComponentTickEnabled() const { return PrimaryComponentTick.IsTickFunctionEnabled(); }
+
     /** Component가 제거되었을 때 호출됩니다. */
     virtual void OnComponentDestroyed();
 
@@ -64,6 +71,9 @@ public:
     /** Component가 현재 활성화 중인지 여부를 반환합니다. */
     bool IsActive() const { return bIsActive; }
 
+    /** Component가 삭제 처리중인지 여부를 반환합니다. */
+    bool IsBeingDestroyed() const { return bIsBeingDestroyed; }
+
     void Activate();
     void Deactivate();
 
@@ -83,6 +93,12 @@ private:
     uint8 bIsActive : 1 = true;
 
 public:
+    /**
+     * Component의 Tick Function, Tick 설정(bCanEverTick, TickGroup, TickInterval 등)은 생성자에서 변경합니다.
+     * 기본적으로 bCanEverTick이 false이므로, TickComponent를 override하는 클래스에서 켜야 합니다.
+     */
+    FActorComponentTickFunction PrimaryComponentTick;
+
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
     uint8 bAutoActive : 1 = true;
 };
@@ -23,10 +23,13 @@ public:
     {
         OutRefSkeleton = RefSkeleton;
     }
+    /** 매 프레임 호출되는 곳에서는 복사하지 않도록 참조를 반환하는 버전을 사용합니다. */
+    const FReferenceSkeleton& GetRefSkeleton() const { return RefSkeleton; }
     void GetInverseBindPoseMatrices(TArray<FMatrix>& OutMatrices) const
     {
         OutMatrices = InverseBindPoseMatrices;
     }
+    const TArray<FMatrix>& GetInverseBindPoseMatrices() const { return InverseBindPoseMatrices; }
     //void GetDuplicatedVerticesSection(TArray<FSkeletalVertex>& OutDuplicatedVertices, int32 SectionIndex) const
     //{
     //    OutDuplicatedVertices = DuplicatedVertices[SectionIndex];
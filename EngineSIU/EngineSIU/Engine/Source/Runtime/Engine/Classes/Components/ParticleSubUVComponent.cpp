@@ -8,6 +8,12 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 {
     SetType(StaticClass()->GetName());
     bIsLoop = true;
+
+    // TickComponent는 elapsedTime, indexU, indexV, UVScale, UVOffset과 (Loop가 아닐 때) bIsActive만 쓰고,
+    // Texture의 크기는 읽기만 하며 Transform은 건드리지 않으므로 Worker 스레드에서 Tick합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bRunOnAnyThread = true;
+    PrimaryComponentTick.bAllowSignificanceThrottling = true;
 }
 
 // Duplicate: 버퍼 포인터는 복사하지 않고 애니메이션 상태만 복제
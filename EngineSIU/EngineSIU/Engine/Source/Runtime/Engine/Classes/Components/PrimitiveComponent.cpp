@@ -18,6 +18,10 @@ FOverlapInfo::FOverlapInfo(UPrimitiveComponent* InComponent, int32 InBodyIndex)
     OverlapInfo.Item = InBodyIndex;
 }
 
+// 한 번의 UpdateOverlaps에서 다루는 Overlap은 대부분 몇 개 되지 않으므로, 임시 배열은 Inline으로 할당합니다.
+using FInlineOverlapInfoArray = TArray<FOverlapInfo, TInlineAllocator<3>>;
+using FInlineOverlapPointerArray = TArray<const FOverlapInfo*, TInlineAllocator<8>>;
+
 // Helper for finding the index of an FOverlapInfo in an Array using the FFastOverlapInfoCompare predicate, knowing that at least one overlap is valid (non-null).
 template<class AllocatorType>
 int32 IndexOfOverlapFast(const TArray<FOverlapInfo, AllocatorType>& OverlapArray, const FOverlapInfo& SearchItem)
@@ -473,8 +477,8 @@ void UPrimitiveComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPend
                 }
             }
 
-            TArray<FOverlapInfo> OverlapMultiResult;
-            TArray<const FOverlapInfo*> NewOverlappingComponentPtrs;
+            FInlineOverlapInfoArray OverlapMultiResult;
+            FInlineOverlapPointerArray NewOverlappingComponentPtrs;
 
             if (this && GetGenerateOverlapEvents())
             {
@@ -530,7 +534,7 @@ void UPrimitiveComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPend
 
             if (OverlappingComponents.Num() > 0)
             {
-                TArray<const FOverlapInfo*> OldOverlappingComponentPtrs;
+                FInlineOverlapPointerArray OldOverlappingComponentPtrs;
                 if (bIgnoreChildren)
                 {
                     GetPointersToArrayDataByPredicate(OldOverlappingComponentPtrs, OverlappingComponents, FPredicateOverlapHasDifferentActor(*MyActor));
@@ -561,7 +565,7 @@ void UPrimitiveComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPend
                 if (NumOldOverlaps > 0)
                 {
                     // Now we have to make a copy of the overlaps because we can't keep pointers to them, that list is about to be manipulated in EndComponentOverlap().
-                    TArray<FOverlapInfo> OldOverlappingComponents;
+                    FInlineOverlapInfoArray OldOverlappingComponents;
                     OldOverlappingComponents.SetNum(NumOldOverlaps);
                     for (int32 i=0; i < NumOldOverlaps; i++)
                     {
@@ -599,7 +603,7 @@ void UPrimitiveComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* NewPend
         ClearComponentOverlaps(bDoNotifies, false);
     }
 
-    TArray<USceneComponent*> AttachedChildren(GetAttachChildren());
+    const FAttachChildrenArray AttachedChildren(GetAttachChildren());
     for (USceneComponent* const ChildComp : AttachedChildren)
     {
         if (ChildComp)
@@ -614,7 +618,8 @@ void UPrimitiveComponent::ClearComponentOverlaps(bool bDoNotifies, bool bSkipNot
     if (OverlappingComponents.Num() > 0)
     {
         // Make a copy since EndComponentOverlap will remove items from OverlappingComponents.
-        const TArray<FOverlapInfo> OverlapsCopy(OverlappingComponents);
+        FInlineOverlapInfoArray OverlapsCopy;
+        OverlapsCopy.Append(OverlappingComponents.GetData(), OverlappingComponents.Num());
         for (const FOverlapInfo& OtherOverlap : OverlapsCopy)
         {
             EndComponentOverlap(OtherOverlap, bDoNotifies, bSkipNotifySelf);
@@ -9,6 +9,9 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = FVector(0.f, 0.f, 0.f);
     ProjectileLifetime = 10.0f; // 기본 생명주기 설정
     AccumulatedTime = 0;
+
+    // Owner의 RootComponent 위치를 바꾸고 수명이 다하면 Owner를 Destroy하므로 게임 스레드에서 Tick합니다.
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -1,4 +1,5 @@
 #include "Components/SceneComponent.h"
+#include "Async/JobSystem.h"
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
@@ -6,9 +7,44 @@
 #include "Engine/HitResult.h"
 #include "GameFramework/Actor.h"
 
+FTransformCacheCounters FTransformCacheStats::TotalCounters;
+FTransformCacheCounters FTransformCacheStats::FrameStartCounters;
+FTransformCacheCounters FTransformCacheStats::LastFrameCounters;
+
+
+void FTransformCacheStats::BeginFrame()
+{
+    LastFrameCounters.Requests = TotalCounters.Requests - FrameStartCounters.Requests;
+    LastFrameCounters.Recomputes = TotalCounters.Recomputes - FrameStartCounters.Recomputes;
+    LastFrameCounters.Invalidations = TotalCounters.Invalidations - FrameStartCounters.Invalidations;
+
+    FrameStartCounters = TotalCounters;
+}
+
+
+namespace
+{
+/**
+ * FMatrix::GetRotationMatrix(Rotator)와 같은 행렬을 만드는 Quat
+ * FQuat(Matrix)는 행렬의 역회전을 만들므로 뒤집습니다. FQuat::Rotator()로 되돌리면 같은 회전이 됩니다.
+ */
+FQuat RotatorToQuat(const FRotator& Rotator)
+{
+    return FQuat(FMatrix::GetRotationMatrix(Rotator)).GetInverse();
+}
+
+/** World Transform 캐시는 Lock 없이 갱신하므로, Job System이 동작하는 동안에는 게임 스레드에서만 접근할 수 있습니다. */
+bool IsInTransformThread()
+{
+    const FJobSystem& JobSystem = FJobSystem::Get();
+    return !JobSystem.IsRunning() || JobSystem.IsInGameThread();
+}
+}
+
+
 USceneComponent::USceneComponent()
     : RelativeLocation(FVector(0.f, 0.f, 0.f))
-    , RelativeRotation(FVector(0.f, 0.f, 0.f))
+    , RelativeRotation(FQuat::Identity)
     , RelativeScale3D(FVector(1.f, 1.f, 1.f))
 {
 }
@@ -28,7 +64,7 @@ void USceneComponent::GetProperties(TMap<FString, FString>& OutProperties) const
 {
     Super::GetProperties(OutProperties);
     OutProperties.Add(TEXT("RelativeLocation"), *RelativeLocation.ToString());
-    OutProperties.Add(TEXT("RelativeRotation"), *RelativeRotation.ToString());
+    OutProperties.Add(TEXT("RelativeRotation"), *GetRelativeRotation().ToString());
     OutProperties.Add(TEXT("RelativeScale3D"), *RelativeScale3D.ToString());
 
     USceneComponent* ParentComp = GetAttachParent();
@@ -54,13 +90,16 @@ void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
     TempStr = InProperties.Find(TEXT("RelativeRotation"));
     if (TempStr)
     {
-        RelativeRotation.InitFromString(*TempStr);
+        FRotator Rotation;
+        Rotation.InitFromString(*TempStr);
+        RelativeRotation = RotatorToQuat(Rotation);
     }
     TempStr = InProperties.Find(TEXT("RelativeScale3D"));
     if (TempStr)
     {
         RelativeScale3D.InitFromString(*TempStr);
     }
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::InitializeComponent()
@@ -82,7 +121,7 @@ int USceneComponent::CheckRayIntersection(const FVector& InRayOrigin, const FVec
 
 void USceneComponent::DestroyComponent(bool bPromoteChildren)
 {
-    TArray<USceneComponent*> ChildrenCopy = AttachChildren;
+    FAttachChildrenArray ChildrenCopy = AttachChildren;
     for (auto& Child : ChildrenCopy)
     {
         if (Child == nullptr)
@@ -154,19 +193,20 @@ FVector USceneComponent::GetUpVector() const
 
 void USceneComponent::AddLocation(const FVector& InAddValue)
 {
-    RelativeLocation = RelativeLocation + InAddValue;
-
+    SetRelativeLocation(RelativeLocation + InAddValue);
 }
 
 void USceneComponent::AddRotation(const FRotator& InAddValue)
 {
-    RelativeRotation = RelativeRotation + InAddValue;
-    RelativeRotation.Normalize();
+    FRotator Rotation = GetRelativeRotation() + InAddValue;
+    Rotation.Normalize();
+    RelativeRotation = RotatorToQuat(Rotation);
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::AddScale(const FVector& InAddValue)
 {
-    RelativeScale3D = RelativeScale3D + InAddValue;
+    SetRelativeScale3D(RelativeScale3D + InAddValue);
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
@@ -177,6 +217,8 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
         AttachParent->AttachChildren.Remove(this);
     }
 
+    MarkWorldTransformDirty();
+
     // InParent도 nullptr이면 부모를 nullptr로 설정
     if (InParent == nullptr)
     {
@@ -205,7 +247,7 @@ void USceneComponent::SetWorldLocation(const FVector& InLocation)
         NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
     }
     FVector NewRelativeLocation = NewRelativeMatrix.GetTranslationVector();
-    RelativeLocation = NewRelativeLocation;
+    SetRelativeLocation(NewRelativeLocation);
 }
 
 void USceneComponent::SetWorldRotation(const FRotator& InRotation)
@@ -223,8 +265,7 @@ void USceneComponent::SetWorldRotation(const FQuat& InQuat)
         NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
     }
     FQuat NewRelativeRotation = FQuat(NewRelativeMatrix);
-    RelativeRotation = FRotator(NewRelativeRotation);
-    RelativeRotation.Normalize();   
+    SetRelativeRotation(NewRelativeRotation);
 }
 
 void USceneComponent::SetWorldScale3D(const FVector& InScale)
@@ -237,19 +278,19 @@ void USceneComponent::SetWorldScale3D(const FVector& InScale)
         NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
     }
     FVector NewRelativeScale = NewRelativeMatrix.GetScaleVector();
-    RelativeScale3D = NewRelativeScale;
+    SetRelativeScale3D(NewRelativeScale);
 }
 
 FVector USceneComponent::GetWorldLocation() const
 {
-    return GetWorldMatrix().GetTranslationVector();
+    ConditionalUpdateWorldTransform();
+    return CachedWorldRotationTranslation.GetTranslationVector();
 }
 
 FRotator USceneComponent::GetWorldRotation() const
 {
-    FMatrix WorldMatrix = GetWorldMatrix().GetMatrixWithoutScale();
-    FQuat Quat = WorldMatrix.ToQuat();
-    return FRotator(Quat);
+    ConditionalUpdateWorldTransform();
+    return FRotator(CachedWorldRotationTranslation.ToQuat());
 }
 
 FVector USceneComponent::GetWorldScale3D() const
@@ -264,7 +305,7 @@ FMatrix USceneComponent::GetScaleMatrix() const
 
 FMatrix USceneComponent::GetRotationMatrix() const
 {
-    return FMatrix::GetRotationMatrix(RelativeRotation);
+    return RelativeRotation.ToMatrix();
 }
 
 FMatrix USceneComponent::GetTranslationMatrix() const
@@ -274,27 +315,66 @@ FMatrix USceneComponent::GetTranslationMatrix() const
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    FMatrix ScaleMat = GetScaleMatrix();
-    FMatrix RotationMat = GetRotationMatrix();
-    FMatrix TranslationMat = GetTranslationMatrix();
+    ConditionalUpdateWorldTransform();
+    return CachedWorldMatrix;
+}
 
-    FMatrix RTMat = RotationMat * TranslationMat;
+void USceneComponent::MarkWorldTransformDirty()
+{
+    assert(IsInTransformThread() && "USceneComponent: Transform은 게임 스레드에서만 바꿀 수 있습니다.");
 
-    USceneComponent* Parent = AttachParent;
-    while (Parent)
+    // Dirty인 컴포넌트의 자식은 이미 모두 Dirty이므로 더 내려가지 않습니다.
+    if (bWorldTransformDirty)
     {
-        FMatrix ParentScaleMat = Parent->GetScaleMatrix();
-        FMatrix ParentRotationMat = Parent->GetRotationMatrix();
-        FMatrix ParentTranslationMat = Parent->GetTranslationMatrix();
-        
-        ScaleMat = ScaleMat * ParentScaleMat;
-        
-        FMatrix ParentRTMat = ParentRotationMat * ParentTranslationMat;
-        RTMat = RTMat * ParentRTMat;
-
-        Parent = Parent->AttachParent;
+        return;
+    }
+
+    bWorldTransformDirty = true;
+    FTransformCacheStats::AddInvalidation();
+
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
     }
-    return ScaleMat * RTMat;
+}
+
+void USceneComponent::ConditionalUpdateWorldTransform() const
+{
+    assert(IsInTransformThread() && "USceneComponent: World Transform은 게임 스레드에서만 읽을 수 있습니다.");
+
+    FTransformCacheStats::AddRequest();
+    if (bWorldTransformDirty)
+    {
+        UpdateWorldTransform();
+    }
+}
+
+void USceneComponent::UpdateWorldTransform() const
+{
+    FTransformCacheStats::AddRecompute();
+
+    // Rotation * Translation
+    FMatrix RTMat = GetRotationMatrix();
+    RTMat.M[3][0] = RelativeLocation.X;
+    RTMat.M[3][1] = RelativeLocation.Y;
+    RTMat.M[3][2] = RelativeLocation.Z;
+
+    FVector Scale = RelativeScale3D;
+
+    if (AttachParent)
+    {
+        AttachParent->ConditionalUpdateWorldTransform();
+        RTMat = RTMat * AttachParent->CachedWorldRotationTranslation;
+        Scale = Scale * AttachParent->CachedWorldScale;
+    }
+
+    CachedWorldRotationTranslation = RTMat;
+    CachedWorldScale = Scale;
+    CachedWorldMatrix = FMatrix::GetScaleMatrix(Scale) * RTMat;
+    bWorldTransformDirty = false;
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent)
@@ -313,6 +393,8 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
+
+        MarkWorldTransformDirty();
     }
 }
 
@@ -326,6 +408,22 @@ void USceneComponent::DetachFromComponent(USceneComponent* Target)
     }
 
     Target->AttachChildren.Remove(this);
+
+    // 부모의 자식 목록에서 빠지면 부모가 바뀌어도 Dirty를 받지 못하므로, 부모와의 연결도 끊습니다.
+    if (AttachParent == Target)
+    {
+        AttachParent = nullptr;
+    }
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::SetRelativeLocation(const FVector& InLocation)
+{
+    if (RelativeLocation != InLocation)
+    {
+        RelativeLocation = InLocation;
+        MarkWorldTransformDirty();
+    }
 }
 
 void USceneComponent::SetRelativeRotation(const FRotator& InRotation)
@@ -335,10 +433,21 @@ void USceneComponent::SetRelativeRotation(const FRotator& InRotation)
 
 void USceneComponent::SetRelativeRotation(const FQuat& InQuat)
 {
-    FQuat NormalizedQuat = InQuat.GetNormalized();
+    const FQuat NormalizedQuat = InQuat.GetNormalized();
+    if (!RelativeRotation.Equals(NormalizedQuat, 0.f))
+    {
+        RelativeRotation = NormalizedQuat;
+        MarkWorldTransformDirty();
+    }
+}
 
-    RelativeRotation = NormalizedQuat.Rotator();
-    RelativeRotation.Normalize();
+void USceneComponent::SetRelativeScale3D(const FVector& InScale)
+{
+    if (RelativeScale3D != InScale)
+    {
+        RelativeScale3D = InScale;
+        MarkWorldTransformDirty();
+    }
 }
 
 void USceneComponent::UpdateOverlaps(const TArray<FOverlapInfo>* PendingOverlaps, bool bDoNotifies, const TArray<const FOverlapInfo>* OverlapsAtEndLocation)
@@ -358,7 +467,7 @@ bool USceneComponent::MoveComponent(const FVector& Delta, const FRotator& NewRot
 
 void USceneComponent::UpdateOverlapsImpl(const TArray<FOverlapInfo>* PendingOverlaps, bool bDoNotifies, const TArray<const FOverlapInfo>* OverlapsAtEndLocation)
 {
-    TArray<USceneComponent*> AttachedChildren(AttachChildren);
+    FAttachChildrenArray AttachedChildren(AttachChildren);
     for (USceneComponent* ChildComponent : AttachedChildren)
     {
         if (ChildComponent)
@@ -1,16 +1,70 @@
 #pragma once
 #include "ActorComponent.h"
+#include "Math/Matrix.h"
+#include "Math/Quat.h"
 #include "Math/Rotator.h"
 #include "UObject/ObjectMacros.h"
 
 struct FHitResult;
 struct FOverlapInfo;
 
+
+/** USceneComponent의 World Transform 캐시 통계 한 묶음 */
+struct FTransformCacheCounters
+{
+    /** GetWorldMatrix, GetWorldLocation 등으로 World Transform을 읽은 수, 자식을 계산하며 부모를 읽은 것도 포함합니다. */
+    uint64 Requests = 0;
+
+    /** 캐시가 Dirty여서 다시 계산한 수 */
+    uint64 Recomputes = 0;
+
+    /** Relative Transform이나 부모가 바뀌어 Dirty가 된 Component 수 */
+    uint64 Invalidations = 0;
+
+    /** 캐시 덕분에 하지 않은 계산 수, 캐시가 없었다면 Requests마다 부모까지 모두 다시 계산했습니다. */
+    uint64 GetSaved() const { return Requests - Recomputes; }
+};
+
+
+/**
+ * USceneComponent의 World Transform 캐시를 세는 클래스
+ *
+ * Transform의 변경과 World Transform 조회는 게임 스레드에서만 할 수 있으므로(SceneComponent.cpp에서 assert로 검사합니다) atomic을 쓰지 않습니다.
+ * 따라서 bRunOnAnyThread로 Worker 스레드에서 Tick하는 컴포넌트는 Transform을 바꾸거나 읽으면 안됩니다.
+ */
+struct FTransformCacheStats
+{
+private:
+    static FTransformCacheCounters TotalCounters;
+
+    // 프레임 단위 통계
+    static FTransformCacheCounters FrameStartCounters;
+    static FTransformCacheCounters LastFrameCounters;
+
+public:
+    static void AddRequest() { ++TotalCounters.Requests; }
+    static void AddRecompute() { ++TotalCounters.Recomputes; }
+    static void AddInvalidation() { ++TotalCounters.Invalidations; }
+
+    /** 시작 후 누적 값 */
+    static const FTransformCacheCounters& GetTotalCounters() { return TotalCounters; }
+
+    /** 지난 프레임 동안의 값 */
+    static const FTransformCacheCounters& GetLastFrameCounters() { return LastFrameCounters; }
+
+    /** 지난 프레임 값을 보관합니다. 게임 스레드에서 매 프레임 시작 시 호출합니다. */
+    static void BeginFrame();
+};
+
+
 class USceneComponent : public UActorComponent
 {
     DECLARE_CLASS(USceneComponent, UActorComponent)
 
 public:
+    /** 대부분의 컴포넌트는 자식이 몇 개 되지 않으므로, 작은 개수까지는 Heap 할당 없이 저장합니다. */
+    using FAttachChildrenArray = TArray<USceneComponent*, TInlineAllocator<4>>;
+
     USceneComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
@@ -32,20 +86,20 @@ public:
     void AddScale(const FVector& InAddValue);
 
     USceneComponent* GetAttachParent() const { return AttachParent; }
-    const TArray<USceneComponent*>& GetAttachChildren() const { return AttachChildren; }
+    const FAttachChildrenArray& GetAttachChildren() const { return AttachChildren; }
 
     void AttachToComponent(USceneComponent* InParent);
     void SetupAttachment(USceneComponent* InParent);
     void DetachFromComponent(USceneComponent* Target);
     
 public:
-    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; }
+    void SetRelativeLocation(const FVector& InLocation);
     void SetRelativeRotation(const FRotator& InRotation);
     void SetRelativeRotation(const FQuat& InQuat);
-    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; }
+    void SetRelativeScale3D(const FVector& InScale);
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
-    FRotator GetRelativeRotation() const { return RelativeRotation; }
+    FRotator GetRelativeRotation() const { return RelativeRotation.Rotator().GetNormalized(); }
     FVector GetRelativeScale3D() const { return RelativeScale3D; }
 
     void SetWorldLocation(const FVector& InLocation);
@@ -61,8 +115,15 @@ public:
     FMatrix GetRotationMatrix() const;
     FMatrix GetTranslationMatrix() const;
 
+    /** 캐시한 World Transform, Dirty면 부모부터 다시 계산합니다. */
     FMatrix GetWorldMatrix() const;
 
+    /**
+     * 이 컴포넌트와 모든 자식의 World Transform 캐시를 Dirty로 만듭니다.
+     * Relative Transform과 부모를 바꾸는 함수가 호출하므로, 그 밖의 방법으로 Transform을 바꿨을 때만 직접 호출합니다.
+     */
+    void MarkWorldTransformDirty();
+
     void UpdateOverlaps(const TArray<FOverlapInfo>* PendingOverlaps = nullptr, bool bDoNotifies = true, const TArray<const FOverlapInfo>* OverlapsAtEndLocation = nullptr);
 
     bool MoveComponent(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr);
@@ -73,9 +134,12 @@ protected:
     UPROPERTY
     (FVector, RelativeLocation)
 
-    /** 부모 컴포넌트로부터 상대적인 회전 */
+    /**
+     * 부모 컴포넌트로부터 상대적인 회전
+     * World Transform을 계산할 때마다 삼각함수를 쓰지 않도록 Quat으로 저장하고, FRotator는 GetRelativeRotation에서 만듭니다.
+     */
     UPROPERTY
-    (FRotator, RelativeRotation)
+    (FQuat, RelativeRotation)
 
     /** 부모 컴포넌트로부터 상대적인 크기 */
     UPROPERTY
@@ -85,7 +149,7 @@ protected:
     (USceneComponent*, AttachParent, = nullptr)
 
     UPROPERTY
-    (TArray<USceneComponent*>, AttachChildren)
+    (FAttachChildrenArray, AttachChildren)
 
     virtual void UpdateOverlapsImpl(const TArray<FOverlapInfo>* PendingOverlaps = nullptr, bool bDoNotifies = true, const TArray<const FOverlapInfo>* OverlapsAtEndLocation = nullptr);
 
@@ -96,4 +160,24 @@ public:
     void SetUsingAbsoluteRotation(const bool bInAbsoluteRotation);
 protected:
     uint8 bAbsoluteRotation : 1;
+
+private:
+    /** Dirty면 World Transform을 다시 계산합니다. World Transform을 읽는 모든 함수가 이 함수를 거칩니다. */
+    void ConditionalUpdateWorldTransform() const;
+
+    void UpdateWorldTransform() const;
+
+    /** Scale * RotationTranslation */
+    mutable FMatrix CachedWorldMatrix;
+
+    /**
+     * 부모까지의 회전과 이동만 곱한 행렬
+     * 부모의 Scale은 자식의 위치에 적용하지 않고 Scale끼리만 곱하므로(CachedWorldScale), 자식은 이 행렬에 이어서 곱합니다.
+     */
+    mutable FMatrix CachedWorldRotationTranslation;
+
+    mutable FVector CachedWorldScale;
+
+    /** true면 Cached* 값이 Relative Transform이나 부모와 맞지 않습니다. Dirty인 컴포넌트의 자식은 모두 Dirty입니다. */
+    mutable bool bWorldTransformDirty = true;
 };
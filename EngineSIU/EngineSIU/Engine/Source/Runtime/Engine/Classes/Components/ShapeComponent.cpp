@@ -1,13 +1,18 @@
 
 #include "ShapeComponent.h"
+#include "Stats/Stats.h"
 
 UShapeComponent::UShapeComponent()
 {
+    // 모든 Actor의 이동이 끝난 뒤에 Overlap을 갱신합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
 }
 
 void UShapeComponent::TickComponent(float DeltaTime)
 {
     UPrimitiveComponent::TickComponent(DeltaTime);
 
+    QUICK_SCOPE_CYCLE_COUNTER(Shape_UpdateOverlaps)
     UpdateOverlaps();
 }
@@ -7,9 +7,18 @@
 #include "UObject/Casts.h"
 #include "Components/Mesh/SkeletalMesh.h"
 #include "GameFramework/Actor.h"
+#include "HAL/MemoryTracker.h"
 #include "Math/JungleMath.h"
+#include "Stats/Stats.h"
 #include "UObject/ObjectFactory.h"
 
+USkeletalMeshComponent::USkeletalMeshComponent()
+{
+    // 멀리 있는 Mesh는 Animation을 느리게 갱신하거나 멈춥니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bAllowSignificanceThrottling = true;
+}
+
 void USkeletalMeshComponent::InitializeComponent()
 {
     Super::InitializeComponent();
@@ -20,6 +29,8 @@ void USkeletalMeshComponent::InitializeComponent()
 
 void USkeletalMeshComponent::TickComponent(float DeltaSeconds)
 {
+    SCOPED_MEMORY_TAG(Animation);
+
     Super::TickComponent(DeltaSeconds);
 
     /* 애니메이션 비활성화 또는 필요한 에셋과 인스턴스 없으면 실행 안 함
@@ -30,6 +41,7 @@ void USkeletalMeshComponent::TickComponent(float DeltaSeconds)
         return;
     }
 
+    QUICK_SCOPE_CYCLE_COUNTER(Animation_Update)
     AnimScriptInstance->UpdateAnimation(DeltaSeconds, CurrentPose);
 }
 
@@ -92,7 +104,8 @@ void USkeletalMeshComponent::SetSkeletalMesh(USkeletalMesh* InSkeletalMesh)
     SelectedBoneIndex = -1;
     ResetPose();
 }
-void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix>& OutMatrices) const
+template <typename Allocator>
+void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix, Allocator>& OutMatrices) const
 {
     if (!SkeletalMesh)
     {
@@ -100,8 +113,7 @@ void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix>& OutMatrices) c
         return;
     }
     
-    FReferenceSkeleton RefSkeleton;
-    SkeletalMesh->GetRefSkeleton(RefSkeleton);
+    const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
     if (CurrentPose.Num() == 0)
     {
         OutMatrices.Add(FMatrix::Identity);
@@ -110,11 +122,10 @@ void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix>& OutMatrices) c
 
     const TArray<FTransform>& BonePose = CurrentPose;
     OutMatrices.SetNum(CurrentPose.Num());
-    TArray<FMatrix> CurrentPoseMatrices; // joint -> model space
+    TArray<FMatrix, TFrameAllocator<FMatrix>> CurrentPoseMatrices; // joint -> model space
     CurrentPoseMatrices.SetNum(CurrentPose.Num());
 
-    TArray<FMatrix> InverseBindPose;
-    SkeletalMesh->GetInverseBindPoseMatrices(InverseBindPose);
+    const TArray<FMatrix>& InverseBindPose = SkeletalMesh->GetInverseBindPoseMatrices();
 
     for (int JointIndex = 0; JointIndex < CurrentPose.Num(); ++JointIndex)
     {
@@ -143,6 +154,9 @@ void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix>& OutMatrices) c
     }
 }
 
+template void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix>& OutMatrices) const;
+template void USkeletalMeshComponent::GetSkinningMatrices(TArray<FMatrix, TFrameAllocator<FMatrix>>& OutMatrices) const;
+
 void USkeletalMeshComponent::GetCurrentPoseMatrices(TArray<FMatrix>& OutMatrices) const
 {
     if (!SkeletalMesh)
@@ -151,8 +165,7 @@ void USkeletalMeshComponent::GetCurrentPoseMatrices(TArray<FMatrix>& OutMatrices
         return;
     }
     
-    FReferenceSkeleton RefSkeleton;
-    SkeletalMesh->GetRefSkeleton(RefSkeleton);
+    const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
     if (CurrentPose.Num() == 0)
     {
         OutMatrices.Add(FMatrix::Identity);
@@ -162,9 +175,6 @@ void USkeletalMeshComponent::GetCurrentPoseMatrices(TArray<FMatrix>& OutMatrices
     const TArray<FTransform>& BonePose = CurrentPose;
     OutMatrices.SetNum(RefSkeleton.RawRefBonePose.Num());
 
-    TArray<FMatrix> InverseBindPose;
-    SkeletalMesh->GetInverseBindPoseMatrices(InverseBindPose);
-
     for (int JointIndex = 0; JointIndex < RefSkeleton.RawRefBonePose.Num(); ++JointIndex)
     {
         const FTransform& RefPose = BonePose[JointIndex];
@@ -21,7 +21,7 @@ class USkeletalMeshComponent: public UMeshComponent
 {
     DECLARE_CLASS(USkeletalMeshComponent, UMeshComponent)
 public:
-    USkeletalMeshComponent() = default;
+    USkeletalMeshComponent();
     virtual void InitializeComponent() override;
     virtual void TickComponent(float DeltaSeconds) override;
     
@@ -31,7 +31,8 @@ public:
 
     USkeletalMesh* GetSkeletalMesh() const { return SkeletalMesh; }
     void SetSkeletalMesh(USkeletalMesh* InSkeletalMesh);
-    void GetSkinningMatrices(TArray<FMatrix>& OutMatrices) const;
+    template <typename Allocator>
+    void GetSkinningMatrices(TArray<FMatrix, Allocator>& OutMatrices) const;
     void GetCurrentPoseMatrices(TArray<FMatrix>& OutMatrices) const;
     TArray<int> GetChildrenOfBone(int InParentIndex) const;
     const TMap<int, FString> GetBoneIndexToName();
@@ -5,6 +5,10 @@
 USkySphereComponent::USkySphereComponent()
 {
     SetType(StaticClass()->GetName());
+
+    // TickComponent는 이 컴포넌트의 UOffset, VOffset만 쓰고, 다른 객체나 Transform은 건드리지 않으므로 Worker 스레드에서 Tick합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bRunOnAnyThread = true;
 }
 
 UObject* USkySphereComponent::Duplicate(UObject* InOuter)
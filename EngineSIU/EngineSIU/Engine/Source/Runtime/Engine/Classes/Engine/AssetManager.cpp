@@ -2,15 +2,146 @@
 #include "Engine.h"
 
 #include <filesystem>
+#include <fstream>
 
 #include "FFbxLoader.h"
+#include "WindowsPlatformTime.h"
+#include "Asset/SkeletalMeshAsset.h"
+#include "Asset/StaticMeshAsset.h"
+#include "Components/Mesh/SkeletalMesh.h"
+#include "Components/Mesh/StaticMeshRenderData.h"
 #include "Engine/FObjLoader.h"
+#include "Serialization/Serializer.h"
+
+namespace
+{
+    const std::string ContentsPath = "Contents/";
+
+    /** Asset의 경로, 크기, 수정 시간과 로드한 적이 있는 Mesh의 정보를 저장해 두는 파일 */
+    const std::string RegistryFilePath = "Saved/AssetRegistry.bin";
+    constexpr uint32 RegistryFileMagic = 0x47455241; // "AREG"
+    constexpr uint32 RegistryFileVersion = 2;
+
+    constexpr int32 PrefetchPriority = FStreamableManager::DefaultAsyncLoadPriority - 1;
+
+    bool GetAssetTypeFromExtension(const std::filesystem::path& Path, EAssetType& OutAssetType)
+    {
+        const std::filesystem::path Extension = Path.extension();
+        if (Extension == ".obj")
+        {
+            OutAssetType = EAssetType::StaticMesh; // obj 파일은 무조건 StaticMesh
+        }
+        else if (Extension == ".fbx")
+        {
+            OutAssetType = EAssetType::SkeletalMesh;
+        }
+        else if (Extension == ".png" || Extension == ".jpg" || Extension == ".jpeg" || Extension == ".dds")
+        {
+            OutAssetType = EAssetType::Texture2D;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    /** Registry 파일을 읽어 전체 경로를 Key로 하는 Map에 채웁니다. 파일이 없거나 Version이 다르면 false */
+    bool LoadRegistryFile(TMap<FString, FAssetInfo>& OutAssets)
+    {
+        std::ifstream File(RegistryFilePath, std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        uint32 NumAssets = 0;
+        File.read(reinterpret_cast<char*>(&Magic), sizeof(Magic));
+        File.read(reinterpret_cast<char*>(&Version), sizeof(Version));
+        File.read(reinterpret_cast<char*>(&NumAssets), sizeof(NumAssets));
+        if (!File || Magic != RegistryFileMagic || Version != RegistryFileVersion)
+        {
+            return false;
+        }
+
+        for (uint32 Index = 0; Index < NumAssets; ++Index)
+        {
+            FString FullPath;
+            FAssetInfo AssetInfo;
+            Serializer::ReadFString(File, FullPath);
+            File.read(reinterpret_cast<char*>(&AssetInfo.AssetType), sizeof(AssetInfo.AssetType));
+            File.read(reinterpret_cast<char*>(&AssetInfo.Size), sizeof(AssetInfo.Size));
+            File.read(reinterpret_cast<char*>(&AssetInfo.LastWriteTime), sizeof(AssetInfo.LastWriteTime));
+            File.read(reinterpret_cast<char*>(&AssetInfo.bHasMeshInfo), sizeof(AssetInfo.bHasMeshInfo));
+            if (AssetInfo.bHasMeshInfo)
+            {
+                File.read(reinterpret_cast<char*>(&AssetInfo.MeshInfo), sizeof(AssetInfo.MeshInfo));
+            }
+            if (!File)
+            {
+                OutAssets.Empty();
+                return false;
+            }
+            OutAssets.Add(FullPath, AssetInfo);
+        }
+        return true;
+    }
+
+    /** 로드된 Mesh에서 MeshInfo를 채웁니다. 로드되지 않았으면 false */
+    bool GetLoadedMeshInfo(const FString& FullPath, EAssetType AssetType, FAssetMeshInfo& OutMeshInfo)
+    {
+        if (AssetType == EAssetType::StaticMesh)
+        {
+            UStaticMesh* const* StaticMesh = FObjManager::GetStaticMeshes().Find(FullPath.ToWideString());
+            const FStaticMeshRenderData* RenderData = StaticMesh ? (*StaticMesh)->GetRenderData() : nullptr;
+            if (!RenderData)
+            {
+                return false;
+            }
+
+            OutMeshInfo.BoundsMin = RenderData->BoundingBoxMin;
+            OutMeshInfo.BoundsMax = RenderData->BoundingBoxMax;
+            OutMeshInfo.NumVertices = RenderData->Vertices.Num();
+            OutMeshInfo.NumMaterialSlots = RenderData->Materials.Num();
+            return true;
+        }
+
+        if (AssetType == EAssetType::SkeletalMesh)
+        {
+            const USkeletalMesh* SkeletalMesh = FFbxLoader::GetSkeletalMesh(FullPath);
+            if (!SkeletalMesh)
+            {
+                return false;
+            }
+
+            // Skeletal Mesh는 Bounding Box를 따로 가지고 있지 않으므로 Bind Pose의 정점으로 계산합니다.
+            bool bFirstVertex = true;
+            for (const FSkelMeshRenderSection& Section : SkeletalMesh->GetRenderData().RenderSections)
+            {
+                for (const FSkeletalVertex& Vertex : Section.Vertices)
+                {
+                    OutMeshInfo.BoundsMin = bFirstVertex ? Vertex.Position : OutMeshInfo.BoundsMin.ComponentMin(Vertex.Position);
+                    OutMeshInfo.BoundsMax = bFirstVertex ? Vertex.Position : OutMeshInfo.BoundsMax.ComponentMax(Vertex.Position);
+                    bFirstVertex = false;
+                }
+                OutMeshInfo.NumVertices += Section.Vertices.Num();
+            }
+            OutMeshInfo.NumMaterialSlots = SkeletalMesh->GetMaterials().Num();
+            OutMeshInfo.NumBones = SkeletalMesh->GetRefSkeleton().GetRawBoneNum();
+            return true;
+        }
+
+        return false;
+    }
+}
 
 inline UAssetManager::UAssetManager() {
     FFbxLoader::Init();
     FFbxLoader::OnLoadFBXCompleted.BindLambda(
         [this](const FString& filename) {
-            OnLoaded(filename);
+            NotifyAssetLoaded(filename);
         }
     );
 }
@@ -49,6 +180,23 @@ const TMap<FName, FAssetInfo>& UAssetManager::GetAssetRegistry()
     return AssetRegistry->PathNameToAssetInfo;
 }
 
+FAssetInfo* UAssetManager::FindAssetInfo(const FString& FullPath) const
+{
+    if (!AssetRegistry)
+    {
+        return nullptr;
+    }
+
+    // Registry의 Key는 파일 이름이므로, 다른 폴더의 같은 이름 파일과 구분하기 위해 경로를 확인합니다.
+    const std::filesystem::path Path(FullPath.ToWideString());
+    FAssetInfo* AssetInfo = AssetRegistry->PathNameToAssetInfo.Find(FName(Path.filename().string()));
+    if (AssetInfo && AssetInfo->GetFullPath() == FullPath)
+    {
+        return AssetInfo;
+    }
+    return nullptr;
+}
+
 bool UAssetManager::AddAsset(std::wstring filePath) const
 {
     std::filesystem::path path(filePath);
@@ -79,42 +227,96 @@ bool UAssetManager::AddAsset(std::wstring filePath) const
     return true;
 }
 
-void UAssetManager::LoadEntireAssets()
+const FAssetScanStats& UAssetManager::ScanContents(bool bUseRegistryFile)
 {
-    const std::string BasePathName = "Contents/";
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    LastScanStats = FAssetScanStats();
 
-    // Obj, FBX 파일 로드
-    
-    for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
+    TMap<FString, FAssetInfo> CachedAssets;
+    if (bUseRegistryFile)
     {
-        if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+        LoadRegistryFile(CachedAssets);
+    }
+
+    std::error_code ErrorCode;
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(ContentsPath, ErrorCode))
+    {
+        EAssetType AssetType;
+        if (!Entry.is_regular_file() || !GetAssetTypeFromExtension(Entry.path(), AssetType))
+        {
+            continue;
+        }
+
+        FAssetInfo NewAssetInfo;
+        NewAssetInfo.AssetName = FName(Entry.path().filename().string());
+        NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
+        NewAssetInfo.AssetType = AssetType;
+        NewAssetInfo.LastWriteTime = Entry.last_write_time().time_since_epoch().count();
+        NewAssetInfo.IsLoaded = false; // 처음 참조될 때 로드
+
+        const FString FullPath = NewAssetInfo.GetFullPath();
+        const FAssetInfo* CachedAssetInfo = CachedAssets.Find(FullPath);
+        if (CachedAssetInfo && CachedAssetInfo->LastWriteTime == NewAssetInfo.LastWriteTime)
+        {
+            NewAssetInfo.Size = CachedAssetInfo->Size;
+            NewAssetInfo.bHasMeshInfo = CachedAssetInfo->bHasMeshInfo;
+            NewAssetInfo.MeshInfo = CachedAssetInfo->MeshInfo;
+            ++LastScanStats.NumCached;
+            LastScanStats.NumWithMeshInfo += CachedAssetInfo->bHasMeshInfo ? 1 : 0;
+        }
+        else
         {
-            FAssetInfo NewAssetInfo;
-            NewAssetInfo.AssetName = FName(Entry.path().filename().string());
-            NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
-            NewAssetInfo.AssetType = EAssetType::StaticMesh; // obj 파일은 무조건 StaticMesh
-            NewAssetInfo.Size = static_cast<uint32>(std::filesystem::file_size(Entry.path()));
-            AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
-            
-            FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FObjManager::CreateStaticMesh(MeshName);
-            // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
-            // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
-        }
-        if (Entry.is_regular_file() && Entry.path().extension() == ".fbx")
+            NewAssetInfo.Size = static_cast<uint32>(Entry.file_size());
+            if (CachedAssetInfo)
+            {
+                // .obj.bin은 원본의 수정 시간을 확인하지 않으므로 지워서 다시 만들게 합니다. (.fbx.bin은 스스로 확인합니다)
+                if (AssetType == EAssetType::StaticMesh)
+                {
+                    std::filesystem::remove(Entry.path().wstring() + L".bin", ErrorCode);
+                }
+                ++LastScanStats.NumChanged;
+            }
+        }
+
+        // 다시 스캔하는 경우에도 이미 로드된 상태는 유지합니다.
+        if (const FAssetInfo* ExistingAssetInfo = FindAssetInfo(FullPath))
         {
-            FAssetInfo NewAssetInfo;
-            NewAssetInfo.AssetName = FName(Entry.path().filename().string());
-            NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
-            NewAssetInfo.AssetType = EAssetType::SkeletalMesh;
-            NewAssetInfo.Size = static_cast<uint32>(std::filesystem::file_size(Entry.path()));
-            NewAssetInfo.IsLoaded = false; // fbx는 비동기로 로드하므로 나중에 변경
-            AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
+            NewAssetInfo.IsLoaded = ExistingAssetInfo->IsLoaded;
+            if (!NewAssetInfo.bHasMeshInfo && ExistingAssetInfo->bHasMeshInfo && ExistingAssetInfo->LastWriteTime == NewAssetInfo.LastWriteTime)
+            {
+                NewAssetInfo.bHasMeshInfo = true;
+                NewAssetInfo.MeshInfo = ExistingAssetInfo->MeshInfo;
+            }
+        }
+
+        AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
+
+        ++LastScanStats.NumAssets;
+        LastScanStats.TotalBytes += NewAssetInfo.Size;
+    }
+
+    SaveRegistryFile();
 
-            FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FFbxLoader::LoadFBX(MeshName);
+    LastScanStats.ScanMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    return LastScanStats;
+}
+
+int32 UAssetManager::PrefetchAssets()
+{
+    int32 NumRequested = 0;
+    for (const auto& [AssetName, AssetInfo] : AssetRegistry->PathNameToAssetInfo)
+    {
+        const FString FullPath = AssetInfo.GetFullPath();
+        if (AssetInfo.IsLoaded || !FStreamableManager::IsSupportedAsset(FullPath))
+        {
+            continue;
         }
+
+        // Level에서 참조하는 Asset이 먼저 로드되도록 기본값보다 낮은 Priority로 요청합니다.
+        StreamableManager.RequestAsyncLoad(FullPath, FStreamableDelegate(), PrefetchPriority);
+        ++NumRequested;
     }
+    return NumRequested;
 }
 
 // 파일 로드의 호출이 UAssetManager 외부에서 발생하였을 때 등록하는 함수입니다.
@@ -143,16 +345,49 @@ void UAssetManager::RegisterAsset(std::wstring filePath) const
     AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
 }
 
-void UAssetManager::OnLoaded(const FString& filename)
+void UAssetManager::NotifyAssetLoaded(const FString& FullPath)
+{
+    FAssetInfo* AssetInfo = FindAssetInfo(FullPath);
+    if (!AssetInfo)
+    {
+        return;
+    }
+
+    if (!AssetInfo->IsLoaded)
+    {
+        AssetInfo->IsLoaded = true;
+        UE_LOG(ELogLevel::Display, "Asset Loaded : %s", *FullPath);
+    }
+
+    if (!AssetInfo->bHasMeshInfo)
+    {
+        AssetInfo->bHasMeshInfo = GetLoadedMeshInfo(FullPath, AssetInfo->AssetType, AssetInfo->MeshInfo);
+    }
+}
+
+void UAssetManager::SaveRegistryFile() const
 {
-    FName AssetName = FName(filename);
-    for (auto& asset : AssetRegistry->PathNameToAssetInfo)
+    std::ofstream File(RegistryFilePath, std::ios::binary);
+    if (!File.is_open())
+    {
+        UE_LOG(ELogLevel::Warning, "Failed to save asset registry : %s", RegistryFilePath.c_str());
+        return;
+    }
+
+    const uint32 NumAssets = AssetRegistry->PathNameToAssetInfo.Num();
+    File.write(reinterpret_cast<const char*>(&RegistryFileMagic), sizeof(RegistryFileMagic));
+    File.write(reinterpret_cast<const char*>(&RegistryFileVersion), sizeof(RegistryFileVersion));
+    File.write(reinterpret_cast<const char*>(&NumAssets), sizeof(NumAssets));
+    for (const auto& [AssetName, AssetInfo] : AssetRegistry->PathNameToAssetInfo)
     {
-        if (asset.Value.GetFullPath() == filename)
+        Serializer::WriteFString(File, AssetInfo.GetFullPath());
+        File.write(reinterpret_cast<const char*>(&AssetInfo.AssetType), sizeof(AssetInfo.AssetType));
+        File.write(reinterpret_cast<const char*>(&AssetInfo.Size), sizeof(AssetInfo.Size));
+        File.write(reinterpret_cast<const char*>(&AssetInfo.LastWriteTime), sizeof(AssetInfo.LastWriteTime));
+        File.write(reinterpret_cast<const char*>(&AssetInfo.bHasMeshInfo), sizeof(AssetInfo.bHasMeshInfo));
+        if (AssetInfo.bHasMeshInfo)
         {
-            asset.Value.IsLoaded = true;
-            UE_LOG(ELogLevel::Display, "Asset Loaded : %s", *filename);
-            return;
+            File.write(reinterpret_cast<const char*>(&AssetInfo.MeshInfo), sizeof(AssetInfo.MeshInfo));
         }
     }
 }
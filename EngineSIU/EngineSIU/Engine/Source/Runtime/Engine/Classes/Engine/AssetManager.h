@@ -1,4 +1,6 @@
 #pragma once
+#include "StreamableManager.h"
+#include "Math/Vector.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
@@ -10,14 +12,29 @@ enum class EAssetType : uint8
     Material,
 };
 
+/** 로드된 Mesh에서 얻은 정보, Registry 파일에 저장되어 다음 실행부터는 Mesh를 로드하지 않고 알 수 있습니다. */
+struct FAssetMeshInfo
+{
+    FVector BoundsMin = FVector::ZeroVector;
+    FVector BoundsMax = FVector::ZeroVector;
+    uint32 NumVertices = 0;
+    uint32 NumMaterialSlots = 0;
+    uint32 NumBones = 0; // SkeletalMesh만
+};
+
 struct FAssetInfo
 {
     FName AssetName;      // Asset의 이름
     FName PackagePath;    // Asset의 패키지 경로
     EAssetType AssetType; // Asset의 타입
     uint32 Size;          // Asset의 크기 (바이트 단위)
+    int64 LastWriteTime = 0; // 파일의 마지막 수정 시간, Registry 파일과 비교해 바뀐 Asset을 찾습니다.
     bool IsLoaded = true;
 
+    /** 이 파일을 로드한 적이 있어서 MeshInfo가 채워져 있는지 여부, 파일이 수정되면 false가 됩니다. */
+    bool bHasMeshInfo = false;
+    FAssetMeshInfo MeshInfo;
+
     FString GetFullPath() const { return PackagePath.ToString() / AssetName.ToString(); }
 };
 
@@ -26,6 +43,25 @@ struct FAssetRegistry
     TMap<FName, FAssetInfo> PathNameToAssetInfo;
 };
 
+/** UAssetManager::ScanContents의 결과 */
+struct FAssetScanStats
+{
+    int32 NumAssets = 0;
+
+    /** Registry 파일의 정보를 그대로 사용한 Asset 수 */
+    int32 NumCached = 0;
+
+    /** 그 중 이전 실행에서 로드되어 MeshInfo까지 가지고 있는 Asset 수 */
+    int32 NumWithMeshInfo = 0;
+
+    /** Registry 파일을 저장한 뒤에 수정된 Asset 수 */
+    int32 NumChanged = 0;
+
+    uint64 TotalBytes = 0;
+
+    double ScanMilliseconds = 0.0;
+};
+
 class UAssetManager : public UObject
 {
     DECLARE_CLASS(UAssetManager, UObject)
@@ -33,6 +69,10 @@ class UAssetManager : public UObject
 private:
     std::unique_ptr<FAssetRegistry> AssetRegistry;
 
+    FStreamableManager StreamableManager;
+
+    FAssetScanStats LastScanStats;
+
 public:
     UAssetManager();
 
@@ -47,14 +87,43 @@ public:
     void InitAssetManager();
 
     const TMap<FName, FAssetInfo>& GetAssetRegistry();
+
+    /** 전체 경로로 등록된 Asset을 찾습니다. 없으면 nullptr */
+    FAssetInfo* FindAssetInfo(const FString& FullPath) const;
+
+    FStreamableManager& GetStreamableManager() { return StreamableManager; }
+
     bool AddAsset(std::wstring filePath) const;
 
     //void LoadAssetsOnScene();
-    void LoadEntireAssets();
+
+    /**
+     * Contents 폴더를 훑어 Asset의 정보만 Registry에 등록합니다. Asset은 처음 참조될 때 로드됩니다.
+     * 이전 실행의 Registry 파일과 수정 시간을 비교해, 바뀐 .obj의 .bin 캐시를 지우고 Registry 파일을 갱신합니다.
+     *
+     * @param bUseRegistryFile false이면 Registry 파일을 읽지 않고 모든 파일의 정보를 새로 읽습니다.
+     */
+    const FAssetScanStats& ScanContents(bool bUseRegistryFile = true);
+
+    /**
+     * 아직 로드되지 않은 Mesh Asset들을 낮은 Priority로 비동기 로드합니다.
+     * @return 요청한 Asset 수
+     */
+    int32 PrefetchAssets();
+
+    const FAssetScanStats& GetLastScanStats() const { return LastScanStats; }
+
+    /** 시작할 때 ScanContents 이후 PrefetchAssets를 호출할지 여부 */
+    bool bPrefetchOnStartup = true;
 
     void RegisterAsset(std::wstring filePath) const;
 
-private:
+    /**
+     * Asset이 처음 로드되었을 때 호출되며, Registry의 IsLoaded와 MeshInfo를 갱신합니다. 게임 스레드에서만 호출해야 합니다.
+     * 갱신된 MeshInfo는 다음 SaveRegistryFile에서 저장됩니다.
+     */
+    void NotifyAssetLoaded(const FString& FullPath);
 
-    void OnLoaded(const FString& filename);
+    /** 현재 Registry를 Registry 파일에 저장합니다. ScanContents와 Engine 종료 시 호출됩니다. */
+    void SaveRegistryFile() const;
 };
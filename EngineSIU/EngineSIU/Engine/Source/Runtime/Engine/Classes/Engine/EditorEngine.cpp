@@ -43,18 +43,37 @@ void UEditorEngine::Init()
         assert(AssetManager);
         AssetManager->InitAssetManager();
     }
+
+    // Asset은 정보만 등록해두고, Level에서 참조하는 것부터 로드합니다.
+    AssetManager->ScanContents();
     LoadLevel("Saved/AutoSaves.scene");
-    AssetManager->LoadEntireAssets();
+    if (AssetManager->bPrefetchOnStartup)
+    {
+        AssetManager->PrefetchAssets();
+    }
     StartPreviewWorld(nullptr);
 }
 
 void UEditorEngine::Release()
 {
-    SaveLevel("Saved/AutoSaves.scene");
+    // 이번 실행에서 로드한 Mesh의 정보를 다음 실행의 ScanContents에서 사용합니다.
+    if (AssetManager)
+    {
+        AssetManager->SaveRegistryFile();
+    }
+
+
+    // Headless 실행은 편집하지 않으므로 AutoSave를 덮어쓰지 않습니다.
+    if (!GEngineLoop.IsHeadless())
+    {
+        SaveLevel("Saved/AutoSaves.scene");
+    }
 }
 
 void UEditorEngine::Tick(float DeltaTime)
 {
+    SCOPED_MEMORY_TAG(World);
+
     for (FWorldContext* WorldContext : WorldList)
     {
         if (WorldContext->WorldType == EWorldType::Editor || WorldContext->WorldType == EWorldType::EditorPreview)
@@ -62,39 +81,19 @@ void UEditorEngine::Tick(float DeltaTime)
             if (UWorld* World = WorldContext->World())
             {
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
-                World->Tick(DeltaTime);
-                EditorPlayer->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
+                // EditorPlayer는 ImGui와 Viewport로 입력을 처리하므로 Headless에서는 Tick하지 않습니다.
+                if (!GEngineLoop.IsHeadless())
                 {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
+                    EditorPlayer->TickActorAndComponents(DeltaTime);
                 }
+                World->Tick(LEVELTICK_ViewportsOnly, DeltaTime);
             }
         }
         else if (WorldContext->WorldType == EWorldType::PIE)
         {
             if (UWorld* World = WorldContext->World())
             {
-                World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
+                World->Tick(LEVELTICK_All, DeltaTime);
             }
         }
     }
@@ -0,0 +1,205 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "Core/HAL/PlatformType.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UActorComponent;
+class UObject;
+class FTickTaskManager;
+
+
+/** World를 어떤 방식으로 Tick하는지 */
+enum ELevelTick : uint8
+{
+    /** 시간만 갱신합니다. */
+    LEVELTICK_TimeOnly,
+
+    /** Editor World, bTickInEditor인 Actor와 그 Component만 Tick합니다. */
+    LEVELTICK_ViewportsOnly,
+
+    /** PIE/Game World, 모든 Tick Function을 실행합니다. */
+    LEVELTICK_All,
+};
+
+/** Tick Function이 실행되는 단계, 앞의 Group이 모두 끝나야 다음 Group이 시작됩니다. */
+enum ETickingGroup : uint8
+{
+    /** 물리 시뮬레이션 이전, 이동과 게임 로직 */
+    TG_PrePhysics,
+
+    /** 물리 시뮬레이션과 같은 단계, 물리 결과에 의존하지 않는 작업 */
+    TG_DuringPhysics,
+
+    /** 물리 시뮬레이션 이후, 충돌/Overlap 결과를 사용하는 작업 */
+    TG_PostPhysics,
+
+    /** 모든 이동이 끝난 뒤, 카메라와 Attach된 대상을 따라가는 작업 */
+    TG_PostUpdateWork,
+
+    TG_MAX,
+};
+
+const char* GetTickingGroupName(ETickingGroup TickGroup);
+
+/** Significance에 따른 Tick 빈도 */
+enum class ETickSignificance : uint8
+{
+    /** 매 프레임, 또는 TickInterval마다 Tick합니다. */
+    Full,
+
+    /** FTickTaskManager::ReducedTickInterval 이상의 간격으로 Tick합니다. */
+    Reduced,
+
+    /** Significance가 다시 올라갈 때까지 ExecuteTick을 호출하지 않으며, 멈춰있던 동안의 DeltaTime은 버립니다. */
+    Dormant,
+};
+
+
+struct FTickFunction;
+
+/** 선행 Tick Function과 그 소유 객체, 소유 객체가 삭제되면 무시됩니다. */
+struct FTickPrerequisite
+{
+    TWeakObjectPtr<UObject> PrerequisiteObject;
+    FTickFunction* PrerequisiteTickFunction = nullptr;
+
+    FTickPrerequisite() = default;
+
+    FTickPrerequisite(UObject* TargetObject, FTickFunction& TargetTickFunction)
+        : PrerequisiteObject(TargetObject)
+        , PrerequisiteTickFunction(&TargetTickFunction)
+    {
+    }
+
+    /** 소유 객체가 유효하면 Tick Function을, 아니면 nullptr을 반환합니다. */
+    FTickFunction* Get() const
+    {
+        return PrerequisiteObject.IsValid() ? PrerequisiteTickFunction : nullptr;
+    }
+
+    bool operator==(const FTickPrerequisite& Other) const
+    {
+        return PrerequisiteObject == Other.PrerequisiteObject && PrerequisiteTickFunction == Other.PrerequisiteTickFunction;
+    }
+};
+
+
+/**
+ * FTickTaskManager에 등록되어 매 프레임 실행되는 Tick의 단위
+ *
+ * Prerequisites에 등록된 Tick Function이 모두 끝난 뒤에 실행되며,
+ * 선행 Tick Function이 더 뒤의 TickGroup에 있다면 그 Group까지 미뤄집니다.
+ *
+ * @note 등록/해제와 설정 변경은 게임 스레드에서만 해야 합니다.
+ */
+struct FTickFunction
+{
+public:
+    /** 이 Tick Function이 속한 Group */
+    ETickingGroup TickGroup = TG_PrePhysics;
+
+    /** false이면 등록되지 않습니다. */
+    uint8 bCanEverTick : 1 = false;
+
+    /** 등록될 때 바로 Tick을 활성화할지 여부 */
+    uint8 bStartWithTickEnabled : 1 = true;
+
+    /**
+     * true이면 Worker 스레드에서 다른 Tick과 동시에 실행될 수 있습니다.
+     * 자신과 소유 객체의 상태만 변경하고, Spawn/Destroy, Delegate 호출, 다른 Actor 접근을 하지 않는 경우에만 사용해야 합니다.
+     * USceneComponent의 Transform도 게임 스레드에서만 바꾸거나 읽을 수 있습니다.
+     */
+    uint8 bRunOnAnyThread : 1 = false;
+
+    /** true이면 FTickTaskManager::SignificanceDelegate의 결과에 따라 Tick이 느려지거나 멈출 수 있습니다. */
+    uint8 bAllowSignificanceThrottling : 1 = false;
+
+    /**
+     * Tick 사이의 최소 간격(초), 0이면 매 프레임 Tick합니다.
+     * 건너뛴 프레임의 DeltaTime은 누적되어 다음 ExecuteTick에 전달됩니다.
+     */
+    float TickInterval = 0.0f;
+
+public:
+    FTickFunction() = default;
+    virtual ~FTickFunction();
+
+    FTickFunction(const FTickFunction&) = delete;
+    FTickFunction& operator=(const FTickFunction&) = delete;
+
+    /** 실제 Tick을 수행합니다. */
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType) = 0;
+
+    /** 디버그 출력에 사용할 이름 */
+    virtual FString DiagnosticMessage() const = 0;
+
+    /** Significance를 계산할 기준 Actor, nullptr이면 항상 ETickSignificance::Full로 취급합니다. */
+    virtual const AActor* GetSignificanceActor() const { return nullptr; }
+
+    ETickSignificance GetSignificance() const { return Significance; }
+
+    void RegisterTickFunction(FTickTaskManager* InTickTaskManager);
+    void UnRegisterTickFunction();
+    bool IsTickFunctionRegistered() const { return TickTaskManager != nullptr; }
+
+    void SetTickFunctionEnable(bool bInEnabled) { bTickEnabled = bInEnabled; }
+    bool IsTickFunctionEnabled() const { return bTickEnabled; }
+
+    /** TargetTickFunction이 끝난 뒤에 이 Tick Function이 실행되도록 합니다. */
+    void AddPrerequisite(UObject* TargetObject, FTickFunction& TargetTickFunction);
+    void RemovePrerequisite(UObject* TargetObject, FTickFunction& TargetTickFunction);
+
+    const TArray<FTickPrerequisite>& GetPrerequisites() const { return Prerequisites; }
+
+private:
+    friend class FTickTaskManager;
+
+    TArray<FTickPrerequisite> Prerequisites;
+
+    FTickTaskManager* TickTaskManager = nullptr;
+
+    /** FTickTaskManager::TickFunctions에서의 위치 */
+    int32 RegisteredIndex = INDEX_NONE;
+
+    bool bTickEnabled = true;
+
+    ETickSignificance Significance = ETickSignificance::Full;
+
+    /** 마지막 Tick 이후 누적된 DeltaTime */
+    float AccumulatedDeltaTime = 0.0f;
+
+    /** 이번 프레임 ExecuteTick에 전달할 DeltaTime */
+    float TickDeltaTime = 0.0f;
+
+    /** 이번 프레임의 스케줄 정보, FTickTaskManager가 매 프레임 다시 계산합니다. */
+    uint32 RunFrame = 0;          // FrameCounter와 같으면 이번 프레임에 실행
+    uint32 ScheduledFrame = 0;    // FrameCounter와 같으면 TickGroup과 Wave가 정해짐
+    ETickingGroup ActualTickGroup = TG_PrePhysics;
+    int32 WaveIndex = 0;
+    bool bScheduling = false;
+};
+
+
+/** AActor::Tick을 실행하는 Tick Function */
+struct FActorTickFunction : public FTickFunction
+{
+    AActor* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType) override;
+    virtual FString DiagnosticMessage() const override;
+    virtual const AActor* GetSignificanceActor() const override { return Target; }
+};
+
+/** UActorComponent::TickComponent를 실행하는 Tick Function */
+struct FActorComponentTickFunction : public FTickFunction
+{
+    UActorComponent* Target = nullptr;
+
+    virtual void ExecuteTick(float DeltaTime, ELevelTick TickType) override;
+    virtual FString DiagnosticMessage() const override;
+
+    /** Owner Actor의 Significance를 따릅니다. */
+    virtual const AActor* GetSignificanceActor() const override;
+};
@@ -14,6 +14,8 @@
 #include "Components/Mesh/SkeletalMesh.h"
 #include "Container/StringConv.h"
 #include "Engine/AssetManager.h"
+#include "HAL/MemoryTracker.h"
+#include "Async/JobSystem.h"
 
 #define DEBUG_DUMP_ANIMATION
 
@@ -37,32 +39,54 @@ void FFbxLoader::Init()
 }
 
 // FBX 파일을 로드합니다.
-// 비동기적으로 실행되며, 실행이 끝나면 로그와 함께 UAssetManager에 해당 등록됩니다.
-// 현재는 UAssetManager에서 Contents 폴더의 모든 파일에 대해서 프로그램 시작 시 호출됩니다.
-void FFbxLoader::LoadFBX(const FString& filename)
+// 비동기적으로 실행되며, 실행이 끝나면 게임 스레드에서 OnLoadFBXCompleted가 호출됩니다.
+// 현재는 FStreamableManager를 통해 UAssetManager에서 Contents 폴더의 모든 파일에 대해서 프로그램 시작 시 호출됩니다.
+FJobHandle FFbxLoader::LoadFBX(const FString& filename)
 {
-    UE_LOG(ELogLevel::Display, "Loading FBX : %s", *filename);
+    SCOPED_MEMORY_TAG(Fbx);
+
+    while (true)
     {
-        std::lock_guard<std::mutex> lock(MapMutex);
-        if (MeshMap.Contains(filename)) return;
+        {
+            std::lock_guard<std::mutex> lock(MapMutex);
+            const MeshEntry* Entry = MeshMap.Find(filename);
+            if (!Entry)
+            {
+                // 바로 Loading 상태 등록
+                MeshMap.Add(filename, { LoadState::Loading, nullptr, {}, {}, true });
+                break;
+            }
 
-        // 바로 Loading 상태 등록
-        MeshMap.Add(filename, { LoadState::Loading, nullptr });
+            // 처음 요청한 쪽과 같은 완료 Job을 반환합니다. GetSkeletalMesh에서 바로 로드한 파일이면 빈 Handle입니다.
+            if (!Entry->bLoadedByJob || Entry->CompletedJob.IsValid())
+            {
+                return Entry->CompletedJob;
+            }
+        }
+
+        // 처음 요청한 쪽이 아직 Job을 등록하지 않았음
+        std::this_thread::yield();
     }
 
-    std::thread loader([filename]() {
+    UE_LOG(ELogLevel::Display, "Loading FBX : %s", *filename);
+
+    // 파싱은 Worker에서, 완료 알림은 게임 스레드에서 실행됩니다.
+    FJobHandle LoadJob = FJobSystem::Get().Launch([filename]() {
+        SCOPED_MEMORY_TAG(Fbx);
         USkeletalMesh* mesh = ParseSkeletalMesh(filename);
         std::lock_guard<std::mutex> lock(MapMutex);
-        if (mesh) {
-            MeshMap[filename] = { LoadState::Completed, mesh };
-        }
-        else
-        {
-            MeshMap[filename] = { LoadState::Failed, nullptr };
-        }
-        OnLoadFBXCompleted.Execute(filename);
+        // Entry를 덮어쓰면 Handle이 사라지므로 상태만 바꿉니다.
+        MeshEntry& Entry = MeshMap[filename];
+        Entry.State = mesh ? LoadState::Completed : LoadState::Failed;
+        Entry.Mesh = mesh;
         });
-    loader.detach();
+    FJobHandle CompletedJob = LoadJob.Then([filename]() { OnLoadFBXCompleted.ExecuteIfBound(filename); }, EJobThread::GameThread);
+
+    std::lock_guard<std::mutex> lock(MapMutex);
+    MeshEntry& Entry = MeshMap[filename];
+    Entry.LoadJob = LoadJob;
+    Entry.CompletedJob = CompletedJob;
+    return CompletedJob;
 }
 
 // 이전에 LoadFBX로 호출된 파일이라면 로드된 에셋을 반환합니다.
@@ -71,6 +95,7 @@ USkeletalMesh* FFbxLoader::GetSkeletalMesh(const FString& filename)
 {
     while (true)
     {
+        FJobHandle LoadJob;
         {
             std::lock_guard<std::mutex> lock(MapMutex);
 
@@ -85,6 +110,7 @@ USkeletalMesh* FFbxLoader::GetSkeletalMesh(const FString& filename)
                 case LoadState::Failed:
                     return nullptr;
                 case LoadState::Loading:
+                    LoadJob = entry.LoadJob;
                     break; //switch break : 기다림
                 }
             }
@@ -94,27 +120,24 @@ USkeletalMesh* FFbxLoader::GetSkeletalMesh(const FString& filename)
             }
         }
 
-        // Sleep 없이 무한 루프 → CPU 낭비 방지
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (LoadJob.IsValid())
+        {
+            // 기다리는 동안 다른 Job을 대신 실행하되, 호출한 쪽이 실행 중일 수 있는 GameThread Job은 건드리지 않습니다.
+            LoadJob.Wait(false);
+        }
+        else
+        {
+            // LoadFBX가 아직 Job을 등록하지 않았음
+            std::this_thread::yield();
+        }
     }
 
     // 로드를 시작한 적이 없으면 메인쓰레드에서 로드
     // 이 경우 AssetManager에서 로드한 적이 없는거이므로
     // AssetManager에 추가
 
-    TMap<FName, FAssetInfo> AssetRegistry = UAssetManager::Get().GetAssetRegistry();
-    bool bRegistered = false;
-    for (const auto& Asset : AssetRegistry)
-    {
-        if (Asset.Value.GetFullPath() == filename)
-        {
-            bRegistered = true;
-            break;
-        }
-
-    }
     // 만약 등록되지 않았으면 등록하고 로드
-    if (!bRegistered)
+    if (!UAssetManager::Get().FindAssetInfo(filename))
     {
         UAssetManager::Get().RegisterAsset(StringToWString(*filename));
     }
@@ -131,6 +154,11 @@ USkeletalMesh* FFbxLoader::GetSkeletalMesh(const FString& filename)
             MeshMap[filename] = { LoadState::Failed, nullptr };
         }
     }
+
+    if (mesh)
+    {
+        UAssetManager::Get().NotifyAssetLoaded(filename);
+    }
     
     return mesh;
 }
@@ -653,6 +681,8 @@ void FFbxLoader::ParseFBXAnimationOnly(const FString& filename, USkeletalMesh* s
 
 void FFbxLoader::LoadAnimationInfo(FbxScene* Scene, USkeletalMesh* SkeletalMesh, TArray<UAnimSequence*>& OutSequences)
 {
+    SCOPED_MEMORY_TAG(Animation);
+
     FbxArray<FbxString*> animNames;
     Scene->FillAnimStackNameArray(animNames);
 
@@ -6,6 +6,7 @@
 #include "Container/Map.h"
 #include "Container/String.h"
 #include "Asset/SkeletalMeshAsset.h"
+#include "Async/JobSystem.h"
 #include <mutex>
 
 #include "Animation/AnimSequence.h"
@@ -22,9 +23,15 @@ struct FFbxLoader
 {
 public:
     static void Init();
-    static void LoadFBX(const FString& filename);
+
+    /**
+     * Worker 스레드에서 FBX를 파싱합니다.
+     * @return 로드가 끝나면 완료되는 Job, 이미 로드를 시작한 파일이면 그 로드의 Job (끝났으면 빈 Handle)
+     */
+    static FJobHandle LoadFBX(const FString& filename);
     static USkeletalMesh* GetSkeletalMesh(const FString& filename);
 
+    /** 게임 스레드에서 실행됩니다. */
     inline static FOnLoadFBXCompleted OnLoadFBXCompleted;
 private:
     static USkeletalMesh* ParseSkeletalMesh(const FString& filename);
@@ -82,6 +89,9 @@ public:
     struct MeshEntry {
         LoadState State;
         USkeletalMesh* Mesh;
+        FJobHandle LoadJob = {};      // 파싱 Job, Loading 상태일 때 GetSkeletalMesh가 기다림
+        FJobHandle CompletedJob = {}; // 게임 스레드의 완료 알림까지 포함한 Job, LoadFBX가 반환함
+        bool bLoadedByJob = false;    // LoadFBX로 로드를 시작했으면 true, GetSkeletalMesh에서 바로 로드했으면 false
     };
     struct FAnimEntry
     {
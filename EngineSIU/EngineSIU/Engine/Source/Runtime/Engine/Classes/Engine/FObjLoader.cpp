@@ -1,15 +1,19 @@
 #include "FObjLoader.h"
 
+#include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
 #include "Components/Material/Material.h"
 #include "Components/Mesh/StaticMeshRenderData.h"
 
 #include "Asset/StaticMeshAsset.h"
+#include "HAL/MemoryTracker.h"
 
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
 #include "AssetManager.h"
+#include "StreamableManager.h"
 
 bool FObjLoader::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
@@ -638,20 +642,25 @@ void FObjLoader::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticM
 
 FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
-    FStaticMeshRenderData* NewStaticMesh = new FStaticMeshRenderData();
+    SCOPED_MEMORY_TAG(StaticMesh);
 
-    if ( const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
-        return *It;
+        std::lock_guard Lock(ObjStaticMeshMapMutex);
+        if (const auto It = ObjStaticMeshMap.Find(PathFileName))
+        {
+            return *It;
+        }
     }
 
+    // 파싱하는 동안에는 Lock을 잡지 않습니다.
+    FStaticMeshRenderData* NewStaticMesh = new FStaticMeshRenderData();
+
     FWString BinaryPath = (PathFileName + ".bin").ToWideString();
     if (std::ifstream(BinaryPath).good())
     {
         if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
         {
-            ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-            return NewStaticMesh;
+            return AddObjStaticMesh(PathFileName, NewStaticMesh);
         }
     }
 
@@ -676,11 +685,8 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
             return nullptr;
         }
 
+        // UMaterial은 게임 스레드의 UStaticMesh::SetData에서 만듭니다.
         CombineMaterialIndex(*NewStaticMesh);
-
-        for (int materialIndex = 0; materialIndex < NewStaticMesh->Materials.Num(); materialIndex++) {
-            CreateMaterial(NewStaticMesh->Materials[materialIndex]);
-        }
     }
 
     // Convert FStaticMeshRenderData
@@ -692,8 +698,19 @@ FStaticMeshRenderData* FObjManager::LoadObjStaticMeshAsset(const FString& PathFi
     }
 
     SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); 
-    ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-    return NewStaticMesh;
+    return AddObjStaticMesh(PathFileName, NewStaticMesh);
+}
+
+FStaticMeshRenderData* FObjManager::AddObjStaticMesh(const FString& PathFileName, FStaticMeshRenderData* StaticMesh)
+{
+    std::lock_guard Lock(ObjStaticMeshMapMutex);
+    if (const auto It = ObjStaticMeshMap.Find(PathFileName))
+    {
+        delete StaticMesh;
+        return *It;
+    }
+    ObjStaticMeshMap.Add(PathFileName, StaticMesh);
+    return StaticMesh;
 }
 
 void FObjManager::CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh)
@@ -909,25 +926,48 @@ UMaterial* FObjManager::GetMaterial(FString name)
 
 UStaticMesh* FObjManager::CreateStaticMesh(const FString& filePath)
 {
-    FStaticMeshRenderData* StaticMeshRenderData = FObjManager::LoadObjStaticMeshAsset(filePath);
+    // 같은 파일을 Worker에서 읽고 있다면 다시 파싱하지 않고 그 결과를 기다립니다.
+    if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+    {
+        FStreamableManager& StreamableManager = AssetManager->GetStreamableManager();
+        if (StreamableManager.IsAsyncLoading(filePath))
+        {
+            return Cast<UStaticMesh>(StreamableManager.LoadSynchronous(filePath));
+        }
+    }
+
+    return RegisterStaticMesh(LoadObjStaticMeshAsset(filePath));
+}
 
+UStaticMesh* FObjManager::RegisterStaticMesh(FStaticMeshRenderData* StaticMeshRenderData)
+{
     if (StaticMeshRenderData == nullptr) return nullptr;
 
-    UStaticMesh* StaticMesh = GetStaticMesh(StaticMeshRenderData->ObjectName);
-    if (StaticMesh != nullptr)
+    if (UStaticMesh** Found = StaticMeshMap.Find(StaticMeshRenderData->ObjectName))
     {
-        return StaticMesh;
+        return *Found;
     }
 
     UAssetManager& AssetManager = UAssetManager::Get();
-    StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(&AssetManager);
+    UStaticMesh* StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(&AssetManager);
     StaticMesh->SetData(StaticMeshRenderData);
 
     StaticMeshMap.Add(StaticMeshRenderData->ObjectName, StaticMesh); // TODO: 장기적으로 보면 파일 이름 대신 경로를 Key로 사용하는게 좋음.
+    AssetManager.NotifyAssetLoaded(FString(StaticMeshRenderData->ObjectName));
     return StaticMesh;
 }
 
 UStaticMesh* FObjManager::GetStaticMesh(const FWString& name)
 {
-    return StaticMeshMap[name];
+    if (UStaticMesh** Found = StaticMeshMap.Find(name))
+    {
+        return *Found;
+    }
+
+    // Contents의 Asset은 비동기로 로드되므로, 아직 등록되지 않았을 수 있습니다.
+    if (std::filesystem::exists(name))
+    {
+        return CreateStaticMesh(FString(name));
+    }
+    return nullptr;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "EngineLoop.h"
 #include "Container/Map.h"
 #include "HAL/PlatformType.h"
@@ -33,6 +35,7 @@ private:
 struct FObjManager
 {
 public:
+    /** .obj(또는 캐시된 .bin)를 읽어 RenderData를 만듭니다. UObject를 만들지 않으므로 Worker 스레드에서도 호출할 수 있습니다. */
     static FStaticMeshRenderData* LoadObjStaticMeshAsset(const FString& PathFileName);
 
     static void CombineMaterialIndex(FStaticMeshRenderData& OutFStaticMesh);
@@ -49,15 +52,24 @@ public:
 
     static int GetMaterialNum() { return MaterialMap.Num(); }
 
+    /** 비동기로 로드 중인 파일이면 그 로드가 끝나기를 기다립니다. 게임 스레드에서만 호출해야 합니다. */
     static UStaticMesh* CreateStaticMesh(const FString& filePath);
 
+    /** LoadObjStaticMeshAsset의 결과로 UStaticMesh를 만들어 등록합니다. 게임 스레드에서만 호출해야 합니다. */
+    static UStaticMesh* RegisterStaticMesh(FStaticMeshRenderData* StaticMeshRenderData);
+
     static const TMap<FWString, UStaticMesh*>& GetStaticMeshes() { return StaticMeshMap; }
 
+    /** 아직 로드되지 않은 파일 경로라면 그 자리에서 로드합니다. */
     static UStaticMesh* GetStaticMesh(const FWString& name);
 
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
 private:
+    /** 다른 스레드가 먼저 같은 파일을 등록했다면 StaticMesh를 지우고 등록된 것을 반환합니다. */
+    static FStaticMeshRenderData* AddObjStaticMesh(const FString& PathFileName, FStaticMeshRenderData* StaticMesh);
+
+    inline static std::mutex ObjStaticMeshMapMutex;
     inline static TMap<FString, FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> MaterialMap;
@@ -5,6 +5,7 @@
 #include "Define.h"
 #include "Components/SkySphereComponent.h"
 #include "D3D11RHI/GraphicDevice.h"
+#include "D3D11RHI/RHIStats.h"
 #include "DirectXTK/DDSTextureLoader.h"
 #include "Engine/FObjLoader.h"
 
@@ -46,6 +47,7 @@ void FResourceMgr::Initialize(FRenderer* renderer, FGraphicsDevice* device)
 }
 
 void FResourceMgr::Release(FRenderer* renderer) {
+    std::lock_guard Lock(TextureMapMutex);
     for (const auto& Pair : textureMap)
     {
         FTexture* texture = Pair.Value.get();
@@ -75,10 +77,23 @@ struct TupleHash {
 
 std::shared_ptr<FTexture> FResourceMgr::GetTexture(const FWString& name) const
 {
+    std::lock_guard Lock(TextureMapMutex);
     auto* TempValue = textureMap.Find(name);
     return TempValue ? *TempValue : nullptr;
 }
 
+void FResourceMgr::AddTexture(const FWString& name, const std::shared_ptr<FTexture>& texture)
+{
+    std::lock_guard Lock(TextureMapMutex);
+    if (textureMap.Contains(name))
+    {
+        // 다른 스레드가 같은 파일을 먼저 로드했습니다.
+        texture->Release();
+        return;
+    }
+    textureMap.Add(name, texture);
+}
+
 HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, const wchar_t* filename, bool bIsSRGB)
 {
     IWICImagingFactory* wicFactory = nullptr;
@@ -121,6 +136,22 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, const wchar_t* f
         return hr;
     }
 
+    FRHIStats::AddUpload(static_cast<uint64>(width) * height * 4);
+
+    // Null RHI(-headless)에서는 디코딩까지만 하고, GPU 리소스 없이 크기만 등록합니다.
+    if (!device)
+    {
+        delete[] imageData;
+        wicFactory->Release();
+        decoder->Release();
+        frame->Release();
+        converter->Release();
+
+        const FWString Name = FWString(filename);
+        AddTexture(Name, std::make_shared<FTexture>(nullptr, nullptr, nullptr, Name, width, height));
+        return S_OK;
+    }
+
     // DirectX 11 텍스처 생성
     D3D11_TEXTURE2D_DESC textureDesc = {};
     textureDesc.Width = width;
@@ -169,7 +200,7 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, const wchar_t* f
     device->CreateSamplerState(&samplerDesc, &SamplerState);
     FWString name = FWString(filename);
 
-    textureMap[name] = std::make_shared<FTexture>(TextureSRV, Texture2D, SamplerState, name, width, height);
+    AddTexture(name, std::make_shared<FTexture>(TextureSRV, Texture2D, SamplerState, name, width, height));
 
     FConsole::GetInstance().AddLog(ELogLevel::Warning, "Texture File Load Successs");
     return hr;
@@ -178,6 +209,12 @@ HRESULT FResourceMgr::LoadTextureFromFile(ID3D11Device* device, const wchar_t* f
 HRESULT FResourceMgr::LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceContext* context, const wchar_t* filename)
 {
 
+    // DDS는 Device 없이 읽을 수 없으므로 Null RHI에서는 건너뜁니다.
+    if (!device)
+    {
+        return E_FAIL;
+    }
+
     ID3D11Resource* texture = nullptr;
     ID3D11ShaderResourceView* textureView = nullptr;
 
@@ -223,7 +260,7 @@ HRESULT FResourceMgr::LoadTextureFromDDS(ID3D11Device* device, ID3D11DeviceConte
 
     FWString name = FWString(filename);
 
-    textureMap[name] = std::make_shared<FTexture>(textureView, texture2D, SamplerState, name, width, height);
+    AddTexture(name, std::make_shared<FTexture>(textureView, texture2D, SamplerState, name, width, height));
 
     FConsole::GetInstance().AddLog(ELogLevel::Warning, "Texture File Load Successs");
 
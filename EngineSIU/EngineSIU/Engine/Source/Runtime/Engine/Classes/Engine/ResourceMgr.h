@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <mutex>
 #include "Texture.h"
 #include "Container/Map.h"
 
@@ -16,5 +17,11 @@ public:
 
     std::shared_ptr<FTexture> GetTexture(const FWString& name) const;
 private:
+    /** 이미 같은 이름의 Texture가 있으면 새로 만든 Texture를 해제하고 기존 것을 유지합니다. */
+    void AddTexture(const FWString& name, const std::shared_ptr<FTexture>& texture);
+
     TMap<FWString, std::shared_ptr<FTexture>> textureMap;
+
+    /** Asset Streaming 중에는 Worker 스레드에서도 Texture를 로드하므로 textureMap을 보호합니다. */
+    mutable std::mutex TextureMapMutex;
 };
@@ -0,0 +1,305 @@
+#include "StreamableManager.h"
+
+#include <filesystem>
+
+#include "FFbxLoader.h"
+#include "FObjLoader.h"
+#include "UObject/Object.h"
+#include "UserInterface/Console.h"
+
+
+namespace
+{
+    enum class EStreamableAssetType : uint8
+    {
+        Unsupported,
+        StaticMesh,
+        SkeletalMesh,
+    };
+
+    EStreamableAssetType GetStreamableAssetType(const FString& AssetPath)
+    {
+        const std::filesystem::path Extension = std::filesystem::path(AssetPath.ToWideString()).extension();
+        if (Extension == ".obj")
+        {
+            return EStreamableAssetType::StaticMesh;
+        }
+        if (Extension == ".fbx")
+        {
+            return EStreamableAssetType::SkeletalMesh;
+        }
+        return EStreamableAssetType::Unsupported;
+    }
+}
+
+
+const FString& FStreamableHandle::GetAssetPath() const
+{
+    return Request->AssetPath;
+}
+
+void FStreamableHandle::SetPriority(int32 NewPriority)
+{
+    Priority = NewPriority;
+    if (IsLoadingInProgress())
+    {
+        FStreamableManager::UpdateRequestPriority(*Request);
+    }
+}
+
+void FStreamableHandle::WaitUntilComplete()
+{
+    if (IsLoadingInProgress())
+    {
+        Manager->WaitForRequest(Request);
+    }
+}
+
+void FStreamableHandle::CancelHandle()
+{
+    if (IsLoadingInProgress())
+    {
+        Manager->CancelHandle(*this);
+    }
+}
+
+
+FStreamableManager::~FStreamableManager()
+{
+    // FinishJob이 this를 참조하므로 시작한 로드는 끝날 때까지 기다립니다. Callback은 호출하지 않습니다.
+    QueuedRequests.Empty();
+
+    TArray<std::shared_ptr<FStreamableRequest>> Requests;
+    for (const auto& [AssetPath, Request] : ActiveRequests)
+    {
+        Requests.Add(Request);
+    }
+
+    for (const std::shared_ptr<FStreamableRequest>& Request : Requests)
+    {
+        for (const std::shared_ptr<FStreamableHandle>& Handle : Request->Handles)
+        {
+            Handle->bCanceled = true;
+        }
+        Request->Handles.Empty();
+
+        if (Request->State == EStreamableState::Loading)
+        {
+            const FJobHandle FinishJob = Request->FinishJob;
+            FinishJob.Wait();
+        }
+    }
+}
+
+bool FStreamableManager::IsSupportedAsset(const FString& AssetPath)
+{
+    return GetStreamableAssetType(AssetPath) != EStreamableAssetType::Unsupported;
+}
+
+std::shared_ptr<FStreamableHandle> FStreamableManager::RequestAsyncLoad(const FString& AssetPath, FStreamableDelegate DelegateToCall, int32 Priority)
+{
+    if (!IsSupportedAsset(AssetPath))
+    {
+        UE_LOG(ELogLevel::Warning, "RequestAsyncLoad: Unsupported asset type : %s", *AssetPath);
+        return nullptr;
+    }
+
+    std::shared_ptr<FStreamableHandle> Handle = std::make_shared<FStreamableHandle>();
+    Handle->Manager = this;
+    Handle->CompletionDelegate = std::move(DelegateToCall);
+    Handle->Priority = Priority;
+
+    // 같은 경로를 이미 기다리거나 로드 중이면 그 로드를 공유합니다.
+    if (const std::shared_ptr<FStreamableRequest>* ActiveRequest = ActiveRequests.Find(AssetPath))
+    {
+        Handle->Request = *ActiveRequest;
+        Handle->Request->Handles.Add(Handle);
+        UpdateRequestPriority(*Handle->Request);
+        return Handle;
+    }
+
+    std::shared_ptr<FStreamableRequest> Request = std::make_shared<FStreamableRequest>();
+    Request->AssetPath = AssetPath;
+    Request->Priority = Priority;
+    Request->RequestOrder = NextRequestOrder++;
+    Request->Handles.Add(Handle);
+    Handle->Request = Request;
+
+    ActiveRequests.Add(AssetPath, Request);
+    QueuedRequests.Add(Request);
+    StartQueuedLoads();
+
+    return Handle;
+}
+
+UObject* FStreamableManager::LoadSynchronous(const FString& AssetPath)
+{
+    const std::shared_ptr<FStreamableHandle> Handle = RequestAsyncLoad(AssetPath, FStreamableDelegate(), AsyncLoadHighPriority);
+    if (!Handle)
+    {
+        return nullptr;
+    }
+
+    Handle->WaitUntilComplete();
+    return Handle->GetLoadedAsset();
+}
+
+bool FStreamableManager::IsAsyncLoading(const FString& AssetPath) const
+{
+    return ActiveRequests.Contains(AssetPath);
+}
+
+void FStreamableManager::StartQueuedLoads()
+{
+    while (NumLoading < MaxConcurrentLoads && QueuedRequests.Num() > 0)
+    {
+        // 대기열이 짧으므로 정렬하지 않고 매번 가장 높은 Priority를 찾습니다.
+        int32 BestIndex = 0;
+        for (int32 Index = 1; Index < QueuedRequests.Num(); ++Index)
+        {
+            const FStreamableRequest& Candidate = *QueuedRequests[Index];
+            const FStreamableRequest& Best = *QueuedRequests[BestIndex];
+            if (Candidate.Priority > Best.Priority
+                || (Candidate.Priority == Best.Priority && Candidate.RequestOrder < Best.RequestOrder))
+            {
+                BestIndex = Index;
+            }
+        }
+
+        const std::shared_ptr<FStreamableRequest> Request = QueuedRequests[BestIndex];
+        QueuedRequests.RemoveAt(BestIndex);
+        StartLoad(Request);
+    }
+}
+
+void FStreamableManager::StartLoad(const std::shared_ptr<FStreamableRequest>& Request)
+{
+    Request->State = EStreamableState::Loading;
+    ++NumLoading;
+
+    const FString& AssetPath = Request->AssetPath;
+    FJobHandle LoadJob;
+    switch (GetStreamableAssetType(AssetPath))
+    {
+    case EStreamableAssetType::StaticMesh:
+        // 파싱과 Texture 로드는 Worker에서, UStaticMesh와 UMaterial 생성은 게임 스레드에서 실행합니다.
+        LoadJob = FJobSystem::Get().Launch([Request]()
+        {
+            FStaticMeshRenderData* RenderData = FObjManager::LoadObjStaticMeshAsset(Request->AssetPath);
+            Request->Resolve = [RenderData]() -> UObject*
+            {
+                return FObjManager::RegisterStaticMesh(RenderData);
+            };
+        });
+        break;
+
+    case EStreamableAssetType::SkeletalMesh:
+        // LoadFBX의 Job이 끝난 뒤에는 GetSkeletalMesh가 기다리지 않고 바로 반환합니다.
+        LoadJob = FFbxLoader::LoadFBX(AssetPath);
+        Request->Resolve = [AssetPath]() -> UObject*
+        {
+            return FFbxLoader::GetSkeletalMesh(AssetPath);
+        };
+        break;
+
+    default:
+        break;
+    }
+
+    Request->FinishJob = LoadJob.Then([this, Request]()
+    {
+        FinishLoad(Request);
+    }, EJobThread::GameThread);
+}
+
+void FStreamableManager::FinishLoad(const std::shared_ptr<FStreamableRequest>& Request)
+{
+    Request->LoadedAsset = Request->Resolve ? Request->Resolve() : nullptr;
+    Request->Resolve = nullptr;
+    Request->State = Request->LoadedAsset ? EStreamableState::Completed : EStreamableState::Failed;
+
+    if (!Request->LoadedAsset)
+    {
+        UE_LOG(ELogLevel::Error, "Failed to load asset : %s", *Request->AssetPath);
+    }
+
+    --NumLoading;
+    ActiveRequests.Remove(Request->AssetPath);
+
+    // Callback 안에서 새 요청을 할 수 있으므로, 상태를 모두 정리한 뒤에 호출합니다.
+    const TArray<std::shared_ptr<FStreamableHandle>> Handles = Request->Handles;
+    Request->Handles.Empty();
+    for (const std::shared_ptr<FStreamableHandle>& Handle : Handles)
+    {
+        Handle->bFinished = true;
+        Handle->LoadedAsset = Request->LoadedAsset;
+    }
+
+    StartQueuedLoads();
+
+    for (const std::shared_ptr<FStreamableHandle>& Handle : Handles)
+    {
+        // 앞선 Callback에서 취소되었을 수 있습니다.
+        if (!Handle->bCanceled)
+        {
+            Handle->CompletionDelegate.ExecuteIfBound(Request->LoadedAsset);
+        }
+    }
+}
+
+void FStreamableManager::WaitForRequest(const std::shared_ptr<FStreamableRequest>& Request)
+{
+    if (Request->State == EStreamableState::Queued)
+    {
+        // 기다리는 동안 다른 로드가 끝나기를 기다리지 않도록 MaxConcurrentLoads와 상관없이 바로 시작합니다.
+        QueuedRequests.Remove(Request);
+        StartLoad(Request);
+    }
+
+    // FinishLoad는 GameThread Job이므로 Wait 중에 게임 스레드에서 실행됩니다.
+    const FJobHandle FinishJob = Request->FinishJob;
+    FinishJob.Wait();
+}
+
+void FStreamableManager::CancelHandle(FStreamableHandle& Handle)
+{
+    Handle.bCanceled = true;
+
+    const std::shared_ptr<FStreamableRequest> Request = Handle.Request;
+    for (int32 Index = 0; Index < Request->Handles.Num(); ++Index)
+    {
+        if (Request->Handles[Index].get() == &Handle)
+        {
+            Request->Handles.RemoveAt(Index);
+            break;
+        }
+    }
+
+    if (Request->Handles.Num() > 0)
+    {
+        UpdateRequestPriority(*Request);
+        return;
+    }
+
+    // 시작한 로드는 Worker에서 멈출 수 없으므로 끝까지 진행하고, 결과는 캐시에 남습니다.
+    if (Request->State == EStreamableState::Queued)
+    {
+        QueuedRequests.Remove(Request);
+        ActiveRequests.Remove(Request->AssetPath);
+    }
+}
+
+void FStreamableManager::UpdateRequestPriority(FStreamableRequest& Request)
+{
+    if (Request.Handles.Num() == 0)
+    {
+        return;
+    }
+
+    int32 MaxPriority = Request.Handles[0]->Priority;
+    for (const std::shared_ptr<FStreamableHandle>& Handle : Request.Handles)
+    {
+        MaxPriority = std::max(MaxPriority, Handle->Priority);
+    }
+    Request.Priority = MaxPriority;
+}
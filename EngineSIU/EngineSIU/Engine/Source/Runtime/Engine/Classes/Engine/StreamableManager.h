@@ -0,0 +1,189 @@
+#pragma once
+#include <functional>
+#include <memory>
+
+#include "Async/JobSystem.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "Delegates/DelegateCombination.h"
+#include "HAL/PlatformType.h"
+
+class UObject;
+class FStreamableManager;
+
+/** 로드가 끝나면 게임 스레드에서 호출됩니다. 실패하면 nullptr가 전달됩니다. */
+DECLARE_DELEGATE_OneParam(FStreamableDelegate, UObject* /*LoadedAsset*/);
+
+
+enum class EStreamableState : uint8
+{
+    /** 다른 로드가 끝나기를 기다리는 중 */
+    Queued,
+
+    /** Worker 스레드에서 읽는 중 */
+    Loading,
+
+    Completed,
+    Failed,
+};
+
+
+/**
+ * 같은 경로에 대한 요청들이 공유하는 실제 로드, FStreamableManager 내부에서만 사용합니다.
+ * 모든 멤버는 게임 스레드에서만 접근합니다. (Resolve만 Worker에서 설정되고, FinishJob 이후에 읽힙니다.)
+ */
+struct FStreamableRequest
+{
+    FString AssetPath;
+
+    /** 이 로드를 기다리는 Handle들 중 가장 높은 Priority */
+    int32 Priority = 0;
+
+    /** 같은 Priority끼리는 먼저 요청된 것부터 시작합니다. */
+    uint64 RequestOrder = 0;
+
+    EStreamableState State = EStreamableState::Queued;
+
+    UObject* LoadedAsset = nullptr;
+
+    /** Worker 단계가 끝난 뒤 게임 스레드에서 UObject를 만들거나 찾는 함수 */
+    std::function<UObject*()> Resolve;
+
+    /** 게임 스레드에서 결과를 처리하는 Job, 이 Job이 끝나면 로드가 끝난 것입니다. */
+    FJobHandle FinishJob;
+
+    /** 완료 시 Callback을 받을 Handle들, 완료되거나 취소되면 비웁니다. */
+    TArray<std::shared_ptr<struct FStreamableHandle>> Handles;
+};
+
+
+/**
+ * RequestAsyncLoad가 반환하는 요청 하나의 Handle
+ *
+ * Handle마다 Callback과 Priority를 따로 가지며, 같은 경로의 요청들은 하나의 로드를 공유합니다.
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+struct FStreamableHandle
+{
+    const FString& GetAssetPath() const;
+
+    int32 GetPriority() const { return Priority; }
+
+    /** 아직 완료되지 않았고, 취소되지도 않았으면 true */
+    bool IsLoadingInProgress() const { return !bFinished && !bCanceled; }
+
+    /** 로드에 성공했으면 true, 실패한 경우 GetLoadedAsset이 nullptr입니다. */
+    bool HasLoadCompleted() const { return bFinished && LoadedAsset; }
+
+    bool WasCanceled() const { return bCanceled; }
+
+    UObject* GetLoadedAsset() const { return LoadedAsset; }
+
+    /**
+     * Priority를 바꿉니다. 아직 시작하지 않은 로드에만 의미가 있으며,
+     * 같은 로드를 공유하는 다른 Handle의 Priority가 더 높으면 그 값을 따릅니다.
+     */
+    void SetPriority(int32 NewPriority);
+
+    /** 로드가 끝날 때까지 다른 Job을 실행하며 기다립니다. 대기 중인 로드는 즉시 시작합니다. */
+    void WaitUntilComplete();
+
+    /**
+     * 이 Handle의 Callback이 호출되지 않도록 합니다.
+     * 같은 로드를 기다리는 Handle이 없고 아직 시작하지 않았다면 로드 자체를 취소합니다.
+     */
+    void CancelHandle();
+
+private:
+    friend class FStreamableManager;
+
+    FStreamableManager* Manager = nullptr;
+
+    std::shared_ptr<FStreamableRequest> Request;
+
+    FStreamableDelegate CompletionDelegate;
+
+    int32 Priority = 0;
+
+    UObject* LoadedAsset = nullptr;
+
+    bool bFinished = false;
+    bool bCanceled = false;
+};
+
+
+/**
+ * 경로로 Asset을 비동기 로드합니다.
+ *
+ * - 파일 읽기와 파싱은 FJobSystem의 Worker에서, UObject 생성과 Callback은 게임 스레드에서 실행됩니다.
+ * - 동시에 Worker에서 읽는 로드는 MaxConcurrentLoads개로 제한되며, 나머지는 Priority 순으로 대기합니다.
+ * - 현재 .obj(UStaticMesh)와 .fbx(USkeletalMesh)를 지원합니다.
+ *
+ * 게임 스레드에서만 사용해야 합니다.
+ */
+class FStreamableManager
+{
+public:
+    static constexpr int32 DefaultAsyncLoadPriority = 0;
+    static constexpr int32 AsyncLoadHighPriority = 100;
+
+    /** Worker에서 동시에 읽는 최대 로드 수, 나머지 Worker는 Tick과 렌더링 준비에 남겨둡니다. */
+    int32 MaxConcurrentLoads = 2;
+
+    FStreamableManager() = default;
+    ~FStreamableManager();
+
+    FStreamableManager(const FStreamableManager&) = delete;
+    FStreamableManager& operator=(const FStreamableManager&) = delete;
+
+    /**
+     * Asset을 비동기로 로드합니다.
+     * @param AssetPath 로드할 파일 경로
+     * @param DelegateToCall 완료되면 게임 스레드에서 호출됩니다. 취소하면 호출되지 않습니다.
+     * @param Priority 높을수록 먼저 시작합니다.
+     * @return 요청의 Handle, 지원하지 않는 파일이면 nullptr
+     */
+    std::shared_ptr<FStreamableHandle> RequestAsyncLoad(
+        const FString& AssetPath, FStreamableDelegate DelegateToCall = FStreamableDelegate(), int32 Priority = DefaultAsyncLoadPriority
+    );
+
+    /** Asset을 로드하고 끝날 때까지 기다립니다. 이미 비동기로 로드 중이면 그 로드를 기다립니다. */
+    UObject* LoadSynchronous(const FString& AssetPath);
+
+    /** AssetPath를 대기 중이거나 로드 중이면 true */
+    bool IsAsyncLoading(const FString& AssetPath) const;
+
+    /** 대기 중인 로드와 로드 중인 로드의 수 */
+    int32 GetNumPendingLoads() const { return ActiveRequests.Num(); }
+
+    static bool IsSupportedAsset(const FString& AssetPath);
+
+private:
+    friend struct FStreamableHandle;
+
+    /** 대기 중인 로드를 Priority 순으로 MaxConcurrentLoads까지 시작합니다. */
+    void StartQueuedLoads();
+
+    void StartLoad(const std::shared_ptr<FStreamableRequest>& Request);
+
+    /** 게임 스레드에서 로드 결과를 처리하고 Callback을 호출합니다. */
+    void FinishLoad(const std::shared_ptr<FStreamableRequest>& Request);
+
+    void WaitForRequest(const std::shared_ptr<FStreamableRequest>& Request);
+
+    void CancelHandle(FStreamableHandle& Handle);
+
+    static void UpdateRequestPriority(FStreamableRequest& Request);
+
+private:
+    /** 대기 중이거나 로드 중인 요청, 경로로 찾습니다. */
+    TMap<FString, std::shared_ptr<FStreamableRequest>> ActiveRequests;
+
+    /** 아직 시작하지 않은 요청 */
+    TArray<std::shared_ptr<FStreamableRequest>> QueuedRequests;
+
+    int32 NumLoading = 0;
+
+    uint64 NextRequestOrder = 0;
+};
@@ -0,0 +1,369 @@
+#include "TickTaskManager.h"
+
+#include <algorithm>
+
+#include "Async/JobSystem.h"
+#include "Container/ContainerAllocator.h"
+#include "UserInterface/Console.h"
+
+
+const char* GetTickingGroupName(ETickingGroup TickGroup)
+{
+    switch (TickGroup)
+    {
+    case TG_PrePhysics:
+        return "PrePhysics";
+    case TG_DuringPhysics:
+        return "DuringPhysics";
+    case TG_PostPhysics:
+        return "PostPhysics";
+    case TG_PostUpdateWork:
+        return "PostUpdateWork";
+    default:
+        return "Unknown";
+    }
+}
+
+
+FTickFunction::~FTickFunction()
+{
+    UnRegisterTickFunction();
+}
+
+void FTickFunction::RegisterTickFunction(FTickTaskManager* InTickTaskManager)
+{
+    if (!bCanEverTick || !InTickTaskManager || TickTaskManager == InTickTaskManager)
+    {
+        return;
+    }
+
+    UnRegisterTickFunction();
+
+    bTickEnabled = bStartWithTickEnabled;
+    AccumulatedDeltaTime = 0.0f;
+    InTickTaskManager->AddTickFunction(this);
+}
+
+void FTickFunction::UnRegisterTickFunction()
+{
+    if (TickTaskManager)
+    {
+        TickTaskManager->RemoveTickFunction(this);
+    }
+}
+
+void FTickFunction::AddPrerequisite(UObject* TargetObject, FTickFunction& TargetTickFunction)
+{
+    if (&TargetTickFunction == this)
+    {
+        return;
+    }
+
+    const FTickPrerequisite Prerequisite(TargetObject, TargetTickFunction);
+    if (!Prerequisites.Contains(Prerequisite))
+    {
+        Prerequisites.Add(Prerequisite);
+    }
+}
+
+void FTickFunction::RemovePrerequisite(UObject* TargetObject, FTickFunction& TargetTickFunction)
+{
+    Prerequisites.Remove(FTickPrerequisite(TargetObject, TargetTickFunction));
+}
+
+
+FTickTaskManager::~FTickTaskManager()
+{
+    for (FTickFunction* TickFunction : TickFunctions)
+    {
+        if (TickFunction)
+        {
+            TickFunction->TickTaskManager = nullptr;
+            TickFunction->RegisteredIndex = INDEX_NONE;
+        }
+    }
+}
+
+void FTickTaskManager::AddTickFunction(FTickFunction* TickFunction)
+{
+    TickFunction->TickTaskManager = this;
+    TickFunction->RegisteredIndex = TickFunctions.Add(TickFunction);
+}
+
+void FTickTaskManager::RemoveTickFunction(FTickFunction* TickFunction)
+{
+    // Tick 도중에 해제될 수 있으므로 Slot만 비워두고, 다음 프레임 시작 시 정리합니다.
+    TickFunctions[TickFunction->RegisteredIndex] = nullptr;
+    ++NumRemoved;
+
+    TickFunction->TickTaskManager = nullptr;
+    TickFunction->RegisteredIndex = INDEX_NONE;
+}
+
+void FTickTaskManager::CompactTickFunctions()
+{
+    if (NumRemoved == 0)
+    {
+        return;
+    }
+
+    int32 NewNum = 0;
+    for (int32 Index = 0; Index < TickFunctions.Num(); ++Index)
+    {
+        if (FTickFunction* TickFunction = TickFunctions[Index])
+        {
+            TickFunction->RegisteredIndex = NewNum;
+            TickFunctions[NewNum++] = TickFunction;
+        }
+    }
+    TickFunctions.SetNum(NewNum);
+    NumRemoved = 0;
+}
+
+void FTickTaskManager::Tick(float DeltaTime, ELevelTick TickType)
+{
+    if (TickType == LEVELTICK_TimeOnly)
+    {
+        return;
+    }
+
+    CompactTickFunctions();
+
+    // 0은 한 번도 스케줄되지 않은 상태이므로 건너뜁니다.
+    if (++FrameCounter == 0)
+    {
+        ++FrameCounter;
+    }
+
+    for (TArray<TArray<FTickFunction*>>& GroupWaves : Waves)
+    {
+        for (TArray<FTickFunction*>& Wave : GroupWaves)
+        {
+            Wave.Empty();
+        }
+    }
+
+    FrameStats = FTickStats();
+    FrameStats.NumRegistered = TickFunctions.Num();
+
+    const bool bUseSignificance = SignificanceDelegate.IsBound();
+    bool bUpdateSignificance = false;
+    if (bUseSignificance)
+    {
+        TimeSinceSignificanceUpdate += DeltaTime;
+        if (TimeSinceSignificanceUpdate >= SignificanceUpdateInterval)
+        {
+            TimeSinceSignificanceUpdate = 0.0f;
+            bUpdateSignificance = true;
+        }
+    }
+
+    // Tick 도중에 등록된 Tick Function은 다음 프레임부터 실행됩니다.
+    const int32 NumTickFunctions = TickFunctions.Num();
+    for (int32 Index = 0; Index < NumTickFunctions; ++Index)
+    {
+        FTickFunction* TickFunction = TickFunctions[Index];
+        if (!TickFunction || !TickFunction->bTickEnabled)
+        {
+            continue;
+        }
+
+        if (bUpdateSignificance && TickFunction->bAllowSignificanceThrottling)
+        {
+            const AActor* SignificanceActor = TickFunction->GetSignificanceActor();
+            TickFunction->Significance = SignificanceActor
+                ? SignificanceDelegate.Execute(SignificanceActor)
+                : ETickSignificance::Full;
+        }
+
+        if (ShouldTickThisFrame(TickFunction, DeltaTime, bUseSignificance))
+        {
+            TickFunction->RunFrame = FrameCounter;
+        }
+    }
+
+    // 선행 Tick Function을 재귀적으로 먼저 스케줄하므로, 모든 RunFrame이 정해진 뒤에 시작합니다.
+    for (int32 Index = 0; Index < NumTickFunctions; ++Index)
+    {
+        FTickFunction* TickFunction = TickFunctions[Index];
+        if (TickFunction && TickFunction->RunFrame == FrameCounter)
+        {
+            ScheduleTickFunction(TickFunction);
+        }
+    }
+
+    bIsTicking = true;
+    for (const TArray<TArray<FTickFunction*>>& GroupWaves : Waves)
+    {
+        for (const TArray<FTickFunction*>& Wave : GroupWaves)
+        {
+            if (Wave.Num() > 0)
+            {
+                RunWave(Wave, TickType);
+            }
+        }
+    }
+    bIsTicking = false;
+}
+
+bool FTickTaskManager::ShouldTickThisFrame(FTickFunction* TickFunction, float DeltaTime, bool bUseSignificance)
+{
+    float TickInterval = TickFunction->TickInterval;
+    if (bUseSignificance && TickFunction->bAllowSignificanceThrottling)
+    {
+        switch (TickFunction->Significance)
+        {
+        case ETickSignificance::Dormant:
+            // 깨어날 때 멈춰있던 시간만큼 한 번에 진행하지 않도록 누적하지 않습니다.
+            TickFunction->AccumulatedDeltaTime = 0.0f;
+            ++FrameStats.NumDormant;
+            ++FrameStats.NumSkipped;
+            return false;
+        case ETickSignificance::Reduced:
+            TickInterval = std::max(TickInterval, ReducedTickInterval);
+            ++FrameStats.NumSlowed;
+            break;
+        default:
+            break;
+        }
+    }
+
+    TickFunction->AccumulatedDeltaTime += DeltaTime;
+    if (TickFunction->AccumulatedDeltaTime < TickInterval)
+    {
+        ++FrameStats.NumSkipped;
+        return false;
+    }
+
+    TickFunction->TickDeltaTime = TickFunction->AccumulatedDeltaTime;
+    TickFunction->AccumulatedDeltaTime = 0.0f;
+    ++FrameStats.NumRan;
+    return true;
+}
+
+void FTickTaskManager::ScheduleTickFunction(FTickFunction* TickFunction)
+{
+    if (TickFunction->ScheduledFrame == FrameCounter)
+    {
+        return;
+    }
+
+    TickFunction->bScheduling = true;
+
+    // 선행 Tick Function 중 가장 늦은 Group까지 미룹니다.
+    ETickingGroup ActualTickGroup = TickFunction->TickGroup;
+    for (const FTickPrerequisite& Prerequisite : TickFunction->Prerequisites)
+    {
+        FTickFunction* PrerequisiteFunction = Prerequisite.Get();
+        // 이번 프레임에 실행되지 않는 선행 Tick Function은 기다리지 않습니다.
+        if (!PrerequisiteFunction || PrerequisiteFunction->TickTaskManager != this || PrerequisiteFunction->RunFrame != FrameCounter)
+        {
+            continue;
+        }
+
+        if (PrerequisiteFunction->bScheduling)
+        {
+            UE_LOG(
+                ELogLevel::Warning, "Tick prerequisite cycle: %s -> %s, ignoring the dependency",
+                *TickFunction->DiagnosticMessage(), *PrerequisiteFunction->DiagnosticMessage()
+            );
+            continue;
+        }
+
+        ScheduleTickFunction(PrerequisiteFunction);
+        ActualTickGroup = std::max(ActualTickGroup, PrerequisiteFunction->ActualTickGroup);
+    }
+
+    // 같은 Group의 선행 Tick Function보다 한 단계 뒤의 Wave에서 실행합니다.
+    int32 WaveIndex = 0;
+    for (const FTickPrerequisite& Prerequisite : TickFunction->Prerequisites)
+    {
+        FTickFunction* PrerequisiteFunction = Prerequisite.Get();
+        if (PrerequisiteFunction
+            && PrerequisiteFunction->ScheduledFrame == FrameCounter
+            && PrerequisiteFunction->ActualTickGroup == ActualTickGroup)
+        {
+            WaveIndex = std::max(WaveIndex, PrerequisiteFunction->WaveIndex + 1);
+        }
+    }
+
+    TickFunction->bScheduling = false;
+    TickFunction->ScheduledFrame = FrameCounter;
+    TickFunction->ActualTickGroup = ActualTickGroup;
+    TickFunction->WaveIndex = WaveIndex;
+
+    TArray<TArray<FTickFunction*>>& GroupWaves = Waves[ActualTickGroup];
+    if (GroupWaves.Num() <= WaveIndex)
+    {
+        GroupWaves.SetNum(WaveIndex + 1);
+    }
+    GroupWaves[WaveIndex].Add(TickFunction);
+}
+
+void FTickTaskManager::RunWave(const TArray<FTickFunction*>& Wave, ELevelTick TickType) const
+{
+    FJobSystem& JobSystem = FJobSystem::Get();
+    if (bForceSerialTicking || !JobSystem.IsRunning())
+    {
+        for (FTickFunction* TickFunction : Wave)
+        {
+            ExecuteTickFunction(TickFunction, TickType);
+        }
+        return;
+    }
+
+    // Worker에 보낼 Tick은 여기서 실행 여부를 확정합니다.
+    // Worker는 등록 상태나 bTickEnabled를 읽지 않으므로, 같은 Wave의 게임 스레드 Tick이 해제하거나 비활성화해도 이번 Wave에는 실행됩니다.
+    TArray<FTickFunction*, TFrameAllocator<FTickFunction*>> ParallelTicks;
+    TArray<FTickFunction*, TFrameAllocator<FTickFunction*>> GameThreadTicks;
+    for (FTickFunction* TickFunction : Wave)
+    {
+        if (TickFunction->bRunOnAnyThread)
+        {
+            if (TickFunction->IsTickFunctionRegistered() && TickFunction->bTickEnabled)
+            {
+                ParallelTicks.Add(TickFunction);
+            }
+        }
+        else
+        {
+            GameThreadTicks.Add(TickFunction);
+        }
+    }
+
+    // Batch를 먼저 보내고, Worker가 실행하는 동안 게임 스레드 Tick을 처리합니다.
+    TArray<FJobHandle, TFrameAllocator<FJobHandle>> Batches;
+    for (int32 Begin = 0; Begin < ParallelTicks.Num(); Begin += ParallelTickBatchSize)
+    {
+        const int32 End = std::min(Begin + ParallelTickBatchSize, ParallelTicks.Num());
+        Batches.Add(JobSystem.Launch([&ParallelTicks, Begin, End, TickType]()
+        {
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                FTickFunction* TickFunction = ParallelTicks[Index];
+                TickFunction->ExecuteTick(TickFunction->TickDeltaTime, TickType);
+            }
+        }));
+    }
+
+    for (FTickFunction* TickFunction : GameThreadTicks)
+    {
+        ExecuteTickFunction(TickFunction, TickType);
+    }
+
+    // Tick 목록을 순회하는 중이므로, 로드 완료 Callback 같은 GameThread Job은 ProcessGameThreadJobs에 맡깁니다.
+    for (const FJobHandle& Batch : Batches)
+    {
+        JobSystem.Wait(Batch, false);
+    }
+}
+
+void FTickTaskManager::ExecuteTickFunction(FTickFunction* TickFunction, ELevelTick TickType)
+{
+
+    // 같은 프레임의 앞선 Tick에서 해제되거나 비활성화되었을 수 있습니다. 게임 스레드에서만 호출합니다.
+    if (TickFunction->IsTickFunctionRegistered() && TickFunction->bTickEnabled)
+    {
+        TickFunction->ExecuteTick(TickFunction->TickDeltaTime, TickType);
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "EngineBaseTypes.h"
+#include "Container/Array.h"
+#include "Delegates/Delegate.h"
+
+
+/** 한 프레임 동안의 Tick 통계 */
+struct FTickStats
+{
+    int32 NumRegistered = 0;
+
+    /** 실행된 Tick Function 수 */
+    int32 NumRan = 0;
+
+    /** 활성화되어 있지만 TickInterval이 지나지 않았거나 Dormant여서 건너뛴 수 */
+    int32 NumSkipped = 0;
+
+    /** Significance가 Reduced여서 Tick 간격이 늘어난 수 */
+    int32 NumSlowed = 0;
+
+    /** Significance가 Dormant여서 멈춘 수, NumSkipped에 포함됩니다. */
+    int32 NumDormant = 0;
+};
+
+/** Actor의 Significance를 반환합니다. 게임 스레드에서 SignificanceUpdateInterval마다 호출됩니다. */
+using FTickSignificanceDelegate = TDelegate<ETickSignificance(const AActor*)>;
+
+
+/**
+ * World 하나에 등록된 Tick Function들을 TickGroup 순서대로 실행합니다.
+ *
+ * 매 프레임 각 Tick Function의 실제 TickGroup과 Wave(같은 Group 안에서 선행 Tick Function이 끝나야 하는 단계)를 계산하고,
+ * Wave마다 bRunOnAnyThread인 Tick은 Batch로 묶어 Job System으로, 나머지는 게임 스레드에서 실행합니다.
+ * 같은 Wave의 Tick들은 서로 의존하지 않으므로 동시에 실행될 수 있습니다.
+ * Worker에서 실행할 Tick은 Wave 시작 시 게임 스레드에서 확정되므로, 같은 Wave 안에서 해제하거나 비활성화하면 다음 Wave부터 반영됩니다.
+ *
+ * Worker에서 Tick하는 것은 SkySphere, ParticleSubUV 컴포넌트뿐입니다.
+ * AFish와 UProjectileMovementComponent는 Transform을 바꾸고 Delegate 호출, Destroy 등을 하므로 게임 스레드에서 Tick하며,
+ * APlatformActor와 AGoalPlatformActor는 Tick하지 않습니다.
+ *
+ * TickInterval이 지나지 않았거나 Significance가 Dormant인 Tick Function은 스케줄 전에 걸러지므로,
+ * 이번 프레임에 실행되지 않는 Tick Function은 Wave 계산과 Job 생성 비용이 들지 않습니다.
+ */
+class FTickTaskManager
+{
+public:
+    /** Worker에 보내는 Job 하나가 실행하는 Tick Function 수 */
+    static constexpr int32 ParallelTickBatchSize = 16;
+
+    /** true이면 모든 Tick을 게임 스레드에서 Group, Wave, 등록 순서대로 실행합니다. (디버그용) */
+    static inline bool bForceSerialTicking = false;
+
+    /** Significance가 Reduced인 Tick Function의 최소 Tick 간격(초) */
+    float ReducedTickInterval = 0.1f;
+
+    /** Significance를 다시 계산하는 간격(초) */
+    float SignificanceUpdateInterval = 0.25f;
+
+    /** bAllowSignificanceThrottling인 Tick Function의 Significance를 정합니다. Bind되지 않으면 모두 Full입니다. */
+    FTickSignificanceDelegate SignificanceDelegate;
+
+    FTickTaskManager() = default;
+    ~FTickTaskManager();
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+    /** 등록된 Tick Function을 모든 TickGroup에 걸쳐 실행합니다. 게임 스레드에서 호출해야 합니다. */
+    void Tick(float DeltaTime, ELevelTick TickType);
+
+    int32 GetNumRegisteredTickFunctions() const { return TickFunctions.Num() - NumRemoved; }
+
+    bool IsTicking() const { return bIsTicking; }
+
+    /** 마지막으로 Tick한 프레임의 통계 */
+    const FTickStats& GetFrameStats() const { return FrameStats; }
+
+private:
+    friend struct FTickFunction;
+
+    void AddTickFunction(FTickFunction* TickFunction);
+    void RemoveTickFunction(FTickFunction* TickFunction);
+
+    /** 해제되어 비어있는 Slot을 등록 순서를 유지하며 제거합니다. */
+    void CompactTickFunctions();
+
+    /** 누적 DeltaTime과 Significance로 이번 프레임에 실행할지 정합니다. */
+    bool ShouldTickThisFrame(FTickFunction* TickFunction, float DeltaTime, bool bUseSignificance);
+
+    /** TickFunction과 그 선행 Tick Function들의 이번 프레임 TickGroup과 Wave를 정합니다. */
+    void ScheduleTickFunction(FTickFunction* TickFunction);
+
+    void RunWave(const TArray<FTickFunction*>& Wave, ELevelTick TickType) const;
+
+    /** 게임 스레드에서 실행할 Tick을 실행합니다. Worker에 보낸 Tick은 RunWave에서 실행 여부를 미리 정합니다. */
+    static void ExecuteTickFunction(FTickFunction* TickFunction, ELevelTick TickType);
+
+private:
+    /** 등록 순서대로 저장되며, 해제된 Slot은 nullptr입니다. */
+    TArray<FTickFunction*> TickFunctions;
+    int32 NumRemoved = 0;
+
+    /** TickGroup별 Wave 목록, 매 프레임 다시 채우며 메모리는 재사용합니다. */
+    TArray<TArray<FTickFunction*>> Waves[TG_MAX];
+
+    uint32 FrameCounter = 0;
+
+    float TimeSinceSignificanceUpdate = 0.0f;
+
+    FTickStats FrameStats;
+
+    bool bIsTicking = false;
+};
@@ -1,10 +1,15 @@
 #include "Actor.h"
 
 #include "Components/PrimitiveComponent.h"
+#include "Engine/TickTaskManager.h"
 #include "World/World.h"
 
 AActor::AActor()
 {
+    // Tick 로직이 있는 하위 클래스에서만 bCanEverTick을 켭니다.
+    PrimaryActorTick.Target = this;
+    PrimaryActorTick.bCanEverTick = false;
+
     RootComponent = AddComponent<USceneComponent>();
 }
 
@@ -18,6 +23,7 @@ UObject* AActor::Duplicate(UObject* InOuter)
 
     NewActor->Owner = Owner;
     NewActor->bTickInEditor = bTickInEditor;
+    NewActor->bAllowTickDormancy = bAllowTickDormancy;
     // 기본적으로 있던 컴포넌트 제거
     TSet CopiedComponents = NewActor->OwnedComponents;
 
@@ -109,16 +115,48 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaTime)
 {
-    // TODO: 임시로 Actor에서 Tick 돌리기
-    // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
-    const auto CopyComponents = OwnedComponents;
+}
+
+void AActor::TickActorAndComponents(float DeltaTime)
+{
+    Tick(DeltaTime);
 
+    // Tick 도중 Component가 추가/삭제될 수 있으므로 복사해서 순회
+    const auto CopyComponents = OwnedComponents;
     for (UActorComponent* Comp : CopyComponents)
     {
         Comp->TickComponent(DeltaTime);
     }
 }
 
+void AActor::RegisterAllActorTickFunctions(bool bRegister)
+{
+    if (bRegister == bTickFunctionsRegistered)
+    {
+        return;
+    }
+
+    if (bRegister)
+    {
+        UWorld* World = GetWorld();
+        if (!World)
+        {
+            return;
+        }
+        PrimaryActorTick.RegisterTickFunction(World->GetTickTaskManager());
+    }
+    else
+    {
+        PrimaryActorTick.UnRegisterTickFunction();
+    }
+    bTickFunctionsRegistered = bRegister;
+
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        Component->RegisterComponentTickFunctions(bRegister);
+    }
+}
+
 void AActor::Destroyed()
 {
     // Actor가 제거되었을 때 호출하는 EndPlay
@@ -223,6 +261,12 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
             Component->InitializeComponent();
         }
 
+        // 이미 World에 등록된 Actor라면 바로 Tick 대상이 됩니다.
+        if (bTickFunctionsRegistered)
+        {
+            Component->RegisterComponentTickFunctions(true);
+        }
+
         return Component;
     }
     
@@ -332,3 +376,24 @@ void AActor::SetActorTickInEditor(bool InbInTickInEditor)
 {
     bTickInEditor = InbInTickInEditor;
 }
+
+
+void FActorTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType)
+{
+    if (!Target || Target->IsActorBeingDestroyed())
+    {
+        return;
+    }
+
+    if (TickType == LEVELTICK_ViewportsOnly && !Target->IsActorTickInEditor())
+    {
+        return;
+    }
+
+    Target->Tick(DeltaTime);
+}
+
+FString FActorTickFunction::DiagnosticMessage() const
+{
+    return Target ? Target->GetName() + TEXT("[Tick]") : FString(TEXT("<null>[Tick]"));
+}
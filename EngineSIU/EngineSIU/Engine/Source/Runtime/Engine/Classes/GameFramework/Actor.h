@@ -1,6 +1,7 @@
 #pragma once
 #include "Components/SceneComponent.h"
 #include "Container/Set.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Engine/EngineTypes.h"
 #include "UObject/Casts.h"
 #include "UObject/Object.h"
@@ -27,9 +28,15 @@ public:
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 Tick마다 호출됩니다. */
+    /**
+     * 매 Tick마다 PrimaryActorTick에 의해 호출됩니다.
+     * Component는 각자의 Tick Function으로 이 함수가 끝난 뒤에 Tick됩니다.
+     */
     virtual void Tick(float DeltaTime);
 
+    /** World의 Tick Manager에 등록되지 않은 Actor(Gizmo, EditorPlayer 등)를 직접 Tick할 때 사용합니다. */
+    void TickActorAndComponents(float DeltaTime);
+
     /** Actor가 제거될 때 호출됩니다. */
     virtual void Destroyed();
 
@@ -131,6 +138,26 @@ private:
 #endif
 
 public:
+    /**
+     * Actor의 Tick Function, Tick 설정(bCanEverTick, TickGroup, TickInterval 등)은 생성자에서 변경합니다.
+     * 기본적으로 bCanEverTick이 false이므로, Tick을 override하는 클래스에서 켜야 합니다.
+     */
+    FActorTickFunction PrimaryActorTick;
+
+    /**
+     * false이면 카메라에서 멀어져도 Tick이 멈추지 않고 느려지기만 합니다. (UWorld::TickDormantDistance 참고)
+     * 멀리서도 상태가 계속 진행되어야 하는 Actor는 생성자에서 끕니다.
+     */
+    bool bAllowTickDormancy = true;
+
+    /** Actor와 모든 Component의 Tick Function을 World의 Tick Manager에 등록하거나 해제합니다. */
+    void RegisterAllActorTickFunctions(bool bRegister);
+
+    bool HasRegisteredTickFunctions() const { return bTickFunctionsRegistered; }
+
+    void SetActorTickEnabled(bool bEnabled) { PrimaryActorTick.SetTickFunctionEnable(bEnabled); }
+    bool IsActorTickEnabled() const { return PrimaryActorTick.IsTickFunctionEnabled(); }
+
     bool IsActorTickInEditor() const { return bTickInEditor; }
     void SetActorTickInEditor(bool InbInTickInEditor);
 
@@ -140,6 +167,8 @@ public:
 private:
     bool bTickInEditor = false;     // Editor Tick을 수행 여부
 
+    bool bTickFunctionsRegistered = false;
+
     bool bHidden = false;
     
 public:
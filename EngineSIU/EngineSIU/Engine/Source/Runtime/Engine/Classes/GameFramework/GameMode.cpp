@@ -15,6 +15,7 @@ AGameMode::AGameMode()
     
     //LuaScriptComp->GetOuter()->
 
+    PrimaryActorTick.bCanEverTick = true;
     SetActorTickInEditor(false); // PIE 모드에서만 Tick 수행
 
     if (FSlateAppMessageHandler* Handler = GEngineLoop.GetAppMessageHandler())
@@ -29,6 +29,10 @@ USpringArmComponent::USpringArmComponent()
     CameraLagMaxTimeStep = 1.f / 60.f;
     CameraLagMaxDistance = 0.f;
 
+    // Target이 이동을 마친 뒤에 따라갑니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
     bAbsoluteRotation = false;
     
 }
@@ -16,6 +16,7 @@ void ULevel::Release()
     for (AActor* Actor : Actors)
     {
         Actor->EndPlay(EEndPlayReason::WorldTransition);
+        Actor->RegisterAllActorTickFunctions(false);
         TSet<UActorComponent*> Components = Actor->GetComponents();
         for (UActorComponent* Component : Components)
         {
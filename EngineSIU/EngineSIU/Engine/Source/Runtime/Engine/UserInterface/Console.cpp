@@ -1,16 +1,30 @@
 #include "Console.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
+#include <sstream>
 
 #include "Actors/PointLightActor.h"
 #include "Actors/SpotLightActor.h"
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/ClassCastBenchmark.h"
+#include "Benchmark/JobSystemBenchmark.h"
+#include "Benchmark/QueueBenchmark.h"
+#include "Benchmark/StartupBenchmark.h"
+#include "Benchmark/StressScene.h"
+#include "Components/SceneComponent.h"
 #include "Components/Light/LightComponent.h"
+#include "D3D11RHI/RHIStats.h"
+#include "Engine/AssetManager.h"
 #include "Engine/Engine.h"
+#include "Engine/TickTaskManager.h"
 #include "Renderer/UpdateLightBufferPass.h"
+#include "Stats/CpuProfiler.h"
 #include "Stats/GPUTimingManager.h"
 #include "Stats/ProfilerStatsManager.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/UObjectIterator.h"
+#include "World/World.h"
 
 
 void FStatOverlay::ToggleStat(const std::string& Command)
@@ -30,6 +44,21 @@ void FStatOverlay::ToggleStat(const std::string& Command)
         bShowLight = true;
         bShowRender = true;
     }
+    else if (Command == "stat tick")
+    {
+        bShowTick = true;
+        bShowRender = true;
+    }
+    else if (Command == "stat rhi")
+    {
+        bShowRHI = true;
+        bShowRender = true;
+    }
+    else if (Command == "stat transform")
+    {
+        bShowTransform = true;
+        bShowRender = true;
+    }
     else if (Command == "stat profiler")
     {
         GEngineLoop.EngineProfiler.ToggleWindow();
@@ -84,8 +113,56 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::SeparatorText("Memory Usage");
         ImGui::Text("Allocated Object Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Object>());
         ImGui::Text("Allocated Object Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Object>());
+        ImGui::Text("Object Pool Reserved Memory: %llu Byte", FPlatformMemory::GetPoolReservedBytes());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container Memory: %llu Byte", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+        ImGui::Text("Object Allocations (Last Frame): %llu", FPlatformMemory::GetLastFrameAllocationCount<EAT_Object>());
+        ImGui::Text("Container Allocations (Last Frame): %llu", FPlatformMemory::GetLastFrameAllocationCount<EAT_Container>());
+
+#if ENABLE_MEMORY_TAGS
+        ImGui::SeparatorText("Memory Tags");
+        if (ImGui::BeginTable("MemoryTagTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Current (KB)");
+            ImGui::TableSetupColumn("Peak (KB)");
+            ImGui::TableSetupColumn("Count");
+            ImGui::TableHeadersRow();
+
+            for (size_t Index = 0; Index < static_cast<size_t>(EMemoryTag::Count); ++Index)
+            {
+                const EMemoryTag Tag = static_cast<EMemoryTag>(Index);
+                const FMemoryTagStats Stats = FMemoryTracker::GetStats(Tag);
+                if (Stats.TotalCount == 0)
+                {
+                    continue;
+                }
+
+                // 예산을 넘긴 Tag는 빨간색으로 표시
+                const bool bOverBudget = Stats.IsOverBudget();
+                if (bOverBudget)
+                {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.2f, 0.2f, 1.0f));
+                }
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(FMemoryTracker::GetTagName(Tag));
+                ImGui::TableSetColumnIndex(1);
+                ImGui::Text("%.1f", static_cast<double>(Stats.CurrentBytes) / 1024.0);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%.1f", static_cast<double>(Stats.PeakBytes) / 1024.0);
+                ImGui::TableSetColumnIndex(3);
+                ImGui::Text("%lld", Stats.CurrentCount);
+
+                if (bOverBudget)
+                {
+                    ImGui::PopStyleColor();
+                }
+            }
+            ImGui::EndTable();
+        }
+#endif
     }
 
     if (bShowLight)
@@ -95,6 +172,37 @@ void FStatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Spot Light: %d", GetNumOfObjectsByClass(ASpotLight::StaticClass()));
     }
 
+    if (bShowTick && GEngine && GEngine->ActiveWorld)
+    {
+        const FTickStats& Stats = GEngine->ActiveWorld->GetTickTaskManager()->GetFrameStats();
+        ImGui::SeparatorText("[ Tick Counters ]\n");
+        ImGui::Text("Registered: %d", Stats.NumRegistered);
+        ImGui::Text("Ran: %d", Stats.NumRan);
+        ImGui::Text("Skipped: %d (Dormant: %d)", Stats.NumSkipped, Stats.NumDormant);
+        ImGui::Text("Slowed: %d", Stats.NumSlowed);
+    }
+
+    if (bShowRHI)
+    {
+        const FRHICounters& Counters = FRHIStats::GetLastFrameCounters();
+        ImGui::SeparatorText("[ RHI (Last Frame) ]\n");
+        ImGui::Text("Mesh Draw Calls: %llu", Counters.DrawCalls);
+        ImGui::Text("State Changes: %llu", Counters.StateChanges);
+        ImGui::Text("Buffers Created: %llu", Counters.BuffersCreated);
+        ImGui::Text("Uploaded: %.1f KB", static_cast<double>(Counters.BytesUploaded) / 1024.0);
+    }
+
+    if (bShowTransform)
+    {
+        const FTransformCacheCounters& Counters = FTransformCacheStats::GetLastFrameCounters();
+        const double SavedPercent = Counters.Requests > 0 ? 100.0 * static_cast<double>(Counters.GetSaved()) / static_cast<double>(Counters.Requests) : 0.0;
+        ImGui::SeparatorText("[ Transform Cache (Last Frame) ]\n");
+        ImGui::Text("World Transform Requests: %llu", Counters.Requests);
+        ImGui::Text("Recomputed: %llu", Counters.Recomputes);
+        ImGui::Text("Saved: %llu (%.1f%%)", Counters.GetSaved(), SavedPercent);
+        ImGui::Text("Invalidated: %llu", Counters.Invalidations);
+    }
+
     ImGui::PopStyleColor();
     ImGui::End();
 }
@@ -177,57 +285,217 @@ FConsole& FConsole::GetInstance() {
     return Instance;
 }
 
+namespace
+{
+    FLogRecord MakeLogRecord(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, FString&& Message)
+    {
+        FLogRecord Record;
+        Record.Category = &Category;
+        Record.File = File;
+        Record.Line = Line;
+        Record.Level = Level;
+        Record.Message = std::move(Message);
+        return Record;
+    }
+
+    ImVec4 GetLogLevelColor(ELogLevel Level)
+    {
+        switch (Level)
+        {
+        case ELogLevel::Verbose:
+            return ImVec4(0.6f, 0.6f, 0.6f, 1.0f); // 회색
+        case ELogLevel::Warning:
+            return ImVec4(1.0f, 1.0f, 0.0f, 1.0f); // 노란색
+        case ELogLevel::Error:
+            return ImVec4(1.0f, 0.4f, 0.4f, 1.0f); // 빨간색
+        default:
+            return ImVec4(1.0f, 1.0f, 1.0f, 1.0f); // 기본 흰색
+        }
+    }
+}
+
 // 로그 초기화
 void FConsole::Clear() {
-    Items.Empty();
+    LogBuffer.Clear();
+    bFilterDirty = true;
 }
 
 // 로그 추가
 void FConsole::AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...)
 {
+    if (LogTemp.IsSuppressed(Level))
+    {
+        return;
+    }
+
     va_list Args;
     va_start(Args, Fmt);
-    // AddLog(Level, Fmt, Args);
+    FString Message = FormatLogMessageV(Fmt, Args);
+    va_end(Args);
+
+    LogBuffer.Add(MakeLogRecord(LogTemp, Level, nullptr, 0, std::move(Message)));
+}
 
-    char Buf[1024];
-    vsnprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
+void FConsole::AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...)
+{
+    if (LogTemp.IsSuppressed(Level))
     {
-        std::lock_guard<std::mutex> Lock(LogEntryMutex);
-        Items.Emplace(Level, std::string(Buf));
+        return;
     }
+
+    va_list Args;
+    va_start(Args, Fmt);
+    FString Message = FormatLogMessageV(Fmt, Args);
     va_end(Args);
 
-    ScrollToBottom = true;
+    LogBuffer.Add(MakeLogRecord(LogTemp, Level, nullptr, 0, std::move(Message)));
 }
 
-void FConsole::AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...)
+void FConsole::AddLog(ELogLevel Level, const FString& Message)
+{
+    if (LogTemp.IsSuppressed(Level))
+    {
+        return;
+    }
+
+    AddLog(LogTemp, Level, nullptr, 0, Message);
+}
+
+void FConsole::AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const ANSICHAR* Fmt, ...)
+{
+    va_list Args;
+    va_start(Args, Fmt);
+    FString Message = FormatLogMessageV(Fmt, Args);
+    va_end(Args);
+
+    LogBuffer.Add(MakeLogRecord(Category, Level, File, Line, std::move(Message)));
+}
+
+void FConsole::AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const WIDECHAR* Fmt, ...)
 {
     va_list Args;
     va_start(Args, Fmt);
-    // AddLog(Level, Fmt, Args);
+    FString Message = FormatLogMessageV(Fmt, Args);
+    va_end(Args);
 
-    wchar_t Buf[1024];
-    _vsnwprintf_s(Buf, sizeof(Buf), _TRUNCATE, Fmt, Args);
+    LogBuffer.Add(MakeLogRecord(Category, Level, File, Line, std::move(Message)));
+}
+
+void FConsole::AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const FString& Message)
+{
+    LogBuffer.Add(MakeLogRecord(Category, Level, File, Line, FString(Message)));
+}
+
+void FConsole::FlushLogs()
+{
+    LogBuffer.Flush();
+    UpdateFilteredIndex();
+}
+
+bool FConsole::PassesFilter(const FLogRecord& Record) const
+{
+    // 로그 수준에 맞는 필터링
+    if ((Record.Level == ELogLevel::Verbose && !ShowVerbose) ||
+        (Record.Level == ELogLevel::Display && !ShowLogTemp) ||
+        (Record.Level == ELogLevel::Warning && !ShowWarning) ||
+        (Record.Level == ELogLevel::Error && !ShowError))
     {
-        std::lock_guard<std::mutex> Lock(LogEntryMutex);
-        Items.Emplace(Level, FString(Buf).ToAnsiString());
-        va_end(Args);
+        return false;
     }
 
-    ScrollToBottom = true;
+    if (HiddenCategories.Contains(Record.Category))
+    {
+        return false;
+    }
+
+    return Filter.PassFilter(*Record.Message);
 }
 
-void FConsole::AddLog(ELogLevel Level, const FString& Message)
+void FConsole::UpdateFilteredIndex()
 {
+    const uint64 FirstSequence = LogBuffer.GetFirstSequence();
+    const uint64 EndSequence = LogBuffer.GetEndSequence();
+
+    if (bFilterDirty)
+    {
+        FilteredSequences.Empty(FilteredSequences.Max());
+        FilteredStart = 0;
+        IndexedEndSequence = FirstSequence;
+        bFilterDirty = false;
+    }
+
+    // Ring에서 밀려난 로그는 앞에서부터 건너뛰고, 절반 이상 쌓이면 한 번에 당깁니다.
+    while (FilteredStart < FilteredSequences.Num() && FilteredSequences[FilteredStart] < FirstSequence)
     {
-        std::lock_guard<std::mutex> Lock(LogEntryMutex);
-        Items.Emplace(Level, Message);
+        ++FilteredStart;
+    }
+    if (FilteredStart > 0 && FilteredStart * 2 >= FilteredSequences.Num())
+    {
+        const int32 NumRemaining = FilteredSequences.Num() - FilteredStart;
+        std::memmove(FilteredSequences.GetData(), FilteredSequences.GetData() + FilteredStart, sizeof(uint64) * NumRemaining);
+        FilteredSequences.SetNum(NumRemaining);
+        FilteredStart = 0;
+    }
+
+    // 지난 Flush 이후 Ring을 한 바퀴 넘게 돌았다면 남아있는 로그부터 봅니다.
+    for (uint64 Sequence = std::max(IndexedEndSequence, FirstSequence); Sequence < EndSequence; ++Sequence)
+    {
+        if (PassesFilter(LogBuffer.Get(Sequence)))
+        {
+            FilteredSequences.Add(Sequence);
+        }
+    }
+    IndexedEndSequence = EndSequence;
+}
+
+void FConsole::DrawLogRecord(const FLogRecord& Record) const
+{
+    const ImVec4 Color = GetLogLevelColor(Record.Level);
+    const bool bShowCategory = Record.Category && Record.Category != &LogTemp;
+
+    // 화면에 보이는 줄만 여기까지 오므로, 접두어는 그릴 때 붙입니다.
+    if (Record.File && bShowCategory)
+    {
+        ImGui::TextColored(Color, "[%s:%d] %s: %s", Record.File, Record.Line, Record.Category->GetName(), *Record.Message);
+    }
+    else if (Record.File)
+    {
+        ImGui::TextColored(Color, "[%s:%d] %s", Record.File, Record.Line, *Record.Message);
+    }
+    else if (bShowCategory)
+    {
+        ImGui::TextColored(Color, "%s: %s", Record.Category->GetName(), *Record.Message);
+    }
+    else
+    {
+        ImGui::TextColored(Color, "%s", *Record.Message);
     }
-    ScrollToBottom = true;
+}
+
+void FConsole::CopyFilteredLogsToClipboard() const
+{
+    ImGuiTextBuffer Buffer;
+    for (int32 Index = FilteredStart; Index < FilteredSequences.Num(); ++Index)
+    {
+        const FLogRecord& Record = LogBuffer.Get(FilteredSequences[Index]);
+        if (Record.File)
+        {
+            Buffer.appendf("[%s:%d] ", Record.File, Record.Line);
+        }
+        if (Record.Category && Record.Category != &LogTemp)
+        {
+            Buffer.appendf("%s: ", Record.Category->GetName());
+        }
+        Buffer.appendf("%s\n", *Record.Message);
+    }
+    ImGui::SetClipboardText(Buffer.c_str());
 }
 
 // 콘솔 창 렌더링
 void FConsole::Draw() {
+    // 창이 닫혀 있어도 스레드 Queue가 가득 차지 않도록 먼저 비웁니다.
+    FlushLogs();
+
     if (!bWasOpen)
     {
         return;
@@ -268,7 +536,58 @@ void FConsole::Draw() {
     ImGui::SameLine();
     if (ImGui::Button("Copy"))
     {
-        ImGui::LogToClipboard();
+        CopyFilteredLogsToClipboard();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Categories"))
+    {
+        ImGui::OpenPopup("LogCategories");
+    }
+    if (ImGui::BeginPopup("LogCategories"))
+    {
+        // 체크박스는 Console 표시 여부, Combo는 호출하는 곳에서 거를 Verbosity입니다.
+        FLogCategory::ForEach([this](FLogCategory& Category)
+        {
+            ImGui::PushID(&Category);
+
+            bool bShow = !HiddenCategories.Contains(&Category);
+            if (ImGui::Checkbox(Category.GetName(), &bShow))
+            {
+                if (bShow)
+                {
+                    HiddenCategories.Remove(&Category);
+                }
+                else
+                {
+                    HiddenCategories.Add(&Category);
+                }
+                bFilterDirty = true;
+            }
+
+            ImGui::SameLine(200.0f);
+            ImGui::SetNextItemWidth(100.0f);
+            if (ImGui::BeginCombo("##Verbosity", LexToString(Category.GetVerbosity())))
+            {
+                for (uint8 Level = 0; Level <= static_cast<uint8>(ELogLevel::Error); ++Level)
+                {
+                    const ELogLevel LogLevel = static_cast<ELogLevel>(Level);
+                    if (ImGui::Selectable(LexToString(LogLevel), Category.GetVerbosity() == LogLevel))
+                    {
+                        Category.SetVerbosity(LogLevel);
+                    }
+                }
+                ImGui::EndCombo();
+            }
+
+            ImGui::PopID();
+        });
+        ImGui::EndPopup();
+    }
+
+    if (const uint64 NumDropped = LogBuffer.GetNumDropped())
+    {
+        ImGui::SameLine();
+        ImGui::TextColored(GetLogLevelColor(ELogLevel::Warning), "%llu logs dropped", NumDropped);
     }
 
     ImGui::Separator();
@@ -276,59 +595,47 @@ void FConsole::Draw() {
     // 필터 입력 창
     ImGui::Text("Filter:");
     ImGui::SameLine();
-    Filter.Draw("##Filter", 100);
+    bFilterDirty |= Filter.Draw("##Filter", 100);
     ImGui::SameLine();
-    // 로그 수준을 선택할 체크박스
-    ImGui::Checkbox("Show Display", &ShowLogTemp);
+
+    // 로그 수준을 선택할 체크박스, 괄호 안은 Ring에 남아있는 로그 수입니다.
+    auto LevelCheckbox = [this](const char* Name, ELogLevel Level, bool& bShow)
+    {
+        char Label[64];
+        snprintf(Label, sizeof(Label), "Show %s (%d)###Show%s", Name, LogBuffer.GetNumRecords(Level), Name);
+        bFilterDirty |= ImGui::Checkbox(Label, &bShow);
+    };
+    LevelCheckbox("Verbose", ELogLevel::Verbose, ShowVerbose);
+    ImGui::SameLine();
+    LevelCheckbox("Display", ELogLevel::Display, ShowLogTemp);
     ImGui::SameLine();
-    ImGui::Checkbox("Show Warning", &ShowWarning);
+    LevelCheckbox("Warning", ELogLevel::Warning, ShowWarning);
     ImGui::SameLine();
-    ImGui::Checkbox("Show Error", &ShowError);
+    LevelCheckbox("Error", ELogLevel::Error, ShowError);
 
     ImGui::Separator();
 
-    // 로그 출력 (필터 적용)
-    ImGui::BeginChild("ScrollingRegion", ImVec2(0, -ImGui::GetTextLineHeightWithSpacing()), false, ImGuiWindowFlags_HorizontalScrollbar);
-
-    TArray<LogEntry> ItemsDup;
+    if (bFilterDirty)
     {
-        std::lock_guard<std::mutex> Lock(LogEntryMutex);
-        ItemsDup = Items;
+        UpdateFilteredIndex();
     }
-    for (const auto& [Level, Message] : ItemsDup)
-    {
-        if (!Filter.PassFilter(*Message))
-        {
-            continue;
-        }
 
-        // 로그 수준에 맞는 필터링
-        if ((Level == ELogLevel::Display && !ShowLogTemp) ||
-            (Level == ELogLevel::Warning && !ShowWarning) ||
-            (Level == ELogLevel::Error && !ShowError))
-        {
-            continue;
-        }
+    // 로그 출력 (필터 적용), 화면에 보이는 줄만 그립니다.
+    ImGui::BeginChild("ScrollingRegion", ImVec2(0, -ImGui::GetTextLineHeightWithSpacing()), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-        // 색상 지정
-        ImVec4 Color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-        switch (Level)
+    ImGuiListClipper Clipper;
+    Clipper.Begin(FilteredSequences.Num() - FilteredStart);
+    while (Clipper.Step())
+    {
+        for (int32 Index = Clipper.DisplayStart; Index < Clipper.DisplayEnd; ++Index)
         {
-        case ELogLevel::Display:
-            Color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f); // 기본 흰색
-            break;
-        case ELogLevel::Warning:
-            Color = ImVec4(1.0f, 1.0f, 0.0f, 1.0f); // 노란색
-            break;
-        case ELogLevel::Error:
-            Color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f); // 빨간색
-            break;
+            DrawLogRecord(LogBuffer.Get(FilteredSequences[FilteredStart + Index]));
         }
-
-        ImGui::TextColored(Color, "%s", *Message);
     }
+    Clipper.End();
 
-    if (ScrollToBottom)
+    // 맨 아래를 보고 있었다면 새 로그를 따라 내려갑니다.
+    if (ScrollToBottom || ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
     {
         ImGui::SetScrollHereY(1.0f);
         ScrollToBottom = false;
@@ -363,6 +670,13 @@ void FConsole::Draw() {
     ImGui::End();
 }
 
+namespace
+{
+/** stress spawn으로 만든 Actor와 그 World, stress clear로 지웁니다. */
+FStressSceneGenerator StressSceneGenerator;
+UWorld* StressSceneWorld = nullptr;
+}
+
 void FConsole::ExecuteCommand(const std::string& Command)
 {
     AddLog(ELogLevel::Display, "Executing command: %s", Command.c_str());
@@ -379,9 +693,216 @@ void FConsole::ExecuteCommand(const std::string& Command)
         AddLog(ELogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(ELogLevel::Display, " - stat memory: Toggle Memory display");
         AddLog(ELogLevel::Display, " - stat light: Toggle Light display");
+        AddLog(ELogLevel::Display, " - stat tick: Toggle Tick counters display");
+        AddLog(ELogLevel::Display, " - stat rhi: Toggle RHI draw/upload/state change counters display");
         AddLog(ELogLevel::Display, " - stat profiler: Toggle Profiler display");
         AddLog(ELogLevel::Display, " - stat all: Show all stat overlays");
         AddLog(ELogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(ELogLevel::Display, " - bench isa: Compare IsChildOf against the SuperClass walk");
+        AddLog(ELogLevel::Display, " - bench queue: Compare lock-free queues against std::mutex under contention");
+        AddLog(ELogLevel::Display, " - bench jobs: Stress the job system and compare ParallelFor grain sizes");
+        AddLog(ELogLevel::Display, " - bench startup: Report time to first frame against content size and rescan Contents");
+        AddLog(ELogLevel::Display, " - bench list: Show registered microbenchmarks");
+        AddLog(ELogLevel::Display, " - bench run [Filter]: Run microbenchmarks, save them to %s and compare against %s",
+            FBenchmarkSettings::DefaultOutputPath, FBenchmarkSettings::DefaultBaselinePath);
+        AddLog(ELogLevel::Display, " - bench baseline [Filter]: Run microbenchmarks and save them as the baseline");
+        AddLog(ELogLevel::Display, " - stress spawn <Spec>: Spawn a stress scene such as StaticMesh=1000,Shape=200,Seed=7 in the active world");
+        AddLog(ELogLevel::Display, " - stress clear: Destroy the actors spawned by stress spawn");
+        AddLog(ELogLevel::Display, " - asset prefetch: Stream every registered mesh that is not loaded yet");
+        AddLog(ELogLevel::Display, " - tick serial: Run every tick function on the game thread in order (debug)");
+        AddLog(ELogLevel::Display, " - tick parallel: Run bRunOnAnyThread tick functions on worker threads");
+        AddLog(ELogLevel::Display, " - tick significance <Reduced> <Dormant>: Slow down or stop ticks farther than these distances in the active world (0 disables)");
+        AddLog(ELogLevel::Display, " - log list: Show log categories and their verbosity");
+        AddLog(ELogLevel::Display, " - log <Category> <Verbosity>: Suppress logs below Verbose/Display/Warning/Error at the call site");
+        AddLog(ELogLevel::Display, " - profile stats [Frames]: Show per-scope CPU times over the recorded frames");
+        AddLog(ELogLevel::Display, " - profile dump [Path]: Save the recorded frames as a Chrome trace (chrome://tracing, ui.perfetto.dev)");
+        AddLog(ELogLevel::Display, " - profile capture <Frames> [Path]: Save the next Frames frames as a Chrome trace");
+    }
+    else if (Command == "bench isa")
+    {
+        RunClassCastBenchmark();
+    }
+    else if (Command == "bench queue")
+    {
+        RunQueueContentionBenchmark();
+    }
+    else if (Command == "bench jobs")
+    {
+        RunJobSystemBenchmark();
+    }
+    else if (Command == "bench startup")
+    {
+        RunStartupBenchmark();
+    }
+    else if (Command == "bench list")
+    {
+        for (const FBenchmark* Benchmark : FBenchmarkRegistry::GetBenchmarks())
+        {
+            AddLog(ELogLevel::Display, " - %s (%d cases)", *Benchmark->GetName(), Benchmark->GetNumCases());
+        }
+    }
+    else if (Command == "bench run" || Command.starts_with("bench run "))
+    {
+        std::string Filter;
+        std::istringstream(Command.substr(9)) >> Filter;
+
+        FBenchmarkSettings Settings;
+        Settings.Filter = Filter.c_str();
+        Settings.OutputPath = FBenchmarkSettings::DefaultOutputPath;
+        Settings.BaselinePath = FBenchmarkSettings::DefaultBaselinePath;
+
+        TArray<FBenchmarkResult> Results;
+        FBenchmarkRunner::RunBenchmarks(Settings, Results);
+    }
+    else if (Command == "bench baseline" || Command.starts_with("bench baseline "))
+    {
+        std::string Filter;
+        std::istringstream(Command.substr(14)) >> Filter;
+
+        FBenchmarkSettings Settings;
+        Settings.Filter = Filter.c_str();
+        Settings.OutputPath = FBenchmarkSettings::DefaultBaselinePath;
+
+        TArray<FBenchmarkResult> Results;
+        FBenchmarkRunner::RunBenchmarks(Settings, Results);
+    }
+    else if (Command.starts_with("stress spawn "))
+    {
+        FStressSceneSettings Settings;
+        if (!Settings.ParseSpec(FString(Command.substr(13).c_str())))
+        {
+            return;
+        }
+
+        // World가 바뀌었다면 이전 Actor는 그 World와 함께 이미 지워졌습니다.
+        UWorld* World = GEngine->ActiveWorld;
+        if (World != StressSceneWorld)
+        {
+            StressSceneGenerator = FStressSceneGenerator();
+            StressSceneWorld = World;
+        }
+        AddLog(ELogLevel::Display, "Spawned %d stress actors", StressSceneGenerator.Generate(World, Settings));
+    }
+    else if (Command == "stress clear")
+    {
+        if (GEngine->ActiveWorld == StressSceneWorld)
+        {
+            StressSceneGenerator.Clear();
+        }
+        StressSceneGenerator = FStressSceneGenerator();
+        StressSceneWorld = nullptr;
+    }
+    else if (Command == "asset prefetch")
+    {
+        if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+        {
+            AddLog(ELogLevel::Display, "Prefetching %d assets", AssetManager->PrefetchAssets());
+        }
+    }
+    else if (Command == "tick serial")
+    {
+        FTickTaskManager::bForceSerialTicking = true;
+        AddLog(ELogLevel::Display, "Tick functions now run serially on the game thread");
+    }
+    else if (Command == "tick parallel")
+    {
+        FTickTaskManager::bForceSerialTicking = false;
+        AddLog(ELogLevel::Display, "bRunOnAnyThread tick functions now run on worker threads");
+    }
+    else if (Command.starts_with("tick significance"))
+    {
+        std::istringstream Stream(Command.substr(17));
+        float ReducedDistance = 0.0f, DormantDistance = 0.0f;
+        Stream >> ReducedDistance >> DormantDistance;
+
+        if (UWorld* World = GEngine->ActiveWorld)
+        {
+            World->TickReducedDistance = ReducedDistance;
+            World->TickDormantDistance = DormantDistance;
+            AddLog(ELogLevel::Display, "Tick significance distances: Reduced %.1f, Dormant %.1f", ReducedDistance, DormantDistance);
+        }
+    }
+    else if (Command == "log list")
+    {
+        FLogCategory::ForEach([this](const FLogCategory& Category)
+        {
+            AddLog(ELogLevel::Display, " - %s: %s", Category.GetName(), LexToString(Category.GetVerbosity()));
+        });
+    }
+    else if (Command.starts_with("log "))
+    {
+        std::istringstream Stream(Command.substr(4));
+        std::string CategoryName, VerbosityName;
+        Stream >> CategoryName >> VerbosityName;
+
+        FLogCategory* Category = FLogCategory::Find(CategoryName.c_str());
+        if (!Category)
+        {
+            AddLog(ELogLevel::Error, "Unknown log category: %s", CategoryName.c_str());
+            return;
+        }
+
+        for (uint8 Level = 0; Level <= static_cast<uint8>(ELogLevel::Error); ++Level)
+        {
+            if (_stricmp(LexToString(static_cast<ELogLevel>(Level)), VerbosityName.c_str()) == 0)
+            {
+                Category->SetVerbosity(static_cast<ELogLevel>(Level));
+                AddLog(ELogLevel::Display, "%s verbosity set to %s", Category->GetName(), LexToString(Category->GetVerbosity()));
+                return;
+            }
+        }
+        AddLog(ELogLevel::Error, "Unknown verbosity: %s", VerbosityName.c_str());
+    }
+    else if (Command == "profile stats" || Command.starts_with("profile stats "))
+    {
+        int32 NumFrames = 0;
+        std::istringstream(Command.substr(13)) >> NumFrames;
+
+        const FCpuProfiler& Profiler = FCpuProfiler::Get();
+        const FProfileStatSummary Frame = Profiler.GetFrameTimeSummary(NumFrames);
+        AddLog(ELogLevel::Display, "CPU frame over %d frames: avg %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms (%llu events dropped)",
+            Frame.NumFrames, Frame.AvgMs, Frame.P95Ms, Frame.P99Ms, Frame.MaxMs, Profiler.GetNumDropped());
+
+        TArray<FProfileStatSummary> Summaries;
+        Profiler.GetStatSummaries(Summaries, NumFrames);
+
+        constexpr int32 MaxLines = 20;
+        for (int32 Index = 0; Index < Summaries.Num() && Index < MaxLines; ++Index)
+        {
+            const FProfileStatSummary& Summary = Summaries[Index];
+            AddLog(ELogLevel::Display, " - %s: avg %.3f ms (excl %.3f), p95 %.3f ms, max %.3f ms, %.1f calls/frame",
+                *Summary.Name.ToString(), Summary.AvgMs, Summary.AvgExclusiveMs, Summary.P95Ms, Summary.MaxMs, Summary.AvgCallsPerFrame);
+        }
+    }
+    else if (Command == "profile dump" || Command.starts_with("profile dump "))
+    {
+        std::string Path;
+        std::istringstream(Command.substr(12)) >> Path;
+
+        const FString OutPath = Path.empty() ? FCpuProfiler::Get().MakeDefaultCapturePath() : FString(Path.c_str());
+        if (FCpuProfiler::Get().ExportChromeTrace(OutPath))
+        {
+            AddLog(ELogLevel::Display, "Saved %d frames to %s", FCpuProfiler::Get().GetNumFrames(), *OutPath);
+        }
+        else
+        {
+            AddLog(ELogLevel::Error, "Failed to save CPU profile to %s", *OutPath);
+        }
+    }
+    else if (Command.starts_with("profile capture "))
+    {
+        int32 NumFrames = 0;
+        std::string Path;
+        std::istringstream(Command.substr(16)) >> NumFrames >> Path;
+        if (NumFrames <= 0)
+        {
+            AddLog(ELogLevel::Error, "Usage: profile capture <Frames> [Path]");
+            return;
+        }
+
+        const FString OutPath = Path.empty() ? FCpuProfiler::Get().MakeDefaultCapturePath() : FString(Path.c_str());
+        FCpuProfiler::Get().StartCapture(NumFrames, OutPath);
+        AddLog(ELogLevel::Display, "Capturing %d frames to %s", NumFrames, *OutPath);
     }
     else if (Command.starts_with("stat "))
     {
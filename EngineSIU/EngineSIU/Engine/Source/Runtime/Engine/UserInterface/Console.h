@@ -4,6 +4,8 @@
 #include "Container/Array.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "HAL/PlatformType.h"
+#include "Logging/LogBuffer.h"
+#include "Logging/LogCategory.h"
 #include "UObject/NameTypes.h"
 #include "ImGui/imgui.h"
 #include "PropertyEditor/IWindowToggleable.h"
@@ -23,15 +25,31 @@ static consteval const char* GetFileName(const char* Path)
 }
 
 #define FILENAME GetFileName(__FILE__)
-#define UE_LOG(Level, Fmt, ...) FConsole::GetInstance().AddLog(Level, "[%s:%d] " Fmt, FILENAME, __LINE__, __VA_ARGS__)
-#define UE_LOG_FMT(Level, Fmt, ...) FConsole::GetInstance().AddLog(Level, std::format("[{}:{}] " Fmt, FILENAME, __LINE__, __VA_ARGS__))
 
-enum class ELogLevel : uint8
-{
-    Display,
-    Warning,
-    Error
-};
+/**
+ * Category의 Verbosity보다 낮은 Level이면 인자를 평가하지 않고 바로 넘어갑니다.
+ * 게임 스레드가 아닌 스레드에서는 인자만 복사해두고 메시지는 FlushLogs에서 만듭니다. (FLogBuffer::AddFormatted)
+ * "[File:Line] " 접두어는 Console에 그릴 때 붙입니다.
+ */
+#define UE_LOG_CAT(Category, Level, Fmt, ...) \
+    do \
+    { \
+        if (!(Category).IsSuppressed(Level)) \
+        { \
+            FConsole::GetInstance().AddLog(Category, Level, FILENAME, __LINE__, Fmt, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define UE_LOG(Level, Fmt, ...) UE_LOG_CAT(LogTemp, Level, Fmt, ##__VA_ARGS__)
+
+#define UE_LOG_FMT(Level, Fmt, ...) \
+    do \
+    { \
+        if (!LogTemp.IsSuppressed(Level)) \
+        { \
+            FConsole::GetInstance().AddLog(LogTemp, Level, FILENAME, __LINE__, std::format(Fmt, __VA_ARGS__)); \
+        } \
+    } while (0)
 
 class FStatOverlay
 {
@@ -46,6 +64,9 @@ public:
             uint8 bShowMemory : 1;
             uint8 bShowLight : 1;
             uint8 bShowRender : 1;
+            uint8 bShowTick : 1;
+            uint8 bShowRHI : 1;
+            uint8 bShowTransform : 1;
         };
         uint8 StatFlags = 0; // 기본적으로 다 끄기
     };
@@ -100,23 +121,48 @@ public:
     static FConsole& GetInstance(); // 참조 반환으로 변경
 
     void Clear();
+
+    /** LogTemp 카테고리로, 파일 위치 없이 로그를 남깁니다. */
     void AddLog(ELogLevel Level, const ANSICHAR* Fmt, ...);
     void AddLog(ELogLevel Level, const WIDECHAR* Fmt, ...);
     void AddLog(ELogLevel Level, const FString& Message);
+
+    /**
+     * UE_LOG_CAT에서 사용합니다. 아무 스레드에서나 호출할 수 있습니다.
+     * Fmt가 문자열 리터럴이고 인자가 있으면 이 오버로드가 선택되며, 다른 스레드의 로그는 게임 스레드에서 메시지를 만듭니다.
+     */
+    template <typename CharType, size_t N, typename... ArgTypes>
+    void AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const CharType (&Fmt)[N], ArgTypes&&... Args)
+    {
+        LogBuffer.AddFormatted(FLogRecord{ &Category, File, Line, Level, FString() }, Fmt, std::forward<ArgTypes>(Args)...);
+    }
+
+    /** Fmt가 리터럴이 아니거나 인자가 없을 때 사용되며, 호출한 스레드에서 메시지를 만듭니다. */
+    void AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const ANSICHAR* Fmt, ...);
+    void AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const WIDECHAR* Fmt, ...);
+    void AddLog(const FLogCategory& Category, ELogLevel Level, const ANSICHAR* File, int32 Line, const FString& Message);
+
+    /** 다른 스레드에서 남긴 로그를 가져오고 필터 Index를 갱신합니다. 게임 스레드에서 매 프레임 호출합니다. */
+    void FlushLogs();
+
     void Draw();
     void ExecuteCommand(const std::string& Command);
     void OnResize(HWND hWnd);
 
     virtual void Toggle() override { bWasOpen = !bWasOpen; }
 
-public:
-    struct LogEntry
-    {
-        ELogLevel Level;
-        FString Message;
-    };
+private:
+    bool PassesFilter(const FLogRecord& Record) const;
+
+    /** 새로 들어온 로그를 FilteredSequences에 추가합니다. 필터가 바뀌었으면 처음부터 다시 만듭니다. */
+    void UpdateFilteredIndex();
+
+    void DrawLogRecord(const FLogRecord& Record) const;
+
+    /** 필터를 통과한 로그를 모두 클립보드에 복사합니다. */
+    void CopyFilteredLogsToClipboard() const;
 
-    TArray<LogEntry> Items;
+public:
     TArray<FString> History;
     int32 HistoryPos = -1;
     char InputBuf[256] = "";
@@ -124,6 +170,7 @@ public:
 
     ImGuiTextFilter Filter; // 필터링을 위한 ImGuiTextFilter
 
+    bool ShowVerbose = true; // Verbose 체크박스
     bool ShowLogTemp = true; // LogTemp 체크박스
     bool ShowWarning = true; // Warning 체크박스
     bool ShowError = true;   // Error 체크박스
@@ -137,5 +184,17 @@ private:
     UINT Width;
     UINT Height;
 
-    std::mutex LogEntryMutex;
+    FLogBuffer LogBuffer;
+
+    /** Console에 표시하지 않을 카테고리 */
+    TArray<const FLogCategory*> HiddenCategories;
+
+    /** 필터를 통과한 로그의 Sequence, 오름차순입니다. 앞의 FilteredStart개는 이미 Ring에서 밀려난 로그입니다. */
+    TArray<uint64> FilteredSequences;
+    int32 FilteredStart = 0;
+
+    /** FilteredSequences에 반영한 마지막 Sequence + 1 */
+    uint64 IndexedEndSequence = 0;
+
+    bool bFilterDirty = true;
 };
@@ -16,6 +16,7 @@
 #include "GameFramework/GameMode.h"
 #include "Classes/Components/TextComponent.h"
 #include "Contents/Actors/Fish.h"
+#include "Stats/Stats.h"
 
 class UEditorEngine;
 
@@ -34,69 +35,10 @@ void UWorld::InitializeNewWorld()
 {
     ActiveLevel = FObjectFactory::ConstructObject<ULevel>(this);
     ActiveLevel->InitLevel(this);
-    //InitializeLightScene(); // 테스트용 LightScene 비활성화
 
     CollisionManager = new FCollisionManager();
-}
-
-void UWorld::InitializeLightScene()
-{
-    const int TotalLights = 1000;        // 최대 개수
-    const int HalfCountPerAxis = 0;    // -4 ~ +4. 9*9*9 개수만큼 생성
-    const float Spacing = 20.0f;        // 오브젝트간의 간격
-    const float JitterAmount = 100.0f;    // 랜덤 흔들림 정도. 
-
-    //고정 시드 랜덤 오프셋. 매 실행마다 같은 결과.
-    auto HashOffset = [JitterAmount](int x, int y, int z) -> FVector
-        {
-            // 단순한 LCG 기반 해시: 고정된 결과를 줌
-            auto LCG = [](int seed) -> float {
-                seed = (1103515245 * seed + 12345) & 0x7fffffff;
-                return (seed % 1000) / 1000.0f; // 0.0 ~ 0.999
-                };
-
-            int seedBase = x * 73856093 ^ y * 19349663 ^ z * 83492791;
-            float dx = (LCG(seedBase + 1) - 0.5f) * 2.0f * JitterAmount;
-            float dy = (LCG(seedBase + 2) - 0.5f) * 2.0f * JitterAmount;
-            float dz = (LCG(seedBase + 3) - 0.5f) * 2.0f * JitterAmount;
-
-            return FVector(dx, dy, dz);
-        };
-
-    //그리드 기반 생성. 랜덤 오프셋 추가함.
-    int LightCount = 0;
-    for (int x = -HalfCountPerAxis; x <= HalfCountPerAxis; ++x)
-    {
-        for (int y = -HalfCountPerAxis; y <= HalfCountPerAxis; ++y)
-        {
-            for (int z = -HalfCountPerAxis; z <= HalfCountPerAxis; ++z)
-            {
-                if (x == 0 && y == 0 && z == 0)
-                    continue;
-
-                FVector basePos = FVector(x * Spacing, y * Spacing, z * Spacing);
-                FVector jitter = HashOffset(x, y, z);        //랜덤 오프셋 추가.
-                FVector finalPos = basePos+jitter;
-
-                /*if (LightCount % 2 == 0)
-                {
-                    APointLight* PointLightActor = SpawnActor<APointLight>();
-                    PointLightActor->SetActorLabel(FString::Printf(TEXT("OBJ_PointLight_%d"), LightCount));
-                    PointLightActor->SetActorLocation(finalPos);
-                }
-                else*/
-                {
-                    //continue;
-                    ASpotLight* SpotLightActor = SpawnActor<ASpotLight>();
-                    SpotLightActor->SetActorLabel(FString::Printf(TEXT("OBJ_SpotLight_%d"), LightCount));
-                    SpotLightActor->SetActorLocation(finalPos);
-                }
 
-                ++LightCount;
-                UE_LOG(ELogLevel::Display,"LightCount %d", LightCount);
-            }
-        }
-    }
+    InitializeTickSignificance();
 }
 
 UObject* UWorld::Duplicate(UObject* InOuter)
@@ -105,25 +47,87 @@ UObject* UWorld::Duplicate(UObject* InOuter)
     UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
     NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
     NewWorld->ActiveLevel->InitLevel(NewWorld);
+
+    for (AActor* Actor : NewWorld->ActiveLevel->Actors)
+    {
+        Actor->RegisterAllActorTickFunctions(true);
+    }
     
     NewWorld->CollisionManager = new FCollisionManager();
+    NewWorld->TickReducedDistance = TickReducedDistance;
+    NewWorld->TickDormantDistance = TickDormantDistance;
+    NewWorld->InitializeTickSignificance();
     
     return NewWorld;
 }
 
-void UWorld::Tick(float DeltaTime)
+void UWorld::Tick(ELevelTick TickType, float DeltaTime)
 {
     TimeSeconds += DeltaTime;
     
     // SpawnActor()에 의해 Actor가 생성된 경우, 여기서 BeginPlay 호출
     if (WorldType != EWorldType::Editor)
     {
+        QUICK_SCOPE_CYCLE_COUNTER(World_BeginPlay)
         for (AActor* Actor : PendingBeginPlayActors)
         {
             Actor->BeginPlay();
         }
         PendingBeginPlayActors.Empty();
     }
+
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(World_TickActors)
+        TickTaskManager.Tick(DeltaTime, TickType);
+    }
+}
+
+void UWorld::InitializeTickSignificance()
+{
+    TickTaskManager.SignificanceDelegate.BindLambda([this](const AActor* Actor)
+    {
+        const bool bUseDormant = TickDormantDistance > 0.0f && Actor->bAllowTickDormancy;
+        const bool bUseReduced = TickReducedDistance > 0.0f;
+
+        FVector ViewLocation;
+        if ((!bUseDormant && !bUseReduced) || !GetTickSignificanceViewLocation(ViewLocation))
+        {
+            return ETickSignificance::Full;
+        }
+
+        const float DistSquared = FVector::DistSquared(Actor->GetActorLocation(), ViewLocation);
+        if (bUseDormant && DistSquared >= TickDormantDistance * TickDormantDistance)
+        {
+            return ETickSignificance::Dormant;
+        }
+        if (bUseReduced && DistSquared >= TickReducedDistance * TickReducedDistance)
+        {
+            return ETickSignificance::Reduced;
+        }
+        return ETickSignificance::Full;
+    });
+}
+
+bool UWorld::GetTickSignificanceViewLocation(FVector& OutLocation) const
+{
+    if (WorldType != EWorldType::Game && WorldType != EWorldType::PIE)
+    {
+        return false;
+    }
+
+    if (PlayerController && PlayerController->PlayerCameraManager)
+    {
+        OutLocation = PlayerController->PlayerCameraManager->ViewTarget.POV.Location;
+        return true;
+    }
+
+    if (MainPlayer)
+    {
+        OutLocation = MainPlayer->GetActorLocation();
+        return true;
+    }
+
+    return false;
 }
 
 void UWorld::BeginPlay()
@@ -244,6 +248,7 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         // Actor->InitializeComponents();
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        NewActor->RegisterAllActorTickFunctions(true);
         return NewActor;
     }
     
@@ -270,6 +275,8 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     // 액터의 Destroyed 호출
     ThisActor->Destroyed();
 
+    ThisActor->RegisterAllActorTickFunctions(false);
+
     if (ThisActor->GetOwner())
     {
         ThisActor->SetOwner(nullptr);
@@ -11,6 +11,7 @@
 #include "Camera/PlayerCameraManager.h"
 #include "Engine/Engine.h"
 #include "Engine/EventManager.h"
+#include "Engine/TickTaskManager.h"
 #include "UObject/UObjectIterator.h"
 
 class UPrimitiveComponent;
@@ -34,10 +35,13 @@ public:
     static UWorld* CreateWorld(UObject* InOuter, const EWorldType InWorldType, const FString& InWorldName = "DefaultWorld");
 
     void InitializeNewWorld();
-    void InitializeLightScene();
     virtual UObject* Duplicate(UObject* InOuter) override;
 
-    void Tick(float DeltaTime);
+    /**
+     * 시간을 갱신하고, 대기 중인 Actor의 BeginPlay를 호출한 뒤 등록된 Tick Function들을 실행합니다.
+     * @param TickType LEVELTICK_ViewportsOnly이면 bTickInEditor인 Actor와 그 Component만 Tick합니다.
+     */
+    void Tick(ELevelTick TickType, float DeltaTime);
     void BeginPlay();
 
     void Release();
@@ -79,13 +83,34 @@ public:
     APlayerController* GetPlayerController() const;
 
     AGameMode* GetGameMode() const { return GameMode; }
+
+    FTickTaskManager* GetTickTaskManager() { return &TickTaskManager; }
     
     void CheckOverlap(const UPrimitiveComponent* Component, TArray<FOverlapResult>& OutOverlaps) const;
 
 public:
     double TimeSeconds;
+
+    /**
+     * Game/PIE World에서 카메라(없으면 MainPlayer)와 이 거리 이상 떨어진 Actor는 Tick이 느려집니다.
+     * 맵의 크기에 따라 World마다 정하며, 0 이하이면 사용하지 않습니다. (기본값)
+     */
+    float TickReducedDistance = 0.0f;
+
+    /**
+     * 이 거리 이상 떨어진 Actor는 Tick이 멈춥니다. 0 이하이면 사용하지 않습니다. (기본값)
+     * 멈추는 것은 bAllowSignificanceThrottling인 Tick Function의 ExecuteTick뿐이며, 렌더링과 Overlap 검사는 그대로 실행됩니다.
+     * AActor::bAllowTickDormancy가 false인 Actor는 Reduced까지만 느려집니다.
+     */
+    float TickDormantDistance = 0.0f;
     
 private:
+    /** 카메라와의 거리로 Tick Significance를 정하도록 TickTaskManager에 Bind합니다. */
+    void InitializeTickSignificance();
+
+    /** Significance 계산의 기준 위치, Game/PIE World가 아니거나 기준이 없으면 false */
+    bool GetTickSignificanceViewLocation(FVector& OutLocation) const;
+
     AGameMode* GameMode = nullptr;
 
     FString WorldName = "DefaultWorld";
@@ -103,6 +128,8 @@ private:
     UTextComponent* MainTextComponent = nullptr;
 
     FCollisionManager* CollisionManager = nullptr;
+
+    FTickTaskManager TickTaskManager;
 };
 
 
@@ -122,6 +149,7 @@ T* UWorld::DuplicateActor(T* InActor)
         T* NewActor = static_cast<T*>(InActor->Duplicate(this));
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        NewActor->RegisterAllActorTickFunctions(true);
         return NewActor;
     }
     return nullptr;
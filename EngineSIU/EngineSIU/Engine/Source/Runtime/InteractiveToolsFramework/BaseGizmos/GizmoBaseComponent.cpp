@@ -22,12 +22,12 @@ void UGizmoBaseComponent::TickComponent(float DeltaTime)
             float Scaler = (ViewportClient->PerspectiveCamera.GetLocation() - GetOwner()->GetActorLocation()).Length();
             
             Scaler *= GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
         else
         {
             float Scaler = FEditorViewportClient::OrthoSize * GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
     }
 }
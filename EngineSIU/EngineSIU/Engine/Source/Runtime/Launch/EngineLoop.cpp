@@ -13,6 +13,17 @@
 #include "World/World.h"
 #include "Renderer/TileLightCullingPass.h"
 #include "SoundManager.h"
+#include "HAL/MemStack.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/MemoryTracker.h"
+#include "Async/JobSystem.h"
+#include "Math/MathKernels.h"
+#include "Benchmark/StartupBenchmark.h"
+#include "Misc/Parse.h"
+#include "Stats/CpuProfiler.h"
+#include "Stats/Stats.h"
+#include "D3D11RHI/RHIStats.h"
+#include "Components/SceneComponent.h"
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -40,12 +51,109 @@ FEngineLoop::FEngineLoop()
 
 int32 FEngineLoop::PreInit()
 {
+    // FMatrix, FQuat의 inline 연산(MathSSE.h)과 충돌 검사가 SSE4.1을 직접 사용하므로, 지원하지 않는 CPU에서는 시작하지 않습니다.
+    if (!FMathKernels::IsSupported(EMathISA::SSE41))
+    {
+        MessageBoxA(nullptr, "This program requires a CPU that supports SSE4.1.", "Unsupported CPU", MB_ICONERROR | MB_OK);
+        return 1;
+    }
     return 0;
 }
 
 int32 FEngineLoop::Init(HINSTANCE hInstance)
 {
     FPlatformTime::InitTiming();
+    InitStartCycles = FPlatformTime::Cycles64();
+
+    // Console의 로그 Ring은 생성한 스레드에서 읽으므로, Worker가 로그를 남기기 전에 게임 스레드에서 생성합니다.
+    FConsole::GetInstance();
+
+    // Asset 로드, Shader 컴파일 등이 사용하므로 가장 먼저 Worker를 생성합니다.
+    FJobSystem::Get().Initialize();
+    FCpuProfiler::Get().SetThreadName(TEXT("GameThread"));
+
+    UE_LOG(ELogLevel::Display, TEXT("Math kernels: %s"), FMathKernels::GetISAName(FMathKernels::Get().ISA));
+
+    {
+        const TCHAR* CommandLine = GetCommandLineA();
+
+        // -Headless: 창, Device, Renderer, Editor UI 없이 World Tick과 Asset 로드만 실행합니다.
+        // -Frames=<N>: N 프레임 후 종료합니다.
+        bHeadless = FParse::Param(CommandLine, TEXT("Headless"));
+        FParse::Value(CommandLine, TEXT("Frames="), MaxFrames);
+
+        // -Benchmark[=Filter] [-BenchmarkOut=<Path>] [-BenchmarkBaseline=<Path>] [-BenchmarkThreshold=<Percent>] [-BenchmarkMinTime=<Ms>]
+        // 첫 프레임 후 Benchmark를 실행하고 종료합니다. Baseline보다 Threshold 이상 느려진 Benchmark가 있으면 종료 코드가 1입니다.
+        TCHAR BenchmarkValue[MAX_PATH];
+        if (FParse::Value(CommandLine, TEXT("Benchmark="), BenchmarkValue, MAX_PATH))
+        {
+            bRunBenchmarks = true;
+            BenchmarkSettings.Filter = BenchmarkValue;
+        }
+        else
+        {
+            bRunBenchmarks = FParse::Param(CommandLine, TEXT("Benchmark"));
+        }
+        if (bRunBenchmarks)
+        {
+            BenchmarkSettings.OutputPath = FParse::Value(CommandLine, TEXT("BenchmarkOut="), BenchmarkValue, MAX_PATH)
+                ? FString(BenchmarkValue)
+                : FString(FBenchmarkSettings::DefaultOutputPath);
+            if (FParse::Value(CommandLine, TEXT("BenchmarkBaseline="), BenchmarkValue, MAX_PATH))
+            {
+                BenchmarkSettings.BaselinePath = BenchmarkValue;
+            }
+            FParse::Value(CommandLine, TEXT("BenchmarkThreshold="), BenchmarkSettings.RegressionThresholdPercent);
+            FParse::Value(CommandLine, TEXT("BenchmarkMinTime="), BenchmarkSettings.MinTimeMs);
+        }
+
+        // -StressScene=<Spec> [-StressSteps=<N>] [-StressWarmup=<Frames>] [-StressFrames=<Frames>] [-StressOut=<Path>]
+        // Spec은 "StaticMesh=1000,Shape=200,Seed=7" 형식입니다. Scene 크기를 두 배씩 늘려가며 Steps번 측정하고 종료합니다.
+        TCHAR StressSceneValue[MAX_PATH];
+        if (FParse::Value(CommandLine, TEXT("StressScene="), StressSceneValue, MAX_PATH, false))
+        {
+            bRunStressScene = StressSceneSettings.Scene.ParseSpec(StressSceneValue);
+            if (!bRunStressScene)
+            {
+                ExitCode = 1;
+                bIsExit = true;
+            }
+            FParse::Value(CommandLine, TEXT("StressSteps="), StressSceneSettings.NumSteps);
+            FParse::Value(CommandLine, TEXT("StressWarmup="), StressSceneSettings.NumWarmupFrames);
+            FParse::Value(CommandLine, TEXT("StressFrames="), StressSceneSettings.NumFrames);
+            StressSceneSettings.OutputPath = FParse::Value(CommandLine, TEXT("StressOut="), StressSceneValue, MAX_PATH)
+                ? FString(StressSceneValue)
+                : FString(FStressSceneRunSettings::DefaultOutputPath);
+        }
+
+        // -ProfileCapture=<Frames> [-ProfileOut=<Path>] [-ProfileExit]
+        // 첫 프레임부터 Frames개 프레임을 Chrome Trace로 저장하고, ProfileExit이면 저장 후 종료합니다.
+        int32 NumProfileFrames = 0;
+        if (FParse::Value(CommandLine, TEXT("ProfileCapture="), NumProfileFrames) && NumProfileFrames > 0)
+        {
+            TCHAR ProfilePath[MAX_PATH];
+            const FString Path = FParse::Value(CommandLine, TEXT("ProfileOut="), ProfilePath, MAX_PATH)
+                ? FString(ProfilePath)
+                : FCpuProfiler::Get().MakeDefaultCapturePath();
+            FCpuProfiler::Get().StartCapture(NumProfileFrames, Path);
+            bExitAfterProfileCapture = FParse::Param(CommandLine, TEXT("ProfileExit"));
+        }
+    }
+
+    // Game Thread의 FMemStack은 매 프레임 Flush됩니다.
+    FMemStack::Get().SetFrameScoped(true);
+
+    // 서브시스템별 메모리 예산, Peak가 예산을 넘으면 Stat Overlay와 리포트에 표시됩니다.
+    FMemoryTracker::SetBudget(EMemoryTag::Animation, 256ull * 1024 * 1024);
+    FMemoryTracker::SetBudget(EMemoryTag::Fbx, 512ull * 1024 * 1024);
+    FMemoryTracker::SetBudget(EMemoryTag::StaticMesh, 512ull * 1024 * 1024);
+    FMemoryTracker::SetBudget(EMemoryTag::Rendering, 256ull * 1024 * 1024);
+
+    if (bHeadless)
+    {
+        InitHeadless();
+        return 0;
+    }
 
     /** Create Window */
     MainAppWnd = CreateNewWindow(hInstance, L"MainWindowClass", L"SIU Engine", 1400, 1000, nullptr);
@@ -66,22 +174,34 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
     GEngine = FObjectFactory::ConstructObject<UEditorEngine>(nullptr);
 
     /** Initialized */
-    GraphicDevice.Initialize(MainAppWnd);
-    GraphicDevice.CreateAdditionalSwapChain(SkeletalMeshViewerAppWnd);
-    BufferManager->Initialize(GraphicDevice.Device, GraphicDevice.DeviceContext);
-    Renderer.Initialize(&GraphicDevice, BufferManager, &GPUTimingManager);
-    PrimitiveDrawBatch.Initialize(&GraphicDevice);
-    ResourceManager.Initialize(&Renderer, &GraphicDevice);
+    {
+        SCOPED_MEMORY_TAG(Rendering);
+        GraphicDevice.Initialize(MainAppWnd);
+        GraphicDevice.CreateAdditionalSwapChain(SkeletalMeshViewerAppWnd);
+        BufferManager->Initialize(GraphicDevice.Device, GraphicDevice.DeviceContext);
+        Renderer.Initialize(&GraphicDevice, BufferManager, &GPUTimingManager);
+        PrimitiveDrawBatch.Initialize(&GraphicDevice);
+        ResourceManager.Initialize(&Renderer, &GraphicDevice);
+    }
 
-    GEngine->Init();
+    {
+        SCOPED_MEMORY_TAG(World);
+        GEngine->Init();
+    }
 
-    MainUIManager->Initialize(MainAppWnd, GraphicDevice.Device, GraphicDevice.DeviceContext);
-    SkeletalMeshViewerUIManager->Initialize(SkeletalMeshViewerAppWnd, GraphicDevice.Device, GraphicDevice.DeviceContext);
+    {
+        SCOPED_MEMORY_TAG(UI);
+        MainUIManager->Initialize(MainAppWnd, GraphicDevice.Device, GraphicDevice.DeviceContext);
+        SkeletalMeshViewerUIManager->Initialize(SkeletalMeshViewerAppWnd, GraphicDevice.Device, GraphicDevice.DeviceContext);
+    }
 
-    LevelEditor->Initialize(1400, 1000);
-    AssetViewer->Initialize(800, 600);
-    
-    UnrealEditor->Initialize();
+    {
+        SCOPED_MEMORY_TAG(Editor);
+        LevelEditor->Initialize(1400, 1000);
+        AssetViewer->Initialize(800, 600);
+
+        UnrealEditor->Initialize();
+    }
     
     {
         if (!GPUTimingManager.Initialize(GraphicDevice.Device, GraphicDevice.DeviceContext))
@@ -115,8 +235,33 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
     return 0;
 }
 
+void FEngineLoop::InitHeadless()
+{
+    BufferManager = new FDXDBufferManager();
+    AppMessageHandler = std::make_unique<FSlateAppMessageHandler>();
+    GEngine = FObjectFactory::ConstructObject<UEditorEngine>(nullptr);
+
+    // Device 없이 초기화하면 Null RHI로 동작합니다. Texture는 디코딩까지만 합니다.
+    {
+        SCOPED_MEMORY_TAG(Rendering);
+        BufferManager->Initialize(nullptr, nullptr);
+        ResourceManager.Initialize(&Renderer, &GraphicDevice);
+    }
+
+    {
+        SCOPED_MEMORY_TAG(World);
+        GEngine->Init();
+    }
+
+    FSoundManager::GetInstance().Initialize();
+
+    UE_LOG(ELogLevel::Display, TEXT("Running headless with the null RHI"));
+}
+
 void FEngineLoop::Render() const
 {
+    SCOPED_MEMORY_TAG(Rendering);
+
     GraphicDevice.Prepare(MainAppWnd);
     
     if (LevelEditor->IsMultiViewport())
@@ -158,6 +303,8 @@ void FEngineLoop::Render() const
 
 void FEngineLoop::Render(HWND Handle) const
 {
+    SCOPED_MEMORY_TAG(Rendering);
+
     GraphicDevice.Prepare(Handle);
 
     if (Handle && IsWindowVisible(Handle))
@@ -205,16 +352,44 @@ void FEngineLoop::Tick()
     LARGE_INTEGER StartTime, EndTime;
     double ElapsedTime = 0.0;
 
+    if (bRunStressScene && !StressSceneRunner.Start(StressSceneSettings))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Failed to start the stress scene"));
+        ExitCode = 1;
+        bIsExit = true;
+    }
+
     while (bIsExit == false)
     {
         QueryPerformanceCounter(&StartTime);
 
-        FProfilerStatsManager::BeginFrame();    // Clear previous frame stats
+        FMemStack::Get().Flush();               // Release previous frame temporaries
+        FPlatformMemory::BeginFrame();          // Snapshot previous frame allocation count
+        FRHIStats::BeginFrame();                // Snapshot previous frame RHI counters
+        FTransformCacheStats::BeginFrame();     // Snapshot previous frame transform cache counters
+        FCpuProfiler::Get().BeginFrame();       // Close previous CPU frame and publish its stats
         if (GPUTimingManager.IsInitialized())
         {
             GPUTimingManager.BeginFrame();      // Start GPU frame timing
         }
 
+        if (StressSceneRunner.BeginFrame())
+        {
+            bIsExit = true;
+            break;
+        }
+        if (bExitAfterProfileCapture && !FCpuProfiler::Get().IsCapturing())
+        {
+            bIsExit = true;
+            break;
+        }
+        if (MaxFrames > 0 && NumFrames >= static_cast<uint64>(MaxFrames))
+        {
+            bIsExit = true;
+            break;
+        }
+        ++NumFrames;
+
         MSG Msg;
         while (PeekMessage(&Msg, nullptr, 0, 0, PM_REMOVE))
         {
@@ -235,20 +410,47 @@ void FEngineLoop::Tick()
             break;
         }
 
-        /* Tick Game Logic */
-        const float DeltaTime = static_cast<float>(ElapsedTime / 1000.f);
-        GEngine->Tick(DeltaTime);
-        LevelEditor->Tick(DeltaTime);
-        AssetViewer->Tick(DeltaTime);
-        // @todo SkeletalMeshViewer->Tick(DeltaTime);
+        /* Game thread continuations of worker jobs */
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(GameThreadJobs)
+            FJobSystem::Get().ProcessGameThreadJobs();
+        }
 
-        /* Render Viewports */
-        Render();
-        Render(SkeletalMeshViewerAppWnd);
+        /* Logs from worker threads */
+        FConsole::GetInstance().FlushLogs();
 
-        if (CurrentImGuiContext != nullptr)
+        /* Tick Game Logic */
+        // Stress Scene은 실제 프레임 시간과 상관없이 같은 시뮬레이션이 되도록 고정된 DeltaTime을 씁니다.
+        const float DeltaTime = StressSceneRunner.IsRunning()
+            ? StressSceneRunner.GetFixedDeltaTime()
+            : static_cast<float>(ElapsedTime / 1000.f);
         {
-            ImGui::SetCurrentContext(CurrentImGuiContext);
+            QUICK_SCOPE_CYCLE_COUNTER(Engine_Tick)
+            GEngine->Tick(DeltaTime);
+        }
+
+        // Headless에서는 Swap Chain이 없으므로 아래 SwapBuffer는 아무것도 하지 않습니다.
+        if (!bHeadless)
+        {
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(Editor_Tick)
+                SCOPED_MEMORY_TAG(Editor);
+                LevelEditor->Tick(DeltaTime);
+                AssetViewer->Tick(DeltaTime);
+            }
+            // @todo SkeletalMeshViewer->Tick(DeltaTime);
+
+            /* Render Viewports */
+            {
+                QUICK_SCOPE_CYCLE_COUNTER(Render_Viewports)
+                Render();
+                Render(SkeletalMeshViewerAppWnd);
+            }
+
+            if (CurrentImGuiContext != nullptr)
+            {
+                ImGui::SetCurrentContext(CurrentImGuiContext);
+            }
         }
 
         // Delete pending object
@@ -259,8 +461,27 @@ void FEngineLoop::Tick()
             GPUTimingManager.EndFrame();        // End GPU frame timing
         }
 
-        GraphicDevice.SwapBuffer(MainAppWnd);
+        {
+            QUICK_SCOPE_CYCLE_COUNTER(Present)
+            GraphicDevice.SwapBuffer(MainAppWnd);
+        }
+
+        if (!bHasPresentedFirstFrame)
+        {
+            bHasPresentedFirstFrame = true;
+            RecordTimeToFirstFrame(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - InitStartCycles));
+
+            // World와 Asset이 준비된 뒤에 측정합니다.
+            if (bRunBenchmarks)
+            {
+                TArray<FBenchmarkResult> BenchmarkResults;
+                ExitCode = FBenchmarkRunner::RunBenchmarks(BenchmarkSettings, BenchmarkResults) ? 0 : 1;
+                bIsExit = true;
+            }
+        }
         
+        StressSceneRunner.EndFrame();
+
         /** Does not fix errors, This isn't critical error. */
         GraphicDevice.SwapBuffer(SkeletalMeshViewerAppWnd);
         GraphicDevice.SwapBuffer(AnimationViewerAppWnd);
@@ -285,6 +506,9 @@ void FEngineLoop::GetClientSize(const HWND hWnd, uint32& OutWidth, uint32& OutHe
 
 void FEngineLoop::Exit()
 {
+    // 실행 중인 Job이 아래에서 해제되는 객체에 접근하지 않도록 먼저 종료합니다.
+    FJobSystem::Get().Shutdown();
+
     /** SkeletalMesh Viewer Section */
     if (AssetViewer)
     {
@@ -333,6 +557,52 @@ void FEngineLoop::Exit()
 
     delete UnrealEditor;
     delete BufferManager;
+
+    FMemoryTracker::DumpCsv("Saved/MemoryTags.csv");
+    FMemoryTracker::DumpLeakReport("Saved/MemoryLeakReport.txt");
+
+    // Headless에서는 로그를 볼 창이 없으므로 결과를 파일로 남깁니다.
+    if (bHeadless)
+    {
+        WriteHeadlessReport("Saved/HeadlessReport.txt");
+    }
+}
+
+bool FEngineLoop::WriteHeadlessReport(const char* FilePath) const
+{
+    FILE* File = nullptr;
+    if (fopen_s(&File, FilePath, "w") != 0)
+    {
+        return false;
+    }
+
+    const FProfileStatSummary Frame = FCpuProfiler::Get().GetFrameTimeSummary();
+    fprintf(File, "Frames: %llu\n", NumFrames);
+    fprintf(
+        File, "CPU frame over last %d frames (ms): avg %.3f, p50 %.3f, p95 %.3f, p99 %.3f, max %.3f\n",
+        Frame.NumFrames, Frame.AvgMs, Frame.P50Ms, Frame.P95Ms, Frame.P99Ms, Frame.MaxMs
+    );
+
+    const FRHICounters RHI = FRHIStats::GetTotalCounters();
+    fprintf(
+        File, "RHI total: %llu draws, %llu buffers, %llu bytes uploaded, %llu state changes\n",
+        RHI.DrawCalls, RHI.BuffersCreated, RHI.BytesUploaded, RHI.StateChanges
+    );
+
+    TArray<FProfileStatSummary> Summaries;
+    FCpuProfiler::Get().GetStatSummaries(Summaries);
+
+    fprintf(File, "\nStat,AvgMs,AvgExclusiveMs,P95Ms,MaxMs,CallsPerFrame\n");
+    for (const FProfileStatSummary& Summary : Summaries)
+    {
+        fprintf(
+            File, "%s,%.4f,%.4f,%.4f,%.4f,%.1f\n",
+            *Summary.Name.ToString(), Summary.AvgMs, Summary.AvgExclusiveMs, Summary.P95Ms, Summary.MaxMs, Summary.AvgCallsPerFrame
+        );
+    }
+
+    fclose(File);
+    return true;
 }
 
 HWND FEngineLoop::CreateNewWindow(HINSTANCE hInstance, const WCHAR* WindowClass, const WCHAR* WindowName, int Width, int Height, HWND Parent) const
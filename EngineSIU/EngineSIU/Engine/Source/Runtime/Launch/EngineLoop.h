@@ -1,5 +1,7 @@
 #pragma once
 #include "Core/HAL/PlatformType.h"
+#include "Benchmark/Benchmark.h"
+#include "Benchmark/StressScene.h"
 #include "Engine/ResourceMgr.h"
 #include "LevelEditor/SlateAppMessageHandler.h"
 #include "Renderer/Renderer.h"
@@ -34,7 +36,19 @@ public:
 
     void GetClientSize(HWND hWnd, uint32& OutWidth, uint32& OutHeight) const;
 
+    /** -Headless로 실행되어 창, Renderer, Editor UI가 없는지 여부 */
+    bool IsHeadless() const { return bHeadless; }
+
+    /** 프로세스 종료 코드, -Benchmark에서 Regression이 있거나 -StressScene을 시작하지 못하면 1입니다. */
+    int32 GetExitCode() const { return ExitCode; }
+
 private:
+    /** 창과 Device 없이 Null RHI로 Engine을 초기화합니다. */
+    void InitHeadless();
+
+    /** 프레임 수, CPU 프레임 시간, Stat별 시간과 RHI 호출 수를 저장합니다. */
+    bool WriteHeadlessReport(const char* FilePath) const;
+
     HWND CreateNewWindow(HINSTANCE hInstance, const WCHAR* WindowClass, const WCHAR* WindowName, int Width, int Height, HWND Parent = nullptr) const;
     
     static LRESULT CALLBACK AppWndProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
@@ -81,6 +95,30 @@ private:
     FDXDBufferManager* BufferManager; //TODO: UEngine으로 옮겨야함.
 
     bool bIsExit = false;
+
+    /** -ProfileExit, Command Line으로 시작한 CPU Profile 저장이 끝나면 종료합니다. */
+    bool bExitAfterProfileCapture = false;
+
+    bool bHeadless = false;
+
+    /** -Frames=<N>, 0이면 제한 없음 */
+    int32 MaxFrames = 0;
+    uint64 NumFrames = 0;
+
+    /** -Benchmark, 첫 프레임 후 BenchmarkSettings로 Benchmark를 실행하고 종료합니다. */
+    bool bRunBenchmarks = false;
+    FBenchmarkSettings BenchmarkSettings;
+
+    /** -StressScene, PIE World에 Stress Scene을 만들고 정해진 프레임을 측정한 뒤 종료합니다. */
+    bool bRunStressScene = false;
+    FStressSceneRunSettings StressSceneSettings;
+    FStressSceneRunner StressSceneRunner;
+
+    int32 ExitCode = 0;
+
+    /** Init 시작 시각, 첫 프레임까지의 시간을 측정합니다. */
+    uint64 InitStartCycles = 0;
+    bool bHasPresentedFirstFrame = false;
     // @todo Option으로 선택 가능하도록
     int32 TargetFPS = 999;
 
@@ -11,9 +11,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
+    if (const int32 ErrorCode = GEngineLoop.PreInit())
+    {
+        return ErrorCode;
+    }
+
     GEngineLoop.Init(hInstance);
     GEngineLoop.Tick();
     GEngineLoop.Exit();
 
-    return 0;
+    return GEngineLoop.GetExitCode();
 }
@@ -962,8 +962,7 @@ void FEditorRenderPass::RenderSkinnedMeshs()
         {
             continue;
         }
-        FReferenceSkeleton Skeleton;
-        Comp->GetSkeletalMesh()->GetRefSkeleton(Skeleton);
+        const FReferenceSkeleton& Skeleton = Comp->GetSkeletalMesh()->GetRefSkeleton();
         PyramidsPerComp.Reserve(Skeleton.RawRefBonePose.Num());
         SpheresPerComp.Reserve(Skeleton.RawRefBonePose.Num());
         
@@ -220,6 +220,7 @@ void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const
     if (RenderData->MaterialSubsets.Num() == 0)
     {
         Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        FRHIStats::AddDrawCall();
         return;
     }
 
@@ -243,6 +244,7 @@ void FShadowRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, const
         uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
         uint32 IndexCount = RenderData->MaterialSubsets[SubMeshIndex].IndexCount;
         Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
+        FRHIStats::AddDrawCall();
     }
 }
 
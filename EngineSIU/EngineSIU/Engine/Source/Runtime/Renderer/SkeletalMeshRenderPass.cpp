@@ -209,7 +209,7 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdi
         // Bone Matrix는 CPU에서 처리
         // Model -> j -> transform -> model space로 변환하는 행렬
         // 즉, transform을 적용해주는 행렬
-        TArray<FMatrix> SkinningMatrices;
+        TArray<FMatrix, TFrameAllocator<FMatrix>> SkinningMatrices;
         SkeletalMeshComponent->GetSkinningMatrices(SkinningMatrices);
 
         // Update constant buffers
@@ -220,9 +220,8 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdi
             SkeletalMeshComponent->GetSkeletalMesh()->bCPUSkinned
         );
 
-        TArray<UMaterial*> Materials;
-        SkeletalMesh->GetUsedMaterials(Materials);
-        TArray<UMaterial*> OverrideMaterials = SkeletalMeshComponent->GetOverrideMaterials();
+        const TArray<UMaterial*>& Materials = SkeletalMesh->GetMaterials();
+        const TArray<UMaterial*>& OverrideMaterials = SkeletalMeshComponent->GetOverrideMaterials();
 
         for (int SectionIndex = 0; SectionIndex < Renderdata.RenderSections.Num(); ++SectionIndex)
         {
@@ -231,8 +230,9 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdi
             if (SkeletalMesh->bCPUSkinned)
             {
                 // Update vertex buffer
-                TArray<FSkeletalVertex> Vertices;
-                GetSkinnedVertices(SkeletalMesh, SectionIndex, SkinningMatrices, Vertices);
+                TArray<FSkeletalVertex, TFrameAllocator<FSkeletalVertex>> Vertices;
+                Vertices.SetNum(RenderSection.Vertices.Num());
+                GetSkinnedVertices(SkeletalMesh, SectionIndex, SkinningMatrices.GetData(), SkinningMatrices.Num(), Vertices.GetData());
 
                 BufferManager->CreateDynamicVertexBuffer(RenderSection.Name, Vertices, VertexInfo);
                 BufferManager->UpdateDynamicVertexBuffer(RenderSection.Name, Vertices);
@@ -240,7 +240,7 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdi
             else
             {
                 // Update bone matrices
-                UpdateBoneMatrices(SkinningMatrices);
+                UpdateBoneMatrices(SkinningMatrices.GetData(), SkinningMatrices.Num());
                 BufferManager->CreateVertexBuffer(RenderSection.Name,
                     RenderSection.Vertices, VertexInfo);
             }
@@ -271,6 +271,7 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FEdi
                 uint32 StartIndex = Renderdata.MaterialSubsets[SubsetIndex].IndexStart;
                 uint32 IndexCount = Renderdata.MaterialSubsets[SubsetIndex].IndexCount;
                 Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
+                FRHIStats::AddDrawCall();
             }
         }
     }
@@ -343,9 +344,9 @@ void FSkeletalMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, c
     BufferManager->UpdateConstantBuffer(TEXT("FObjectConstantBuffer"), ObjectData);
 }
 
-void FSkeletalMeshRenderPass::UpdateBoneMatrices(const TArray<FMatrix>& BoneMatrices) const
+void FSkeletalMeshRenderPass::UpdateBoneMatrices(const FMatrix* BoneMatrices, int32 NumBoneMatrices) const
 {
-    BufferManager->UpdateConstantBuffer(TEXT("FBoneMatrices"), BoneMatrices);
+    BufferManager->UpdateConstantBuffer(TEXT("FBoneMatrices"), BoneMatrices, NumBoneMatrices);
 }
 
 void FSkeletalMeshRenderPass::CreateShader()
@@ -402,11 +403,10 @@ void FSkeletalMeshRenderPass::UpdateVertexBuffer(FFbxMeshData& meshData, const T
     BufferManager->UpdateDynamicVertexBuffer(meshData.name, NewVertices);
 }
 
-void FSkeletalMeshRenderPass::GetSkinnedVertices(USkeletalMesh* SkeletalMesh, uint32 Section, const TArray<FMatrix>& BoneMatrices, TArray<FSkeletalVertex>& OutVertices) const
+void FSkeletalMeshRenderPass::GetSkinnedVertices(USkeletalMesh* SkeletalMesh, uint32 Section, const FMatrix* BoneMatrices, int32 NumBoneMatrices, FSkeletalVertex* OutVertices) const
 {
     const FSkelMeshRenderSection& RenderSection = SkeletalMesh->GetRenderData().RenderSections[Section];
     const TArray<FSkeletalVertex>& Vertices = RenderSection.Vertices;
-    OutVertices.SetNum(Vertices.Num());
     for (int i = 0; i < Vertices.Num(); ++i)
     {
         const FSkeletalVertex& Vertex = Vertices[i];
@@ -418,6 +418,7 @@ void FSkeletalMeshRenderPass::GetSkinnedVertices(USkeletalMesh* SkeletalMesh, ui
         {
             if (Vertex.BoneWeights[j] > 0.0f)
             {
+                assert(Vertex.BoneIndices[j] < NumBoneMatrices);
                 const FMatrix& BoneMatrix = BoneMatrices[Vertex.BoneIndices[j]];
                 SkinnedPosition += BoneMatrix.TransformPosition(Vertex.Position) * Vertex.BoneWeights[j];
                 SkinnedNormal += BoneMatrix.TransformFVector4(FVector4(Vertex.Normal, 0)) * Vertex.BoneWeights[j];
@@ -36,13 +36,15 @@ public:
     void RenderAllSkeletalMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport);
 
     void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected, bool bCPUSkinning) const;
-    void UpdateBoneMatrices(const TArray<FMatrix>& BoneMatrices) const;
+    void UpdateBoneMatrices(const FMatrix* BoneMatrices, int32 NumBoneMatrices) const;
 
 private:
     void CreateShader();
 
     void UpdateVertexBuffer(FFbxMeshData& meshData, const TArray<FMatrix>& BoneMatrices);
-    void GetSkinnedVertices(USkeletalMesh* SkeletalMesh, uint32 Section, const TArray<FMatrix>& BoneMatrices, TArray<FSkeletalVertex>& OutVertices) const;
+
+    /** Section의 정점들을 CPU에서 Skinning해 OutVertices에 씁니다. OutVertices는 Section의 정점 수만큼 할당되어 있어야 합니다. */
+    void GetSkinnedVertices(USkeletalMesh* SkeletalMesh, uint32 Section, const FMatrix* BoneMatrices, int32 NumBoneMatrices, FSkeletalVertex* OutVertices) const;
 
 protected:
     TArray<USkeletalMeshComponent*> SkeletalMeshComponents;
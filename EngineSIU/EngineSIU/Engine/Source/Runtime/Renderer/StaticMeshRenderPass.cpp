@@ -262,6 +262,7 @@ void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, T
     if (RenderData->MaterialSubsets.Num() == 0)
     {
         Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        FRHIStats::AddDrawCall();
         return;
     }
 
@@ -285,6 +286,7 @@ void FStaticMeshRenderPass::RenderPrimitive(FStaticMeshRenderData* RenderData, T
         uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
         uint32 IndexCount = RenderData->MaterialSubsets[SubMeshIndex].IndexCount;
         Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
+        FRHIStats::AddDrawCall();
     }
 }
 
@@ -294,6 +296,7 @@ void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVerti
     UINT Offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &pBuffer, &Stride, &Offset);
     Graphics->DeviceContext->Draw(numVertices, 0);
+    FRHIStats::AddDrawCall();
 }
 
 void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices) const
@@ -303,6 +306,7 @@ void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT nu
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &pVertexBuffer, &Stride, &Offset);
     Graphics->DeviceContext->IASetIndexBuffer(pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
     Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
+    FRHIStats::AddDrawCall();
 }
 
 void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FEditorViewportClient>& Viewport)
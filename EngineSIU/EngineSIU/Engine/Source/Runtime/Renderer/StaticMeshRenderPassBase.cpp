@@ -10,6 +10,7 @@
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/Casts.h"
 #include "Editor/PropertyEditor/ShowFlags.h"
+#include "D3D11RHI/RHIStats.h"
 
 FStaticMeshRenderPassBase::FStaticMeshRenderPassBase()
     : BufferManager(nullptr)
@@ -124,6 +125,7 @@ void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderDat
     if (RenderData->MaterialSubsets.Num() == 0)
     {
         Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
+        FRHIStats::AddDrawCall();
         return;
     }
 
@@ -147,6 +149,7 @@ void FStaticMeshRenderPassBase::RenderPrimitive(FStaticMeshRenderData* RenderDat
         uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
         uint32 IndexCount = RenderData->MaterialSubsets[SubMeshIndex].IndexCount;
         Graphics->DeviceContext->DrawIndexed(IndexCount, StartIndex, 0);
+        FRHIStats::AddDrawCall();
     }
 }
 
@@ -156,6 +159,7 @@ void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* Buffer, UINT Verti
     UINT Offset = 0;
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &Buffer, &Stride, &Offset);
     Graphics->DeviceContext->Draw(VerticesNum, 0);
+    FRHIStats::AddDrawCall();
 }
 
 void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* VertexBuffer, ID3D11Buffer* IndexBuffer, UINT IndicesNum) const
@@ -165,6 +169,7 @@ void FStaticMeshRenderPassBase::RenderPrimitive(ID3D11Buffer* VertexBuffer, ID3D
     Graphics->DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
     Graphics->DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
     Graphics->DeviceContext->DrawIndexed(IndicesNum, 0, 0);
+    FRHIStats::AddDrawCall();
 }
 
 void FStaticMeshRenderPassBase::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
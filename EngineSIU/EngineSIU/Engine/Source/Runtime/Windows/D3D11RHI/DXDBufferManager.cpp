@@ -49,6 +49,12 @@ void FDXDBufferManager::ReleaseConstantBuffer()
 void FDXDBufferManager::BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const
 {
     const int Count = Keys.Num();
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     TArray<ID3D11Buffer*> Buffers;
     Buffers.Reserve(Count);
     for (const FString& Key : Keys)
@@ -77,6 +83,12 @@ void FDXDBufferManager::BindConstantBuffers(const TArray<FString>& Keys, UINT St
 
 void FDXDBufferManager::BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const
 {
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     ID3D11Buffer* Buffer = GetConstantBuffer(Key);
     if (Stage == EShaderStage::Vertex)
         DXDeviceContext->VSSetConstantBuffers(StartSlot, 1, &Buffer);
@@ -105,6 +117,12 @@ void FDXDBufferManager::SetVertexBuffer(const FString& InName, ID3D11DeviceConte
     Offset = 0;
     Buffer = VertexInfo.VertexBuffer;
 
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     if (DeviceContext)
     {
         DeviceContext->IASetVertexBuffers(0, 1, &Buffer, &Stride, &Offset);
@@ -133,6 +151,12 @@ void FDXDBufferManager::SetIndexBuffer(const FString& InName, ID3D11DeviceContex
     FIndexInfo& VertexInfo = IndexBufferPool[InName];
     Buffer = VertexInfo.IndexBuffer;
 
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     if (DeviceContext)
     {
         DeviceContext->IASetIndexBuffer(Buffer, DXGI_FORMAT_R32_UINT, 0);
@@ -179,6 +203,40 @@ FIndexInfo FDXDBufferManager::GetTextIndexBuffer(const FWString& InName) const
 }
 
 
+HRESULT FDXDBufferManager::CreateBuffer(const D3D11_BUFFER_DESC& Desc, const D3D11_SUBRESOURCE_DATA* InitData, ID3D11Buffer** OutBuffer) const
+{
+    FRHIStats::AddBufferCreated(InitData ? Desc.ByteWidth : 0);
+
+    if (IsNullRHI())
+    {
+        *OutBuffer = nullptr;
+        return S_OK;
+    }
+    return DXDevice->CreateBuffer(&Desc, InitData, OutBuffer);
+}
+
+HRESULT FDXDBufferManager::WriteBuffer(ID3D11Buffer* Buffer, const void* Data, uint64 Size) const
+{
+    FRHIStats::AddUpload(Size);
+
+    if (IsNullRHI())
+    {
+        return S_OK;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    const HRESULT hr = DXDeviceContext->Map(Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
+    if (FAILED(hr))
+    {
+        UE_LOG(ELogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
+        return hr;
+    }
+
+    memcpy(MappedResource.pData, Data, Size);
+    DXDeviceContext->Unmap(Buffer, 0);
+    return S_OK;
+}
+
 ID3D11Buffer* FDXDBufferManager::GetConstantBuffer(const FString& InName) const
 {
     if (ConstantBufferPool.Contains(InName))
@@ -8,6 +8,7 @@
 #include "Container/Map.h"
 #include "Engine/Texture.h"
 #include "GraphicDevice.h"
+#include "RHIStats.h"
 #include "UserInterface/Console.h"
 
 // ShaderStage 열거형
@@ -30,8 +31,16 @@ public:
     QuadVertex Q;
 
     FDXDBufferManager() = default;
+
+    /** Device가 nullptr이면 Null RHI로 동작합니다. */
     void Initialize(ID3D11Device* DXDevice, ID3D11DeviceContext* DXDeviceContext);
 
+    /**
+     * Device 없이(-headless) 초기화되었는지 여부
+     * Null RHI에서는 Buffer를 만들지 않고 Pool에 nullptr를 등록하며, 업로드와 바인딩은 FRHIStats에 세기만 합니다.
+     */
+    bool IsNullRHI() const { return DXDevice == nullptr; }
+
     // 템플릿을 활용한 버텍스 버퍼 생성 (정적/동적) - FString / FWString
     template<typename T>
     HRESULT CreateVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
@@ -53,12 +62,12 @@ public:
     template<typename T>
     HRESULT CreateIndexBuffer(const FString& KeyName, const TArray<T>& indices, D3D11_USAGE Usage = D3D11_USAGE_DEFAULT, UINT CpuAccessFlags = 0);
 
-    template<typename T>
-    HRESULT CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo);
+    template<typename T, typename Allocator>
+    HRESULT CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T, Allocator>& vertices, FVertexInfo& OutVertexInfo);
 
     // 템플릿 헬퍼 함수: 내부에서 버퍼 생성 로직 통합
-    template<typename T>
-    HRESULT CreateVertexBufferInternal(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
+    template<typename T, typename Allocator>
+    HRESULT CreateVertexBufferInternal(const FString& KeyName, const TArray<T, Allocator>& vertices, FVertexInfo& OutVertexInfo,
         D3D11_USAGE usage, UINT cpuAccessFlags);
 
     template<typename T>
@@ -81,11 +90,15 @@ public:
     template<typename T>
     void UpdateConstantBuffer(const FString& key, const T& data) const;
 
-    template<typename T>
-    void UpdateConstantBuffer(const FString& key, const TArray<T>& data) const;
+    template<typename T, typename Allocator>
+    void UpdateConstantBuffer(const FString& key, const TArray<T, Allocator>& data) const;
 
+    /** Data부터 Num개의 원소를 Constant Buffer에 씁니다. */
     template<typename T>
-    void UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const;
+    void UpdateConstantBuffer(const FString& key, const T* data, int32 Num) const;
+
+    template<typename T, typename Allocator>
+    void UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T, Allocator>& vertices) const;
 
     void BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const;
     void BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const;
@@ -109,6 +122,12 @@ public:
 private:
     // 16바이트 정렬
     inline UINT Align16(UINT size) { return (size + 15) & ~15; }
+
+    /** Null RHI면 Buffer를 만들지 않고 OutBuffer에 nullptr를 돌려줍니다. */
+    HRESULT CreateBuffer(const D3D11_BUFFER_DESC& Desc, const D3D11_SUBRESOURCE_DATA* InitData, ID3D11Buffer** OutBuffer) const;
+
+    /** Dynamic Buffer의 앞부분을 Data로 덮어씁니다. */
+    HRESULT WriteBuffer(ID3D11Buffer* Buffer, const void* Data, uint64 Size) const;
 private:
     ID3D11Device* DXDevice = nullptr;
     ID3D11DeviceContext* DXDeviceContext = nullptr;
@@ -124,8 +143,8 @@ private:
 
 // 템플릿 함수 구현부
 
-template<typename T>
-HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo,
+template<typename T, typename Allocator>
+HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, const TArray<T, Allocator>& vertices, FVertexInfo& OutVertexInfo,
     D3D11_USAGE usage, UINT cpuAccessFlags)
 {
     if (!KeyName.IsEmpty() && VertexBufferPool.Contains(KeyName))
@@ -144,7 +163,7 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FString& KeyName, co
     initData.pSysMem = vertices.GetData();
 
     ID3D11Buffer* NewBuffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&bufferDesc, &initData, &NewBuffer);
+    HRESULT hr = CreateBuffer(bufferDesc, &initData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
@@ -175,7 +194,7 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FString& KeyName, const TArra
     indexInitData.pSysMem = indices.GetData();
 
     ID3D11Buffer* NewBuffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&indexBufferDesc, &indexInitData, &NewBuffer);
+    HRESULT hr = CreateBuffer(indexBufferDesc, &indexInitData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
@@ -215,7 +234,7 @@ HRESULT FDXDBufferManager::CreateVertexBufferInternal(const FWString& KeyName, c
     initData.pSysMem = vertices.GetData();
 
     ID3D11Buffer* NewBuffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&bufferDesc, &initData, &NewBuffer);
+    HRESULT hr = CreateBuffer(bufferDesc, &initData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
@@ -248,7 +267,7 @@ HRESULT FDXDBufferManager::CreateIndexBuffer(const FWString& KeyName, const TArr
     indexInitData.pSysMem = indices.GetData();
 
     ID3D11Buffer* NewBuffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&indexBufferDesc, &indexInitData, &NewBuffer);
+    HRESULT hr = CreateBuffer(indexBufferDesc, &indexInitData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
@@ -304,7 +323,7 @@ inline HRESULT FDXDBufferManager::CreateVertexBuffer(const FString& KeyName, con
     initData.pSysMem = Vertices;
 
     ID3D11Buffer* NewBuffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&bufferDesc, &initData, &NewBuffer);
+    HRESULT hr = CreateBuffer(bufferDesc, &initData, &NewBuffer);
     if (FAILED(hr))
         return hr;
 
@@ -327,8 +346,8 @@ inline HRESULT FDXDBufferManager::CreateVertexBuffer(const FString& KeyName, con
 }
 
 
-template<typename T>
-HRESULT FDXDBufferManager::CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices, FVertexInfo& OutVertexInfo)
+template<typename T, typename Allocator>
+HRESULT FDXDBufferManager::CreateDynamicVertexBuffer(const FString& KeyName, const TArray<T, Allocator>& vertices, FVertexInfo& OutVertexInfo)
 {
     return CreateVertexBufferInternal(KeyName, vertices, OutVertexInfo, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 }
@@ -353,7 +372,7 @@ HRESULT FDXDBufferManager::CreateBufferGeneric(const FString& KeyName, T* data,
     initData.pSysMem = data;
 
     ID3D11Buffer* buffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&desc, data ? &initData : nullptr, &buffer);
+    HRESULT hr = CreateBuffer(desc, data ? &initData : nullptr, &buffer);
     if (FAILED(hr))
     {
         UE_LOG(ELogLevel::Error, TEXT("Error Create Constant Buffer!"));
@@ -387,7 +406,7 @@ inline HRESULT FDXDBufferManager::CreateConstantBuffer(const FString& KeyName, U
     desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
     ID3D11Buffer* buffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&desc, nullptr, &buffer);
+    HRESULT hr = CreateBuffer(desc, nullptr, &buffer);
     if (FAILED(hr))
     {
         UE_LOG(ELogLevel::Error, TEXT("Error Create Constant Buffer!"));
@@ -401,49 +420,36 @@ inline HRESULT FDXDBufferManager::CreateConstantBuffer(const FString& KeyName, U
 template<typename T>
 void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T& data) const
 {
-    ID3D11Buffer* buffer = GetConstantBuffer(key);
-    if (!buffer)
+    // Null RHI에서는 Pool에 nullptr가 등록되어 있습니다.
+    if (!ConstantBufferPool.Contains(key))
     {
         UE_LOG(ELogLevel::Error, TEXT("UpdateConstantBuffer 호출: 키 %s에 해당하는 buffer가 없습니다."), *key);
         return;
     }
 
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    HRESULT hr = DXDeviceContext->Map(buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-    if (FAILED(hr))
-    {
-        UE_LOG(ELogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
-        return;
-    }
-    auto a = sizeof(T);
-    memcpy(mappedResource.pData, &data, sizeof(T));
-    DXDeviceContext->Unmap(buffer, 0);
+    WriteBuffer(ConstantBufferPool[key], &data, sizeof(T));
+}
+
+template<typename T, typename Allocator>
+void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const TArray<T, Allocator>& data) const
+{
+    UpdateConstantBuffer(key, data.GetData(), data.Num());
 }
 
 template<typename T>
-void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const TArray<T>& data) const
+void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T* data, int32 Num) const
 {
-    ID3D11Buffer* buffer = GetConstantBuffer(key);
-    if (!buffer)
+    if (!ConstantBufferPool.Contains(key))
     {
         UE_LOG(ELogLevel::Error, TEXT("UpdateConstantBuffer 호출: 키 %s에 해당하는 buffer가 없습니다."), *key);
         return;
     }
 
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    HRESULT hr = DXDeviceContext->Map(buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-    if (FAILED(hr))
-    {
-        UE_LOG(ELogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
-        return;
-    }
-
-    memcpy(mappedResource.pData, data.GetData(), sizeof(T) * data.Num());
-    DXDeviceContext->Unmap(buffer, 0);
+    WriteBuffer(ConstantBufferPool[key], data, sizeof(T) * Num);
 }
 
-template<typename T>
-void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const
+template<typename T, typename Allocator>
+void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T, Allocator>& vertices) const
 {
     if (!VertexBufferPool.Contains(KeyName))
     {
@@ -452,16 +458,7 @@ void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const
     }
     FVertexInfo vbInfo = VertexBufferPool[KeyName];
 
-    D3D11_MAPPED_SUBRESOURCE mapped;
-    HRESULT hr = DXDeviceContext->Map(vbInfo.VertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped);
-    if (FAILED(hr))
-    {
-        UE_LOG(ELogLevel::Error, TEXT("VertexBuffer Map 실패, HRESULT: 0x%X"), hr);
-        return;
-    }
-
-    memcpy(mapped.pData, vertices.GetData(), sizeof(T) * vertices.Num());
-    DXDeviceContext->Unmap(vbInfo.VertexBuffer, 0);
+    WriteBuffer(vbInfo.VertexBuffer, vertices.GetData(), sizeof(T) * vertices.Num());
 }
 
 template<typename T>
@@ -6,6 +6,9 @@
 #include <unordered_set>
 #include <functional>
 
+#include "RHIStats.h"
+#include "Async/JobSystem.h"
+
 FDXDShaderManager::FDXDShaderManager(ID3D11Device* Device)
     : DXDDevice(Device)
 {
@@ -515,7 +518,8 @@ void FDXDShaderManager::AddVertexShaderAndInputLayoutAsync(const std::wstring& K
     }
 
 
-    std::thread Worker([this, Key, FileName, EntryPoint, Layout, LayoutSize, DefinesCopy]() {
+    // D3DCompileFromFile은 D3DCompileMutex로 직렬화되지만, 파일 읽기와 Shader 생성은 Worker에서 병렬로 진행됩니다.
+    FJobSystem::Get().Launch([this, Key, FileName, EntryPoint, Layout, LayoutSize, DefinesCopy]() {
         UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
 #ifdef _DEBUG
         shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
@@ -655,7 +659,6 @@ void FDXDShaderManager::AddVertexShaderAndInputLayoutAsync(const std::wstring& K
             free((void*)macro.Definition);
         }
         });
-    Worker.detach();
 }
 
 void FDXDShaderManager::AddPixelShaderAsync(const std::wstring& Key, const std::wstring& FileName, const std::string& EntryPoint, const D3D_SHADER_MACRO* defines)
@@ -685,7 +688,7 @@ void FDXDShaderManager::AddPixelShaderAsync(const std::wstring& Key, const std::
     }
 
 
-    std::thread Worker([this, Key, FileName, EntryPoint, DefinesCopy]() {
+    FJobSystem::Get().Launch([this, Key, FileName, EntryPoint, DefinesCopy]() {
         UINT shaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
 #ifdef _DEBUG
         shaderFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
@@ -766,7 +769,6 @@ void FDXDShaderManager::AddPixelShaderAsync(const std::wstring& Key, const std::
             free((void*)macro.Definition);
         }
         });
-    Worker.detach();
 }
 
 HRESULT FDXDShaderManager::AddVertexShader(const std::wstring& Key, const std::wstring& FileName)
@@ -1175,6 +1177,12 @@ ID3D11GeometryShader* FDXDShaderManager::GetGeometryShaderByKey(const std::wstri
 
 void FDXDShaderManager::SetVertexShader(const std::wstring& Key, ID3D11DeviceContext* Context)
 {
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     ID3D11VertexShader* Shader = this->GetVertexShaderByKey(Key);
     if (!Shader)
     {
@@ -1195,6 +1203,12 @@ void FDXDShaderManager::SetVertexShader(const std::wstring& Key, ID3D11DeviceCon
 
 void FDXDShaderManager::SetVertexShaderAndInputLayout(const std::wstring& Key, ID3D11DeviceContext* Context)
 {
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     ID3D11VertexShader* Shader = this->GetVertexShaderByKey(Key);
     if (!Shader)
     {
@@ -1222,6 +1236,12 @@ void FDXDShaderManager::SetVertexShaderAndInputLayout(const std::wstring& Key, I
 
 void FDXDShaderManager::SetPixelShader(const std::wstring& Key, ID3D11DeviceContext* Context)
 {
+    FRHIStats::AddStateChange();
+    if (IsNullRHI())
+    {
+        return;
+    }
+
     ID3D11PixelShader* Shader = this->GetPixelShaderByKey(Key);
     if (!Shader)
     {
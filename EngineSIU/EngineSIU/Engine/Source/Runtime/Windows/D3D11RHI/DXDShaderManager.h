@@ -53,8 +53,11 @@ public:
     void BuildDependency(const FShaderReloadInfo& Info);
     bool IsOutdatedWithDependency(const FShaderReloadInfo& Info);
     void UpdateDependencyTimestamps();
+
+    /** Device 없이(-headless) 생성되었는지 여부, Null RHI에서는 Shader 바인딩을 세기만 합니다. */
+    bool IsNullRHI() const { return DXDDevice == nullptr; }
 private:
-    ID3D11Device* DXDDevice;
+    ID3D11Device* DXDDevice = nullptr;
 
 public:
     // 비동기 함수. 먼저 Add를 하고 필요할때 Get을 호출하세요
@@ -0,0 +1,32 @@
+#include "RHIStats.h"
+
+std::atomic<uint64> FRHIStats::DrawCalls = 0;
+std::atomic<uint64> FRHIStats::BytesUploaded = 0;
+std::atomic<uint64> FRHIStats::BuffersCreated = 0;
+std::atomic<uint64> FRHIStats::StateChanges = 0;
+
+FRHICounters FRHIStats::FrameStartCounters;
+FRHICounters FRHIStats::LastFrameCounters;
+
+
+FRHICounters FRHIStats::GetTotalCounters()
+{
+    FRHICounters Counters;
+    Counters.DrawCalls = DrawCalls.load(std::memory_order_relaxed);
+    Counters.BytesUploaded = BytesUploaded.load(std::memory_order_relaxed);
+    Counters.BuffersCreated = BuffersCreated.load(std::memory_order_relaxed);
+    Counters.StateChanges = StateChanges.load(std::memory_order_relaxed);
+    return Counters;
+}
+
+void FRHIStats::BeginFrame()
+{
+    const FRHICounters Total = GetTotalCounters();
+
+    LastFrameCounters.DrawCalls = Total.DrawCalls - FrameStartCounters.DrawCalls;
+    LastFrameCounters.BytesUploaded = Total.BytesUploaded - FrameStartCounters.BytesUploaded;
+    LastFrameCounters.BuffersCreated = Total.BuffersCreated - FrameStartCounters.BuffersCreated;
+    LastFrameCounters.StateChanges = Total.StateChanges - FrameStartCounters.StateChanges;
+
+    FrameStartCounters = Total;
+}
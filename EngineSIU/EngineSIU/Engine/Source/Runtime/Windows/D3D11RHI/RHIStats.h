@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+
+#include "Core/HAL/PlatformType.h"
+
+
+/** RHI 호출 통계 한 묶음 */
+struct FRHICounters
+{
+    /** Static/Skeletal Mesh Pass와 Shadow Pass의 Draw 호출 수 */
+    uint64 DrawCalls = 0;
+
+    /** Buffer 생성, Map/Update로 GPU에 올린 데이터 크기 */
+    uint64 BytesUploaded = 0;
+
+    uint64 BuffersCreated = 0;
+
+    /** Buffer, Shader, Input Layout 바인딩 횟수 */
+    uint64 StateChanges = 0;
+};
+
+
+/**
+ * RHI 호출 수를 세는 클래스
+ *
+ * Device가 없는 Null RHI(-headless)에서도 실제 D3D 호출만 건너뛰고 똑같이 세므로,
+ * 렌더링 없이 CPU 쪽 비용과 호출 수를 비교할 수 있습니다. Asset Streaming 중에는 Worker 스레드에서도 호출됩니다.
+ */
+struct FRHIStats
+{
+private:
+    static std::atomic<uint64> DrawCalls;
+    static std::atomic<uint64> BytesUploaded;
+    static std::atomic<uint64> BuffersCreated;
+    static std::atomic<uint64> StateChanges;
+
+    // 프레임 단위 통계
+    static FRHICounters FrameStartCounters;
+    static FRHICounters LastFrameCounters;
+
+public:
+    static void AddDrawCall() { DrawCalls.fetch_add(1, std::memory_order_relaxed); }
+    static void AddUpload(uint64 Bytes) { BytesUploaded.fetch_add(Bytes, std::memory_order_relaxed); }
+    static void AddBufferCreated(uint64 Bytes)
+    {
+        BuffersCreated.fetch_add(1, std::memory_order_relaxed);
+        AddUpload(Bytes);
+    }
+    static void AddStateChange(uint64 Count = 1) { StateChanges.fetch_add(Count, std::memory_order_relaxed); }
+
+    /** 시작 후 누적 값 */
+    static FRHICounters GetTotalCounters();
+
+    /** 지난 프레임 동안의 값 */
+    static const FRHICounters& GetLastFrameCounters() { return LastFrameCounters; }
+
+    /** 지난 프레임 값을 보관합니다. 게임 스레드에서 매 프레임 시작 시 호출합니다. */
+    static void BeginFrame();
+};
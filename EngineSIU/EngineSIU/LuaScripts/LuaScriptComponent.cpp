@@ -4,10 +4,13 @@
 #include "World/World.h"
 #include "Engine/EditorEngine.h"
 #include "Runtime/Engine/Classes/GameFramework/Actor.h"
+#include "Stats/Stats.h"
 // #include "Engine/Engine.h"
 
 ULuaScriptComponent::ULuaScriptComponent()
 {
+    // Script의 Tick 함수를 매 프레임 호출합니다.
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 ULuaScriptComponent::~ULuaScriptComponent()
@@ -197,6 +200,7 @@ void ULuaScriptComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
 
+    QUICK_SCOPE_CYCLE_COUNTER(Lua_Tick)
     CallLuaFunction("Tick", DeltaTime);
 
     if (CheckFileModified()) {
@@ -0,0 +1,17 @@
+-- Stress Scene의 Script Actor, 매 Tick 원을 그리며 움직입니다.
+-- 모든 Actor가 같은 파일을 쓰지만 Lua State는 Actor마다 따로 만들어집니다.
+TurnSpeed = 90
+MoveSpeed = 10
+
+function BeginPlay()
+end
+
+function EndPlay()
+end
+
+function Tick(dt)
+    local rot = actor.Rotator
+    rot.Yaw = rot.Yaw + TurnSpeed * dt
+    actor.Rotator = rot
+    actor.Location = actor.Location + actor:Forward() * (MoveSpeed * dt)
+end